@@ -112,7 +112,8 @@ typedef struct EbSvtAv1DecConfiguration
     uint32_t                 asm_type;
     // Application Specific parameters
 
-    /* Number of threads used by decoder.
+    /* Number of threads used by decoder. The tiles of a frame are parsed and
+    * reconstructed in parallel, so only multi-tile streams benefit.
     *
     * 0 = System default.
     * 1 = Single thread decoding.
@@ -235,6 +236,12 @@ typedef struct EbSvtAv1DecConfiguration
      * @ *stream_info           Sequence header info
      * @ *frame_info            Last decoded frame info
      *
+     * When frame buffer callbacks are registered, the planes are not copied:
+     * the luma, cb and cr pointers, strides and size of the EbSvtIOFormat
+     * are set to the decoder picture, which lives in an application frame
+     * buffer whose private_data is returned in p_app_private. The planes
+     * stay valid until that frame buffer is released.
+     *
      *  Returns EB_ErrorNone if the picture has been returned successfully.
      *  Returns EB_DecNoOutputPicture if the next output picture has not
      *  been generated yet. Calling a decoding function is needed to generate more pictures. */
@@ -271,7 +278,10 @@ typedef struct EbSvtAv1DecConfiguration
     EB_API EbErrorType eb_dec_flush(
         EbComponentType     *svt_dec_component);
 
-    /* Initialize callback functions.
+    /* Initialize callback functions. When set, the decoder pictures (both
+     * references and output) are allocated with allocate_buffer and given
+     * back with release_buffer once they are neither referenced nor output.
+     * Must be called before the first sequence header is decoded.
      *
      * Parameter:
      * @ *svt_dec_component     Decoder handle
@@ -27,6 +27,88 @@ extern "C" {
 #define EB_BUFFERFLAG_IS_ALT_REF    0x00000008  // signals that the packet contains an ALT_REF frame
 #define EB_BUFFERFLAG_ERROR_MASK    0xFFFFFFF0  // mask for signalling error assuming top flags fit in 4 bits. To be changed, if more flags are added.
 
+/* Layout of an input picture the encoder can reference in place, see
+ * eb_svt_enc_send_picture_in_place(). Sizes are in samples. */
+typedef struct EbInputBufferRequirements
+{
+    /* Luma size the planes must hold: the source size rounded up to a
+     * multiple of 8. The extra columns / rows need not be initialized. */
+    uint32_t width;
+    uint32_t height;
+
+    /* Luma border the planes must have around the picture, halved for
+     * chroma. The encoder writes to the borders. */
+    uint32_t left_padding;
+    uint32_t right_padding;
+    uint32_t top_padding;
+    uint32_t bottom_padding;
+
+    /* Required strides, y_stride = left_padding + width + right_padding */
+    uint32_t y_stride;
+    uint32_t cb_stride;
+    uint32_t cr_stride;
+
+    /* Required alignment in bytes of the first sample of each plane
+     * border (i.e. of plane - top_padding * stride - left_padding) */
+    uint32_t alignment;
+
+    /* Number of pictures the encoder may hold at once. With fewer buffers
+     * the application can wait forever for a release. */
+    uint32_t buffer_count;
+} EbInputBufferRequirements;
+
+/* Called once the encoder no longer uses a picture sent with
+ * eb_svt_enc_send_picture_in_place(). May be called from any encoder
+ * thread. */
+typedef void (*EbInputReleaseCallback)(
+    void *release_context);
+
+#define EB_MAX_MOTION_FIELD_REFS    8
+
+/* Motion vector of an EbSvtMotionField, in 1/4 sample units of the picture
+ * the field was computed on */
+typedef struct EbSvtMotionVector
+{
+    int16_t x;
+    int16_t y;
+} EbSvtMotionVector;
+
+/* Motion of an input picture computed outside the encoder, e.g. on another
+ * rendition of the same source, see eb_svt_enc_send_picture_with_motion(). */
+typedef struct EbSvtMotionField
+{
+    /* Luma size of the picture the motion was computed on. Blocks and
+     * vectors are scaled to the size of the encoded pictures. */
+    uint32_t width;
+    uint32_t height;
+
+    /* Size of the square blocks of the field: 8, 16, 32 or 64 */
+    uint32_t block_size;
+
+    /* Distance in vectors between two rows of blocks, at least
+     * (width + block_size - 1) / block_size */
+    uint32_t stride;
+
+    /* References of the field. ref_distance is the display order distance
+     * to the reference (picture number minus reference picture number,
+     * negative for a future reference) and mv the vectors of the blocks in
+     * raster order. A reference of the encoder missing from the field uses
+     * the nearest field reference on the same side, scaled. */
+    uint32_t           ref_count;
+    int32_t            ref_distance[EB_MAX_MOTION_FIELD_REFS];
+    EbSvtMotionVector *mv[EB_MAX_MOTION_FIELD_REFS];
+
+    /* 0: the vectors replace the hierarchical search and center the full
+     * search, 1: the vectors are only refined in a small window */
+    uint8_t refine_only;
+} EbSvtMotionField;
+
+#define EB_MAX_LADDER_RENDITIONS    8
+
+/* Renditions of an ABR ladder encoded in one process, see
+ * eb_svt_enc_join_ladder(). */
+typedef struct EbSvtLadder EbSvtLadder;
+
 // Will contain the EbEncApi which will live in the EncHandle class
 // Only modifiable during config-time.
 typedef struct EbSvtAv1EncConfiguration
@@ -242,6 +324,13 @@ typedef struct EbSvtAv1EncConfiguration
      *
      * Default depends on input resolution. */
     uint32_t                 search_area_height;
+    /* Interpolate each reference picture once into half-pel planes kept with
+     * the reference, instead of interpolating the search region of every
+     * super block. Trades three luma planes per PA reference picture for the
+     * interpolation time of the motion search.
+     *
+     * Default is 0. */
+    EbBool                   half_pel_planes;
 
     // MD Parameters
     /* Enable the use of HBD (10-bit) at the mode decision step
@@ -255,6 +344,16 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is 0. */
     EbBool                   constrained_intra;
 
+    /* Keep the prediction, reconstruction and quantized coefficients of the
+     * block winners of the mode decision, and copy them in the encode pass
+     * instead of transforming and quantizing the block again. Applies to 8
+     * bit inter blocks coded without merge; a block is recomputed when the
+     * prediction of the encode pass differs from the one of the mode
+     * decision. Costs a copy of the block buffers per EncDec thread.
+     *
+     * Default is 0. */
+    EbBool                   reuse_md_recon;
+
     // Rate Control
 
     /* Rate control mode.
@@ -372,6 +471,24 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is -1. */
     int32_t                 target_socket;
 
+    /* Run the multi-threaded encoder stages (picture analysis, motion
+     * estimation, source based operations, mode decision configuration,
+     * EncDec, deblocking, CDEF, restoration and entropy coding) as tasks on one
+     * work-stealing pool sized to the logical processors, instead of on fixed
+     * per-stage thread pools.
+     *
+     * Default is 0. */
+    uint32_t                task_pool;
+
+    /* Memory the picture pools of the channel may use, in MB. When set, the
+     * picture control set, reference and buffer pools are sized to the
+     * smallest counts that keep the pipeline fed (from the hierarchical
+     * levels, look ahead distance and core count) and grown toward their
+     * default counts as long as the estimated footprint fits.
+     *
+     * Default is 0, the pools are sized from the frame rate and core count. */
+    uint32_t                memory_budget;
+
     // Debug tools
 
     /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -384,6 +501,15 @@ typedef struct EbSvtAv1EncConfiguration
         * Default is 0. */
     int32_t                  tile_columns;
     int32_t                  tile_rows;
+    /* Carry the CDFs adapted by the entropy coding of a reference picture
+     * over to the pictures using it as LAST reference (frame end CDF
+     * update and primary_ref_frame). Saves bits, but the entropy coding of
+     * a picture then waits for the one of its LAST reference. When 0, every
+     * picture starts from the default CDFs and the entropy coding of
+     * consecutive pictures overlaps freely.
+     *
+     * Default is 0. */
+    uint32_t                 frame_end_cdf_update;
 
 /* To be deprecated.
  * Encoder configuration parameters below this line are to be deprecated. */
@@ -454,6 +580,36 @@ typedef struct EbSvtAv1EncConfiguration
      *
      * Parameter:
      * @ *svt_enc_component  Encoder handler. */
+    /* OPTIONAL: Create a ladder shared by the encoders of rendition_count
+     * renditions of the same source, at most EB_MAX_LADDER_RENDITIONS.
+     *
+     * Parameter:
+     * @ **ladder          Created ladder.
+     * @ rendition_count   Number of encoders joining the ladder. */
+    EB_API EbErrorType eb_svt_ladder_create(
+        EbSvtLadder **ladder,
+        uint32_t      rendition_count);
+
+    /* OPTIONAL: Make an encoder a rendition of a ladder, between STEP 2 and
+     * STEP 3. Rendition 0, the leader, is the top resolution: the scene
+     * change decisions and the motion estimated on its pictures are shared
+     * with the other renditions, which skip their own scene change
+     * detection and hierarchical motion search. Pictures and temporal
+     * filtering stay per rendition. All the renditions must use the same
+     * prediction structure, intra period and frame rate, be sent the same
+     * pictures and have their packets drained concurrently: a rendition
+     * waits for the leader, and the leader for renditions running too far
+     * behind. eb_init_encoder() fails until every rendition has joined.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *ladder             Ladder created by eb_svt_ladder_create().
+     * @ rendition_index     Index of the rendition, 0 for the leader. */
+    EB_API EbErrorType eb_svt_enc_join_ladder(
+        EbComponentType *svt_enc_component,
+        EbSvtLadder     *ladder,
+        uint32_t         rendition_index);
+
     EB_API EbErrorType eb_init_encoder(
         EbComponentType *svt_enc_component);
 
@@ -491,6 +647,52 @@ typedef struct EbSvtAv1EncConfiguration
         EbComponentType      *svt_enc_component,
         EbBufferHeaderType   *p_buffer);
 
+    /* OPTIONAL: Get the layout input pictures must have to be sent in place.
+     * Valid once the encoder is initialized.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *requirements       Filled with the input picture layout. */
+    EB_API EbErrorType eb_svt_enc_get_input_buffer_requirements(
+        EbComponentType             *svt_enc_component,
+        EbInputBufferRequirements   *requirements);
+
+    /* OPTIONAL: Send a picture without copying it (STEP 4 alternative).
+     * The luma / cb / cr planes of the EbSvtIOFormat point to the top left
+     * sample of the picture, inside a buffer laid out as returned by
+     * eb_svt_enc_get_input_buffer_requirements(). The encoder references
+     * the planes until release_callback is called; in the meantime they
+     * must not be modified or freed by the application, while the encoder
+     * may write to them (borders, temporal filtering). Pictures that can
+     * not be referenced (10 bit input or another layout) are copied and
+     * released before the call returns.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *p_buffer           Header pointer, picture buffer.
+     * @ release_callback    Called once the planes are no longer used.
+     * @ *release_context    Passed back to release_callback. */
+    EB_API EbErrorType eb_svt_enc_send_picture_in_place(
+        EbComponentType         *svt_enc_component,
+        EbBufferHeaderType      *p_buffer,
+        EbInputReleaseCallback   release_callback,
+        void                    *release_context);
+
+    /* OPTIONAL: Send a picture with its motion (STEP 4 alternative).
+     * The picture is copied as by eb_svt_enc_send_picture(). The motion
+     * estimation of the picture starts from the vectors of motion_field
+     * instead of running the hierarchical search. The field is converted
+     * before the call returns and need not be kept by the application.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *p_buffer           Header pointer, picture buffer.
+     * @ *motion_field       Motion of the picture. */
+    EB_API EbErrorType eb_svt_enc_send_picture_with_motion(
+        EbComponentType          *svt_enc_component,
+        EbBufferHeaderType       *p_buffer,
+        const EbSvtMotionField   *motion_field);
+
     /* STEP 5: Receive packet.
      * Parameter:
     * @ *svt_enc_component  Encoder handler.
@@ -532,6 +734,14 @@ typedef struct EbSvtAv1EncConfiguration
     EB_API EbErrorType eb_deinit_handle(
         EbComponentType  *svt_enc_component);
 
+    /* OPTIONAL: Destroy a ladder, once the encoders of all its renditions
+     * are deinitialized.
+     *
+     * Parameter:
+     * @ *ladder  Ladder created by eb_svt_ladder_create(). */
+    EB_API EbErrorType eb_svt_ladder_destroy(
+        EbSvtLadder *ladder);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
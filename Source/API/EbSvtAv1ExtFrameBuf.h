@@ -36,7 +36,8 @@ typedef struct EbExtFrameBuf {
  * Parameters:
  * @  *frame_buf pointer to the frame buffer structure to be allocated
  * @  min_size  requested data size in bytes.
- * @  private_data is the private data that can be used by the allocator*/
+ * @  private_data is the private data that can be used by the allocator
+ * Returns 0 on success. */
 typedef int (*eb_allocate_frame_buffer)(
             EbExtFrameBuf   *frame_buf,
             uint32_t        min_size,
@@ -34,6 +34,7 @@
 #define PIC_WIDTH_TOKEN                 "-w"
 #define PIC_HEIGHT_TOKEN                "-h"
 #define COLOUR_SPACE_TOKEN              "-colour-space"
+#define THREADS_TOKEN                   "-threads"
 #define MD5_SUPPORT_TOKEN               "-md5"
 #define MAX_NUM_TOKENS 200
 
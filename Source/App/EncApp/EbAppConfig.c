@@ -10,6 +10,7 @@
 #include "EbAppString.h"
 #include "EbAppConfig.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputMap.h"
 
 #ifdef _WIN32
 #else
@@ -33,6 +34,7 @@
 #define HEIGHT_TOKEN                    "-h"
 #define NUMBER_OF_PICTURES_TOKEN        "-n"
 #define BUFFERED_INPUT_TOKEN            "-nb"
+#define MMAP_INPUT_TOKEN                "-mmap-input"
 #define BASE_LAYER_SWITCH_MODE_TOKEN    "-base-layer-switch-mode" // no Eval
 #define QP_TOKEN                        "-q"
 #define USE_QP_FILE_TOKEN               "-use-q-file"
@@ -66,6 +68,7 @@
 #define IN_LOOP_ME                      "-in-loop-me"
 #define SEARCH_AREA_WIDTH_TOKEN         "-search-w"
 #define SEARCH_AREA_HEIGHT_TOKEN        "-search-h"
+#define HALF_PEL_PLANES_TOKEN           "-hp-planes"
 #define NUM_HME_SEARCH_WIDTH_TOKEN      "-num-hme-w"
 #define NUM_HME_SEARCH_HEIGHT_TOKEN     "-num-hme-h"
 #define HME_SRCH_T_L0_WIDTH_TOKEN       "-hme-tot-l0-w"
@@ -85,6 +88,7 @@
 // --- end: ALTREF_FILTERING_SUPPORT
 #define HBD_MD_ENABLE_TOKEN             "-hbd-md"
 #define CONSTRAINED_INTRA_ENABLE_TOKEN  "-constrd-intra"
+#define REUSE_MD_RECON_TOKEN            "-reuse-md-recon"
 #define IMPROVE_SHARPNESS_TOKEN         "-sharp"
 #define HDR_INPUT_TOKEN                 "-hdr"
 #define RATE_CONTROL_ENABLE_TOKEN       "-rc"
@@ -96,6 +100,7 @@
 #define SUPER_BLOCK_SIZE_TOKEN          "-sb-size"
 #define TILE_ROW_TOKEN                   "-tile-rows"
 #define TILE_COL_TOKEN                   "-tile-columns"
+#define FRAME_END_CDF_UPDATE_TOKEN       "-frame-end-cdf-update"
 
 #define SCENE_CHANGE_DETECTION_TOKEN    "-scd"
 #define INJECTOR_TOKEN                  "-inj"  // no Eval
@@ -104,6 +109,8 @@
 #define ASM_TYPE_TOKEN                  "-asm"
 #define THREAD_MGMNT                    "-lp"
 #define TARGET_SOCKET                   "-ss"
+#define TASK_POOL_TOKEN                 "-task-pool"
+#define MEMORY_BUDGET_TOKEN             "-mem-budget"
 #define CONFIG_FILE_COMMENT_CHAR    '#'
 #define CONFIG_FILE_NEWLINE_CHAR    '\n'
 #define CONFIG_FILE_RETURN_CHAR     '\r'
@@ -172,6 +179,7 @@ static void SetSeperateFields                   (const char *value, EbConfig *cf
 static void SetCfgSourceHeight                  (const char *value, EbConfig *cfg) {cfg->source_height = strtoul(value, NULL, 0) >> cfg->separate_fields;};
 static void SetCfgFramesToBeEncoded             (const char *value, EbConfig *cfg) {cfg->frames_to_be_encoded = strtol(value,  NULL, 0) << cfg->separate_fields;};
 static void SetBufferedInput                    (const char *value, EbConfig *cfg) {cfg->buffered_input = (strtol(value, NULL, 0) != -1 && cfg->separate_fields) ? strtol(value, NULL, 0) << cfg->separate_fields : strtol(value, NULL, 0);};
+static void SetMmapInput                        (const char *value, EbConfig *cfg) {cfg->mmap_input = (EbBool)strtoul(value, NULL, 0);};
 static void SetFrameRate                        (const char *value, EbConfig *cfg) {
     cfg->frame_rate = strtoul(value, NULL, 0);
     if (cfg->frame_rate > 1000 )
@@ -200,6 +208,7 @@ static void SetEnableHmeFlag                    (const char *value, EbConfig *cf
 static void SetEnableHmeLevel0Flag              (const char *value, EbConfig *cfg) {cfg->enable_hme_level0_flag = (EbBool)strtoul(value, NULL, 0);};
 static void SetTileRow                          (const char *value, EbConfig *cfg) { cfg->tile_rows = strtoul(value, NULL, 0); };
 static void SetTileCol                          (const char *value, EbConfig *cfg) { cfg->tile_columns = strtoul(value, NULL, 0); };
+static void SetFrameEndCdfUpdate                (const char *value, EbConfig *cfg) {cfg->frame_end_cdf_update = (uint32_t)strtoul(value, NULL, 0);};
 
 static void SetSceneChangeDetection             (const char *value, EbConfig *cfg) {cfg->scene_change_detection = strtoul(value, NULL, 0);};
 static void SetLookAheadDistance                (const char *value, EbConfig *cfg) {cfg->look_ahead_distance = strtoul(value, NULL, 0);};
@@ -212,6 +221,7 @@ static void SetEnableHmeLevel1Flag              (const char *value, EbConfig *cf
 static void SetEnableHmeLevel2Flag              (const char *value, EbConfig *cfg) {cfg->enable_hme_level2_flag  = (EbBool)strtoul(value, NULL, 0);};
 static void SetCfgSearchAreaWidth               (const char *value, EbConfig *cfg) {cfg->search_area_width = strtoul(value, NULL, 0);};
 static void SetCfgSearchAreaHeight              (const char *value, EbConfig *cfg) {cfg->search_area_height = strtoul(value, NULL, 0);};
+static void SetHalfPelPlanes                    (const char *value, EbConfig *cfg) {cfg->half_pel_planes = (EbBool)strtoul(value, NULL, 0);};
 static void SetCfgNumberHmeSearchRegionInWidth  (const char *value, EbConfig *cfg) {cfg->number_hme_search_region_in_width = strtoul(value, NULL, 0);};
 static void SetCfgNumberHmeSearchRegionInHeight (const char *value, EbConfig *cfg) {cfg->number_hme_search_region_in_height = strtoul(value, NULL, 0);};
 static void SetCfgHmeLevel0TotalSearchAreaWidth (const char *value, EbConfig *cfg) {cfg->hme_level0_total_search_area_width = strtoul(value, NULL, 0);};
@@ -234,6 +244,7 @@ static void SetEnableOverlays                   (const char *value, EbConfig *cf
 // --- end: ALTREF_FILTERING_SUPPORT
 static void SetEnableHBDModeDecision            (const char *value, EbConfig *cfg) {cfg->enable_hbd_mode_decision = (EbBool)strtoul(value, NULL, 0);};
 static void SetEnableConstrainedIntra           (const char *value, EbConfig *cfg) {cfg->constrained_intra                                             = (EbBool)strtoul(value, NULL, 0);};
+static void SetReuseMdRecon                     (const char *value, EbConfig *cfg) {cfg->reuse_md_recon = (EbBool)strtoul(value, NULL, 0);};
 static void SetImproveSharpness                 (const char *value, EbConfig *cfg) {cfg->improve_sharpness               = (EbBool)strtol(value,  NULL, 0);};
 static void SetHighDynamicRangeInput            (const char *value, EbConfig *cfg) {cfg->high_dynamic_range_input            = strtol(value,  NULL, 0);};
 static void SetProfile                          (const char *value, EbConfig *cfg) {cfg->profile                          = strtol(value,  NULL, 0);};
@@ -258,6 +269,8 @@ static void SetLatencyMode                      (const char *value, EbConfig *cf
 static void SetAsmType                          (const char *value, EbConfig *cfg)  {cfg->asm_type                   = (uint32_t)strtoul(value, NULL, 0);};
 static void SetLogicalProcessors                (const char *value, EbConfig *cfg)  {cfg->logical_processors         = (uint32_t)strtoul(value, NULL, 0);};
 static void SetTargetSocket                     (const char *value, EbConfig *cfg)  {cfg->target_socket              = (int32_t)strtol(value, NULL, 0);};
+static void SetTaskPool                         (const char *value, EbConfig *cfg)  {cfg->task_pool                  = (uint32_t)strtoul(value, NULL, 0);};
+static void SetMemoryBudget                     (const char *value, EbConfig *cfg)  {cfg->memory_budget              = (uint32_t)strtoul(value, NULL, 0);};
 
 enum cfg_type{
     SINGLE_INPUT,   // Configuration parameters that have only 1 value input
@@ -295,6 +308,7 @@ config_entry_t config_entry[] = {
     // Prediction Structure
     { SINGLE_INPUT, NUMBER_OF_PICTURES_TOKEN, "FrameToBeEncoded", SetCfgFramesToBeEncoded },
     { SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "BufferedInput", SetBufferedInput },
+    { SINGLE_INPUT, MMAP_INPUT_TOKEN, "MmapInput", SetMmapInput },
     { SINGLE_INPUT, BASE_LAYER_SWITCH_MODE_TOKEN, "BaseLayerSwitchMode", SetBaseLayerSwitchMode },
     { SINGLE_INPUT, ENCMODE_TOKEN, "EncoderMode", SetencMode},
     { SINGLE_INPUT, INTRA_PERIOD_TOKEN, "IntraPeriod", SetCfgIntraPeriod },
@@ -309,6 +323,7 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, PRED_STRUCT_TOKEN, "PredStructure", SetCfgPredStructure },
      { SINGLE_INPUT, TILE_ROW_TOKEN, "TileRow", SetTileRow},
      { SINGLE_INPUT, TILE_COL_TOKEN, "TileCol", SetTileCol},
+    { SINGLE_INPUT, FRAME_END_CDF_UPDATE_TOKEN, "FrameEndCdfUpdate", SetFrameEndCdfUpdate },
     // Rate Control
     { SINGLE_INPUT, SCENE_CHANGE_DETECTION_TOKEN, "SceneChangeDetection", SetSceneChangeDetection},
     { SINGLE_INPUT, QP_TOKEN, "QP", SetCfgQp },
@@ -336,6 +351,7 @@ config_entry_t config_entry[] = {
     // ME Parameters
     { SINGLE_INPUT, SEARCH_AREA_WIDTH_TOKEN, "SearchAreaWidth", SetCfgSearchAreaWidth },
     { SINGLE_INPUT, SEARCH_AREA_HEIGHT_TOKEN, "SearchAreaHeight", SetCfgSearchAreaHeight },
+    { SINGLE_INPUT, HALF_PEL_PLANES_TOKEN, "HalfPelPlanes", SetHalfPelPlanes },
     // HME Parameters
     { SINGLE_INPUT, NUM_HME_SEARCH_WIDTH_TOKEN, "number_hme_search_region_in_width", SetCfgNumberHmeSearchRegionInWidth },
     { SINGLE_INPUT, NUM_HME_SEARCH_HEIGHT_TOKEN, "NumberHmeSearchRegionInHeight", SetCfgNumberHmeSearchRegionInHeight },
@@ -345,9 +361,12 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, SCREEN_CONTENT_TOKEN, "ScreenContentMode", SetScreenContentMode},
     { SINGLE_INPUT, HBD_MD_ENABLE_TOKEN, "HighBitDepthModeDecision", SetEnableHBDModeDecision },
     { SINGLE_INPUT, CONSTRAINED_INTRA_ENABLE_TOKEN, "ConstrainedIntra", SetEnableConstrainedIntra},
+    { SINGLE_INPUT, REUSE_MD_RECON_TOKEN, "ReuseMdRecon", SetReuseMdRecon },
     // Thread Management
     { SINGLE_INPUT, THREAD_MGMNT, "logicalProcessors", SetLogicalProcessors },
     { SINGLE_INPUT, TARGET_SOCKET, "TargetSocket", SetTargetSocket },
+    { SINGLE_INPUT, TASK_POOL_TOKEN, "TaskPool", SetTaskPool },
+    { SINGLE_INPUT, MEMORY_BUDGET_TOKEN, "MemoryBudget", SetMemoryBudget },
     // Optional Features
 
 //    { SINGLE_INPUT, BITRATE_REDUCTION_TOKEN, "bit_rate_reduction", SetBitRateReduction },
@@ -409,6 +428,8 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->frames_to_be_encoded                 = 0;
     config_ptr->buffered_input                        = -1;
     config_ptr->sequence_buffer                       = 0;
+    config_ptr->mmap_input                            = EB_TRUE;
+    memset(&config_ptr->input_map, 0, sizeof(config_ptr->input_map));
     config_ptr->latency_mode                          = 0;
 
     // Interlaced Video
@@ -443,6 +464,7 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->enable_hme_level2_flag                  = EB_FALSE;
     config_ptr->search_area_width                      = 16;
     config_ptr->search_area_height                     = 7;
+    config_ptr->half_pel_planes                        = EB_FALSE;
     config_ptr->number_hme_search_region_in_width         = 2;
     config_ptr->number_hme_search_region_in_height        = 2;
     config_ptr->hme_level0_total_search_area_width        = 64;
@@ -468,6 +490,7 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->screen_content_mode                  = 2;
     config_ptr->enable_hbd_mode_decision             = EB_FALSE;
     config_ptr->constrained_intra                    = 0;
+    config_ptr->reuse_md_recon                       = EB_FALSE;
     config_ptr->film_grain_denoise_strength          = 0;
 
     // Thresholds
@@ -516,10 +539,13 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->stop_encoder                          = 0;
     config_ptr->logical_processors                    = 0;
     config_ptr->target_socket                         = -1;
+    config_ptr->task_pool                             = 0;
+    config_ptr->memory_budget                         = 0;
     config_ptr->processed_frame_count                  = 0;
     config_ptr->processed_byte_count                   = 0;
     config_ptr->tile_rows                            = 0;
     config_ptr->tile_columns                         = 0;
+    config_ptr->frame_end_cdf_update                 = 0;
 
     config_ptr->byte_count_since_ivf                 = 0;
     config_ptr->ivf_count                            = 0;
@@ -545,6 +571,7 @@ void eb_config_dtor(EbConfig *config_ptr)
         config_ptr->config_file = (FILE *) NULL;
     }
 
+    unmap_input_file(config_ptr);
     if (config_ptr->input_file) {
         if (config_ptr->input_file != stdin) fclose(config_ptr->input_file);
         config_ptr->input_file = (FILE *) NULL;
@@ -805,6 +832,11 @@ static EbErrorType VerifySettings(EbConfig *config, uint32_t channelNumber)
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->mmap_input > 1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid MmapInput [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->use_qp_file == EB_TRUE && config->qp_file == NULL) {
         fprintf(config->error_log_file, "Error instance %u: Could not find QP file, UseQpFile is set to 1\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
@@ -846,6 +878,18 @@ static EbErrorType VerifySettings(EbConfig *config, uint32_t channelNumber)
         return_error = EB_ErrorBadParameter;
     }
 
+    // task_pool
+    if (config->task_pool != 0 && config->task_pool != 1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid task pool flag [0 - 1], your input: %u\n", channelNumber + 1, config->task_pool);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    // frame_end_cdf_update
+    if (config->frame_end_cdf_update != 0 && config->frame_end_cdf_update != 1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid frame end CDF update flag [0 - 1], your input: %u\n", channelNumber + 1, config->frame_end_cdf_update);
+        return_error = EB_ErrorBadParameter;
+    }
+
     // Local Warped Motion
     if (config->enable_warped_motion != 0 && config->enable_warped_motion != 1) {
         fprintf(config->error_log_file, "Error instance %u: Invalid warped motion flag [0 - 1], your input: %d\n", channelNumber + 1, config->target_socket);
@@ -860,6 +904,12 @@ static EbErrorType VerifySettings(EbConfig *config, uint32_t channelNumber)
     if (config->enable_hbd_mode_decision == 1 && config->encoder_bit_depth != 10)
         config->enable_hbd_mode_decision = 0;
 
+    // Reuse of the MD reconstruction
+    if (config->reuse_md_recon != 0 && config->reuse_md_recon != 1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid reuse MD recon flag [0 - 1], your input: %d\n", channelNumber + 1, config->reuse_md_recon);
+        return_error = EB_ErrorBadParameter;
+    }
+
     return return_error;
 }
 
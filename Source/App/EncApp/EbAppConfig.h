@@ -160,6 +160,17 @@ typedef struct EbPerformanceContext {
 
 }EbPerformanceContext;
 
+/* Read-only view of the whole input file, frames are handed to the
+   encoder straight from it instead of being read into the input buffer */
+typedef struct EbInputMap
+{
+    uint8_t                 *data;
+    uint64_t                 size;
+    uint64_t                 first_frame;  // offset past the y4m stream header
+    uint64_t                 offset;       // offset of the next frame
+    void                    *handle;       // file mapping object (Windows)
+} EbInputMap;
+
 typedef struct EbConfig
 {
     /****************************************
@@ -178,6 +189,9 @@ typedef struct EbConfig
     EbBool                  y4m_input;
     unsigned char           y4m_buf[9];
 
+    EbBool                  mmap_input;
+    EbInputMap              input_map;
+
     EbBool                  use_qp_file;
     uint8_t                  stat_report;
 
@@ -254,6 +268,7 @@ typedef struct EbConfig
      ****************************************/
     uint32_t                 search_area_width;
     uint32_t                 search_area_height;
+    EbBool                   half_pel_planes;
 
     /****************************************
      * HME Parameters
@@ -280,9 +295,11 @@ typedef struct EbConfig
      ****************************************/
     EbBool                  constrained_intra;
     EbBool                  enable_hbd_mode_decision;
+    EbBool                  reuse_md_recon;
 
     int32_t                  tile_columns;
     int32_t                  tile_rows;
+    uint32_t                 frame_end_cdf_update;
 
     /****************************************
      * Rate Control
@@ -333,6 +350,8 @@ typedef struct EbConfig
     uint32_t                active_channel_count;
     uint32_t                logical_processors;
     int32_t                 target_socket;
+    uint32_t                task_pool;
+    uint32_t                memory_budget;
     EbBool                  stop_encoder;         // to signal CTRL+C Event, need to stop encoding.
 
     uint64_t                processed_frame_count;
@@ -11,6 +11,7 @@
 
 #include "EbAppContext.h"
 #include "EbAppConfig.h"
+#include "EbAppInputMap.h"
 
 #define INPUT_SIZE_576p_TH                0x90000        // 0.58 Million
 #define INPUT_SIZE_1080i_TH                0xB71B0        // 0.75 Million
@@ -165,6 +166,7 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.ext_block_flag = config->ext_block_flag;
     callback_data->eb_enc_parameters.tile_rows = config->tile_rows;
     callback_data->eb_enc_parameters.tile_columns = config->tile_columns;
+    callback_data->eb_enc_parameters.frame_end_cdf_update = config->frame_end_cdf_update;
 
     callback_data->eb_enc_parameters.scene_change_detection = config->scene_change_detection;
     callback_data->eb_enc_parameters.look_ahead_distance = config->look_ahead_distance;
@@ -186,6 +188,7 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.enable_hme_level2_flag = (EbBool)config->enable_hme_level2_flag;
     callback_data->eb_enc_parameters.search_area_width = config->search_area_width;
     callback_data->eb_enc_parameters.search_area_height = config->search_area_height;
+    callback_data->eb_enc_parameters.half_pel_planes = config->half_pel_planes;
     callback_data->eb_enc_parameters.number_hme_search_region_in_width = config->number_hme_search_region_in_width;
     callback_data->eb_enc_parameters.number_hme_search_region_in_height = config->number_hme_search_region_in_height;
     callback_data->eb_enc_parameters.hme_level0_total_search_area_width = config->hme_level0_total_search_area_width;
@@ -193,6 +196,7 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.screen_content_mode = (EbBool)config->screen_content_mode;
     callback_data->eb_enc_parameters.enable_hbd_mode_decision = (EbBool)config->enable_hbd_mode_decision;
     callback_data->eb_enc_parameters.constrained_intra = (EbBool)config->constrained_intra;
+    callback_data->eb_enc_parameters.reuse_md_recon = config->reuse_md_recon;
     callback_data->eb_enc_parameters.channel_id = config->channel_id;
     callback_data->eb_enc_parameters.active_channel_count = config->active_channel_count;
     callback_data->eb_enc_parameters.improve_sharpness = (uint8_t)config->improve_sharpness;
@@ -209,6 +213,8 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.asm_type = config->asm_type;
     callback_data->eb_enc_parameters.logical_processors = config->logical_processors;
     callback_data->eb_enc_parameters.target_socket = config->target_socket;
+    callback_data->eb_enc_parameters.task_pool = config->task_pool;
+    callback_data->eb_enc_parameters.memory_budget = config->memory_budget;
     callback_data->eb_enc_parameters.recon_enabled = config->recon_file ? EB_TRUE : EB_FALSE;
     // --- start: ALTREF_FILTERING_SUPPORT
     callback_data->eb_enc_parameters.enable_altrefs  = (EbBool)config->enable_altrefs;
@@ -304,7 +310,8 @@ EbErrorType AllocateInputBuffers(
 
         EB_APP_MALLOC(uint8_t*, callback_data->input_buffer_pool->p_buffer, sizeof(EbSvtIOFormat), EB_N_PTR, EB_ErrorInsufficientResources);
 
-        if (config->buffered_input == -1) {
+        // Mapped frames are used in place, no frame buffer is needed
+        if (config->buffered_input == -1 && config->input_map.data == NULL) {
             // Allocate frame buffer for the p_buffer
             AllocateFrameBuffer(
                     config,
@@ -571,7 +578,9 @@ EbErrorType init_encoder(
 
     ///********************** APPLICATION INIT [START] ******************///
 
-    // STEP 6: Allocate input buffers carrying the yuv frames in
+    // STEP 6: Map the input file when its frames can be handed over in place,
+    // then allocate input buffers carrying the yuv frames in
+    map_input_file(config);
     return_error = AllocateInputBuffers(
         config,
         callback_data);
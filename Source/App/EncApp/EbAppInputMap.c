@@ -0,0 +1,217 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "EbAppInputMap.h"
+
+#define Y4M_FRAME_TAG           "FRAME"
+#define Y4M_FRAME_TAG_SIZE      5
+#define Y4M_FRAME_HEADER_MAX    80
+// Number of frames past the current one the system is asked to read ahead
+#define READ_AHEAD_FRAMES       4
+
+/* Size in bytes of one frame of the input file, the planes are stored
+   one after the other as in the fread path */
+static uint64_t mapped_frame_size(const EbConfig *config)
+{
+    const uint64_t luma_size = (uint64_t)config->input_padded_width * config->input_padded_height;
+    const uint32_t chroma_shift = 3 - config->encoder_color_format;
+
+    if (config->encoder_bit_depth > 8 && config->compressed_ten_bit_format == 1) {
+        const uint64_t nbit_luma_size = (uint64_t)(config->input_padded_width / 4) * config->input_padded_height;
+        return luma_size + 2 * (luma_size >> chroma_shift) +
+            nbit_luma_size + 2 * (nbit_luma_size >> chroma_shift);
+    }
+
+    const uint64_t size = luma_size << (config->encoder_bit_depth > 8);
+    return size + 2 * (size >> chroma_shift);
+}
+
+/* Lets the system bring the next frames in while the current one is encoded */
+static void read_ahead(EbInputMap *map, uint64_t offset, uint64_t length)
+{
+#ifdef _WIN32
+    (void)map;
+    (void)offset;
+    (void)length;
+#else
+    const uint64_t page_mask = (uint64_t)sysconf(_SC_PAGESIZE) - 1;
+    const uint64_t start = offset & ~page_mask;
+    if (start >= map->size)
+        return;
+    if (length > map->size - offset)
+        length = map->size - offset;
+    madvise(map->data + start, (size_t)(offset + length - start), MADV_WILLNEED);
+#endif
+}
+
+EbBool map_input_file(EbConfig *config)
+{
+    EbInputMap *map = &config->input_map;
+    uint64_t    file_size;
+    uint8_t    *data;
+
+    memset(map, 0, sizeof(*map));
+
+    // Only whole frames laid out with the encoder input stride can be used in place
+    if (!config->mmap_input || config->input_file == NULL || config->input_file == stdin ||
+        config->buffered_input != -1 || config->separate_fields ||
+        config->input_padded_width != config->source_width ||
+        config->input_padded_height != config->source_height)
+        return EB_FALSE;
+
+    const uint64_t first_frame = (uint64_t)ftello64(config->input_file);
+
+#ifdef _WIN32
+    HANDLE        file = (HANDLE)_get_osfhandle(_fileno(config->input_file));
+    LARGE_INTEGER size;
+    HANDLE        mapping;
+
+    if (file == INVALID_HANDLE_VALUE || GetFileType(file) != FILE_TYPE_DISK ||
+        !GetFileSizeEx(file, &size))
+        return EB_FALSE;
+    file_size = (uint64_t)size.QuadPart;
+    if (file_size <= first_frame || file_size > (uint64_t)SIZE_MAX)
+        return EB_FALSE;
+    mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+        return EB_FALSE;
+    data = (uint8_t *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return EB_FALSE;
+    }
+    map->handle = mapping;
+#else
+    const int   fd = fileno(config->input_file);
+    struct stat st;
+
+    if (fd < 0 || fstat(fd, &st) || !S_ISREG(st.st_mode))
+        return EB_FALSE;
+    file_size = (uint64_t)st.st_size;
+    if (file_size <= first_frame || file_size > (uint64_t)SIZE_MAX)
+        return EB_FALSE;
+    data = (uint8_t *)mmap(NULL, (size_t)file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == (uint8_t *)MAP_FAILED)
+        return EB_FALSE;
+    madvise(data, (size_t)file_size, MADV_SEQUENTIAL);
+#endif
+
+    map->data = data;
+    map->size = file_size;
+    map->first_frame = first_frame;
+    map->offset = first_frame;
+
+    // The file has to hold at least one frame
+    if (file_size - first_frame < mapped_frame_size(config)) {
+        unmap_input_file(config);
+        return EB_FALSE;
+    }
+
+    read_ahead(map, first_frame, READ_AHEAD_FRAMES * mapped_frame_size(config));
+    return EB_TRUE;
+}
+
+/* Skips the "FRAME" line in front of a y4m frame, returns EB_FALSE at the
+   end of the stream */
+static EbBool skip_y4m_frame_header(EbConfig *config, uint64_t *offset)
+{
+    const EbInputMap *map = &config->input_map;
+    const uint64_t    remaining = map->size - *offset;
+    const uint8_t    *line = map->data + *offset;
+    uint64_t          length = 0;
+
+    if (remaining < Y4M_FRAME_TAG_SIZE + 1)
+        return EB_FALSE;
+    if (memcmp(line, Y4M_FRAME_TAG, Y4M_FRAME_TAG_SIZE)) {
+        fprintf(config->error_log_file, "Failed to read proper y4m frame delimeter. Read broken.\n");
+        return EB_FALSE;
+    }
+    // The tag may be followed by frame parameters up to the end of the line
+    while (length < remaining && length < Y4M_FRAME_HEADER_MAX && line[length] != '\n')
+        length++;
+    if (length == remaining || line[length] != '\n')
+        return EB_FALSE;
+
+    *offset += length + 1;
+    return EB_TRUE;
+}
+
+void read_mapped_frame(
+    EbConfig           *config,
+    uint8_t             is16bit,
+    EbBufferHeaderType *header_ptr)
+{
+    EbInputMap     *map = &config->input_map;
+    EbSvtIOFormat  *input_ptr = (EbSvtIOFormat*)header_ptr->p_buffer;
+    const uint64_t  frame_size = mapped_frame_size(config);
+    const uint32_t  chroma_shift = 3 - config->encoder_color_format;
+    uint64_t        offset = map->offset;
+    EbBool          valid = EB_TRUE;
+
+    if (config->y4m_input == EB_TRUE)
+        valid = skip_y4m_frame_header(config, &offset);
+    // If we reached the end of file, loop over again
+    if (!valid || map->size - offset < frame_size) {
+        offset = map->first_frame;
+        if (config->y4m_input == EB_TRUE)
+            skip_y4m_frame_header(config, &offset);
+    }
+
+    uint8_t *frame = map->data + offset;
+    if (is16bit && config->compressed_ten_bit_format == 1) {
+        const uint64_t luma_size = (uint64_t)config->input_padded_width * config->input_padded_height;
+        const uint64_t chroma_size = luma_size >> chroma_shift;
+        const uint64_t nbit_luma_size = (uint64_t)(config->input_padded_width / 4) * config->input_padded_height;
+        const uint64_t nbit_chroma_size = nbit_luma_size >> chroma_shift;
+
+        input_ptr->luma = frame;
+        input_ptr->cb = frame + luma_size;
+        input_ptr->cr = frame + luma_size + chroma_size;
+        input_ptr->luma_ext = frame + luma_size + 2 * chroma_size;
+        input_ptr->cb_ext = frame + luma_size + 2 * chroma_size + nbit_luma_size;
+        input_ptr->cr_ext = frame + luma_size + 2 * chroma_size + nbit_luma_size + nbit_chroma_size;
+    } else {
+        const uint64_t luma_size = ((uint64_t)config->input_padded_width * config->input_padded_height) << is16bit;
+        const uint64_t chroma_size = luma_size >> chroma_shift;
+
+        input_ptr->luma = frame;
+        input_ptr->cb = frame + luma_size;
+        input_ptr->cr = frame + luma_size + chroma_size;
+    }
+    header_ptr->n_filled_len = (uint32_t)frame_size;
+
+    map->offset = offset + frame_size;
+    read_ahead(map, map->offset, READ_AHEAD_FRAMES * frame_size);
+}
+
+void unmap_input_file(EbConfig *config)
+{
+    EbInputMap *map = &config->input_map;
+
+    if (map->data == NULL)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(map->data);
+    CloseHandle((HANDLE)map->handle);
+#else
+    munmap(map->data, (size_t)map->size);
+#endif
+    memset(map, 0, sizeof(*map));
+}
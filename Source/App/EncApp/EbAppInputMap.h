@@ -0,0 +1,23 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbAppInputMap_h
+#define EbAppInputMap_h
+
+#include "EbAppConfig.h"
+
+/* Maps the input file when it is a regular file whose frames can be used
+   in place, returns EB_TRUE if frames are to be taken from the mapping */
+EbBool map_input_file(EbConfig *config);
+
+/* Points the planes of the input buffer at the next frame of the mapping */
+void read_mapped_frame(
+    EbConfig           *config,
+    uint8_t             is16bit,
+    EbBufferHeaderType *header_ptr);
+
+void unmap_input_file(EbConfig *config);
+
+#endif // EbAppInputMap_h
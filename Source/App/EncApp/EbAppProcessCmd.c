@@ -14,6 +14,7 @@
 #include "EbAppConfig.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputMap.h"
 
 #include "EbTime.h"
 
@@ -762,6 +763,15 @@ void ReadInputFrames(
     inputPtr->cr_stride = input_padded_width >> subsampling_x;
     inputPtr->cb_stride = input_padded_width >> subsampling_x;
 
+    if (config->input_map.data) {
+        // The frame is passed to the encoder straight from the mapped file
+        read_mapped_frame(
+            config,
+            is16bit,
+            headerPtr);
+        return;
+    }
+
     if (config->buffered_input == -1) {
         if (is16bit == 0 || (is16bit == 1 && config->compressed_ten_bit_format == 0)) {
             readSize = (uint64_t)SIZE_OF_ONE_FRAME_IN_BYTES(input_padded_width, input_padded_height, color_format, is16bit);
@@ -129,6 +129,20 @@ extern "C" {
         uint16_t  *p_sad16x16,
         EbBool     sub_sad);
 
+    void get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx2(
+        uint8_t   *src,
+        uint32_t   src_stride,
+        uint8_t  **ref,
+        uint32_t   ref_stride,
+        uint32_t   num_refs,
+        uint32_t **p_best_sad8x8,
+        uint32_t **p_best_mv8x8,
+        uint32_t **p_best_sad16x16,
+        uint32_t **p_best_mv16x16,
+        uint32_t  *mv,
+        uint16_t **p_sad16x16,
+        EbBool     sub_sad);
+
     void get_eight_horizontal_search_point_results_32x32_64x64_pu_avx2_intrin(
         uint16_t  *p_sad16x16,
         uint32_t  *p_best_sad32x32,
@@ -3586,6 +3586,62 @@ static INLINE void sad_eight_8x4x2_avx2_intrin(const uint8_t *src,
     s[1] = _mm256_adds_epu16(s[1], ss4);
 }
 
+/*******************************************
+Reduce the 8x8 SADs of eight horizontal search
+points, store the eight 16x16 SADs and update
+the best 8x8 and 16x16 SAD+MV
+*******************************************/
+static INLINE void update_best_8x8_16x16_avx2_intrin(const __m256i s[4],
+    uint32_t *p_best_sad8x8, uint32_t *p_best_mv8x8, uint32_t *p_best_sad16x16,
+    uint32_t *p_best_mv16x16, uint32_t mv, uint16_t *p_sad16x16)
+{
+    int16_t x_mv, y_mv;
+    __m128i s3;
+    __m128i sad_0, sad_1, sad_2, sad_3;
+    uint32_t temSum;
+
+    sad_0 = _mm_adds_epu16(_mm256_extracti128_si256(s[0], 0), _mm256_extracti128_si256(s[0], 1));
+    sad_1 = _mm_adds_epu16(_mm256_extracti128_si256(s[1], 0), _mm256_extracti128_si256(s[1], 1));
+    sad_2 = _mm_adds_epu16(_mm256_extracti128_si256(s[2], 0), _mm256_extracti128_si256(s[2], 1));
+    sad_3 = _mm_adds_epu16(_mm256_extracti128_si256(s[3], 0), _mm256_extracti128_si256(s[3], 1));
+    s3 = _mm_adds_epu16(_mm_adds_epu16(sad_0, sad_1), _mm_adds_epu16(sad_2, sad_3));
+
+    //sotore the 8 SADs(16x16 SADs)
+    _mm_store_si128((__m128i*)p_sad16x16, s3);
+    //find the best for 16x16
+    s3 = _mm_minpos_epu16(s3);
+    temSum = _mm_extract_epi16(s3, 0);
+    if (temSum < p_best_sad16x16[0]) {
+        p_best_sad16x16[0] = temSum;
+        x_mv = _MVXT(mv) + (int16_t)(_mm_extract_epi16(s3, 1) * 4);
+        y_mv = _MVYT(mv);
+        p_best_mv16x16[0] = ((uint16_t)y_mv << 16) | ((uint16_t)x_mv);
+    }
+
+    //find the best for 8x8_0, 8x8_1, 8x8_2 & 8x8_3
+    sad_0 = _mm_minpos_epu16(sad_0);
+    sad_1 = _mm_minpos_epu16(sad_1);
+    sad_2 = _mm_minpos_epu16(sad_2);
+    sad_3 = _mm_minpos_epu16(sad_3);
+    sad_0 = _mm_unpacklo_epi16(sad_0, sad_1);
+    sad_2 = _mm_unpacklo_epi16(sad_2, sad_3);
+    sad_0 = _mm_unpacklo_epi32(sad_0, sad_2);
+    sad_1 = _mm_unpackhi_epi16(sad_0, _mm_setzero_si128());
+    sad_0 = _mm_unpacklo_epi16(sad_0, _mm_setzero_si128());
+    sad_1 = _mm_slli_epi16(sad_1, 2);
+    sad_2 = _mm_loadu_si128((__m128i*)p_best_sad8x8);
+    s3 = _mm_cmpgt_epi32(sad_2, sad_0);
+    sad_0 = _mm_min_epu32(sad_0, sad_2);
+    _mm_storeu_si128((__m128i*)p_best_sad8x8, sad_0);
+    sad_3 = _mm_loadu_si128((__m128i*)p_best_mv8x8);
+    sad_3 = _mm_andnot_si128(s3, sad_3);
+    sad_2 = _mm_set1_epi32(mv);
+    sad_2 = _mm_add_epi16(sad_2, sad_1);
+    sad_2 = _mm_and_si128(sad_2, s3);
+    sad_2 = _mm_or_si128(sad_2, sad_3);
+    _mm_storeu_si128((__m128i*)p_best_mv8x8, sad_2);
+}
+
 /*******************************************************************************
 * Requirement: p_best_sad8x8[i] must be less than 0x7FFFFFFF because signed comparison is used.
 *******************************************************************************/
@@ -3602,11 +3658,7 @@ void get_eight_horizontal_search_point_results_8x8_16x16_pu_avx2_intrin(
     uint16_t  *p_sad16x16,
     EbBool     sub_sad)
 {
-    int16_t x_mv, y_mv;
-    __m128i s3;
-    __m128i sad_0, sad_1, sad_2, sad_3;
     __m256i s[4];
-    uint32_t temSum;
 
     s[0] = s[1] = s[2] = s[3] = _mm256_setzero_si256();
 
@@ -3665,46 +3717,105 @@ void get_eight_horizontal_search_point_results_8x8_16x16_pu_avx2_intrin(
         sad_eight_8x4x2_avx2_intrin(src + 9 * src_stride, src_stride, ref + 9 * ref_stride, ref_stride, s + 2);
     }
 
-    sad_0 = _mm_adds_epu16(_mm256_extracti128_si256(s[0], 0), _mm256_extracti128_si256(s[0], 1));
-    sad_1 = _mm_adds_epu16(_mm256_extracti128_si256(s[1], 0), _mm256_extracti128_si256(s[1], 1));
-    sad_2 = _mm_adds_epu16(_mm256_extracti128_si256(s[2], 0), _mm256_extracti128_si256(s[2], 1));
-    sad_3 = _mm_adds_epu16(_mm256_extracti128_si256(s[3], 0), _mm256_extracti128_si256(s[3], 1));
-    s3 = _mm_adds_epu16(_mm_adds_epu16(sad_0, sad_1), _mm_adds_epu16(sad_2, sad_3));
+    update_best_8x8_16x16_avx2_intrin(s, p_best_sad8x8, p_best_mv8x8,
+        p_best_sad16x16, p_best_mv16x16, mv, p_sad16x16);
+}
 
-    //sotore the 8 SADs(16x16 SADs)
-    _mm_store_si128((__m128i*)p_sad16x16, s3);
-    //find the best for 16x16
-    s3 = _mm_minpos_epu16(s3);
-    temSum = _mm_extract_epi16(s3, 0);
-    if (temSum < p_best_sad16x16[0]) {
-        p_best_sad16x16[0] = temSum;
-        x_mv = _MVXT(mv) + (int16_t)(_mm_extract_epi16(s3, 1) * 4);
-        y_mv = _MVYT(mv);
-        p_best_mv16x16[0] = ((uint16_t)y_mv << 16) | ((uint16_t)x_mv);
+/* Two source rows, r and r + 2, in one register */
+static INLINE __m256i load_src_8x4x2_avx2_intrin(const uint8_t *src,
+    const uint32_t src_stride)
+{
+    return _mm256_setr_m128i(_mm_loadu_si128((__m128i*)src),
+        _mm_loadu_si128((__m128i*)(src + 2 * src_stride)));
+}
+
+/* sad_eight_8x4x2_avx2_intrin() with the source rows already in registers */
+static INLINE void sad_eight_8x4x2_src_avx2_intrin(const __m256i src[2],
+    const uint8_t *ref, const uint32_t ref_stride, __m256i s[2])
+{
+    __m256i ss0, ss1, ss3, ss4;
+
+    ss0 = _mm256_setr_m128i(_mm_loadu_si128((__m128i*)ref), _mm_loadu_si128((__m128i*)(ref + 2 * ref_stride)));
+    ss1 = _mm256_setr_m128i(_mm_loadu_si128((__m128i*)(ref + 8)), _mm_loadu_si128((__m128i*)(ref + 2 * ref_stride + 8)));
+    ss3 = _mm256_mpsadbw_epu8(ss0, src[0], 0);
+    ss3 = _mm256_adds_epu16(ss3, _mm256_mpsadbw_epu8(ss0, src[0], 45)); // 101 101
+    ss4 = _mm256_mpsadbw_epu8(ss1, src[0], 18);                         // 010 010
+    ss4 = _mm256_adds_epu16(ss4, _mm256_mpsadbw_epu8(ss1, src[0], 63)); // 111 111
+    ref += ref_stride * 4;
+    ss0 = _mm256_setr_m128i(_mm_loadu_si128((__m128i*)ref), _mm_loadu_si128((__m128i*)(ref + 2 * ref_stride)));
+    ss1 = _mm256_setr_m128i(_mm_loadu_si128((__m128i*)(ref + 8)), _mm_loadu_si128((__m128i*)(ref + 2 * ref_stride + 8)));
+    ss3 = _mm256_adds_epu16(ss3, _mm256_mpsadbw_epu8(ss0, src[1], 0));
+    ss3 = _mm256_adds_epu16(ss3, _mm256_mpsadbw_epu8(ss0, src[1], 45)); // 101 101
+    ss4 = _mm256_adds_epu16(ss4, _mm256_mpsadbw_epu8(ss1, src[1], 18)); // 010 010
+    ss4 = _mm256_adds_epu16(ss4, _mm256_mpsadbw_epu8(ss1, src[1], 63)); // 111 111
+    s[0] = _mm256_adds_epu16(s[0], ss3);
+    s[1] = _mm256_adds_epu16(s[1], ss4);
+}
+
+/*******************************************
+Same as get_eight_horizontal_search_point_results_8x8_16x16_pu_avx2_intrin
+for num_refs references at once: the 16x16
+source block is loaded once and kept in
+registers across the references
+*******************************************/
+void get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx2(
+    uint8_t   *src,
+    uint32_t   src_stride,
+    uint8_t  **ref,
+    uint32_t   ref_stride,
+    uint32_t   num_refs,
+    uint32_t **p_best_sad8x8,
+    uint32_t **p_best_mv8x8,
+    uint32_t **p_best_sad16x16,
+    uint32_t **p_best_mv16x16,
+    uint32_t  *mv,
+    uint16_t **p_sad16x16,
+    EbBool     sub_sad)
+{
+    __m256i src_rows[8];
+    __m256i s[4];
+
+    // Rows 0, 2, 4, 6 / 8, 10, 12, 14 and, without sub-sampling, the odd rows
+    src_rows[0] = load_src_8x4x2_avx2_intrin(src + 0 * src_stride, src_stride);
+    src_rows[1] = load_src_8x4x2_avx2_intrin(src + 4 * src_stride, src_stride);
+    src_rows[2] = load_src_8x4x2_avx2_intrin(src + 8 * src_stride, src_stride);
+    src_rows[3] = load_src_8x4x2_avx2_intrin(src + 12 * src_stride, src_stride);
+    if (!sub_sad) {
+        src_rows[4] = load_src_8x4x2_avx2_intrin(src + 1 * src_stride, src_stride);
+        src_rows[5] = load_src_8x4x2_avx2_intrin(src + 5 * src_stride, src_stride);
+        src_rows[6] = load_src_8x4x2_avx2_intrin(src + 9 * src_stride, src_stride);
+        src_rows[7] = load_src_8x4x2_avx2_intrin(src + 13 * src_stride, src_stride);
     }
 
-    //find the best for 8x8_0, 8x8_1, 8x8_2 & 8x8_3
-    sad_0 = _mm_minpos_epu16(sad_0);
-    sad_1 = _mm_minpos_epu16(sad_1);
-    sad_2 = _mm_minpos_epu16(sad_2);
-    sad_3 = _mm_minpos_epu16(sad_3);
-    sad_0 = _mm_unpacklo_epi16(sad_0, sad_1);
-    sad_2 = _mm_unpacklo_epi16(sad_2, sad_3);
-    sad_0 = _mm_unpacklo_epi32(sad_0, sad_2);
-    sad_1 = _mm_unpackhi_epi16(sad_0, _mm_setzero_si128());
-    sad_0 = _mm_unpacklo_epi16(sad_0, _mm_setzero_si128());
-    sad_1 = _mm_slli_epi16(sad_1, 2);
-    sad_2 = _mm_loadu_si128((__m128i*)p_best_sad8x8);
-    s3 = _mm_cmpgt_epi32(sad_2, sad_0);
-    sad_0 = _mm_min_epu32(sad_0, sad_2);
-    _mm_storeu_si128((__m128i*)p_best_sad8x8, sad_0);
-    sad_3 = _mm_loadu_si128((__m128i*)p_best_mv8x8);
-    sad_3 = _mm_andnot_si128(s3, sad_3);
-    sad_2 = _mm_set1_epi32(mv);
-    sad_2 = _mm_add_epi16(sad_2, sad_1);
-    sad_2 = _mm_and_si128(sad_2, s3);
-    sad_2 = _mm_or_si128(sad_2, sad_3);
-    _mm_storeu_si128((__m128i*)p_best_mv8x8, sad_2);
+    for (uint32_t r = 0; r < num_refs; r++) {
+        const uint8_t *p = ref[r];
+
+        s[0] = s[1] = s[2] = s[3] = _mm256_setzero_si256();
+
+        //8x8_0 & 8x8_1
+        sad_eight_8x4x2_src_avx2_intrin(src_rows + 0, p + 0 * ref_stride, ref_stride, s + 0);
+
+        //8x8_2 & 8x8_3
+        sad_eight_8x4x2_src_avx2_intrin(src_rows + 2, p + 8 * ref_stride, ref_stride, s + 2);
+
+        //16x16
+        if (sub_sad) {
+            s[0] = _mm256_slli_epi16(s[0], 1);
+            s[1] = _mm256_slli_epi16(s[1], 1);
+            s[2] = _mm256_slli_epi16(s[2], 1);
+            s[3] = _mm256_slli_epi16(s[3], 1);
+        }
+        else {
+            //8x8_0 & 8x8_1
+            sad_eight_8x4x2_src_avx2_intrin(src_rows + 4, p + 1 * ref_stride, ref_stride, s + 0);
+
+            //8x8_2 & 8x8_3
+            sad_eight_8x4x2_src_avx2_intrin(src_rows + 6, p + 9 * ref_stride, ref_stride, s + 2);
+        }
+
+        update_best_8x8_16x16_avx2_intrin(s, p_best_sad8x8[r], p_best_mv8x8[r],
+            p_best_sad16x16[r], p_best_mv16x16[r], mv[r], p_sad16x16[r]);
+    }
 }
 
 /*******************************************
@@ -0,0 +1,577 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+#include "immintrin.h"
+#include "aom_dsp_rtcd.h"
+
+static INLINE uint32_t hadd64_avx512(const __m512i sum) {
+    const __m256i sum256 = _mm256_add_epi64(_mm512_castsi512_si256(sum),
+        _mm512_extracti64x4_epi64(sum, 1));
+    const __m128i sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum256),
+        _mm256_extracti128_si256(sum256, 1));
+    return (uint32_t)_mm_cvtsi128_si32(
+        _mm_add_epi64(sum128, _mm_srli_si128(sum128, 8)));
+}
+
+/* Two 32 wide rows in one register */
+static INLINE __m512i load_32x2_avx512(const uint8_t *p, const int stride) {
+    const __m256i r0 = _mm256_loadu_si256((const __m256i *)p);
+    const __m256i r1 = _mm256_loadu_si256((const __m256i *)(p + stride));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(r0), r1, 1);
+}
+
+static INLINE uint32_t sad32xh_avx512(const uint8_t *src, int src_stride,
+    const uint8_t *ref, int ref_stride, uint32_t height) {
+    __m512i sum = _mm512_setzero_si512();
+
+    for (uint32_t y = 0; y < height; y += 2) {
+        const __m512i s = load_32x2_avx512(src, src_stride);
+        const __m512i r = load_32x2_avx512(ref, ref_stride);
+        sum = _mm512_add_epi64(sum, _mm512_sad_epu8(s, r));
+        src += 2 * src_stride;
+        ref += 2 * ref_stride;
+    }
+
+    return hadd64_avx512(sum);
+}
+
+static INLINE uint32_t sad64xh_avx512(const uint8_t *src, int src_stride,
+    const uint8_t *ref, int ref_stride, uint32_t width, uint32_t height) {
+    __m512i sum = _mm512_setzero_si512();
+
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x += 64) {
+            const __m512i s = _mm512_loadu_si512((const __m512i *)(src + x));
+            const __m512i r = _mm512_loadu_si512((const __m512i *)(ref + x));
+            sum = _mm512_add_epi64(sum, _mm512_sad_epu8(s, r));
+        }
+        src += src_stride;
+        ref += ref_stride;
+    }
+
+    return hadd64_avx512(sum);
+}
+
+static INLINE void sad32xhx4d_avx512(const uint8_t *src, int src_stride,
+    const uint8_t *const ref[4], int ref_stride, uint32_t res[4],
+    uint32_t height) {
+    __m512i sum[4] = { _mm512_setzero_si512(), _mm512_setzero_si512(),
+        _mm512_setzero_si512(), _mm512_setzero_si512() };
+    uint32_t offset = 0;
+
+    for (uint32_t y = 0; y < height; y += 2) {
+        const __m512i s = load_32x2_avx512(src, src_stride);
+        for (int32_t i = 0; i < 4; i++) {
+            const __m512i r = load_32x2_avx512(ref[i] + offset, ref_stride);
+            sum[i] = _mm512_add_epi64(sum[i], _mm512_sad_epu8(s, r));
+        }
+        src += 2 * src_stride;
+        offset += 2 * ref_stride;
+    }
+
+    for (int32_t i = 0; i < 4; i++)
+        res[i] = hadd64_avx512(sum[i]);
+}
+
+static INLINE void sad64xhx4d_avx512(const uint8_t *src, int src_stride,
+    const uint8_t *const ref[4], int ref_stride, uint32_t res[4],
+    uint32_t width, uint32_t height) {
+    __m512i sum[4] = { _mm512_setzero_si512(), _mm512_setzero_si512(),
+        _mm512_setzero_si512(), _mm512_setzero_si512() };
+    uint32_t offset = 0;
+
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x += 64) {
+            const __m512i s = _mm512_loadu_si512((const __m512i *)(src + x));
+            for (int32_t i = 0; i < 4; i++) {
+                const __m512i r = _mm512_loadu_si512(
+                    (const __m512i *)(ref[i] + offset + x));
+                sum[i] = _mm512_add_epi64(sum[i], _mm512_sad_epu8(s, r));
+            }
+        }
+        src += src_stride;
+        offset += ref_stride;
+    }
+
+    for (int32_t i = 0; i < 4; i++)
+        res[i] = hadd64_avx512(sum[i]);
+}
+
+#define SAD32XH_AVX512(h)                                                      \
+    uint32_t aom_sad32x##h##_avx512(const uint8_t *src_ptr, int src_stride,   \
+        const uint8_t *ref_ptr, int ref_stride) {                              \
+        return sad32xh_avx512(src_ptr, src_stride, ref_ptr, ref_stride, h);    \
+    }                                                                          \
+    void aom_sad32x##h##x4d_avx512(const uint8_t *src_ptr, int src_stride,    \
+        const uint8_t *const ref_ptr[], int ref_stride, uint32_t *sad_array) { \
+        sad32xhx4d_avx512(src_ptr, src_stride, ref_ptr, ref_stride,            \
+            sad_array, h);                                                     \
+    }
+
+#define SAD64XH_AVX512(w, h)                                                   \
+    uint32_t aom_sad##w##x##h##_avx512(const uint8_t *src_ptr, int src_stride,\
+        const uint8_t *ref_ptr, int ref_stride) {                              \
+        return sad64xh_avx512(src_ptr, src_stride, ref_ptr, ref_stride, w, h); \
+    }                                                                          \
+    void aom_sad##w##x##h##x4d_avx512(const uint8_t *src_ptr, int src_stride, \
+        const uint8_t *const ref_ptr[], int ref_stride, uint32_t *sad_array) { \
+        sad64xhx4d_avx512(src_ptr, src_stride, ref_ptr, ref_stride,            \
+            sad_array, w, h);                                                  \
+    }
+
+SAD32XH_AVX512(8)
+SAD32XH_AVX512(16)
+SAD32XH_AVX512(32)
+SAD32XH_AVX512(64)
+SAD64XH_AVX512(64, 16)
+SAD64XH_AVX512(64, 32)
+SAD64XH_AVX512(64, 64)
+SAD64XH_AVX512(64, 128)
+SAD64XH_AVX512(128, 64)
+SAD64XH_AVX512(128, 128)
+
+/* Rows r and r + step of a 16x16 source block, laid out for
+ * _mm512_dbsad_epu8() as one 8 wide half row per 128-bit lane: (r, left),
+ * (r, right), (r + step, left), (r + step, right). src[0] repeats the first
+ * 4 bytes of each half row, src[1] the last 4 bytes. */
+static INLINE void load_src_8x2x2_avx512(const uint8_t *src,
+    const uint32_t stride, __m512i dst[2]) {
+    const __m512i s = _mm512_castsi256_si512(_mm256_setr_m128i(
+        _mm_loadu_si128((const __m128i *)src),
+        _mm_loadu_si128((const __m128i *)(src + stride))));
+    dst[0] = _mm512_permutexvar_epi32(_mm512_setr_epi32(
+        0, 0, 0, 0, 2, 2, 2, 2, 4, 4, 4, 4, 6, 6, 6, 6), s);
+    dst[1] = _mm512_permutexvar_epi32(_mm512_setr_epi32(
+        1, 1, 1, 1, 3, 3, 3, 3, 5, 5, 5, 5, 7, 7, 7, 7), s);
+}
+
+/* SADs of two source rows against the reference at eight horizontal
+ * positions: every 128-bit lane of the result holds the eight 16-bit SADs of
+ * one half row, in the lane order of load_src_8x2x2_avx512(). */
+static INLINE __m512i sad_eight_8x2x2_avx512(const __m512i src[2],
+    const uint8_t *ref, const uint32_t stride) {
+    // Bytes 0..23 of each reference row; the left half row uses bytes 0..14,
+    // the right half row bytes 8..22
+    const __m256i r0 = _mm256_maskz_loadu_epi8(0x00FFFFFF, ref);
+    const __m256i r1 = _mm256_maskz_loadu_epi8(0x00FFFFFF, ref + stride);
+    const __m512i r = _mm512_permutexvar_epi64(
+        _mm512_setr_epi64(0, 1, 1, 2, 4, 5, 5, 6),
+        _mm512_inserti64x4(_mm512_castsi256_si512(r0), r1, 1));
+
+    // First 4 bytes against reference bytes 0..7 / 4..11 and last 4 bytes
+    // against reference bytes 4..11 / 8..15: positions 0..3 / 4..7
+    return _mm512_add_epi16(_mm512_dbsad_epu8(src[0], r, 0x94),
+        _mm512_dbsad_epu8(src[1], r, 0xE9));
+}
+
+/*******************************************
+* get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx512
+*   Eight horizontal search points of one 16x16 source block against
+*   num_refs references. The source rows stay in registers for all the
+*   references; the result matches
+*   get_eight_horizontal_search_point_results_8x8_16x16_pu_avx2_intrin run
+*   once per reference.
+*******************************************/
+void get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx512(
+    uint8_t   *src,
+    uint32_t   src_stride,
+    uint8_t  **ref,
+    uint32_t   ref_stride,
+    uint32_t   num_refs,
+    uint32_t **p_best_sad8x8,
+    uint32_t **p_best_mv8x8,
+    uint32_t **p_best_sad16x16,
+    uint32_t **p_best_mv16x16,
+    uint32_t  *mv,
+    uint16_t **p_sad16x16,
+    EbBool     sub_sad)
+{
+    // Pairs of rows (0, 1), (2, 3) .. (14, 15), or with the sub-sampled SAD
+    // (0, 2), (4, 6) .. (12, 14) doubled
+    const uint32_t row_step = sub_sad ? 2 : 1;
+    const uint32_t num_pairs = sub_sad ? 4 : 8;
+    __m512i src_rows[8][2];
+
+    for (uint32_t i = 0; i < num_pairs; i++)
+        load_src_8x2x2_avx512(src + 2 * i * row_step * src_stride,
+            row_step * src_stride, src_rows[i]);
+
+    for (uint32_t r = 0; r < num_refs; r++) {
+        __m512i top = _mm512_setzero_si512();
+        __m512i bottom = _mm512_setzero_si512();
+        __m128i sad_0, sad_1, sad_2, sad_3, s3;
+        int16_t x_mv, y_mv;
+        uint32_t temSum;
+
+        for (uint32_t i = 0; i < num_pairs / 2; i++)
+            top = _mm512_add_epi16(top, sad_eight_8x2x2_avx512(src_rows[i],
+                ref[r] + 2 * i * row_step * ref_stride, row_step * ref_stride));
+        for (uint32_t i = num_pairs / 2; i < num_pairs; i++)
+            bottom = _mm512_add_epi16(bottom, sad_eight_8x2x2_avx512(
+                src_rows[i], ref[r] + 2 * i * row_step * ref_stride,
+                row_step * ref_stride));
+
+        // Add up the two rows of each lane pair: left 8x8 in lane 0, right
+        // 8x8 in lane 1
+        top = _mm512_add_epi16(top,
+            _mm512_shuffle_i64x2(top, top, _MM_SHUFFLE(1, 0, 3, 2)));
+        bottom = _mm512_add_epi16(bottom,
+            _mm512_shuffle_i64x2(bottom, bottom, _MM_SHUFFLE(1, 0, 3, 2)));
+        sad_0 = _mm512_castsi512_si128(top);
+        sad_1 = _mm512_extracti32x4_epi32(top, 1);
+        sad_2 = _mm512_castsi512_si128(bottom);
+        sad_3 = _mm512_extracti32x4_epi32(bottom, 1);
+        if (sub_sad) {
+            sad_0 = _mm_slli_epi16(sad_0, 1);
+            sad_1 = _mm_slli_epi16(sad_1, 1);
+            sad_2 = _mm_slli_epi16(sad_2, 1);
+            sad_3 = _mm_slli_epi16(sad_3, 1);
+        }
+        s3 = _mm_adds_epu16(_mm_adds_epu16(sad_0, sad_1),
+            _mm_adds_epu16(sad_2, sad_3));
+
+        // Store the eight 16x16 SADs and keep the best 16x16
+        _mm_store_si128((__m128i *)p_sad16x16[r], s3);
+        s3 = _mm_minpos_epu16(s3);
+        temSum = _mm_extract_epi16(s3, 0);
+        if (temSum < p_best_sad16x16[r][0]) {
+            p_best_sad16x16[r][0] = temSum;
+            x_mv = _MVXT(mv[r]) + (int16_t)(_mm_extract_epi16(s3, 1) * 4);
+            y_mv = _MVYT(mv[r]);
+            p_best_mv16x16[r][0] = ((uint16_t)y_mv << 16) | ((uint16_t)x_mv);
+        }
+
+        // Keep the best of each 8x8
+        sad_0 = _mm_minpos_epu16(sad_0);
+        sad_1 = _mm_minpos_epu16(sad_1);
+        sad_2 = _mm_minpos_epu16(sad_2);
+        sad_3 = _mm_minpos_epu16(sad_3);
+        sad_0 = _mm_unpacklo_epi16(sad_0, sad_1);
+        sad_2 = _mm_unpacklo_epi16(sad_2, sad_3);
+        sad_0 = _mm_unpacklo_epi32(sad_0, sad_2);
+        sad_1 = _mm_unpackhi_epi16(sad_0, _mm_setzero_si128());
+        sad_0 = _mm_unpacklo_epi16(sad_0, _mm_setzero_si128());
+        sad_1 = _mm_slli_epi16(sad_1, 2);
+        sad_2 = _mm_loadu_si128((__m128i *)p_best_sad8x8[r]);
+        s3 = _mm_cmpgt_epi32(sad_2, sad_0);
+        sad_0 = _mm_min_epu32(sad_0, sad_2);
+        _mm_storeu_si128((__m128i *)p_best_sad8x8[r], sad_0);
+        sad_3 = _mm_loadu_si128((__m128i *)p_best_mv8x8[r]);
+        sad_3 = _mm_andnot_si128(s3, sad_3);
+        sad_2 = _mm_set1_epi32(mv[r]);
+        sad_2 = _mm_add_epi16(sad_2, sad_1);
+        sad_2 = _mm_and_si128(sad_2, s3);
+        sad_2 = _mm_or_si128(sad_2, sad_3);
+        _mm_storeu_si128((__m128i *)p_best_mv8x8[r], sad_2);
+    }
+}
+
+/* Rows of one step of the search: 4 rows of a 16 wide block, 2 rows of a 32
+ * wide block or 1 row of a 48 / 64 wide block, one 16 wide column per
+ * 128-bit lane. Each lane of dst[k] repeats bytes 4 * k..4 * k + 3 of the
+ * lane, as used by _mm512_dbsad_epu8(). */
+static AOM_FORCE_INLINE void load_src_step_avx512(const uint8_t *src,
+    const uint32_t stride, const uint32_t width, __m512i dst[4]) {
+    __m512i s;
+
+    switch (width) {
+    case 16:
+        s = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_setr_m128i(
+            _mm_loadu_si128((const __m128i *)src),
+            _mm_loadu_si128((const __m128i *)(src + stride)))),
+            _mm256_setr_m128i(
+                _mm_loadu_si128((const __m128i *)(src + 2 * stride)),
+                _mm_loadu_si128((const __m128i *)(src + 3 * stride))), 1);
+        break;
+    case 32: s = load_32x2_avx512(src, stride); break;
+    case 48: s = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFFULL, src); break;
+    default: s = _mm512_loadu_si512((const __m512i *)src); break;
+    }
+
+    dst[0] = _mm512_shuffle_epi32(s, 0x00);
+    dst[1] = _mm512_shuffle_epi32(s, 0x55);
+    dst[2] = _mm512_shuffle_epi32(s, 0xAA);
+    dst[3] = _mm512_shuffle_epi32(s, 0xFF);
+}
+
+/* Reference bytes 0..14 of each lane of load_src_step_avx512(), enough for
+ * the eight horizontal positions of _mm512_dbsad_epu8() */
+static AOM_FORCE_INLINE __m512i load_ref_step_avx512(const uint8_t *ref,
+    const uint32_t stride, const uint32_t width) {
+    switch (width) {
+    case 16:
+        return _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_setr_m128i(
+            _mm_maskz_loadu_epi8(0x7FFF, ref),
+            _mm_maskz_loadu_epi8(0x7FFF, ref + stride))),
+            _mm256_setr_m128i(_mm_maskz_loadu_epi8(0x7FFF, ref + 2 * stride),
+                _mm_maskz_loadu_epi8(0x7FFF, ref + 3 * stride)), 1);
+    case 32:
+        return _mm512_inserti64x4(_mm512_castsi256_si512(
+            _mm256_maskz_loadu_epi8(0x7FFF7FFF, ref)),
+            _mm256_maskz_loadu_epi8(0x7FFF7FFF, ref + stride), 1);
+    case 48: return _mm512_maskz_loadu_epi8(0x00007FFF7FFF7FFFULL, ref);
+    default: return _mm512_maskz_loadu_epi8(0x7FFF7FFF7FFF7FFFULL, ref);
+    }
+}
+
+/* Adds the 16-bit SADs of the eight positions in every lane to the 32-bit
+ * sums of positions 0..3 (sum[0]) and 4..7 (sum[1]) */
+static INLINE void accumulate_sad_eight_avx512(const __m512i sad,
+    __m512i sum[2]) {
+    sum[0] = _mm512_add_epi32(sum[0],
+        _mm512_unpacklo_epi16(sad, _mm512_setzero_si512()));
+    sum[1] = _mm512_add_epi32(sum[1],
+        _mm512_unpackhi_epi16(sad, _mm512_setzero_si512()));
+}
+
+/* Adds up the four lanes of the sums of accumulate_sad_eight_avx512() */
+static INLINE __m256i hadd_sad_eight_avx512(const __m512i sum[2]) {
+    const __m512i s0 = _mm512_add_epi32(
+        _mm512_shuffle_i64x2(sum[0], sum[1], 0x88),
+        _mm512_shuffle_i64x2(sum[0], sum[1], 0xDD));
+    const __m512i s1 = _mm512_add_epi32(s0,
+        _mm512_shuffle_i64x2(s0, s0, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm256_setr_m128i(_mm512_castsi512_si128(s1),
+        _mm512_extracti32x4_epi32(s1, 2));
+}
+
+/* Keeps the first of the lowest SADs at positions x..x + 7 of row y */
+static INLINE void update_best_eight_avx512(const __m256i sad, const int16_t x,
+    const int16_t y, uint32_t *low_sum, int16_t *x_best, int16_t *y_best) {
+    __m256i min = _mm256_min_epu32(sad,
+        _mm256_shuffle_epi32(sad, _MM_SHUFFLE(2, 3, 0, 1)));
+    min = _mm256_min_epu32(min,
+        _mm256_shuffle_epi32(min, _MM_SHUFFLE(1, 0, 3, 2)));
+    min = _mm256_min_epu32(min, _mm256_permute2x128_si256(min, min, 1));
+
+    if ((uint32_t)_mm256_extract_epi32(min, 0) < *low_sum) {
+        // The first of the equal SADs, as the C kernel
+        const uint32_t mask = (uint32_t)_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(sad, min)));
+        int16_t k = 0;
+
+        while (!(mask & (1 << k)))
+            k++;
+        *low_sum = (uint32_t)_mm256_extract_epi32(min, 0);
+        *x_best = x + k;
+        *y_best = y;
+    }
+}
+
+/* Full search of a block with the SADs of 16 horizontal positions per pass,
+ * 8 for the last positions of the row */
+static AOM_FORCE_INLINE void sad_loop_search_avx512(
+    __m512i (*src)[4], const uint32_t width, const uint32_t steps,
+    uint8_t *ref, const uint32_t ref_stride, const uint32_t src_stride_raw,
+    const int16_t search_area_width, const int16_t search_area_height,
+    uint32_t *low_sum, int16_t *x_best, int16_t *y_best) {
+    const uint32_t rows = width == 48 ? 1 : 64 / width;
+    // Positions past search_area_width never win
+    const __m256i leftover_mask = _mm256_cmpgt_epi32(
+        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+        _mm256_set1_epi32((search_area_width & 7) - 1));
+
+    for (int16_t i = 0; i < search_area_height; i++) {
+        int16_t j = 0;
+
+        for (; j <= search_area_width - 16; j += 16) {
+            __m512i sum_0[2] = { _mm512_setzero_si512(), _mm512_setzero_si512() };
+            __m512i sum_1[2] = { _mm512_setzero_si512(), _mm512_setzero_si512() };
+            __m512i sad_0 = _mm512_setzero_si512();
+            __m512i sad_1 = _mm512_setzero_si512();
+            const uint8_t *p = ref + j;
+
+            for (uint32_t k = 0; k < steps; k++) {
+                // Positions j..j + 7 use bytes 0..22, j + 8..j + 15 bytes
+                // 8..30 of each lane
+                const __m512i r0 = load_ref_step_avx512(p, ref_stride, width);
+                const __m512i r1 = load_ref_step_avx512(p + 8, ref_stride,
+                    width);
+                const __m512i r2 = load_ref_step_avx512(p + 16, ref_stride,
+                    width);
+
+                sad_0 = _mm512_add_epi16(sad_0,
+                    _mm512_add_epi16(_mm512_dbsad_epu8(src[k][0], r0, 0x94),
+                        _mm512_dbsad_epu8(src[k][1], r0, 0xE9)));
+                sad_1 = _mm512_add_epi16(sad_1,
+                    _mm512_add_epi16(_mm512_dbsad_epu8(src[k][0], r1, 0x94),
+                        _mm512_dbsad_epu8(src[k][1], r1, 0xE9)));
+                sad_0 = _mm512_add_epi16(sad_0,
+                    _mm512_add_epi16(_mm512_dbsad_epu8(src[k][2], r1, 0x94),
+                        _mm512_dbsad_epu8(src[k][3], r1, 0xE9)));
+                sad_1 = _mm512_add_epi16(sad_1,
+                    _mm512_add_epi16(_mm512_dbsad_epu8(src[k][2], r2, 0x94),
+                        _mm512_dbsad_epu8(src[k][3], r2, 0xE9)));
+                // A step adds at most 16 * 255 to each 16-bit SAD
+                if ((k & 15) == 15) {
+                    accumulate_sad_eight_avx512(sad_0, sum_0);
+                    accumulate_sad_eight_avx512(sad_1, sum_1);
+                    sad_0 = sad_1 = _mm512_setzero_si512();
+                }
+                p += rows * ref_stride;
+            }
+            accumulate_sad_eight_avx512(sad_0, sum_0);
+            accumulate_sad_eight_avx512(sad_1, sum_1);
+
+            update_best_eight_avx512(hadd_sad_eight_avx512(sum_0), j, i,
+                low_sum, x_best, y_best);
+            update_best_eight_avx512(hadd_sad_eight_avx512(sum_1), j + 8, i,
+                low_sum, x_best, y_best);
+        }
+
+        for (; j < search_area_width; j += 8) {
+            __m512i sum[2] = { _mm512_setzero_si512(), _mm512_setzero_si512() };
+            __m512i sad = _mm512_setzero_si512();
+            const uint8_t *p = ref + j;
+            __m256i sad_eight;
+
+            for (uint32_t k = 0; k < steps; k++) {
+                const __m512i r0 = load_ref_step_avx512(p, ref_stride, width);
+                const __m512i r1 = load_ref_step_avx512(p + 8, ref_stride,
+                    width);
+
+                sad = _mm512_add_epi16(sad,
+                    _mm512_add_epi16(_mm512_dbsad_epu8(src[k][0], r0, 0x94),
+                        _mm512_dbsad_epu8(src[k][1], r0, 0xE9)));
+                sad = _mm512_add_epi16(sad,
+                    _mm512_add_epi16(_mm512_dbsad_epu8(src[k][2], r1, 0x94),
+                        _mm512_dbsad_epu8(src[k][3], r1, 0xE9)));
+                if ((k & 15) == 15) {
+                    accumulate_sad_eight_avx512(sad, sum);
+                    sad = _mm512_setzero_si512();
+                }
+                p += rows * ref_stride;
+            }
+            accumulate_sad_eight_avx512(sad, sum);
+
+            sad_eight = hadd_sad_eight_avx512(sum);
+            if (search_area_width - j < 8)
+                sad_eight = _mm256_or_si256(sad_eight, leftover_mask);
+            update_best_eight_avx512(sad_eight, j, i, low_sum, x_best,
+                y_best);
+        }
+        ref += src_stride_raw;
+    }
+}
+
+static INLINE EbBool sad_loop_kernel_avx512_supported(const uint32_t width,
+    const uint32_t height) {
+    switch (width) {
+    case 16: return height <= 64 && !(height % 4);
+    case 32: return height <= 64 && !(height % 2);
+    case 48:
+    case 64: return height <= 64;
+    default: return EB_FALSE;
+    }
+}
+
+static void sad_loop_kernel_avx512(uint8_t *src, uint32_t src_stride,
+    uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width,
+    uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center,
+    uint32_t src_stride_raw, int16_t search_area_width,
+    int16_t search_area_height) {
+    const uint32_t rows = width == 48 ? 1 : 64 / width;
+    const uint32_t steps = height / rows;
+    int16_t x_best = *x_search_center, y_best = *y_search_center;
+    uint32_t low_sum = 0xffffff;
+    __m512i src_steps[64][4];
+
+    for (uint32_t k = 0; k < steps; k++)
+        load_src_step_avx512(src + k * rows * src_stride, src_stride, width,
+            src_steps[k]);
+
+    // One copy of the search per width, for the loads of
+    // load_ref_step_avx512()
+    switch (width) {
+    case 16:
+        sad_loop_search_avx512(src_steps, 16, steps, ref, ref_stride,
+            src_stride_raw, search_area_width, search_area_height, &low_sum,
+            &x_best, &y_best);
+        break;
+    case 32:
+        sad_loop_search_avx512(src_steps, 32, steps, ref, ref_stride,
+            src_stride_raw, search_area_width, search_area_height, &low_sum,
+            &x_best, &y_best);
+        break;
+    case 48:
+        sad_loop_search_avx512(src_steps, 48, steps, ref, ref_stride,
+            src_stride_raw, search_area_width, search_area_height, &low_sum,
+            &x_best, &y_best);
+        break;
+    default:
+        sad_loop_search_avx512(src_steps, 64, steps, ref, ref_stride,
+            src_stride_raw, search_area_width, search_area_height, &low_sum,
+            &x_best, &y_best);
+        break;
+    }
+
+    *best_sad = low_sum;
+    *x_search_center = x_best;
+    *y_search_center = y_best;
+}
+
+/*******************************************************************************
+ * sad_loop_kernel_avx512_intrin
+ *   Full search of a block in the search area with _mm512_dbsad_epu8(), 16
+ *   horizontal positions at a time. The SADs are summed in 32 bits, so the
+ *   result matches sad_loop_kernel() for any content.
+ *   Requirement: width = 16, 32, 48 or 64, height <= 64, height % 4 = 0 when
+ *   width = 16, height % 2 = 0 when width = 32. Other blocks use
+ *   sad_loop_kernel_avx2_intrin().
+*******************************************************************************/
+void sad_loop_kernel_avx512_intrin(
+    uint8_t  *src,                            // input parameter, source samples Ptr
+    uint32_t  src_stride,                      // input parameter, source stride
+    uint8_t  *ref,                            // input parameter, reference samples Ptr
+    uint32_t  ref_stride,                      // input parameter, reference stride
+    uint32_t  height,                         // input parameter, block height (M)
+    uint32_t  width,                          // input parameter, block width (N)
+    uint64_t *best_sad,
+    int16_t *x_search_center,
+    int16_t *y_search_center,
+    uint32_t  src_stride_raw,                   // input parameter, source stride (no line skipping)
+    int16_t search_area_width,
+    int16_t search_area_height)
+{
+    if (sad_loop_kernel_avx512_supported(width, height))
+        sad_loop_kernel_avx512(src, src_stride, ref, ref_stride, height, width,
+            best_sad, x_search_center, y_search_center, src_stride_raw,
+            search_area_width, search_area_height);
+    else
+        sad_loop_kernel_avx2_intrin(src, src_stride, ref, ref_stride, height,
+            width, best_sad, x_search_center, y_search_center, src_stride_raw,
+            search_area_width, search_area_height);
+}
+
+/*******************************************************************************
+ * sad_loop_kernel_avx512_hme_l0_intrin
+ *   sad_loop_kernel_avx512_intrin() for the HME level 0 search, where
+ *   search_area_width % 16 = 0. Other blocks use
+ *   sad_loop_kernel_avx2_hme_l0_intrin().
+*******************************************************************************/
+void sad_loop_kernel_avx512_hme_l0_intrin(
+    uint8_t  *src,                            // input parameter, source samples Ptr
+    uint32_t  src_stride,                      // input parameter, source stride
+    uint8_t  *ref,                            // input parameter, reference samples Ptr
+    uint32_t  ref_stride,                      // input parameter, reference stride
+    uint32_t  height,                         // input parameter, block height (M)
+    uint32_t  width,                          // input parameter, block width (N)
+    uint64_t *best_sad,
+    int16_t *x_search_center,
+    int16_t *y_search_center,
+    uint32_t  src_stride_raw,                   // input parameter, source stride (no line skipping)
+    int16_t search_area_width,
+    int16_t search_area_height)
+{
+    if (sad_loop_kernel_avx512_supported(width, height))
+        sad_loop_kernel_avx512(src, src_stride, ref, ref_stride, height, width,
+            best_sad, x_search_center, y_search_center, src_stride_raw,
+            search_area_width, search_area_height);
+    else
+        sad_loop_kernel_avx2_hme_l0_intrin(src, src_stride, ref, ref_stride,
+            height, width, best_sad, x_search_center, y_search_center,
+            src_stride_raw, search_area_width, search_area_height);
+}
@@ -0,0 +1,103 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+#include "immintrin.h"
+#include "aom_dsp_rtcd.h"
+#include "EbPictureOperators_AVX2.h"
+
+/* 32 pixels widened to 16 bits */
+static INLINE __m512i load_u8_to_u16_avx512(const uint8_t *p) {
+    return _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)p));
+}
+
+void residual_kernel_avx512(
+    uint8_t   *input,
+    uint32_t   input_stride,
+    uint8_t   *pred,
+    uint32_t   pred_stride,
+    int16_t   *residual,
+    uint32_t   residual_stride,
+    uint32_t   area_width,
+    uint32_t   area_height)
+{
+    if (area_width & 31) {
+        ResidualKernel_avx2(input, input_stride, pred, pred_stride, residual,
+            residual_stride, area_width, area_height);
+        return;
+    }
+
+    for (uint32_t y = 0; y < area_height; y++) {
+        for (uint32_t x = 0; x < area_width; x += 32) {
+            const __m512i in = load_u8_to_u16_avx512(input + x);
+            const __m512i pr = load_u8_to_u16_avx512(pred + x);
+            _mm512_storeu_si512((__m512i *)(residual + x),
+                _mm512_sub_epi16(in, pr));
+        }
+        input += input_stride;
+        pred += pred_stride;
+        residual += residual_stride;
+    }
+}
+
+static INLINE void distortion_avx512(const __m512i in, const __m512i re,
+    __m512i *const sum) {
+    const __m512i diff = _mm512_sub_epi16(in, re);
+    *sum = _mm512_add_epi32(*sum, _mm512_madd_epi16(diff, diff));
+}
+
+uint64_t spatial_full_distortion_kernel_avx512(
+    uint8_t   *input,
+    uint32_t   input_offset,
+    uint32_t   input_stride,
+    uint8_t   *recon,
+    uint32_t   recon_offset,
+    uint32_t   recon_stride,
+    uint32_t   area_width,
+    uint32_t   area_height)
+{
+    const uint32_t leftover = area_width & 31;
+    const uint32_t width = area_width - leftover;
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i sum = _mm512_setzero_si512();
+    uint64_t spatial_distortion = 0;
+
+    if (!width) {
+        return spatial_full_distortion_kernel_avx2(input, input_offset,
+            input_stride, recon, recon_offset, recon_stride, area_width,
+            area_height);
+    }
+
+    if (leftover) {
+        spatial_distortion = spatial_full_distortion_kernel_avx2(input,
+            input_offset + width, input_stride, recon, recon_offset + width,
+            recon_stride, leftover, area_height);
+    }
+
+    const uint8_t *inp = input + input_offset;
+    const uint8_t *rec = recon + recon_offset;
+    for (uint32_t y = 0; y < area_height; y++) {
+        uint32_t x = 0;
+        for (; x + 64 <= width; x += 64) {
+            const __m512i in = _mm512_loadu_si512((const __m512i *)(inp + x));
+            const __m512i re = _mm512_loadu_si512((const __m512i *)(rec + x));
+            distortion_avx512(_mm512_unpacklo_epi8(in, zero),
+                _mm512_unpacklo_epi8(re, zero), &sum);
+            distortion_avx512(_mm512_unpackhi_epi8(in, zero),
+                _mm512_unpackhi_epi8(re, zero), &sum);
+        }
+        if (x < width) {
+            distortion_avx512(load_u8_to_u16_avx512(inp + x),
+                load_u8_to_u16_avx512(rec + x), &sum);
+        }
+        inp += input_stride;
+        rec += recon_stride;
+    }
+
+    const __m256i sum256 = _mm256_add_epi32(_mm512_castsi512_si256(sum),
+        _mm512_extracti64x4_epi64(sum, 1));
+    spatial_distortion += (uint32_t)Hadd32_AVX2_INTRIN(sum256);
+    return spatial_distortion;
+}
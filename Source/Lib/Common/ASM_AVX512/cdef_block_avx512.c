@@ -0,0 +1,162 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+#include "immintrin.h"
+#include "aom_dsp_rtcd.h"
+#include "EbCdef.h"
+#include "EbBitstreamUnit.h"
+
+/* Rows i .. i + 3 of an 8 wide block, one row per 128-bit lane */
+static INLINE __m512i load_8x4_avx512(const uint16_t *in) {
+    __m512i v = _mm512_castsi128_si512(
+        _mm_loadu_si128((const __m128i *)(in + 0 * CDEF_BSTRIDE)));
+    v = _mm512_inserti32x4(v,
+        _mm_loadu_si128((const __m128i *)(in + 1 * CDEF_BSTRIDE)), 1);
+    v = _mm512_inserti32x4(v,
+        _mm_loadu_si128((const __m128i *)(in + 2 * CDEF_BSTRIDE)), 2);
+    return _mm512_inserti32x4(v,
+        _mm_loadu_si128((const __m128i *)(in + 3 * CDEF_BSTRIDE)), 3);
+}
+
+// sign(a - b) * min(abs(a - b), max(0, threshold - (abs(a - b) >> adjdamp)))
+static INLINE __m512i constrain16_avx512(const __m512i a, const __m512i b,
+    const __m512i threshold, const __m128i adjdamp) {
+    const __m512i diff = _mm512_sub_epi16(a, b);
+    const __m512i sign = _mm512_srai_epi16(diff, 15);
+    const __m512i abs_diff = _mm512_abs_epi16(diff);
+    const __m512i s = _mm512_subs_epu16(threshold,
+        _mm512_srl_epi16(abs_diff, adjdamp));
+    return _mm512_xor_si512(
+        _mm512_add_epi16(sign, _mm512_min_epi16(abs_diff, s)), sign);
+}
+
+/* Accumulates a tap into the min / max, CDEF_VERY_LARGE samples are left
+   out of the max */
+static INLINE void update_min_max_avx512(const __m512i p, const __m512i large,
+    __m512i *const min, __m512i *const max) {
+    const __mmask32 valid = _mm512_cmpneq_epi16_mask(p, large);
+    *max = _mm512_mask_max_epi16(*max, valid, *max, p);
+    *min = _mm512_min_epi16(*min, p);
+}
+
+static INLINE __m512i cdef_filter_8x4_avx512(const uint16_t *in,
+    const int32_t po[2], const int32_t s1o[2], const int32_t s2o[2],
+    const __m512i pri_taps[2], const __m512i sec_taps[2],
+    const __m512i pri_strength, const __m512i sec_strength,
+    const __m128i pri_damping, const __m128i sec_damping) {
+    const __m512i large = _mm512_set1_epi16(CDEF_VERY_LARGE);
+    const __m512i row = load_8x4_avx512(in);
+    __m512i sum = _mm512_setzero_si512();
+    __m512i min = row, max = row;
+
+    for (int32_t k = 0; k < 2; k++) {
+        // Primary taps
+        __m512i p0 = load_8x4_avx512(in + po[k]);
+        __m512i p1 = load_8x4_avx512(in - po[k]);
+        update_min_max_avx512(p0, large, &min, &max);
+        update_min_max_avx512(p1, large, &min, &max);
+        p0 = constrain16_avx512(p0, row, pri_strength, pri_damping);
+        p1 = constrain16_avx512(p1, row, pri_strength, pri_damping);
+        sum = _mm512_add_epi16(sum,
+            _mm512_mullo_epi16(pri_taps[k], _mm512_add_epi16(p0, p1)));
+
+        // Secondary taps
+        p0 = load_8x4_avx512(in + s1o[k]);
+        p1 = load_8x4_avx512(in - s1o[k]);
+        __m512i p2 = load_8x4_avx512(in + s2o[k]);
+        __m512i p3 = load_8x4_avx512(in - s2o[k]);
+        update_min_max_avx512(p0, large, &min, &max);
+        update_min_max_avx512(p1, large, &min, &max);
+        update_min_max_avx512(p2, large, &min, &max);
+        update_min_max_avx512(p3, large, &min, &max);
+        p0 = constrain16_avx512(p0, row, sec_strength, sec_damping);
+        p1 = constrain16_avx512(p1, row, sec_strength, sec_damping);
+        p2 = constrain16_avx512(p2, row, sec_strength, sec_damping);
+        p3 = constrain16_avx512(p3, row, sec_strength, sec_damping);
+        sum = _mm512_add_epi16(sum, _mm512_mullo_epi16(sec_taps[k],
+            _mm512_add_epi16(_mm512_add_epi16(p0, p1),
+                _mm512_add_epi16(p2, p3))));
+    }
+
+    // res = row + ((sum - (sum < 0) + 8) >> 4)
+    sum = _mm512_add_epi16(sum, _mm512_srai_epi16(sum, 15));
+    sum = _mm512_srai_epi16(_mm512_add_epi16(sum, _mm512_set1_epi16(8)), 4);
+    const __m512i res = _mm512_add_epi16(row, sum);
+    return _mm512_min_epi16(_mm512_max_epi16(res, min), max);
+}
+
+static void cdef_filter_block_8x8_avx512(uint8_t *dst8, uint16_t *dst16,
+    int32_t dstride, const uint16_t *in, int32_t pri_strength,
+    int32_t sec_strength, int32_t dir, int32_t pri_damping,
+    int32_t sec_damping, int32_t coeff_shift) {
+    const int32_t po[2] = { cdef_directions[dir][0], cdef_directions[dir][1] };
+    const int32_t s1o[2] = { cdef_directions[(dir + 2) & 7][0],
+        cdef_directions[(dir + 2) & 7][1] };
+    const int32_t s2o[2] = { cdef_directions[(dir + 6) & 7][0],
+        cdef_directions[(dir + 6) & 7][1] };
+    const int32_t *pri_taps = cdef_pri_taps[(pri_strength >> coeff_shift) & 1];
+    const int32_t *sec_taps = cdef_sec_taps[(pri_strength >> coeff_shift) & 1];
+    const __m512i pri_taps_512[2] = { _mm512_set1_epi16((int16_t)pri_taps[0]),
+        _mm512_set1_epi16((int16_t)pri_taps[1]) };
+    const __m512i sec_taps_512[2] = { _mm512_set1_epi16((int16_t)sec_taps[0]),
+        _mm512_set1_epi16((int16_t)sec_taps[1]) };
+    const __m512i pri_strength_512 = _mm512_set1_epi16((int16_t)pri_strength);
+    const __m512i sec_strength_512 = _mm512_set1_epi16((int16_t)sec_strength);
+
+    if (pri_strength)
+        pri_damping = AOMMAX(0, pri_damping - get_msb(pri_strength));
+    if (sec_strength)
+        sec_damping = AOMMAX(0, sec_damping - get_msb(sec_strength));
+    const __m128i pri_damping_128 = _mm_cvtsi32_si128(pri_damping);
+    const __m128i sec_damping_128 = _mm_cvtsi32_si128(sec_damping);
+
+    for (int32_t i = 0; i < 8; i += 4) {
+        const __m512i res = cdef_filter_8x4_avx512(in + i * CDEF_BSTRIDE, po,
+            s1o, s2o, pri_taps_512, sec_taps_512, pri_strength_512,
+            sec_strength_512, pri_damping_128, sec_damping_128);
+
+        if (dst8) {
+            /* The result is within the pixel range, truncating is exact */
+            const __m256i res8 = _mm512_cvtepi16_epi8(res);
+            const __m128i lo = _mm256_castsi256_si128(res8);
+            const __m128i hi = _mm256_extracti128_si256(res8, 1);
+            _mm_storel_epi64((__m128i *)(dst8 + (i + 0) * dstride), lo);
+            _mm_storel_epi64((__m128i *)(dst8 + (i + 1) * dstride),
+                _mm_srli_si128(lo, 8));
+            _mm_storel_epi64((__m128i *)(dst8 + (i + 2) * dstride), hi);
+            _mm_storel_epi64((__m128i *)(dst8 + (i + 3) * dstride),
+                _mm_srli_si128(hi, 8));
+        }
+        else {
+            _mm_storeu_si128((__m128i *)(dst16 + (i + 0) * dstride),
+                _mm512_castsi512_si128(res));
+            _mm_storeu_si128((__m128i *)(dst16 + (i + 1) * dstride),
+                _mm512_extracti32x4_epi32(res, 1));
+            _mm_storeu_si128((__m128i *)(dst16 + (i + 2) * dstride),
+                _mm512_extracti32x4_epi32(res, 2));
+            _mm_storeu_si128((__m128i *)(dst16 + (i + 3) * dstride),
+                _mm512_extracti32x4_epi32(res, 3));
+        }
+    }
+}
+
+void cdef_filter_block_avx512(uint8_t *dst8, uint16_t *dst16, int32_t dstride,
+    const uint16_t *in, int32_t pri_strength,
+    int32_t sec_strength, int32_t dir, int32_t pri_damping,
+    int32_t sec_damping, int32_t bsize, int32_t max,
+    int32_t coeff_shift) {
+    /* 4 wide blocks fill at most half a register, the AVX2 version is
+       as fast for them */
+    if (bsize != BLOCK_8X8) {
+        cdef_filter_block_avx2(dst8, dst16, dstride, in, pri_strength,
+            sec_strength, dir, pri_damping, sec_damping, bsize, max,
+            coeff_shift);
+        return;
+    }
+
+    cdef_filter_block_8x8_avx512(dst8, dst16, dstride, in, pri_strength,
+        sec_strength, dir, pri_damping, sec_damping, coeff_shift);
+}
@@ -245,3 +245,75 @@ sadMxN(16, 64);
 sadMxNx4D(16, 64);
 sadMxN(64, 16);
 sadMxNx4D(64, 16);
+
+/*******************************************
+* get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_c
+*   Eight horizontal search points of one 16x16 source block against
+*   num_refs references: updates the best 8x8 / 16x16 SAD and MV of every
+*   reference and stores its eight 16x16 SADs for the 32x32 / 64x64 step.
+*******************************************/
+void get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_c(
+    uint8_t   *src,
+    uint32_t   src_stride,
+    uint8_t  **ref,
+    uint32_t   ref_stride,
+    uint32_t   num_refs,
+    uint32_t **p_best_sad8x8,
+    uint32_t **p_best_mv8x8,
+    uint32_t **p_best_sad16x16,
+    uint32_t **p_best_mv16x16,
+    uint32_t  *mv,
+    uint16_t **p_sad16x16,
+    EbBool     sub_sad)
+{
+    const uint32_t row_step = sub_sad ? 2 : 1;
+
+    for (uint32_t r = 0; r < num_refs; r++) {
+        uint32_t sad8x8[4][8];
+        uint32_t sad16x16[8];
+
+        for (uint32_t pos = 0; pos < 8; pos++) {
+            for (uint32_t blk = 0; blk < 4; blk++) {
+                const uint8_t *s = src + (blk >> 1) * 8 * src_stride +
+                    (blk & 1) * 8;
+                const uint8_t *p = ref[r] + (blk >> 1) * 8 * ref_stride +
+                    (blk & 1) * 8 + pos;
+                uint32_t sad = 0;
+                for (uint32_t y = 0; y < 8; y += row_step)
+                    for (uint32_t x = 0; x < 8; x++)
+                        sad += EB_ABS_DIFF(s[y * src_stride + x],
+                                           p[y * ref_stride + x]);
+                sad8x8[blk][pos] = sad * row_step;
+            }
+            sad16x16[pos] = sad8x8[0][pos] + sad8x8[1][pos] +
+                sad8x8[2][pos] + sad8x8[3][pos];
+            p_sad16x16[r][pos] = (uint16_t)sad16x16[pos];
+        }
+
+        // The first position wins ties, and the best is only replaced by a
+        // strictly lower SAD
+        uint32_t best_pos = 0;
+        for (uint32_t pos = 1; pos < 8; pos++)
+            if (sad16x16[pos] < sad16x16[best_pos])
+                best_pos = pos;
+        if (sad16x16[best_pos] < p_best_sad16x16[r][0]) {
+            p_best_sad16x16[r][0] = sad16x16[best_pos];
+            p_best_mv16x16[r][0] =
+                ((uint16_t)_MVYT(mv[r]) << 16) |
+                (uint16_t)(_MVXT(mv[r]) + (int16_t)(best_pos * 4));
+        }
+
+        for (uint32_t blk = 0; blk < 4; blk++) {
+            best_pos = 0;
+            for (uint32_t pos = 1; pos < 8; pos++)
+                if (sad8x8[blk][pos] < sad8x8[blk][best_pos])
+                    best_pos = pos;
+            if (sad8x8[blk][best_pos] < p_best_sad8x8[r][blk]) {
+                p_best_sad8x8[r][blk] = sad8x8[blk][best_pos];
+                p_best_mv8x8[r][blk] =
+                    ((uint16_t)_MVYT(mv[r]) << 16) |
+                    (uint16_t)(_MVXT(mv[r]) + (int16_t)(best_pos * 4));
+            }
+        }
+    }
+}
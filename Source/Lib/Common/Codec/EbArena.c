@@ -0,0 +1,402 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbArena.h"
+#include "EbMalloc.h"
+#include "EbThreads.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef _MSC_VER
+#define EB_THREAD_LOCAL __declspec(thread)
+#else
+#define EB_THREAD_LOCAL __thread
+#endif
+
+#define ARENA_CLASS_COUNT       36
+#define ARENA_MAX_BLOCK_SIZE    (32 << 10)
+#define ARENA_SLAB_SIZE         (64 << 10)
+#define ARENA_REGION_SIZE       (2 << 20)   // one huge page
+#define ARENA_SLABS_PER_REGION  (ARENA_REGION_SIZE / ARENA_SLAB_SIZE)
+
+/* Block sizes, multiples of 64 bytes to keep every block cache line aligned:
+   64 byte steps up to 1 KB then four steps per power of two */
+static const uint32_t class_size[ARENA_CLASS_COUNT] = {
+    64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 896, 960, 1024,
+    1280, 1536, 1792, 2048, 2560, 3072, 3584, 4096, 5120, 6144, 7168, 8192,
+    10240, 12288, 14336, 16384, 20480, 24576, 28672, 32768
+};
+
+/* A region is split in slabs, each slab holds the blocks of one class */
+typedef struct ArenaRegion {
+    uint8_t               *base;
+    EbArena               *arena;
+    struct ArenaRegion    *next;        // next region of the same arena
+    uint32_t               slab_count;  // slabs handed out
+    uint8_t                slab_class[ARENA_SLABS_PER_REGION];
+} ArenaRegion;
+
+typedef struct FreeBlock {
+    struct FreeBlock      *next;
+} FreeBlock;
+
+struct EbArena {
+    ArenaRegion           *regions;     // the first one hands out the new slabs
+    FreeBlock             *free_list[ARENA_CLASS_COUNT];
+    uint8_t               *slab_cur[ARENA_CLASS_COUNT];
+    uint8_t               *slab_end[ARENA_CLASS_COUNT];
+    EbArena               *next;        // next live arena
+    uint64_t               in_use;
+    uint64_t               amount[EB_PTR_TYPE_TOTAL];
+    uint32_t               region_count;
+};
+
+/* All the regions of all the arenas sorted by address, so that EB_FREE can
+   tell arena blocks from malloc'd ones */
+static ArenaRegion       **g_regions;
+static uint32_t            g_region_count;
+static uint32_t            g_region_capacity;
+static EbArena            *g_arenas;
+// Address range of the regions, checked without the lock to let most
+// non arena pointers go straight to free()
+static volatile uintptr_t  g_lowest = UINTPTR_MAX;
+static volatile uintptr_t  g_highest;
+
+static EB_THREAD_LOCAL EbArena *g_current_arena;
+
+static EbHandle g_arena_mutex;
+
+#ifdef _WIN32
+static INIT_ONCE g_arena_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK create_arena_mutex(
+    PINIT_ONCE InitOnce,
+    PVOID Parameter,
+    PVOID *lpContext)
+{
+    (void)InitOnce;
+    (void)Parameter;
+    (void)lpContext;
+    g_arena_mutex = eb_create_mutex();
+    return TRUE;
+}
+
+static EbHandle get_arena_mutex()
+{
+    InitOnceExecuteOnce(&g_arena_once, create_arena_mutex, NULL, NULL);
+    return g_arena_mutex;
+}
+#else
+static void create_arena_mutex()
+{
+    g_arena_mutex = eb_create_mutex();
+}
+
+static pthread_once_t g_arena_once = PTHREAD_ONCE_INIT;
+
+static EbHandle get_arena_mutex()
+{
+    pthread_once(&g_arena_once, create_arena_mutex);
+    return g_arena_mutex;
+}
+#endif
+
+static uint8_t* alloc_region(void)
+{
+#ifdef _WIN32
+    const SIZE_T large_page = GetLargePageMinimum();
+    void* p = NULL;
+
+    // Large pages need the "lock pages in memory" privilege, fall back to
+    // normal pages without it
+    if (large_page && !(ARENA_REGION_SIZE % large_page))
+        p = VirtualAlloc(NULL, ARENA_REGION_SIZE, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    if (!p)
+        p = VirtualAlloc(NULL, ARENA_REGION_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    return (uint8_t*)p;
+#else
+    // Map twice the size to cut a region aligned on its size, which is what
+    // transparent huge pages need
+    uint8_t* p = (uint8_t*)mmap(NULL, 2 * ARENA_REGION_SIZE, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == (uint8_t*)MAP_FAILED)
+        return NULL;
+    uint8_t* base = (uint8_t*)(((uintptr_t)p + ARENA_REGION_SIZE - 1) &
+        ~(uintptr_t)(ARENA_REGION_SIZE - 1));
+    uint8_t* end = p + 2 * ARENA_REGION_SIZE;
+    if (base > p)
+        munmap(p, base - p);
+    if (end > base + ARENA_REGION_SIZE)
+        munmap(base + ARENA_REGION_SIZE, end - (base + ARENA_REGION_SIZE));
+#ifdef MADV_HUGEPAGE
+    madvise(base, ARENA_REGION_SIZE, MADV_HUGEPAGE);
+#endif
+    return base;
+#endif
+}
+
+static void free_region(uint8_t* base)
+{
+#ifdef _WIN32
+    VirtualFree(base, 0, MEM_RELEASE);
+#else
+    munmap(base, ARENA_REGION_SIZE);
+#endif
+}
+
+/* Index of the first region at or above ptr */
+static uint32_t lower_bound(const uint8_t* ptr)
+{
+    uint32_t lo = 0, hi = g_region_count;
+    while (lo < hi) {
+        const uint32_t mid = (lo + hi) >> 1;
+        if (g_regions[mid]->base < ptr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static ArenaRegion* find_region(const uint8_t* ptr)
+{
+    const uint32_t i = lower_bound(ptr);
+    if (i < g_region_count && g_regions[i]->base == ptr)
+        return g_regions[i];
+    if (i && ptr < g_regions[i - 1]->base + ARENA_REGION_SIZE)
+        return g_regions[i - 1];
+    return NULL;
+}
+
+static void update_bounds(void)
+{
+    if (g_region_count) {
+        g_lowest = (uintptr_t)g_regions[0]->base;
+        g_highest = (uintptr_t)g_regions[g_region_count - 1]->base + ARENA_REGION_SIZE;
+    } else {
+        g_lowest = UINTPTR_MAX;
+        g_highest = 0;
+    }
+}
+
+static EbBool add_region(EbArena* arena)
+{
+    ArenaRegion* region;
+    uint32_t i;
+
+    if (g_region_count == g_region_capacity) {
+        const uint32_t capacity = g_region_capacity ? 2 * g_region_capacity : 64;
+        ArenaRegion** regions = (ArenaRegion**)realloc(g_regions, capacity * sizeof(*regions));
+        if (!regions)
+            return EB_FALSE;
+        g_regions = regions;
+        g_region_capacity = capacity;
+    }
+    region = (ArenaRegion*)calloc(1, sizeof(*region));
+    if (!region)
+        return EB_FALSE;
+    region->base = alloc_region();
+    if (!region->base) {
+        free(region);
+        return EB_FALSE;
+    }
+    region->arena = arena;
+    region->next = arena->regions;
+    arena->regions = region;
+    arena->region_count++;
+
+    i = lower_bound(region->base);
+    memmove(g_regions + i + 1, g_regions + i, (g_region_count - i) * sizeof(*g_regions));
+    g_regions[i] = region;
+    g_region_count++;
+    update_bounds();
+    return EB_TRUE;
+}
+
+static EbBool new_slab(EbArena* arena, uint32_t size_class)
+{
+    ArenaRegion* region = arena->regions;
+    uint8_t* slab;
+
+    if (!region || region->slab_count == ARENA_SLABS_PER_REGION) {
+        if (!add_region(arena))
+            return EB_FALSE;
+        region = arena->regions;
+    }
+    slab = region->base + region->slab_count * ARENA_SLAB_SIZE;
+    region->slab_class[region->slab_count++] = (uint8_t)size_class;
+    arena->slab_cur[size_class] = slab;
+    // whole blocks only, the tail of the slab is left unused
+    arena->slab_end[size_class] = slab +
+        ARENA_SLAB_SIZE / class_size[size_class] * class_size[size_class];
+    return EB_TRUE;
+}
+
+static uint32_t get_size_class(size_t size)
+{
+    uint32_t size_class;
+    if (size <= 1024)
+        return size ? (uint32_t)((size - 1) >> 6) : 0;
+    size_class = 16;
+    while (class_size[size_class] < size)
+        size_class++;
+    return size_class;
+}
+
+static void* arena_alloc(EbArena* arena, size_t size, EbPtrType type)
+{
+    const uint32_t size_class = get_size_class(size);
+    const size_t block_size = class_size[size_class];
+    EbHandle m = get_arena_mutex();
+    void* p = NULL;
+
+    eb_block_on_mutex(m);
+    if (arena->free_list[size_class]) {
+        p = arena->free_list[size_class];
+        arena->free_list[size_class] = arena->free_list[size_class]->next;
+    } else if (arena->slab_cur[size_class] != arena->slab_end[size_class] ||
+        new_slab(arena, size_class)) {
+        p = arena->slab_cur[size_class];
+        arena->slab_cur[size_class] += block_size;
+    }
+    if (p) {
+        arena->in_use += block_size;
+        arena->amount[type] += size;
+    }
+    eb_release_mutex(m);
+    return p;
+}
+
+void* eb_malloc(size_t size)
+{
+    EbArena* arena = g_current_arena;
+    if (arena && size <= ARENA_MAX_BLOCK_SIZE) {
+        void* p = arena_alloc(arena, size, EB_N_PTR);
+        if (p)
+            return p;
+    }
+    return malloc(size);
+}
+
+void* eb_calloc(size_t count, size_t size)
+{
+    EbArena* arena = g_current_arena;
+    if (arena && size && count <= ARENA_MAX_BLOCK_SIZE / size) {
+        void* p = arena_alloc(arena, count * size, EB_C_PTR);
+        if (p) {
+            // blocks are reused, unlike fresh pages they are not zeroed
+            memset(p, 0, count * size);
+            return p;
+        }
+    }
+    return calloc(count, size);
+}
+
+void eb_free(void* ptr)
+{
+    const uintptr_t v = (uintptr_t)ptr;
+
+    if (!ptr)
+        return;
+    if (v >= g_lowest && v < g_highest) {
+        EbHandle m = get_arena_mutex();
+        ArenaRegion* region;
+
+        eb_block_on_mutex(m);
+        region = find_region((uint8_t*)ptr);
+        if (region) {
+            EbArena* arena = region->arena;
+            const uint32_t size_class = region->slab_class[((uint8_t*)ptr - region->base) / ARENA_SLAB_SIZE];
+            FreeBlock* block = (FreeBlock*)ptr;
+
+            block->next = arena->free_list[size_class];
+            arena->free_list[size_class] = block;
+            arena->in_use -= class_size[size_class];
+            eb_release_mutex(m);
+            return;
+        }
+        eb_release_mutex(m);
+    }
+    free(ptr);
+}
+
+EbArena* eb_arena_create(void)
+{
+    EbArena* arena = (EbArena*)calloc(1, sizeof(*arena));
+    EbHandle m = get_arena_mutex();
+
+    if (!arena || !m) {
+        free(arena);
+        return NULL;
+    }
+    eb_block_on_mutex(m);
+    arena->next = g_arenas;
+    g_arenas = arena;
+    eb_release_mutex(m);
+    return arena;
+}
+
+void eb_arena_destroy(EbArena* arena)
+{
+    EbHandle m = get_arena_mutex();
+    EbArena** link;
+
+    if (!arena)
+        return;
+    if (g_current_arena == arena)
+        g_current_arena = NULL;
+
+    eb_block_on_mutex(m);
+    while (arena->regions) {
+        ArenaRegion* region = arena->regions;
+        const uint32_t i = lower_bound(region->base);
+
+        memmove(g_regions + i, g_regions + i + 1, (g_region_count - i - 1) * sizeof(*g_regions));
+        g_region_count--;
+        arena->regions = region->next;
+        free_region(region->base);
+        free(region);
+    }
+    update_bounds();
+    for (link = &g_arenas; *link; link = &(*link)->next) {
+        if (*link == arena) {
+            *link = arena->next;
+            break;
+        }
+    }
+    eb_release_mutex(m);
+    free(arena);
+}
+
+EbArena* eb_arena_set_current(EbArena* arena)
+{
+    EbArena* prev = g_current_arena;
+    g_current_arena = arena;
+    return prev;
+}
+
+void eb_arena_get_usage(EbArenaUsage* usage)
+{
+    EbHandle m = get_arena_mutex();
+    const EbArena* arena;
+
+    memset(usage, 0, sizeof(*usage));
+    eb_block_on_mutex(m);
+    for (arena = g_arenas; arena; arena = arena->next) {
+        usage->reserved += (uint64_t)arena->region_count * ARENA_REGION_SIZE;
+        usage->in_use += arena->in_use;
+        usage->region_count += arena->region_count;
+        for (int32_t i = 0; i < EB_PTR_TYPE_TOTAL; i++)
+            usage->amount[i] += arena->amount[i];
+    }
+    eb_release_mutex(m);
+}
@@ -0,0 +1,48 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+#ifndef EbArena_h
+#define EbArena_h
+
+#include "EbDefinitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************
+ * Arena allocator
+ *
+ * Small EB_MALLOC / EB_CALLOC blocks of the thread an arena is current on
+ * are carved from 64 byte aligned, size-classed slabs of large (huge page
+ * backed where available) regions. EB_FREE puts them back on the free list
+ * of their class, the regions are released all at once by eb_arena_destroy.
+ **************************************/
+typedef struct EbArena EbArena;
+
+typedef struct EbArenaUsage {
+    uint64_t reserved;                      // bytes of the regions
+    uint64_t in_use;                        // bytes of the live blocks
+    uint64_t amount[EB_PTR_TYPE_TOTAL];     // bytes served, per pointer type
+    uint32_t region_count;
+} EbArenaUsage;
+
+EbArena* eb_arena_create(void);
+
+/* Releases every region of the arena, any block still allocated from it is
+   gone as well */
+void eb_arena_destroy(EbArena* arena);
+
+/* Makes the arena serve the allocations of the calling thread, returns
+   the arena that was current */
+EbArena* eb_arena_set_current(EbArena* arena);
+
+/* Adds up the usage of all the live arenas */
+void eb_arena_get_usage(EbArenaUsage* usage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //EbArena_h
@@ -402,9 +402,12 @@ void cdef_seg_search16bit(
 }
 
 /******************************************************
- * CDEF Kernel
+ * CDEF Task
+ *   Processes one input object of the CDEF process and
+ *   releases it. Called by cdef_kernel, or directly by the
+ *   encoder task scheduler when the task pool is enabled.
  ******************************************************/
-void* cdef_kernel(void *input_ptr)
+void cdef_task(void *input_ptr, EbObjectWrapper *dlf_results_wrapper_ptr)
 {
     // Context & SCS & PCS
     CdefContext_t                            *context_ptr = (CdefContext_t*)input_ptr;
@@ -414,7 +417,6 @@ void* cdef_kernel(void *input_ptr)
     FrameHeader                           *frm_hdr;
 
     //// Input
-    EbObjectWrapper                       *dlf_results_wrapper_ptr;
     DlfResults                            *dlf_results_ptr;
 
     //// Output
@@ -423,110 +425,121 @@ void* cdef_kernel(void *input_ptr)
 
     // SB Loop variables
 
+    dlf_results_ptr = (DlfResults*)dlf_results_wrapper_ptr->object_ptr;
+    picture_control_set_ptr = (PictureControlSet*)dlf_results_ptr->picture_control_set_wrapper_ptr->object_ptr;
+    sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+
+    EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+    frm_hdr = &picture_control_set_ptr->parent_pcs_ptr->frm_hdr;
+    int32_t selected_strength_cnt[64] = { 0 };
+
+    if (sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode)
+    {
+        if (is16bit)
+            cdef_seg_search16bit(
+                picture_control_set_ptr,
+                sequence_control_set_ptr,
+                dlf_results_ptr->segment_index);
+        else
+            cdef_seg_search(
+                picture_control_set_ptr,
+                sequence_control_set_ptr,
+                dlf_results_ptr->segment_index);
+    }
+
+    //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
+    eb_block_on_mutex(picture_control_set_ptr->cdef_search_mutex);
+
+    picture_control_set_ptr->tot_seg_searched_cdef++;
+    if (picture_control_set_ptr->tot_seg_searched_cdef == picture_control_set_ptr->cdef_segments_total_count)
+    {
+    if (sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode) {
+            finish_cdef_search(
+                0,
+                sequence_control_set_ptr,
+                picture_control_set_ptr,
+                selected_strength_cnt);
+
+            if (sequence_control_set_ptr->seq_header.enable_restoration != 0 || picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag || sequence_control_set_ptr->static_config.recon_enabled){
+                if (is16bit)
+                    av1_cdef_frame16bit(
+                        0,
+                        sequence_control_set_ptr,
+                        picture_control_set_ptr);
+                else
+                    av1_cdef_frame(
+                        0,
+                        sequence_control_set_ptr,
+                        picture_control_set_ptr);
+            }
+    }
+    else {
+        frm_hdr->CDEF_params.cdef_bits = 0;
+        frm_hdr->CDEF_params.cdef_y_strength[0] = 0;
+        picture_control_set_ptr->parent_pcs_ptr->nb_cdef_strengths = 1;
+        frm_hdr->CDEF_params.cdef_uv_strength[0] = 0;
+    }
+
+    //restoration prep
+
+    if (sequence_control_set_ptr->seq_header.enable_restoration)
+    {
+        av1_loop_restoration_save_boundary_lines(
+            cm->frame_to_show,
+            cm,
+            1);
+
+        //are these still needed here?/!!!
+        extend_frame(cm->frame_to_show->buffers[0], cm->frame_to_show->crop_widths[0], cm->frame_to_show->crop_heights[0],
+            cm->frame_to_show->strides[0], RESTORATION_BORDER, RESTORATION_BORDER, is16bit);
+        extend_frame(cm->frame_to_show->buffers[1], cm->frame_to_show->crop_widths[1], cm->frame_to_show->crop_heights[1],
+            cm->frame_to_show->strides[1], RESTORATION_BORDER, RESTORATION_BORDER, is16bit);
+        extend_frame(cm->frame_to_show->buffers[2], cm->frame_to_show->crop_widths[1], cm->frame_to_show->crop_heights[1],
+            cm->frame_to_show->strides[1], RESTORATION_BORDER, RESTORATION_BORDER, is16bit);
+    }
+
+    picture_control_set_ptr->rest_segments_column_count = sequence_control_set_ptr->rest_segment_column_count;
+    picture_control_set_ptr->rest_segments_row_count =   sequence_control_set_ptr->rest_segment_row_count;
+    picture_control_set_ptr->rest_segments_total_count = (uint16_t)(picture_control_set_ptr->rest_segments_column_count  * picture_control_set_ptr->rest_segments_row_count);
+    picture_control_set_ptr->tot_seg_searched_rest = 0;
+    uint32_t segment_index;
+    for (segment_index = 0; segment_index < picture_control_set_ptr->rest_segments_total_count; ++segment_index)
+    {
+        // Get Empty Cdef Results to Rest
+        eb_get_empty_object(
+            context_ptr->cdef_output_fifo_ptr,
+            &cdef_results_wrapper_ptr);
+        cdef_results_ptr = (struct CdefResults*)cdef_results_wrapper_ptr->object_ptr;
+        cdef_results_ptr->picture_control_set_wrapper_ptr = dlf_results_ptr->picture_control_set_wrapper_ptr;
+        cdef_results_ptr->segment_index = segment_index;
+        // Post Cdef Results
+        eb_post_full_object(cdef_results_wrapper_ptr);
+    }
+    }
+    eb_release_mutex(picture_control_set_ptr->cdef_search_mutex);
+
+    // Release Dlf Results
+    eb_release_object(dlf_results_wrapper_ptr);
+}
+
+/******************************************************
+ * CDEF Kernel
+ ******************************************************/
+void* cdef_kernel(void *input_ptr)
+{
+    CdefContext_t                            *context_ptr = (CdefContext_t*)input_ptr;
+    EbObjectWrapper                       *dlf_results_wrapper_ptr;
+
     for (;;) {
         // Get DLF Results
         eb_get_full_object(
             context_ptr->cdef_input_fifo_ptr,
             &dlf_results_wrapper_ptr);
 
-        dlf_results_ptr = (DlfResults*)dlf_results_wrapper_ptr->object_ptr;
-        picture_control_set_ptr = (PictureControlSet*)dlf_results_ptr->picture_control_set_wrapper_ptr->object_ptr;
-        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-
-        EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
-        Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
-        frm_hdr = &picture_control_set_ptr->parent_pcs_ptr->frm_hdr;
-        int32_t selected_strength_cnt[64] = { 0 };
-
-        if (sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode)
-        {
-            if (is16bit)
-                cdef_seg_search16bit(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr,
-                    dlf_results_ptr->segment_index);
-            else
-                cdef_seg_search(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr,
-                    dlf_results_ptr->segment_index);
-        }
-
-        //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
-        eb_block_on_mutex(picture_control_set_ptr->cdef_search_mutex);
-
-        picture_control_set_ptr->tot_seg_searched_cdef++;
-        if (picture_control_set_ptr->tot_seg_searched_cdef == picture_control_set_ptr->cdef_segments_total_count)
-        {
-           // printf("    CDEF all seg here  %i\n", picture_control_set_ptr->picture_number);
-        if (sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode) {
-                finish_cdef_search(
-                    0,
-                    sequence_control_set_ptr,
-                    picture_control_set_ptr,
-                    selected_strength_cnt);
-
-                if (sequence_control_set_ptr->seq_header.enable_restoration != 0 || picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag || sequence_control_set_ptr->static_config.recon_enabled){
-                    if (is16bit)
-                        av1_cdef_frame16bit(
-                            0,
-                            sequence_control_set_ptr,
-                            picture_control_set_ptr);
-                    else
-                        av1_cdef_frame(
-                            0,
-                            sequence_control_set_ptr,
-                            picture_control_set_ptr);
-                }
-        }
-        else {
-            frm_hdr->CDEF_params.cdef_bits = 0;
-            frm_hdr->CDEF_params.cdef_y_strength[0] = 0;
-            picture_control_set_ptr->parent_pcs_ptr->nb_cdef_strengths = 1;
-            frm_hdr->CDEF_params.cdef_uv_strength[0] = 0;
-        }
-
-        //restoration prep
-
-        if (sequence_control_set_ptr->seq_header.enable_restoration)
-        {
-            av1_loop_restoration_save_boundary_lines(
-                cm->frame_to_show,
-                cm,
-                1);
-
-            //are these still needed here?/!!!
-            extend_frame(cm->frame_to_show->buffers[0], cm->frame_to_show->crop_widths[0], cm->frame_to_show->crop_heights[0],
-                cm->frame_to_show->strides[0], RESTORATION_BORDER, RESTORATION_BORDER, is16bit);
-            extend_frame(cm->frame_to_show->buffers[1], cm->frame_to_show->crop_widths[1], cm->frame_to_show->crop_heights[1],
-                cm->frame_to_show->strides[1], RESTORATION_BORDER, RESTORATION_BORDER, is16bit);
-            extend_frame(cm->frame_to_show->buffers[2], cm->frame_to_show->crop_widths[1], cm->frame_to_show->crop_heights[1],
-                cm->frame_to_show->strides[1], RESTORATION_BORDER, RESTORATION_BORDER, is16bit);
-        }
-
-        picture_control_set_ptr->rest_segments_column_count = sequence_control_set_ptr->rest_segment_column_count;
-        picture_control_set_ptr->rest_segments_row_count =   sequence_control_set_ptr->rest_segment_row_count;
-        picture_control_set_ptr->rest_segments_total_count = (uint16_t)(picture_control_set_ptr->rest_segments_column_count  * picture_control_set_ptr->rest_segments_row_count);
-        picture_control_set_ptr->tot_seg_searched_rest = 0;
-        uint32_t segment_index;
-        for (segment_index = 0; segment_index < picture_control_set_ptr->rest_segments_total_count; ++segment_index)
-        {
-            // Get Empty Cdef Results to Rest
-            eb_get_empty_object(
-                context_ptr->cdef_output_fifo_ptr,
-                &cdef_results_wrapper_ptr);
-            cdef_results_ptr = (struct CdefResults*)cdef_results_wrapper_ptr->object_ptr;
-            cdef_results_ptr->picture_control_set_wrapper_ptr = dlf_results_ptr->picture_control_set_wrapper_ptr;
-            cdef_results_ptr->segment_index = segment_index;
-            // Post Cdef Results
-            eb_post_full_object(cdef_results_wrapper_ptr);
-        }
-        }
-        eb_release_mutex(picture_control_set_ptr->cdef_search_mutex);
-
-        // Release Dlf Results
-        eb_release_object(dlf_results_wrapper_ptr);
+        cdef_task(
+            input_ptr,
+            dlf_results_wrapper_ptr);
     }
-
     return EB_NULL;
 }
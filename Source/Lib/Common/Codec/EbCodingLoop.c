@@ -2187,6 +2187,143 @@ void perform_intra_coding_loop(
     } // Transform Loop
 }
 
+/*******************************************
+* MD Reconstruction Reuse (reuse_md_recon)
+*
+* Summary: the winner MD kept for an inter block
+*   coded without merge is used as is when the
+*   prediction of the Encode Pass is the one MD
+*   transformed, which saves the transform,
+*   quantization and reconstruction of the block.
+*******************************************/
+static EbBool md_recon_reusable(
+    PictureControlSet   *picture_control_set_ptr,
+    EncDecContext       *context_ptr,
+    EbPictureBufferDesc *recon_buffer)
+{
+    CodingUnit         *cu_ptr = context_ptr->cu_ptr;
+    const BlockGeom    *blk_geom = context_ptr->blk_geom;
+    const MdBlockRecon *blk_recon;
+    uint32_t            txb_itr, j;
+
+    if (context_ptr->md_context->md_blk_recon == NULL || context_ptr->is16bit)
+        return EB_FALSE;
+    // MD quantizes with the qindex of the frame
+    if (picture_control_set_ptr->parent_pcs_ptr->frm_hdr.segmentation_params.segmentation_enabled ||
+        picture_control_set_ptr->parent_pcs_ptr->frm_hdr.delta_q_params.delta_q_present)
+        return EB_FALSE;
+    blk_recon = &context_ptr->md_context->md_blk_recon[cu_ptr->mds_idx];
+    if (!blk_recon->valid)
+        return EB_FALSE;
+
+    // Chroma follows Luma in transform type: chroma coefficients of a transform
+    // block without luma coefficients must have been coded with DCT_DCT
+    for (txb_itr = 0; txb_itr < blk_geom->txb_count[cu_ptr->tx_depth]; txb_itr++) {
+        uint8_t uv_pass = cu_ptr->tx_depth && txb_itr ? 0 : 1;
+        if (blk_geom->has_uv && uv_pass && blk_recon->eob[0][txb_itr] == 0 &&
+            (blk_recon->eob[1][txb_itr] || blk_recon->eob[2][txb_itr]) &&
+            cu_ptr->transform_unit_array[txb_itr].transform_type[PLANE_TYPE_UV] != DCT_DCT)
+            return EB_FALSE;
+    }
+
+    // Same prediction
+    const uint8_t *pred_y = recon_buffer->buffer_y + (recon_buffer->origin_y + context_ptr->cu_origin_y) * recon_buffer->stride_y + recon_buffer->origin_x + context_ptr->cu_origin_x;
+    for (j = 0; j < blk_geom->bheight; j++)
+        if (memcmp(pred_y + j * recon_buffer->stride_y, blk_recon->pred[0] + j * blk_geom->bwidth, blk_geom->bwidth))
+            return EB_FALSE;
+    if (blk_geom->has_uv) {
+        uint32_t round_origin_x = ROUND_UV(context_ptr->cu_origin_x);
+        uint32_t round_origin_y = ROUND_UV(context_ptr->cu_origin_y);
+        const uint8_t *pred_cb = recon_buffer->buffer_cb + ((recon_buffer->origin_y + round_origin_y) >> 1) * recon_buffer->stride_cb + ((recon_buffer->origin_x + round_origin_x) >> 1);
+        const uint8_t *pred_cr = recon_buffer->buffer_cr + ((recon_buffer->origin_y + round_origin_y) >> 1) * recon_buffer->stride_cr + ((recon_buffer->origin_x + round_origin_x) >> 1);
+        for (j = 0; j < blk_geom->bheight_uv; j++) {
+            if (memcmp(pred_cb + j * recon_buffer->stride_cb, blk_recon->pred[1] + j * blk_geom->bwidth_uv, blk_geom->bwidth_uv) ||
+                memcmp(pred_cr + j * recon_buffer->stride_cr, blk_recon->pred[2] + j * blk_geom->bwidth_uv, blk_geom->bwidth_uv))
+                return EB_FALSE;
+        }
+    }
+    return EB_TRUE;
+}
+
+/*******************************************
+* Write the reconstruction and the quantized
+* coefficients MD kept for the block
+*******************************************/
+static void md_recon_copy(
+    EncDecContext       *context_ptr,
+    EbPictureBufferDesc *recon_buffer,
+    EbPictureBufferDesc *coeff_buffer_sb)
+{
+    CodingUnit         *cu_ptr = context_ptr->cu_ptr;
+    const BlockGeom    *blk_geom = context_ptr->blk_geom;
+    const MdBlockRecon *blk_recon = &context_ptr->md_context->md_blk_recon[cu_ptr->mds_idx];
+    uint32_t            coeff_count_uv = 0;
+    uint32_t            txb_itr, j;
+
+    uint8_t *recon_y = recon_buffer->buffer_y + (recon_buffer->origin_y + context_ptr->cu_origin_y) * recon_buffer->stride_y + recon_buffer->origin_x + context_ptr->cu_origin_x;
+    for (j = 0; j < blk_geom->bheight; j++)
+        memcpy(recon_y + j * recon_buffer->stride_y, blk_recon->recon[0] + j * blk_geom->bwidth, blk_geom->bwidth);
+    // The luma transform blocks tile the block
+    memcpy(((int32_t*)coeff_buffer_sb->buffer_y) + context_ptr->coded_area_sb, blk_recon->coeff[0], blk_geom->bwidth * blk_geom->bheight * sizeof(int32_t));
+
+    if (blk_geom->has_uv) {
+        uint32_t round_origin_x = ROUND_UV(context_ptr->cu_origin_x);
+        uint32_t round_origin_y = ROUND_UV(context_ptr->cu_origin_y);
+        uint8_t *recon_cb = recon_buffer->buffer_cb + ((recon_buffer->origin_y + round_origin_y) >> 1) * recon_buffer->stride_cb + ((recon_buffer->origin_x + round_origin_x) >> 1);
+        uint8_t *recon_cr = recon_buffer->buffer_cr + ((recon_buffer->origin_y + round_origin_y) >> 1) * recon_buffer->stride_cr + ((recon_buffer->origin_x + round_origin_x) >> 1);
+        for (j = 0; j < blk_geom->bheight_uv; j++) {
+            memcpy(recon_cb + j * recon_buffer->stride_cb, blk_recon->recon[1] + j * blk_geom->bwidth_uv, blk_geom->bwidth_uv);
+            memcpy(recon_cr + j * recon_buffer->stride_cr, blk_recon->recon[2] + j * blk_geom->bwidth_uv, blk_geom->bwidth_uv);
+        }
+        for (txb_itr = 0; txb_itr < blk_geom->txb_count[cu_ptr->tx_depth]; txb_itr++)
+            if (cu_ptr->tx_depth == 0 || txb_itr == 0)
+                coeff_count_uv += blk_geom->tx_width_uv[cu_ptr->tx_depth][txb_itr] * blk_geom->tx_height_uv[cu_ptr->tx_depth][txb_itr];
+        memcpy(((int32_t*)coeff_buffer_sb->buffer_cb) + context_ptr->coded_area_sb_uv, blk_recon->coeff[1], coeff_count_uv * sizeof(int32_t));
+        memcpy(((int32_t*)coeff_buffer_sb->buffer_cr) + context_ptr->coded_area_sb_uv, blk_recon->coeff[2], coeff_count_uv * sizeof(int32_t));
+    }
+}
+
+/*******************************************
+* Load the MD results of the current transform
+* block in place of the Encode Loop
+*******************************************/
+static void md_recon_load_txb(
+    EncDecContext       *context_ptr,
+    uint8_t              uv_pass,
+    uint32_t            *count_non_zero_coeffs,
+    uint16_t            *eob)
+{
+    CodingUnit         *cu_ptr = context_ptr->cu_ptr;
+    const BlockGeom    *blk_geom = context_ptr->blk_geom;
+    const MdBlockRecon *blk_recon = &context_ptr->md_context->md_blk_recon[cu_ptr->mds_idx];
+    uint32_t            txb_itr = context_ptr->txb_itr;
+    TransformUnit      *txb_ptr = &cu_ptr->transform_unit_array[txb_itr];
+
+    eob[0] = blk_recon->eob[0][txb_itr];
+    count_non_zero_coeffs[0] = eob[0];
+    txb_ptr->y_has_coeff = eob[0] ? EB_TRUE : EB_FALSE;
+    txb_ptr->nz_coef_count[0] = eob[0];
+    cu_ptr->quantized_dc[0][txb_itr] = blk_recon->quantized_dc[0][txb_itr];
+    if (eob[0] == 0) {
+        // INTER. Chroma follows Luma in transform type
+        txb_ptr->transform_type[PLANE_TYPE_Y] = DCT_DCT;
+        txb_ptr->transform_type[PLANE_TYPE_UV] = DCT_DCT;
+    }
+
+    if (blk_geom->has_uv && uv_pass) {
+        eob[1] = blk_recon->eob[1][txb_itr];
+        eob[2] = blk_recon->eob[2][txb_itr];
+        count_non_zero_coeffs[1] = eob[1];
+        count_non_zero_coeffs[2] = eob[2];
+        txb_ptr->u_has_coeff = eob[1] ? EB_TRUE : EB_FALSE;
+        txb_ptr->v_has_coeff = eob[2] ? EB_TRUE : EB_FALSE;
+        txb_ptr->nz_coef_count[1] = eob[1];
+        txb_ptr->nz_coef_count[2] = eob[2];
+        cu_ptr->quantized_dc[1][txb_itr] = blk_recon->quantized_dc[1][txb_itr];
+        cu_ptr->quantized_dc[2][txb_itr] = blk_recon->quantized_dc[2][txb_itr];
+    }
+}
+
 /*******************************************
 * Encode Pass
 *
@@ -3217,6 +3354,15 @@ EB_EXTERN void av1_encode_pass(
                     uint8_t   cb_qp = cu_ptr->qp;
                     uint32_t  component_mask = context_ptr->blk_geom->has_uv ? PICTURE_BUFFER_DESC_FULL_MASK : PICTURE_BUFFER_DESC_LUMA_MASK;
 
+                    // Use the reconstruction and coefficients MD kept when the prediction is the same
+                    EbBool md_recon_reused = (EbBool)(cu_ptr->prediction_unit_array[0].merge_flag == EB_FALSE && doMC &&
+                        md_recon_reusable(picture_control_set_ptr, context_ptr, recon_buffer));
+                    if (md_recon_reused)
+                        md_recon_copy(
+                            context_ptr,
+                            recon_buffer,
+                            coeff_buffer_sb);
+
                     if (cu_ptr->prediction_unit_array[0].merge_flag == EB_FALSE) {
                         for (uint8_t tuIt = 0; tuIt < totTu; tuIt++) {
                             context_ptr->txb_itr = tuIt;
@@ -3270,7 +3416,16 @@ EB_EXTERN void av1_encode_pass(
                                     &context_ptr->md_context->cr_txb_skip_context,
                                     &context_ptr->md_context->cr_dc_sign_context);
                             }
-                            if (!zeroLumaCbfMD)
+                            if (md_recon_reused) {
+                                md_recon_load_txb(
+                                    context_ptr,
+                                    uv_pass,
+                                    count_non_zero_coeffs,
+                                    eobs[context_ptr->txb_itr]);
+                                yTuFullDistortion[DIST_CALC_RESIDUAL] = 0;
+                                yTuFullDistortion[DIST_CALC_PREDICTION] = 0;
+                            }
+                            else if (!zeroLumaCbfMD)
                                 //inter mode  1
                                 Av1EncodeLoopFunctionTable[is16bit](
                                     picture_control_set_ptr,
@@ -3296,7 +3451,7 @@ EB_EXTERN void av1_encode_pass(
                             // SKIP the CBF zero mode for DC path. There are problems with cost calculations
                             {
                                 // Compute Tu distortion
-                                if (!zeroLumaCbfMD)
+                                if (!zeroLumaCbfMD && !md_recon_reused)
 
                                     // LUMA DISTORTION
                                     picture_full_distortion32_bits(
@@ -3327,7 +3482,7 @@ EB_EXTERN void av1_encode_pass(
                                 cb_tu_coeff_bits = 0;
                                 cr_tu_coeff_bits = 0;
 
-                                if (!zeroLumaCbfMD) {
+                                if (!zeroLumaCbfMD && !md_recon_reused) {
                                     ModeDecisionCandidateBuffer         **candidateBufferPtrArrayBase = context_ptr->md_context->candidate_buffer_ptr_array;
                                     ModeDecisionCandidateBuffer         **candidate_buffer_ptr_array = &(candidateBufferPtrArrayBase[0]);
                                     ModeDecisionCandidateBuffer          *candidateBuffer;
@@ -3363,16 +3518,16 @@ EB_EXTERN void av1_encode_pass(
                                         asm_type);
                                 }
 
-                                // CBF Tu decision
-                                if (zeroLumaCbfMD == EB_FALSE)
-
-                                    av1_encode_tu_calc_cost(
-                                        context_ptr,
-                                        count_non_zero_coeffs,
-                                        yTuFullDistortion,
-                                        &y_tu_coeff_bits,
-                                        component_mask);
-
+                                // CBF Tu decision, already made by MD for a reused block
+                                if (zeroLumaCbfMD == EB_FALSE) {
+                                    if (!md_recon_reused)
+                                        av1_encode_tu_calc_cost(
+                                            context_ptr,
+                                            count_non_zero_coeffs,
+                                            yTuFullDistortion,
+                                            &y_tu_coeff_bits,
+                                            component_mask);
+                                }
                                 else {
                                     cu_ptr->transform_unit_array[context_ptr->txb_itr].y_has_coeff = 0;
                                     cu_ptr->transform_unit_array[context_ptr->txb_itr].u_has_coeff = 0;
@@ -3659,7 +3814,7 @@ EB_EXTERN void av1_encode_pass(
                         }
 
                         //inter mode
-                        if (doRecon)
+                        if (doRecon && !md_recon_reused)
 
                             Av1EncodeGenerateReconFunctionPtr[is16bit](
                                 context_ptr,
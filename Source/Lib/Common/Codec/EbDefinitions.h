@@ -48,13 +48,18 @@ extern "C" {
 #define EIGTH_PEL_MV                      0
 #define ALTREF_TF_EIGHTH_PEL_SEARCH       1 // Add 1/8 sub-pel search/compensation @ Temporal Filtering
 #define ALTREF_TF_ADAPTIVE_WINDOW_SIZE    1 // Add the ability to use dynamic/asymmetric window for AltRef temporal filtering, add the ability to derive the activity within past and future frames @ picture decision, and add a logic to derive window size from activity
+#ifndef LOCK_FREE_FIFO
+#define LOCK_FREE_FIFO                    0 // Use a lock-free bounded ring (spin-then-park) for EbFifo/EbMuxingQueue instead of the mutex-guarded linked lists
+#endif
 //FOR DEBUGGING - Do not remove
 #define NO_ENCDEC                         0 // bypass encDec to test cmpliance of MD. complained achieved when skip_flag is OFF. Port sample code from VCI-SW_AV1_Candidate1 branch
 
 #define ADP_STATS_PER_LAYER                             0
+#define NSQ_PRUNING_STATS                               0 // Print the features and the outcome of the NSQ shapes tested in MD when stat_report is ON, to retrain the NSQ pruning model
 #define NFL_TX_TH                                       12 // To be tuned
 #define NFL_IT_TH                                       2 // To be tuned
 #define NSQ_TAB_SIZE                                    6
+#define NSQ_PRUNING_FEATURE_COUNT                       7
 #define AOM_INTERP_EXTEND                               4
 
 
@@ -72,6 +77,10 @@ typedef enum ME_QP_MODE {
     EX_QP_MODE = 0,       // Exhaustive  1/4-pel serach mode.
     REFINMENT_QP_MODE = 1 // Refinement 1/4-pel serach mode.
 } ME_QP_MODE;
+typedef enum ME_FP_MODE {
+    EX_FP_MODE = 0,        // Exhaustive full-pel search mode.
+    PREDICTIVE_FP_MODE = 1 // Predictor seeded hexagon full-pel search mode.
+} ME_FP_MODE;
 struct Buf2D
 {
     uint8_t *buf;
@@ -125,6 +134,7 @@ enum {
 #define BLOCK_MAX_COUNT_SB_64                     1101  // TODO: reduce alloction for 64x64
 #define MAX_TXB_COUNT                             4 // Maximum number of transform blocks.
 #define MAX_NFL                                   40
+#define FAST_LOOP_BATCH_SIZE                      4 // Candidates predicted ahead of the fast loop distortion (one x4d SAD call)
 #define MAX_LAD                                   120 // max lookahead-distance 2x60fps
 #define ROUND_UV(x) (((x)>>3)<<3)
 #define AV1_PROB_COST_SHIFT 9
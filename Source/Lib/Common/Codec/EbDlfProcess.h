@@ -40,6 +40,8 @@ extern EbErrorType dlf_context_ctor(
     uint32_t                max_input_luma_height
    );
 
+extern void dlf_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
+
 extern void* dlf_kernel(void *input_ptr);
 
 #endif // EbEntropyCodingProcess_h
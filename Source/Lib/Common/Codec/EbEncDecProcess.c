@@ -99,6 +99,7 @@ EbErrorType enc_dec_context_ctor(
     EbBool                  is16bit,
     EbColorFormat           color_format,
     EbBool                  enable_hbd_mode_decision,
+    EbBool                  reuse_md_recon,
     uint32_t                max_input_luma_width,
     uint32_t                max_input_luma_height)
 {
@@ -192,7 +193,8 @@ EbErrorType enc_dec_context_ctor(
     EB_NEW(
         context_ptr->md_context,
         mode_decision_context_ctor,
-        color_format, 0, 0, enable_hbd_mode_decision);
+        color_format, 0, 0, enable_hbd_mode_decision,
+        (EbBool)(reuse_md_recon && !is16bit));
 
     if (enable_hbd_mode_decision)
         context_ptr->md_context->input_sample16bit_buffer = context_ptr->input_sample16bit_buffer;
@@ -1384,9 +1386,12 @@ void av1_estimate_syntax_rate___partial(
     MdRateEstimationContext        *md_rate_estimation_array,
     FRAME_CONTEXT                  *fc);
 /******************************************************
- * EncDec Kernel
+ * EncDec Task
+ *   Processes one input object of the EncDec process and
+ *   releases it. Called by enc_dec_kernel, or directly by the
+ *   encoder task scheduler when the task pool is enabled.
  ******************************************************/
-void* enc_dec_kernel(void *input_ptr)
+void enc_dec_task(void *input_ptr, EbObjectWrapper *encDecTasksWrapperPtr)
 {
     // Context & SCS & PCS
     EncDecContext                         *context_ptr = (EncDecContext*)input_ptr;
@@ -1394,7 +1399,6 @@ void* enc_dec_kernel(void *input_ptr)
     SequenceControlSet                    *sequence_control_set_ptr;
 
     // Input
-    EbObjectWrapper                       *encDecTasksWrapperPtr;
     EncDecTasks                           *encDecTasksPtr;
 
     // Output
@@ -1431,253 +1435,277 @@ void* enc_dec_kernel(void *input_ptr)
     uint32_t                                 segmentBandIndex;
     uint32_t                                 segmentBandSize;
     EncDecSegments                          *segments_ptr;
-    for (;;) {
-        // Get Mode Decision Results
-        eb_get_full_object(
-            context_ptr->mode_decision_input_fifo_ptr,
-            &encDecTasksWrapperPtr);
 
-        encDecTasksPtr = (EncDecTasks*)encDecTasksWrapperPtr->object_ptr;
-        picture_control_set_ptr = (PictureControlSet*)encDecTasksPtr->picture_control_set_wrapper_ptr->object_ptr;
-        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-        segments_ptr = picture_control_set_ptr->enc_dec_segment_ctrl;
-        lastLcuFlag = EB_FALSE;
-        is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
-        (void)is16bit;
-        (void)endOfRowFlag;
-
-        // EncDec Kernel Signal(s) derivation
-
-        signal_derivation_enc_dec_kernel_oq(
+    encDecTasksPtr = (EncDecTasks*)encDecTasksWrapperPtr->object_ptr;
+    picture_control_set_ptr = (PictureControlSet*)encDecTasksPtr->picture_control_set_wrapper_ptr->object_ptr;
+    sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    segments_ptr = picture_control_set_ptr->enc_dec_segment_ctrl;
+    lastLcuFlag = EB_FALSE;
+    is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    (void)is16bit;
+    (void)endOfRowFlag;
+
+    // EncDec Kernel Signal(s) derivation
+
+    signal_derivation_enc_dec_kernel_oq(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        context_ptr->md_context);
+
+    // SB Constants
+    sb_sz = (uint8_t)sequence_control_set_ptr->sb_size_pix;
+    lcuSizeLog2 = (uint8_t)Log2f(sb_sz);
+    context_ptr->sb_sz = sb_sz;
+    picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sb_sz - 1) >> lcuSizeLog2;
+    endOfRowFlag = EB_FALSE;
+    lcuRowIndexStart = lcuRowIndexCount = 0;
+    context_ptr->tot_intra_coded_area = 0;
+
+    // Segment-loop
+    while (AssignEncDecSegments(segments_ptr, &segment_index, encDecTasksPtr, context_ptr->enc_dec_feedback_fifo_ptr) == EB_TRUE)
+    {
+        xLcuStartIndex = segments_ptr->x_start_array[segment_index];
+        yLcuStartIndex = segments_ptr->y_start_array[segment_index];
+        lcuStartIndex = yLcuStartIndex * picture_width_in_sb + xLcuStartIndex;
+        lcuSegmentCount = segments_ptr->valid_lcu_count_array[segment_index];
+
+        segmentRowIndex = segment_index / segments_ptr->segment_band_count;
+        segmentBandIndex = segment_index - segmentRowIndex * segments_ptr->segment_band_count;
+        segmentBandSize = (segments_ptr->lcu_band_count * (segmentBandIndex + 1) + segments_ptr->segment_band_count - 1) / segments_ptr->segment_band_count;
+
+        // Reset Coding Loop State
+        reset_mode_decision( // HT done
+            context_ptr->md_context,
+            picture_control_set_ptr,
             sequence_control_set_ptr,
+            segment_index);
+
+        // Reset EncDec Coding State
+        ResetEncDec(    // HT done
+            context_ptr,
             picture_control_set_ptr,
-            context_ptr->md_context);
-
-        // SB Constants
-        sb_sz = (uint8_t)sequence_control_set_ptr->sb_size_pix;
-        lcuSizeLog2 = (uint8_t)Log2f(sb_sz);
-        context_ptr->sb_sz = sb_sz;
-        picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sb_sz - 1) >> lcuSizeLog2;
-        endOfRowFlag = EB_FALSE;
-        lcuRowIndexStart = lcuRowIndexCount = 0;
-        context_ptr->tot_intra_coded_area = 0;
-
-        // Segment-loop
-        while (AssignEncDecSegments(segments_ptr, &segment_index, encDecTasksPtr, context_ptr->enc_dec_feedback_fifo_ptr) == EB_TRUE)
-        {
-            xLcuStartIndex = segments_ptr->x_start_array[segment_index];
-            yLcuStartIndex = segments_ptr->y_start_array[segment_index];
-            lcuStartIndex = yLcuStartIndex * picture_width_in_sb + xLcuStartIndex;
-            lcuSegmentCount = segments_ptr->valid_lcu_count_array[segment_index];
-
-            segmentRowIndex = segment_index / segments_ptr->segment_band_count;
-            segmentBandIndex = segment_index - segmentRowIndex * segments_ptr->segment_band_count;
-            segmentBandSize = (segments_ptr->lcu_band_count * (segmentBandIndex + 1) + segments_ptr->segment_band_count - 1) / segments_ptr->segment_band_count;
-
-            // Reset Coding Loop State
-            reset_mode_decision( // HT done
-                context_ptr->md_context,
-                picture_control_set_ptr,
-                sequence_control_set_ptr,
-                segment_index);
-
-            // Reset EncDec Coding State
-            ResetEncDec(    // HT done
-                context_ptr,
-                picture_control_set_ptr,
-                sequence_control_set_ptr,
-                segment_index);
-
-            if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL)
-                ((EbReferenceObject  *)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->average_intensity = picture_control_set_ptr->parent_pcs_ptr->average_intensity[0];
-            for (y_lcu_index = yLcuStartIndex, lcuSegmentIndex = lcuStartIndex; lcuSegmentIndex < lcuStartIndex + lcuSegmentCount; ++y_lcu_index) {
-                for (x_lcu_index = xLcuStartIndex; x_lcu_index < picture_width_in_sb && (x_lcu_index + y_lcu_index < segmentBandSize) && lcuSegmentIndex < lcuStartIndex + lcuSegmentCount; ++x_lcu_index, ++lcuSegmentIndex) {
-                    sb_index = (uint16_t)(y_lcu_index * picture_width_in_sb + x_lcu_index);
-                    sb_ptr = picture_control_set_ptr->sb_ptr_array[sb_index];
-                    sb_origin_x = x_lcu_index << lcuSizeLog2;
-                    sb_origin_y = y_lcu_index << lcuSizeLog2;
-                    lastLcuFlag = (sb_index == sequence_control_set_ptr->sb_tot_cnt - 1) ? EB_TRUE : EB_FALSE;
-                    endOfRowFlag = (x_lcu_index == picture_width_in_sb - 1) ? EB_TRUE : EB_FALSE;
-                    lcuRowIndexStart = (x_lcu_index == picture_width_in_sb - 1 && lcuRowIndexCount == 0) ? y_lcu_index : lcuRowIndexStart;
-                    lcuRowIndexCount = (x_lcu_index == picture_width_in_sb - 1) ? lcuRowIndexCount + 1 : lcuRowIndexCount;
-                    mdcPtr = &picture_control_set_ptr->mdc_sb_array[sb_index];
-                    context_ptr->sb_index = sb_index;
-                    context_ptr->md_context->cu_use_ref_src_flag = (picture_control_set_ptr->parent_pcs_ptr->use_src_ref) && (picture_control_set_ptr->parent_pcs_ptr->edge_results_ptr[sb_index].edge_block_num == EB_FALSE || picture_control_set_ptr->parent_pcs_ptr->sb_flat_noise_array[sb_index]) ? EB_TRUE : EB_FALSE;
-
-                    if (picture_control_set_ptr->update_cdf) {
-                        MdRateEstimationContext* md_rate_estimation_array = sequence_control_set_ptr->encode_context_ptr->md_rate_estimation_array;
-                        md_rate_estimation_array += picture_control_set_ptr->slice_type * TOTAL_NUMBER_OF_QP_VALUES + context_ptr->md_context->qp;
-
-                        //this is temp, copy all default tables
-                        picture_control_set_ptr->rate_est_array[sb_index] = *md_rate_estimation_array;
+            sequence_control_set_ptr,
+            segment_index);
+
+        if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL)
+            ((EbReferenceObject  *)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->average_intensity = picture_control_set_ptr->parent_pcs_ptr->average_intensity[0];
+        for (y_lcu_index = yLcuStartIndex, lcuSegmentIndex = lcuStartIndex; lcuSegmentIndex < lcuStartIndex + lcuSegmentCount; ++y_lcu_index) {
+            for (x_lcu_index = xLcuStartIndex; x_lcu_index < picture_width_in_sb && (x_lcu_index + y_lcu_index < segmentBandSize) && lcuSegmentIndex < lcuStartIndex + lcuSegmentCount; ++x_lcu_index, ++lcuSegmentIndex) {
+                sb_index = (uint16_t)(y_lcu_index * picture_width_in_sb + x_lcu_index);
+                sb_ptr = picture_control_set_ptr->sb_ptr_array[sb_index];
+                sb_origin_x = x_lcu_index << lcuSizeLog2;
+                sb_origin_y = y_lcu_index << lcuSizeLog2;
+                lastLcuFlag = (sb_index == sequence_control_set_ptr->sb_tot_cnt - 1) ? EB_TRUE : EB_FALSE;
+                endOfRowFlag = (x_lcu_index == picture_width_in_sb - 1) ? EB_TRUE : EB_FALSE;
+                lcuRowIndexStart = (x_lcu_index == picture_width_in_sb - 1 && lcuRowIndexCount == 0) ? y_lcu_index : lcuRowIndexStart;
+                lcuRowIndexCount = (x_lcu_index == picture_width_in_sb - 1) ? lcuRowIndexCount + 1 : lcuRowIndexCount;
+                mdcPtr = &picture_control_set_ptr->mdc_sb_array[sb_index];
+                context_ptr->sb_index = sb_index;
+                context_ptr->md_context->cu_use_ref_src_flag = (picture_control_set_ptr->parent_pcs_ptr->use_src_ref) && (picture_control_set_ptr->parent_pcs_ptr->edge_results_ptr[sb_index].edge_block_num == EB_FALSE || picture_control_set_ptr->parent_pcs_ptr->sb_flat_noise_array[sb_index]) ? EB_TRUE : EB_FALSE;
+
+                if (picture_control_set_ptr->update_cdf) {
+                    MdRateEstimationContext* md_rate_estimation_array = sequence_control_set_ptr->encode_context_ptr->md_rate_estimation_array;
+                    md_rate_estimation_array += picture_control_set_ptr->slice_type * TOTAL_NUMBER_OF_QP_VALUES + context_ptr->md_context->qp;
+
+                    //this is temp, copy all default tables
+                    picture_control_set_ptr->rate_est_array[sb_index] = *md_rate_estimation_array;
 #if CABAC_SERIAL
-                        if (sb_index == 0)
-                            picture_control_set_ptr->ec_ctx_array[sb_index] = *picture_control_set_ptr->coeff_est_entropy_coder_ptr->fc;
-                        else
-                            picture_control_set_ptr->ec_ctx_array[sb_index] = picture_control_set_ptr->ec_ctx_array[sb_index - 1];
+                    if (sb_index == 0)
+                        picture_control_set_ptr->ec_ctx_array[sb_index] = *picture_control_set_ptr->coeff_est_entropy_coder_ptr->fc;
+                    else
+                        picture_control_set_ptr->ec_ctx_array[sb_index] = picture_control_set_ptr->ec_ctx_array[sb_index - 1];
 #else
-                        if (sb_origin_x == 0)
-                            picture_control_set_ptr->ec_ctx_array[sb_index] = *picture_control_set_ptr->coeff_est_entropy_coder_ptr->fc;
-                        else
-                            picture_control_set_ptr->ec_ctx_array[sb_index] = picture_control_set_ptr->ec_ctx_array[sb_index - 1];
+                    if (sb_origin_x == 0)
+                        picture_control_set_ptr->ec_ctx_array[sb_index] = *picture_control_set_ptr->coeff_est_entropy_coder_ptr->fc;
+                    else
+                        picture_control_set_ptr->ec_ctx_array[sb_index] = picture_control_set_ptr->ec_ctx_array[sb_index - 1];
 #endif
 
-                        //construct the tables using the latest CDFs : Coeff Only here ---to check if I am using all the uptodate CDFs here
-                        av1_estimate_syntax_rate___partial(
-                            &picture_control_set_ptr->rate_est_array[sb_index],
-                            &picture_control_set_ptr->ec_ctx_array[sb_index]);
+                    //construct the tables using the latest CDFs : Coeff Only here ---to check if I am using all the uptodate CDFs here
+                    av1_estimate_syntax_rate___partial(
+                        &picture_control_set_ptr->rate_est_array[sb_index],
+                        &picture_control_set_ptr->ec_ctx_array[sb_index]);
 
-                        av1_estimate_coefficients_rate(
-                            &picture_control_set_ptr->rate_est_array[sb_index],
-                            &picture_control_set_ptr->ec_ctx_array[sb_index]);
+                    av1_estimate_coefficients_rate(
+                        &picture_control_set_ptr->rate_est_array[sb_index],
+                        &picture_control_set_ptr->ec_ctx_array[sb_index]);
 
-                        //let the candidate point to the new rate table.
-                        uint32_t  candidateIndex;
-                        for (candidateIndex = 0; candidateIndex < MODE_DECISION_CANDIDATE_MAX_COUNT; ++candidateIndex)
-                            context_ptr->md_context->fast_candidate_ptr_array[candidateIndex]->md_rate_estimation_ptr = &picture_control_set_ptr->rate_est_array[sb_index];
+                    //let the candidate point to the new rate table.
+                    uint32_t  candidateIndex;
+                    for (candidateIndex = 0; candidateIndex < MODE_DECISION_CANDIDATE_MAX_COUNT; ++candidateIndex)
+                        context_ptr->md_context->fast_candidate_ptr_array[candidateIndex]->md_rate_estimation_ptr = &picture_control_set_ptr->rate_est_array[sb_index];
+                }
+                // Configure the LCU
+                mode_decision_configure_lcu(
+                    context_ptr->md_context,
+                    sb_ptr,
+                    picture_control_set_ptr,
+                    sequence_control_set_ptr,
+                    (uint8_t)context_ptr->qp,
+                    (uint8_t)sb_ptr->qp);
+
+                uint32_t lcuRow;
+                if (picture_control_set_ptr->parent_pcs_ptr->enable_in_loop_motion_estimation_flag) {
+                    EbPictureBufferDesc       *input_picture_ptr;
+
+                    input_picture_ptr = picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr;
+
+                    // Load the SB from the input to the intermediate SB buffer
+                    uint32_t bufferIndex = (input_picture_ptr->origin_y + sb_origin_y) * input_picture_ptr->stride_y + input_picture_ptr->origin_x + sb_origin_x;
+
+                    // Copy the source superblock to the me local buffer
+                    uint32_t sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < MAX_SB_SIZE ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : MAX_SB_SIZE;
+                    uint32_t sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < MAX_SB_SIZE ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : MAX_SB_SIZE;
+                    uint32_t is_complete_sb = sequence_control_set_ptr->sb_geom[sb_index].is_complete_sb;
+
+                    if (!is_complete_sb)
+                        memset(context_ptr->ss_mecontext->sb_buffer, 0, MAX_SB_SIZE*MAX_SB_SIZE);
+                    for (lcuRow = 0; lcuRow < sb_height; lcuRow++) {
+                        EB_MEMCPY((&(context_ptr->ss_mecontext->sb_buffer[lcuRow * MAX_SB_SIZE])), (&(input_picture_ptr->buffer_y[bufferIndex + lcuRow * input_picture_ptr->stride_y])), sb_width * sizeof(uint8_t));
                     }
-                    // Configure the LCU
-                    mode_decision_configure_lcu(
-                        context_ptr->md_context,
-                        sb_ptr,
-                        picture_control_set_ptr,
-                        sequence_control_set_ptr,
-                        (uint8_t)context_ptr->qp,
-                        (uint8_t)sb_ptr->qp);
-
-                    uint32_t lcuRow;
-                    if (picture_control_set_ptr->parent_pcs_ptr->enable_in_loop_motion_estimation_flag) {
-                        EbPictureBufferDesc       *input_picture_ptr;
 
-                        input_picture_ptr = picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr;
+                    context_ptr->ss_mecontext->sb_src_ptr = &(context_ptr->ss_mecontext->sb_buffer[0]);
+                    context_ptr->ss_mecontext->sb_src_stride = context_ptr->ss_mecontext->sb_buffer_stride;
+                    // Set in-loop ME Search Area
+                    int16_t mv_l0_x;
+                    int16_t mv_l0_y;
+                    int16_t mv_l1_x;
+                    int16_t mv_l1_y;
 
-                        // Load the SB from the input to the intermediate SB buffer
-                        uint32_t bufferIndex = (input_picture_ptr->origin_y + sb_origin_y) * input_picture_ptr->stride_y + input_picture_ptr->origin_x + sb_origin_x;
+                    mv_l0_x = 0;
+                    mv_l0_y = 0;
+                    mv_l1_x = 0;
+                    mv_l1_y = 0;
 
-                        // Copy the source superblock to the me local buffer
-                        uint32_t sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < MAX_SB_SIZE ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : MAX_SB_SIZE;
-                        uint32_t sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < MAX_SB_SIZE ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : MAX_SB_SIZE;
-                        uint32_t is_complete_sb = sequence_control_set_ptr->sb_geom[sb_index].is_complete_sb;
-
-                        if (!is_complete_sb)
-                            memset(context_ptr->ss_mecontext->sb_buffer, 0, MAX_SB_SIZE*MAX_SB_SIZE);
-                        for (lcuRow = 0; lcuRow < sb_height; lcuRow++) {
-                            EB_MEMCPY((&(context_ptr->ss_mecontext->sb_buffer[lcuRow * MAX_SB_SIZE])), (&(input_picture_ptr->buffer_y[bufferIndex + lcuRow * input_picture_ptr->stride_y])), sb_width * sizeof(uint8_t));
-                        }
-
-                        context_ptr->ss_mecontext->sb_src_ptr = &(context_ptr->ss_mecontext->sb_buffer[0]);
-                        context_ptr->ss_mecontext->sb_src_stride = context_ptr->ss_mecontext->sb_buffer_stride;
-                        // Set in-loop ME Search Area
-                        int16_t mv_l0_x;
-                        int16_t mv_l0_y;
-                        int16_t mv_l1_x;
-                        int16_t mv_l1_y;
-
-                        mv_l0_x = 0;
-                        mv_l0_y = 0;
-                        mv_l1_x = 0;
-                        mv_l1_y = 0;
-
-                        context_ptr->ss_mecontext->search_area_width = 64;
-                        context_ptr->ss_mecontext->search_area_height = 64;
-
-                        // perform in-loop ME
-                        in_loop_motion_estimation_sblock(
-                            picture_control_set_ptr,
-                            sb_origin_x,
-                            sb_origin_y,
-                            mv_l0_x,
-                            mv_l0_y,
-                            mv_l1_x,
-                            mv_l1_y,
-                            context_ptr->ss_mecontext);
-                    }
+                    context_ptr->ss_mecontext->search_area_width = 64;
+                    context_ptr->ss_mecontext->search_area_height = 64;
 
-                    mode_decision_sb(
-                        sequence_control_set_ptr,
+                    // perform in-loop ME
+                    in_loop_motion_estimation_sblock(
                         picture_control_set_ptr,
-                        mdcPtr,
-                        sb_ptr,
                         sb_origin_x,
                         sb_origin_y,
-                        sb_index,
-                        context_ptr->ss_mecontext,
-                        context_ptr->md_context);
-
-                    // Configure the LCU
-                    EncDecConfigureLcu(
-                        context_ptr,
-                        sb_ptr,
-                        picture_control_set_ptr,
-                        sequence_control_set_ptr,
-                        (uint8_t)context_ptr->qp,
-                        (uint8_t)sb_ptr->qp);
+                        mv_l0_x,
+                        mv_l0_y,
+                        mv_l1_x,
+                        mv_l1_y,
+                        context_ptr->ss_mecontext);
+                }
+
+                mode_decision_sb(
+                    sequence_control_set_ptr,
+                    picture_control_set_ptr,
+                    mdcPtr,
+                    sb_ptr,
+                    sb_origin_x,
+                    sb_origin_y,
+                    sb_index,
+                    context_ptr->ss_mecontext,
+                    context_ptr->md_context);
+
+                // Configure the LCU
+                EncDecConfigureLcu(
+                    context_ptr,
+                    sb_ptr,
+                    picture_control_set_ptr,
+                    sequence_control_set_ptr,
+                    (uint8_t)context_ptr->qp,
+                    (uint8_t)sb_ptr->qp);
 
 #if NO_ENCDEC
-                    no_enc_dec_pass(
-                        sequence_control_set_ptr,
-                        picture_control_set_ptr,
-                        sb_ptr,
-                        sb_index,
-                        sb_origin_x,
-                        sb_origin_y,
-                        sb_ptr->qp,
-                        context_ptr);
+                no_enc_dec_pass(
+                    sequence_control_set_ptr,
+                    picture_control_set_ptr,
+                    sb_ptr,
+                    sb_index,
+                    sb_origin_x,
+                    sb_origin_y,
+                    sb_ptr->qp,
+                    context_ptr);
 #else
-                    // Encode Pass
-                    av1_encode_pass(
-                        sequence_control_set_ptr,
-                        picture_control_set_ptr,
-                        sb_ptr,
-                        sb_index,
-                        sb_origin_x,
-                        sb_origin_y,
-                        context_ptr);
+                // Encode Pass
+                av1_encode_pass(
+                    sequence_control_set_ptr,
+                    picture_control_set_ptr,
+                    sb_ptr,
+                    sb_index,
+                    sb_origin_x,
+                    sb_origin_y,
+                    context_ptr);
 #endif
 
-                    if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL)
-                        ((EbReferenceObject*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->intra_coded_area_sb[sb_index] = (uint8_t)((100 * context_ptr->intra_coded_area_sb[sb_index]) / (64 * 64));
-                }
-                xLcuStartIndex = (xLcuStartIndex > 0) ? xLcuStartIndex - 1 : 0;
+                if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL)
+                    ((EbReferenceObject*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->intra_coded_area_sb[sb_index] = (uint8_t)((100 * context_ptr->intra_coded_area_sb[sb_index]) / (64 * 64));
             }
+            xLcuStartIndex = (xLcuStartIndex > 0) ? xLcuStartIndex - 1 : 0;
         }
+    }
 
-        eb_block_on_mutex(picture_control_set_ptr->intra_mutex);
-        picture_control_set_ptr->intra_coded_area += (uint32_t)context_ptr->tot_intra_coded_area;
-        eb_release_mutex(picture_control_set_ptr->intra_mutex);
+    eb_block_on_mutex(picture_control_set_ptr->intra_mutex);
+    picture_control_set_ptr->intra_coded_area += (uint32_t)context_ptr->tot_intra_coded_area;
+    eb_release_mutex(picture_control_set_ptr->intra_mutex);
+
+    if (context_ptr->md_context->rdoq_cache_lookup_count) {
+        EncodeContext *encode_context_ptr = sequence_control_set_ptr->encode_context_ptr;
+        eb_block_on_mutex(encode_context_ptr->rdoq_cache_stat_mutex);
+        encode_context_ptr->rdoq_cache_lookup_count += context_ptr->md_context->rdoq_cache_lookup_count;
+        encode_context_ptr->rdoq_cache_hit_count += context_ptr->md_context->rdoq_cache_hit_count;
+        eb_release_mutex(encode_context_ptr->rdoq_cache_stat_mutex);
+        context_ptr->md_context->rdoq_cache_lookup_count = 0;
+        context_ptr->md_context->rdoq_cache_hit_count = 0;
+    }
 
-        if (lastLcuFlag) {
-            // Copy film grain data from parent picture set to the reference object for further reference
-            if (sequence_control_set_ptr->seq_header.film_grain_params_present)
-            {
-                if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE && picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr) {
-                    ((EbReferenceObject*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->film_grain_params
-                        = picture_control_set_ptr->parent_pcs_ptr->frm_hdr.film_grain_params;
-                }
+    if (lastLcuFlag) {
+        // Copy film grain data from parent picture set to the reference object for further reference
+        if (sequence_control_set_ptr->seq_header.film_grain_params_present)
+        {
+            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE && picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr) {
+                ((EbReferenceObject*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->film_grain_params
+                    = picture_control_set_ptr->parent_pcs_ptr->frm_hdr.film_grain_params;
             }
-
-            EB_MEMCPY(picture_control_set_ptr->parent_pcs_ptr->av1x->sgrproj_restore_cost, context_ptr->md_rate_estimation_ptr->sgrproj_restore_fac_bits, 2 * sizeof(int32_t));
-            EB_MEMCPY(picture_control_set_ptr->parent_pcs_ptr->av1x->switchable_restore_cost, context_ptr->md_rate_estimation_ptr->switchable_restore_fac_bits, 3 * sizeof(int32_t));
-            EB_MEMCPY(picture_control_set_ptr->parent_pcs_ptr->av1x->wiener_restore_cost, context_ptr->md_rate_estimation_ptr->wiener_restore_fac_bits, 2 * sizeof(int32_t));
-            picture_control_set_ptr->parent_pcs_ptr->av1x->rdmult = context_ptr->full_lambda;
         }
 
-        if (lastLcuFlag)
-        {
-            // Get Empty EncDec Results
-            eb_get_empty_object(
-                context_ptr->enc_dec_output_fifo_ptr,
-                &encDecResultsWrapperPtr);
-            encDecResultsPtr = (EncDecResults*)encDecResultsWrapperPtr->object_ptr;
-            encDecResultsPtr->picture_control_set_wrapper_ptr = encDecTasksPtr->picture_control_set_wrapper_ptr;
-            //CHKN these are not needed for DLF
-            encDecResultsPtr->completed_lcu_row_index_start = 0;
-            encDecResultsPtr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
-            // Post EncDec Results
-            eb_post_full_object(encDecResultsWrapperPtr);
-        }
-        // Release Mode Decision Results
-        eb_release_object(encDecTasksWrapperPtr);
+        EB_MEMCPY(picture_control_set_ptr->parent_pcs_ptr->av1x->sgrproj_restore_cost, context_ptr->md_rate_estimation_ptr->sgrproj_restore_fac_bits, 2 * sizeof(int32_t));
+        EB_MEMCPY(picture_control_set_ptr->parent_pcs_ptr->av1x->switchable_restore_cost, context_ptr->md_rate_estimation_ptr->switchable_restore_fac_bits, 3 * sizeof(int32_t));
+        EB_MEMCPY(picture_control_set_ptr->parent_pcs_ptr->av1x->wiener_restore_cost, context_ptr->md_rate_estimation_ptr->wiener_restore_fac_bits, 2 * sizeof(int32_t));
+        picture_control_set_ptr->parent_pcs_ptr->av1x->rdmult = context_ptr->full_lambda;
+    }
+
+    if (lastLcuFlag)
+    {
+        // Get Empty EncDec Results
+        eb_get_empty_object(
+            context_ptr->enc_dec_output_fifo_ptr,
+            &encDecResultsWrapperPtr);
+        encDecResultsPtr = (EncDecResults*)encDecResultsWrapperPtr->object_ptr;
+        encDecResultsPtr->picture_control_set_wrapper_ptr = encDecTasksPtr->picture_control_set_wrapper_ptr;
+        //CHKN these are not needed for DLF
+        encDecResultsPtr->completed_lcu_row_index_start = 0;
+        encDecResultsPtr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
+        // Post EncDec Results
+        eb_post_full_object(encDecResultsWrapperPtr);
+    }
+    // Release Mode Decision Results
+    eb_release_object(encDecTasksWrapperPtr);
+}
+
+/******************************************************
+ * EncDec Kernel
+ ******************************************************/
+void* enc_dec_kernel(void *input_ptr)
+{
+    EncDecContext                         *context_ptr = (EncDecContext*)input_ptr;
+    EbObjectWrapper                       *encDecTasksWrapperPtr;
+
+    for (;;) {
+        // Get Mode Decision Results
+        eb_get_full_object(
+            context_ptr->mode_decision_input_fifo_ptr,
+            &encDecTasksWrapperPtr);
+
+        enc_dec_task(
+            input_ptr,
+            encDecTasksWrapperPtr);
     }
     return EB_NULL;
 }
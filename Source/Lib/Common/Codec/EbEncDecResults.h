@@ -43,6 +43,9 @@ extern "C" {
         EbObjectWrapper *picture_control_set_wrapper_ptr;
         uint32_t         completed_lcu_row_index_start;
         uint32_t         completed_lcu_row_count;
+        // Tiles coded by the job, when the picture has several tiles
+        uint32_t         tile_index_start;
+        uint32_t         tile_count;
     } RestResults;
 
     typedef struct EncDecResultsInitData {
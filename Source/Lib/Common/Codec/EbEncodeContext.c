@@ -19,6 +19,8 @@ static void encode_context_dctor(EbPtr p)
     EB_DESTROY_MUTEX(obj->rate_table_update_mutex);
     EB_DESTROY_MUTEX(obj->sc_buffer_mutex);
     EB_DESTROY_MUTEX(obj->shared_reference_mutex);
+    EB_DESTROY_MUTEX(obj->hme_level0_stat_mutex);
+    EB_DESTROY_MUTEX(obj->rdoq_cache_stat_mutex);
 
     EB_DELETE(obj->prediction_structure_group_ptr);
     EB_DELETE_PTR_ARRAY(obj->picture_decision_reorder_queue, PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH);
@@ -142,5 +144,7 @@ EbErrorType encode_context_ctor(
     encode_context_ptr->max_coded_poc_selected_ref_qp = 32;
 
     EB_CREATE_MUTEX(encode_context_ptr->shared_reference_mutex);
+    EB_CREATE_MUTEX(encode_context_ptr->hme_level0_stat_mutex);
+    EB_CREATE_MUTEX(encode_context_ptr->rdoq_cache_stat_mutex);
     return EB_ErrorNone;
 }
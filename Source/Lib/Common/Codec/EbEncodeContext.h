@@ -151,7 +151,23 @@ typedef struct EncodeContext
     EbObjectWrapper                                  *previous_picture_control_set_wrapper_ptr;
     EbHandle                                          shared_reference_mutex;
 
+    // ME statistics: SB searches eligible for the HME level 0 skip and
+    // skipped ones
+    EbHandle                                          hme_level0_stat_mutex;
+    uint64_t                                          hme_level0_eligible_count;
+    uint64_t                                          hme_level0_skip_count;
+
+    // MD statistics: RDOQ cache lookups and hits
+    EbHandle                                          rdoq_cache_stat_mutex;
+    uint64_t                                          rdoq_cache_lookup_count;
+    uint64_t                                          rdoq_cache_hit_count;
+
     uint64_t                                          picture_number_alt; // The picture number overlay includes all the overlay frames
+
+    // ABR ladder joined by the encoder, see eb_svt_enc_join_ladder(): the
+    // leader (rendition 0) shares its scene changes and motion
+    EbSvtLadder                                      *ladder;
+    uint32_t                                          ladder_rendition_index;
 } EncodeContext;
 
 typedef struct EncodeContextInitData {
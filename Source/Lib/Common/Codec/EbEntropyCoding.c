@@ -245,28 +245,6 @@ static INLINE uint8_t *SetLevels(uint8_t *const levelsBuf, const int32_t width)
     return levelsBuf + TX_PAD_TOP * (width + TX_PAD_HOR);
 }
 
-static INLINE void av1TxbInitLevels(
-    int32_t         *coeffBufferPtr,
-    const uint32_t    coeff_stride,
-    const int16_t    width,
-    const int16_t    height,
-    uint8_t *const    levels) {
-    const int16_t stride = width + TX_PAD_HOR;
-    uint8_t *ls = levels;
-
-    memset(levels - TX_PAD_TOP * stride, 0,
-        sizeof(*levels) * TX_PAD_TOP * stride);
-    memset(levels + stride * height, 0,
-        sizeof(*levels) * (TX_PAD_BOTTOM * stride + TX_PAD_END));
-
-    for (int16_t i = 0; i < height; i++) {
-        for (int16_t j = 0; j < width; j++)
-            *ls++ = (uint8_t)CLIP3(0, INT8_MAX, abs(coeffBufferPtr[i * coeff_stride + j]));
-        for (int16_t j = 0; j < TX_PAD_HOR; j++)
-            *ls++ = 0;
-    }
-}
-
 /************************************************************************************************/
 // blockd.h
 
@@ -555,10 +533,9 @@ int32_t  Av1WriteCoeffsTxb1D(
     }
     if (eob == 0) return 0;
 
-    av1TxbInitLevels(
+    av1_txb_init_levels(
         coeffBufferPtr,
         width,
-        width,
         height,
         levels);
 
@@ -3969,8 +3946,8 @@ static void WriteGlobalMotion(
     int32_t frame;
     FrameHeader *frm_hdr = &pcs_ptr->frm_hdr;
     for (frame = LAST_FRAME; frame <= ALTREF_FRAME; ++frame) {
-        const EbWarpedMotionParams *ref_params = &default_warp_params;
-        //pcs_ptr->prev_frame ? &pcs_ptr->prev_frame->global_motion[frame] : &default_warp_params;
+        const EbWarpedMotionParams *ref_params = frm_hdr->primary_ref_frame == PRIMARY_REF_NONE ?
+            &default_warp_params : &pcs_ptr->prev_global_motion[frame];
 
         write_global_motion_params(&pcs_ptr->global_motion[frame], ref_params, wb,
             frm_hdr->allow_high_precision_mv);
@@ -4659,13 +4636,29 @@ EbErrorType write_frame_header_av1(
         0, n_log2_tiles, tile_start_and_end_present_flag);
 
     if (!showExisting) {
-        // Add data from EC stream to Picture Stream.
-        int32_t frameSize = (int32_t)(parent_pcs_ptr->av1_cm->tiles_info.tile_cols*parent_pcs_ptr->av1_cm->tiles_info.tile_rows==1 ? pcs_ptr->entropy_coder_ptr->ec_writer.pos : pcs_ptr->entropy_coder_ptr->ec_frame_size);
-        OutputBitstreamUnit *ec_output_bitstream_ptr = (OutputBitstreamUnit*)pcs_ptr->entropy_coder_ptr->ec_output_bitstream_ptr;
-        //****************************************************************//
-        // Copy from EC stream to frame stream
-        memcpy(data + currDataSize, ec_output_bitstream_ptr->buffer_begin_av1, frameSize);
-        currDataSize += (frameSize);
+        const int32_t tile_count = parent_pcs_ptr->av1_cm->tiles_info.tile_cols*parent_pcs_ptr->av1_cm->tiles_info.tile_rows;
+        if (tile_count == 1) {
+            // Add data from EC stream to Picture Stream.
+            int32_t frameSize = (int32_t)pcs_ptr->entropy_coder_ptr->ec_writer.pos;
+            OutputBitstreamUnit *ec_output_bitstream_ptr = (OutputBitstreamUnit*)pcs_ptr->entropy_coder_ptr->ec_output_bitstream_ptr;
+            //****************************************************************//
+            // Copy from EC stream to frame stream
+            memcpy(data + currDataSize, ec_output_bitstream_ptr->buffer_begin_av1, frameSize);
+            currDataSize += (frameSize);
+        }
+        else {
+            // Concatenate the tile streams, each tile but the last preceded by its size
+            for (int32_t tile_idx = 0; tile_idx < tile_count; tile_idx++) {
+                EntropyCodingTile *tile_ptr = pcs_ptr->entropy_coding_tile_array[tile_idx];
+                OutputBitstreamUnit *ec_output_bitstream_ptr = (OutputBitstreamUnit*)tile_ptr->entropy_coder_ptr->ec_output_bitstream_ptr;
+                if (tile_idx < tile_count - 1) {
+                    mem_put_le32(data + currDataSize, tile_ptr->tile_size - AV1_MIN_TILE_SIZE_BYTES);
+                    currDataSize += 4;
+                }
+                memcpy(data + currDataSize, ec_output_bitstream_ptr->buffer_begin_av1, tile_ptr->tile_size);
+                currDataSize += (int32_t)tile_ptr->tile_size;
+            }
+        }
     }
     const uint32_t obuPayloadSize = currDataSize - obuHeaderSize;
     const size_t lengthFieldSize =
@@ -4769,6 +4762,7 @@ static void Av1writeDeltaQindex(
 static void write_cdef(
     SequenceControlSet     *seqCSetPtr,
     PictureControlSet     *p_pcs_ptr,
+    EntropyCodingTile     *tile_ptr,
     //Av1Common *cm,
     MacroBlockD *const xd,
     AomWriter *w,
@@ -4795,8 +4789,8 @@ static void write_cdef(
 // Initialise when at top left part of the superblock
     if (!(mi_row & (seqCSetPtr->seq_header.sb_mi_size - 1)) &&
         !(mi_col & (seqCSetPtr->seq_header.sb_mi_size - 1))) {  // Top left?
-        p_pcs_ptr->cdef_preset[0] = p_pcs_ptr->cdef_preset[1] = p_pcs_ptr->cdef_preset[2] =
-            p_pcs_ptr->cdef_preset[3] = -1;
+        tile_ptr->cdef_preset[0] = tile_ptr->cdef_preset[1] = tile_ptr->cdef_preset[2] =
+            tile_ptr->cdef_preset[3] = -1;
     }
 
     // Emit CDEF param at first non-skip coding block
@@ -4805,16 +4799,16 @@ static void write_cdef(
         ? !!(mi_col & mask) + 2 * !!(mi_row & mask)
         : 0;
 
-    if (p_pcs_ptr->cdef_preset[index] == -1 && !skip) {
+    if (tile_ptr->cdef_preset[index] == -1 && !skip) {
         aom_write_literal(w, mi->mbmi.cdef_strength, frm_hdr->CDEF_params.cdef_bits);
-        p_pcs_ptr->cdef_preset[index] = mi->mbmi.cdef_strength;
+        tile_ptr->cdef_preset[index] = mi->mbmi.cdef_strength;
     }
 }
 
-void av1_reset_loop_restoration(PictureControlSet     *piCSetPtr) {
+void av1_reset_loop_restoration(EntropyCodingTile *tile_ptr) {
     for (int32_t p = 0; p < 3; ++p) {
-        set_default_wiener(piCSetPtr->wiener_info + p);
-        set_default_sgrproj(piCSetPtr->sgrproj_info + p);
+        set_default_wiener(tile_ptr->wiener_info + p);
+        set_default_sgrproj(tile_ptr->sgrproj_info + p);
     }
 }
 static void write_wiener_filter(int32_t wiener_win, const WienerInfo *wiener_info,
@@ -4892,7 +4886,7 @@ static void write_sgrproj_filter(const SgrprojInfo *sgrproj_info,
 
     memcpy(ref_sgrproj_info, sgrproj_info, sizeof(*sgrproj_info));
 }
-static void loop_restoration_write_sb_coeffs(PictureControlSet     *piCSetPtr, FRAME_CONTEXT           *frameContext, const Av1Common *const cm,
+static void loop_restoration_write_sb_coeffs(EntropyCodingTile *tile_ptr, FRAME_CONTEXT           *frameContext, const Av1Common *const cm,
     //MacroBlockD *xd,
     const RestorationUnitInfo *rui,
     AomWriter *const w, int32_t plane/*,
@@ -4906,8 +4900,8 @@ static void loop_restoration_write_sb_coeffs(PictureControlSet     *piCSetPtr, F
 //    assert(!cm->all_lossless);
 
     const int32_t wiener_win = (plane > 0) ? WIENER_WIN_CHROMA : WIENER_WIN;
-    WienerInfo *wiener_info = piCSetPtr->wiener_info + plane;
-    SgrprojInfo *sgrproj_info = piCSetPtr->sgrproj_info + plane;
+    WienerInfo *wiener_info = tile_ptr->wiener_info + plane;
+    SgrprojInfo *sgrproj_info = tile_ptr->sgrproj_info + plane;
     RestorationType unit_rtype = rui->restoration_type;
 
     assert(unit_rtype < CDF_SIZE(RESTORE_SWITCHABLE_TYPES));
@@ -4960,8 +4954,8 @@ static void loop_restoration_write_sb_coeffs(PictureControlSet     *piCSetPtr, F
 }
 
 EbErrorType ec_update_neighbors(
-    PictureControlSet     *picture_control_set_ptr,
     EntropyCodingContext  *context_ptr,
+    EntropyCodingTile     *tile_ptr,
     uint32_t                 blkOriginX,
     uint32_t                 blkOriginY,
     CodingUnit            *cu_ptr,
@@ -4970,16 +4964,16 @@ EbErrorType ec_update_neighbors(
 {
     UNUSED(coeff_ptr);
     EbErrorType return_error = EB_ErrorNone;
-    NeighborArrayUnit     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array;
-    NeighborArrayUnit     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array;
-    NeighborArrayUnit     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array;
-    NeighborArrayUnit     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array;
-    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *inter_pred_dir_neighbor_array = picture_control_set_ptr->inter_pred_dir_neighbor_array;
-    NeighborArrayUnit     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array;
-    NeighborArrayUnit32   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array;
+    NeighborArrayUnit     *mode_type_neighbor_array = tile_ptr->mode_type_neighbor_array;
+    NeighborArrayUnit     *partition_context_neighbor_array = tile_ptr->partition_context_neighbor_array;
+    NeighborArrayUnit     *skip_flag_neighbor_array = tile_ptr->skip_flag_neighbor_array;
+    NeighborArrayUnit     *skip_coeff_neighbor_array = tile_ptr->skip_coeff_neighbor_array;
+    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = tile_ptr->luma_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = tile_ptr->cr_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = tile_ptr->cb_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *inter_pred_dir_neighbor_array = tile_ptr->inter_pred_dir_neighbor_array;
+    NeighborArrayUnit     *ref_frame_type_neighbor_array = tile_ptr->ref_frame_type_neighbor_array;
+    NeighborArrayUnit32   *interpolation_type_neighbor_array = tile_ptr->interpolation_type_neighbor_array;
     const BlockGeom         *blk_geom = get_blk_geom_mds(cu_ptr->mds_idx);
     EbBool                   skipCoeff = EB_FALSE;
     PartitionContext         partition;
@@ -5696,11 +5690,11 @@ int av1_neg_interleave(int x, int ref, int max) {
 }
 
 
-int av1_get_pred_context_seg_id(PictureControlSet *picture_control_set_ptr,
+int av1_get_pred_context_seg_id(EntropyCodingTile *tile_ptr,
                                 CodingUnit *cu_ptr,
                                 uint32_t blkOriginX,
                                 uint32_t blkOriginY) {
-    NeighborArrayUnit *seg_id_pred_neighbor_array = picture_control_set_ptr->segmentation_id_pred_array;
+    NeighborArrayUnit *seg_id_pred_neighbor_array = tile_ptr->segmentation_id_pred_array;
     uint32_t top_idx = get_neighbor_array_unit_top_index(seg_id_pred_neighbor_array, blkOriginX);
     uint32_t left_idx = get_neighbor_array_unit_left_index(seg_id_pred_neighbor_array, blkOriginY);
 
@@ -5709,13 +5703,13 @@ int av1_get_pred_context_seg_id(PictureControlSet *picture_control_set_ptr,
     return above_pred + left_pred;
 }
 
-AomCdfProb *av1_get_pred_cdf_seg_id(PictureControlSet *picture_control_set_ptr,
+AomCdfProb *av1_get_pred_cdf_seg_id(EntropyCodingTile *tile_ptr,
                                       FRAME_CONTEXT *frameContext,
                                       CodingUnit *cu_ptr,
                                       uint32_t blkOriginX,
                                       uint32_t blkOriginY) {
     struct segmentation_probs *segp = &frameContext->seg;
-    return segp->spatial_pred_seg_cdf[av1_get_pred_context_seg_id(picture_control_set_ptr, cu_ptr, blkOriginX, blkOriginY)];
+    return segp->spatial_pred_seg_cdf[av1_get_pred_context_seg_id(tile_ptr, cu_ptr, blkOriginX, blkOriginY)];
 }
 
 static INLINE void update_segmentation_map(PictureControlSet *picture_control_set_ptr,
@@ -5838,28 +5832,29 @@ void write_inter_segment_id(PictureControlSet *picture_control_set_ptr,
 EbErrorType write_modes_b(
     PictureControlSet     *picture_control_set_ptr,
     EntropyCodingContext  *context_ptr,
-    EntropyCoder          *entropy_coder_ptr,
+    EntropyCodingTile     *tile_ptr,
     LargestCodingUnit     *tb_ptr,
     CodingUnit            *cu_ptr,
     EbPictureBufferDesc   *coeff_ptr)
 {
     UNUSED(tb_ptr);
     EbErrorType return_error = EB_ErrorNone;
+    EntropyCoder           *entropy_coder_ptr = tile_ptr->entropy_coder_ptr;
     FRAME_CONTEXT           *frameContext = entropy_coder_ptr->fc;
     AomWriter              *ec_writer = &entropy_coder_ptr->ec_writer;
     SequenceControlSet     *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
     FrameHeader *frm_hdr = &picture_control_set_ptr->parent_pcs_ptr->frm_hdr;
 
-    NeighborArrayUnit     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array;
-    NeighborArrayUnit     *intra_luma_mode_neighbor_array = picture_control_set_ptr->intra_luma_mode_neighbor_array;
-    NeighborArrayUnit     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array;
-    NeighborArrayUnit     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array;
-    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array;
-    NeighborArrayUnit32   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array;
-    NeighborArrayUnit     *txfm_context_array = picture_control_set_ptr->txfm_context_array;
+    NeighborArrayUnit     *mode_type_neighbor_array = tile_ptr->mode_type_neighbor_array;
+    NeighborArrayUnit     *intra_luma_mode_neighbor_array = tile_ptr->intra_luma_mode_neighbor_array;
+    NeighborArrayUnit     *skip_flag_neighbor_array = tile_ptr->skip_flag_neighbor_array;
+    NeighborArrayUnit     *skip_coeff_neighbor_array = tile_ptr->skip_coeff_neighbor_array;
+    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = tile_ptr->luma_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = tile_ptr->cr_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = tile_ptr->cb_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *ref_frame_type_neighbor_array = tile_ptr->ref_frame_type_neighbor_array;
+    NeighborArrayUnit32   *interpolation_type_neighbor_array = tile_ptr->interpolation_type_neighbor_array;
+    NeighborArrayUnit     *txfm_context_array = tile_ptr->txfm_context_array;
     const BlockGeom          *blk_geom = get_blk_geom_mds(cu_ptr->mds_idx);
     uint32_t blkOriginX = context_ptr->sb_origin_x + blk_geom->origin_x;
     uint32_t blkOriginY = context_ptr->sb_origin_y + blk_geom->origin_y;
@@ -5909,6 +5904,7 @@ assert(bsize < BlockSizeS_ALL);
         write_cdef(
             sequence_control_set_ptr,
             picture_control_set_ptr,
+            tile_ptr,
             cu_ptr->av1xd,
             ec_writer,
             skipCoeff,
@@ -6056,6 +6052,7 @@ assert(bsize < BlockSizeS_ALL);
         write_cdef(
             sequence_control_set_ptr,
             picture_control_set_ptr, /*cm,*/
+            tile_ptr,
             cu_ptr->av1xd,
             ec_writer,
             cu_ptr->skip_flag ? 1 : skipCoeff,
@@ -6310,8 +6307,8 @@ assert(bsize < BlockSizeS_ALL);
     }
     // Update the neighbors
     ec_update_neighbors(
-        picture_control_set_ptr,
         context_ptr,
+        tile_ptr,
         blkOriginX,
         blkOriginY,
         cu_ptr,
@@ -6327,14 +6324,15 @@ EB_EXTERN EbErrorType write_sb(
     EntropyCodingContext  *context_ptr,
     LargestCodingUnit     *tb_ptr,
     PictureControlSet     *picture_control_set_ptr,
-    EntropyCoder          *entropy_coder_ptr,
+    EntropyCodingTile     *tile_ptr,
     EbPictureBufferDesc   *coeff_ptr)
 {
     EbErrorType return_error = EB_ErrorNone;
+    EntropyCoder           *entropy_coder_ptr = tile_ptr->entropy_coder_ptr;
     FRAME_CONTEXT           *frameContext = entropy_coder_ptr->fc;
     AomWriter              *ec_writer = &entropy_coder_ptr->ec_writer;
     SequenceControlSet     *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-    NeighborArrayUnit     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array;
+    NeighborArrayUnit     *partition_context_neighbor_array = tile_ptr->partition_context_neighbor_array;
 
     // CU Varaiables
     const BlockGeom          *blk_geom;
@@ -6401,7 +6399,7 @@ EB_EXTERN EbErrorType write_sb(
                                 const int32_t runit_idx = tile_tl_idx + rcol + rrow * rstride;
                                 const RestorationUnitInfo *rui =
                                     &cm->rst_info[plane].unit_info[runit_idx];
-                                loop_restoration_write_sb_coeffs(picture_control_set_ptr, frameContext, cm, /*xd,*/ rui, ec_writer, plane);
+                                loop_restoration_write_sb_coeffs(tile_ptr, frameContext, cm, /*xd,*/ rui, ec_writer, plane);
                             }
                         }
                     }
@@ -6424,7 +6422,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6434,7 +6432,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6445,7 +6443,7 @@ EB_EXTERN EbErrorType write_sb(
                     write_modes_b(
                         picture_control_set_ptr,
                         context_ptr,
-                        entropy_coder_ptr,
+                        tile_ptr,
                         tb_ptr,
                         cu_ptr,
                         coeff_ptr);
@@ -6456,7 +6454,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6466,7 +6464,7 @@ EB_EXTERN EbErrorType write_sb(
                     write_modes_b(
                         picture_control_set_ptr,
                         context_ptr,
-                        entropy_coder_ptr,
+                        tile_ptr,
                         tb_ptr,
                         cu_ptr,
                         coeff_ptr);
@@ -6478,7 +6476,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6488,7 +6486,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6498,7 +6496,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6508,7 +6506,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6518,7 +6516,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6528,7 +6526,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6538,7 +6536,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6548,7 +6546,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6558,7 +6556,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6568,7 +6566,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6578,7 +6576,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6588,7 +6586,7 @@ EB_EXTERN EbErrorType write_sb(
                 write_modes_b(
                     picture_control_set_ptr,
                     context_ptr,
-                    entropy_coder_ptr,
+                    tile_ptr,
                     tb_ptr,
                     cu_ptr,
                     coeff_ptr);
@@ -6606,7 +6604,7 @@ EB_EXTERN EbErrorType write_sb(
                     write_modes_b(
                         picture_control_set_ptr,
                         context_ptr,
-                        entropy_coder_ptr,
+                        tile_ptr,
                         tb_ptr,
                         cu_ptr,
                         coeff_ptr);
@@ -6623,7 +6621,7 @@ EB_EXTERN EbErrorType write_sb(
                     write_modes_b(
                         picture_control_set_ptr,
                         context_ptr,
-                        entropy_coder_ptr,
+                        tile_ptr,
                         tb_ptr,
                         cu_ptr,
                         coeff_ptr);
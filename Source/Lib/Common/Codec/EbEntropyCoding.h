@@ -39,6 +39,7 @@ extern "C" {
 
 #define MAX_TILE_WIDTH (4096)        // Max Tile width in pixels
 #define MAX_TILE_AREA (4096 * 2304)  // Maximum tile area in pixels
+#define AV1_MIN_TILE_SIZE_BYTES 1
     /**************************************
      * Extern Function Declarations
      **************************************/
@@ -47,7 +48,7 @@ extern "C" {
         struct EntropyCodingContext   *context_ptr,
         LargestCodingUnit     *tb_ptr,
         PictureControlSet     *picture_control_set_ptr,
-        EntropyCoder          *entropy_coder_ptr,
+        EntropyCodingTile     *tile_ptr,
         EbPictureBufferDesc   *coeff_ptr);
 
     extern EbErrorType encode_slice_finish(
@@ -25,7 +25,6 @@ extern "C" {
         FRAME_CONTEXT   *fc;              /* this frame entropy */
         AomWriter       ec_writer;
         EbPtr           ec_output_bitstream_ptr;
-        uint64_t   ec_frame_size;
     } EntropyCoder;
 
     extern EbErrorType bitstream_ctor(
@@ -21,10 +21,7 @@
 #include "EbEntropyCodingResults.h"
 #include "EbRateControlTasks.h"
 
-#define  AV1_MIN_TILE_SIZE_BYTES 1
-void av1_reset_loop_restoration(PictureControlSet     *piCSetPtr);
-void av1_tile_set_col(TileInfo *tile, PictureParentControlSet * pcs_ptr, int col);
-void av1_tile_set_row(TileInfo *tile, PictureParentControlSet * pcs_ptr, int row);
+void av1_reset_loop_restoration(EntropyCodingTile *tile_ptr);
 
 /******************************************************
  * Enc Dec Context Constructor
@@ -49,25 +46,25 @@ EbErrorType entropy_coding_context_ctor(
 /***********************************************
  * Entropy Coding Reset Neighbor Arrays
  ***********************************************/
-static void EntropyCodingResetNeighborArrays(PictureControlSet *picture_control_set_ptr)
+static void EntropyCodingResetNeighborArrays(EntropyCodingTile *tile_ptr)
 {
-    neighbor_array_unit_reset(picture_control_set_ptr->mode_type_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->mode_type_neighbor_array);
 
-    neighbor_array_unit_reset(picture_control_set_ptr->partition_context_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->partition_context_neighbor_array);
 
-    neighbor_array_unit_reset(picture_control_set_ptr->skip_flag_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->skip_flag_neighbor_array);
 
-    neighbor_array_unit_reset(picture_control_set_ptr->skip_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->inter_pred_dir_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->ref_frame_type_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->skip_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->luma_dc_sign_level_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->cb_dc_sign_level_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->cr_dc_sign_level_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->inter_pred_dir_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->ref_frame_type_neighbor_array);
 
-    neighbor_array_unit_reset(picture_control_set_ptr->intra_luma_mode_neighbor_array);
-    neighbor_array_unit_reset32(picture_control_set_ptr->interpolation_type_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->txfm_context_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->segmentation_id_pred_array);
+    neighbor_array_unit_reset(tile_ptr->intra_luma_mode_neighbor_array);
+    neighbor_array_unit_reset32(tile_ptr->interpolation_type_neighbor_array);
+    neighbor_array_unit_reset(tile_ptr->txfm_context_array);
+    neighbor_array_unit_reset(tile_ptr->segmentation_id_pred_array);
     return;
 }
 
@@ -158,6 +155,92 @@ void av1_build_nmv_cost_table(int32_t *mvjoint, int32_t *mvcost[2],
     build_nmv_component_cost_table(mvcost[1], &ctx->comps[1], precision);
 }
 
+/**************************************************
+ * Frame Context Ready
+ *   Frame end CDF update: returns EB_FALSE, and queues the
+ *   input on the primary_ref_frame, while the entropy coding
+ *   of the primary_ref_frame is not complete
+ **************************************************/
+static EbBool frame_context_ready(
+    PictureControlSet     *picture_control_set_ptr,
+    EbObjectWrapper       *input_wrapper_ptr)
+{
+    EbBool ready;
+
+    if (picture_control_set_ptr->parent_pcs_ptr->frm_hdr.primary_ref_frame == PRIMARY_REF_NONE)
+        return EB_TRUE;
+
+    EbReferenceObject *ref_obj_l0 = (EbReferenceObject*)picture_control_set_ptr->ref_pic_ptr_array[REF_LIST_0][0]->object_ptr;
+    eb_block_on_mutex(ref_obj_l0->frame_context_mutex);
+    ready = ref_obj_l0->frame_context_done;
+    if (!ready) {
+        input_wrapper_ptr->next_ptr = ref_obj_l0->frame_context_waiting;
+        ref_obj_l0->frame_context_waiting = input_wrapper_ptr;
+    }
+    eb_release_mutex(ref_obj_l0->frame_context_mutex);
+
+    return ready;
+}
+
+/**************************************************
+ * Reset Frame Context
+ *   Default CDFs, or with frame end CDF update the CDFs the
+ *   primary_ref_frame ended with, see frame_context_ready
+ **************************************************/
+static void reset_frame_context(
+    EntropyCoder          *entropy_coder_ptr,
+    uint32_t               entropy_coding_qp,
+    PictureControlSet     *picture_control_set_ptr,
+    SequenceControlSet    *sequence_control_set_ptr)
+{
+    if (picture_control_set_ptr->parent_pcs_ptr->frm_hdr.primary_ref_frame == PRIMARY_REF_NONE)
+        reset_entropy_coder(
+            sequence_control_set_ptr->encode_context_ptr,
+            entropy_coder_ptr,
+            entropy_coding_qp,
+            picture_control_set_ptr->slice_type);
+    else {
+        EbReferenceObject *ref_obj_l0 = (EbReferenceObject*)picture_control_set_ptr->ref_pic_ptr_array[REF_LIST_0][0]->object_ptr;
+        *entropy_coder_ptr->fc = *ref_obj_l0->frame_context;
+    }
+}
+
+/**************************************************
+ * Save Frame Context
+ *   Frame end CDF update: keep the CDFs of tile
+ *   context_update_tile_id (0) with the reference of the picture,
+ *   and post again the inputs of the pictures waiting for them
+ **************************************************/
+static void save_frame_context(
+    PictureControlSet     *picture_control_set_ptr,
+    SequenceControlSet    *sequence_control_set_ptr)
+{
+    PictureParentControlSet *parent_pcs_ptr = picture_control_set_ptr->parent_pcs_ptr;
+
+    if (!sequence_control_set_ptr->static_config.frame_end_cdf_update || !parent_pcs_ptr->is_used_as_reference_flag)
+        return;
+
+    EbReferenceObject *reference_object = (EbReferenceObject*)parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr;
+    EbObjectWrapper *waiting_wrapper_ptr;
+    *reference_object->frame_context = *picture_control_set_ptr->entropy_coding_tile_array[0]->entropy_coder_ptr->fc;
+    av1_reset_cdf_symbol_counters(reference_object->frame_context);
+    eb_block_on_mutex(reference_object->frame_context_mutex);
+    reference_object->frame_context_done = EB_TRUE;
+    waiting_wrapper_ptr = reference_object->frame_context_waiting;
+    reference_object->frame_context_waiting = EB_NULL;
+    eb_release_mutex(reference_object->frame_context_mutex);
+
+    while (waiting_wrapper_ptr != EB_NULL) {
+        EbObjectWrapper *next_wrapper_ptr = waiting_wrapper_ptr->next_ptr;
+        waiting_wrapper_ptr->next_ptr = EB_NULL;
+        eb_post_full_object(waiting_wrapper_ptr);
+        waiting_wrapper_ptr = next_wrapper_ptr;
+    }
+
+    // Release the live count taken by the restoration for the CDFs
+    eb_release_object(parent_pcs_ptr->reference_picture_wrapper_ptr);
+}
+
 /**************************************************
  * Reset Entropy Coding Picture
  **************************************************/
@@ -220,25 +303,25 @@ static void ResetEntropyCodingPicture(
 
     // ADD Reset here
 
-    reset_entropy_coder(
-        sequence_control_set_ptr->encode_context_ptr,
+    reset_frame_context(
         picture_control_set_ptr->entropy_coder_ptr,
         entropyCodingQp,
-        picture_control_set_ptr->slice_type);
+        picture_control_set_ptr,
+        sequence_control_set_ptr);
 
-    EntropyCodingResetNeighborArrays(picture_control_set_ptr);
+    EntropyCodingResetNeighborArrays(picture_control_set_ptr->entropy_coding_tile_array[0]);
 
     return;
 }
 
 static void reset_ec_tile(
-    uint32_t  total_size,
-    uint32_t  is_last_tile_in_tg,
+    EntropyCodingTile     *tile_ptr,
     EntropyCodingContext  *context_ptr,
     PictureControlSet     *picture_control_set_ptr,
     SequenceControlSet    *sequence_control_set_ptr)
 {
-    reset_bitstream(entropy_coder_get_bitstream_ptr(picture_control_set_ptr->entropy_coder_ptr));
+    EntropyCoder *entropy_coder_ptr = tile_ptr->entropy_coder_ptr;
+    reset_bitstream(entropy_coder_get_bitstream_ptr(entropy_coder_ptr));
 
     uint32_t                       entropy_coding_qp;
 
@@ -258,11 +341,6 @@ static void reset_ec_tile(
         entropy_coding_qp = frm_hdr->quantization_params.base_q_idx;
     else
         entropy_coding_qp = frm_hdr->quantization_params.base_q_idx;
-    // Reset CABAC Contexts
-    // Reset QP Assignement
-    picture_control_set_ptr->prev_coded_qp = picture_control_set_ptr->picture_qp;
-    picture_control_set_ptr->prev_quant_group_coded_qp = picture_control_set_ptr->picture_qp;
-
 #if ADD_DELTA_QP_SUPPORT //PART 0
     picture_control_set_ptr->parent_pcs_ptr->prev_qindex = picture_control_set_ptr->parent_pcs_ptr->quant_param.base_q_idx;
     if (picture_control_set_ptr->parent_pcs_ptr->allow_intrabc)
@@ -281,28 +359,26 @@ static void reset_ec_tile(
 #endif
 
     // pass the ent
-    OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)(picture_control_set_ptr->entropy_coder_ptr->ec_output_bitstream_ptr);
+    OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)(entropy_coder_ptr->ec_output_bitstream_ptr);
     //****************************************************************//
 
-    uint8_t *data = output_bitstream_ptr->buffer_av1 + total_size;
-    picture_control_set_ptr->entropy_coder_ptr->ec_writer.allow_update_cdf = !picture_control_set_ptr->parent_pcs_ptr->large_scale_tile;
-    picture_control_set_ptr->entropy_coder_ptr->ec_writer.allow_update_cdf =
-        picture_control_set_ptr->entropy_coder_ptr->ec_writer.allow_update_cdf && !frm_hdr->disable_cdf_update;
-
-    //if not last tile, advance buffer by 4B to leave space for tile Size
-    if (is_last_tile_in_tg == 0)
-        data += 4;
+    // Each tile is coded at the start of its own bitstream, the tile sizes
+    // are inserted when the tiles are concatenated in packetization
+    uint8_t *data = output_bitstream_ptr->buffer_av1;
+    entropy_coder_ptr->ec_writer.allow_update_cdf = !picture_control_set_ptr->parent_pcs_ptr->large_scale_tile;
+    entropy_coder_ptr->ec_writer.allow_update_cdf =
+        entropy_coder_ptr->ec_writer.allow_update_cdf && !frm_hdr->disable_cdf_update;
 
-    aom_start_encode(&picture_control_set_ptr->entropy_coder_ptr->ec_writer, data);
+    aom_start_encode(&entropy_coder_ptr->ec_writer, data);
 
     //reset probabilities
-    reset_entropy_coder(
-        sequence_control_set_ptr->encode_context_ptr,
-        picture_control_set_ptr->entropy_coder_ptr,
+    reset_frame_context(
+        entropy_coder_ptr,
         entropy_coding_qp,
-        picture_control_set_ptr->slice_type);
+        picture_control_set_ptr,
+        sequence_control_set_ptr);
 
-    EntropyCodingResetNeighborArrays(picture_control_set_ptr);
+    EntropyCodingResetNeighborArrays(tile_ptr);
 
     return;
 }
@@ -416,9 +492,12 @@ static EbBool UpdateEntropyCodingRows(
 }
 
 /******************************************************
- * Entropy Coding Kernel
+ * Entropy Coding Task
+ *   Processes one input object of the Entropy Coding process and
+ *   releases it. Called by entropy_coding_kernel, or directly by the
+ *   encoder task scheduler when the task pool is enabled.
  ******************************************************/
-void* entropy_coding_kernel(void *input_ptr)
+void entropy_coding_task(void *input_ptr, EbObjectWrapper *rest_results_wrapper_ptr)
 {
     // Context & SCS & PCS
     EntropyCodingContext                  *context_ptr = (EntropyCodingContext*)input_ptr;
@@ -426,8 +505,7 @@ void* entropy_coding_kernel(void *input_ptr)
     SequenceControlSet                    *sequence_control_set_ptr;
 
     // Input
-    EbObjectWrapper                       *encDecResultsWrapperPtr;
-    EncDecResults                         *encDecResultsPtr;
+    RestResults                           *rest_results_ptr;
 
     // Output
     EbObjectWrapper                       *entropyCodingResultsWrapperPtr;
@@ -445,245 +523,258 @@ void* entropy_coding_kernel(void *input_ptr)
     uint32_t                                   picture_width_in_sb;
     // Variables
     EbBool                                  initialProcessCall;
-    for (;;) {
-        // Get Mode Decision Results
-        eb_get_full_object(
-            context_ptr->enc_dec_input_fifo_ptr,
-            &encDecResultsWrapperPtr);
-        encDecResultsPtr = (EncDecResults*)encDecResultsWrapperPtr->object_ptr;
-        picture_control_set_ptr = (PictureControlSet*)encDecResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
-        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-        // SB Constants
 
-        sb_sz = (uint8_t)sequence_control_set_ptr->sb_size_pix;
+    rest_results_ptr = (RestResults*)rest_results_wrapper_ptr->object_ptr;
+    picture_control_set_ptr = (PictureControlSet*)rest_results_ptr->picture_control_set_wrapper_ptr->object_ptr;
+    sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+
+    // Posted again once the CDFs of the primary_ref_frame are saved
+    if (!frame_context_ready(picture_control_set_ptr, rest_results_wrapper_ptr))
+        return;
+
+    // SB Constants
 
-        lcuSizeLog2 = (uint8_t)Log2f(sb_sz);
-        context_ptr->sb_sz = sb_sz;
-        picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sb_sz - 1) >> lcuSizeLog2;
-        if(picture_control_set_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_cols * picture_control_set_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_rows == 1)
+    sb_sz = (uint8_t)sequence_control_set_ptr->sb_size_pix;
 
+    lcuSizeLog2 = (uint8_t)Log2f(sb_sz);
+    context_ptr->sb_sz = sb_sz;
+    picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sb_sz - 1) >> lcuSizeLog2;
+    if(picture_control_set_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_cols * picture_control_set_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_rows == 1)
+
+    {
+        initialProcessCall = EB_TRUE;
+        y_lcu_index = rest_results_ptr->completed_lcu_row_index_start;
+
+        // LCU-loops
+        while (UpdateEntropyCodingRows(picture_control_set_ptr, &y_lcu_index, rest_results_ptr->completed_lcu_row_count, &initialProcessCall) == EB_TRUE)
         {
-            initialProcessCall = EB_TRUE;
-            y_lcu_index = encDecResultsPtr->completed_lcu_row_index_start;
+            uint32_t rowTotalBits = 0;
+
+            if (y_lcu_index == 0) {
+                ResetEntropyCodingPicture(
+                    context_ptr,
+                    picture_control_set_ptr,
+                    sequence_control_set_ptr);
+                picture_control_set_ptr->entropy_coding_pic_done = EB_FALSE;
+            }
 
-            // LCU-loops
-            while (UpdateEntropyCodingRows(picture_control_set_ptr, &y_lcu_index, encDecResultsPtr->completed_lcu_row_count, &initialProcessCall) == EB_TRUE)
+            for (x_lcu_index = 0; x_lcu_index < picture_width_in_sb; ++x_lcu_index)
             {
-                uint32_t rowTotalBits = 0;
+                sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
+                sb_ptr = picture_control_set_ptr->sb_ptr_array[sb_index];
+
+                sb_origin_x = x_lcu_index << lcuSizeLog2;
+                sb_origin_y = y_lcu_index << lcuSizeLog2;
+                context_ptr->sb_origin_x = sb_origin_x;
+                context_ptr->sb_origin_y = sb_origin_y;
+                if (sb_index == 0)
+                    av1_reset_loop_restoration(picture_control_set_ptr->entropy_coding_tile_array[0]);
+                // Configure the LCU
+                EntropyCodingConfigureLcu(
+                    context_ptr,
+                    sb_ptr,
+                    picture_control_set_ptr);
+                sb_ptr->total_bits = 0;
+                uint32_t prev_pos = sb_index ? picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs : 0;//residual_bc.pos
+                EbPictureBufferDesc *coeff_picture_ptr = sb_ptr->quantized_coeff;
+                write_sb(
+                    context_ptr,
+                    sb_ptr,
+                    picture_control_set_ptr,
+                    picture_control_set_ptr->entropy_coding_tile_array[0],
+                    coeff_picture_ptr);
+                sb_ptr->total_bits = (picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs - prev_pos) << 3;
+                picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += sb_ptr->total_bits;
+                rowTotalBits += sb_ptr->total_bits;
+            }
 
-                if (y_lcu_index == 0) {
-                    ResetEntropyCodingPicture(
-                        context_ptr,
+            // At the end of each LCU-row, send the updated bit-count to Entropy Coding
+            {
+                EbObjectWrapper *rateControlTaskWrapperPtr;
+                RateControlTasks *rateControlTaskPtr;
+
+                // Get Empty EncDec Results
+                eb_get_empty_object(
+                    context_ptr->rate_control_output_fifo_ptr,
+                    &rateControlTaskWrapperPtr);
+                rateControlTaskPtr = (RateControlTasks*)rateControlTaskWrapperPtr->object_ptr;
+                rateControlTaskPtr->task_type = RC_ENTROPY_CODING_ROW_FEEDBACK_RESULT;
+                rateControlTaskPtr->picture_number = picture_control_set_ptr->picture_number;
+                rateControlTaskPtr->row_number = y_lcu_index;
+                rateControlTaskPtr->bit_count = rowTotalBits;
+
+                rateControlTaskPtr->picture_control_set_wrapper_ptr = 0;
+                rateControlTaskPtr->segment_index = ~0u;
+
+                // Post EncDec Results
+                eb_post_full_object(rateControlTaskWrapperPtr);
+            }
+
+            eb_block_on_mutex(picture_control_set_ptr->entropy_coding_mutex);
+            if (picture_control_set_ptr->entropy_coding_pic_done == EB_FALSE) {
+                // If the picture is complete, terminate the slice
+                if (picture_control_set_ptr->entropy_coding_current_row == picture_control_set_ptr->entropy_coding_row_count)
+                {
+                    uint32_t ref_idx;
+
+                    picture_control_set_ptr->entropy_coding_pic_done = EB_TRUE;
+
+                    encode_slice_finish(picture_control_set_ptr->entropy_coder_ptr);
+
+                    save_frame_context(
                         picture_control_set_ptr,
                         sequence_control_set_ptr);
-                    picture_control_set_ptr->entropy_coding_pic_done = EB_FALSE;
-                }
 
-                for (x_lcu_index = 0; x_lcu_index < picture_width_in_sb; ++x_lcu_index)
+                    // Release the List 0 Reference Pictures
+                    for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++ref_idx) {
+                        if (picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx] != EB_NULL) {
+
+                            eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx]);
+                        }
+                    }
+
+                    // Release the List 1 Reference Pictures
+                    for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++ref_idx) {
+                        if (picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx] != EB_NULL)
+                            eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx]);
+                    }
+
+                    // Get Empty Entropy Coding Results
+                    eb_get_empty_object(
+                        context_ptr->entropy_coding_output_fifo_ptr,
+                        &entropyCodingResultsWrapperPtr);
+                    entropyCodingResultsPtr = (EntropyCodingResults*)entropyCodingResultsWrapperPtr->object_ptr;
+                    entropyCodingResultsPtr->picture_control_set_wrapper_ptr = rest_results_ptr->picture_control_set_wrapper_ptr;
+
+                    // Post EntropyCoding Results
+                    eb_post_full_object(entropyCodingResultsWrapperPtr);
+                } // End if(PictureCompleteFlag)
+            }
+            eb_release_mutex(picture_control_set_ptr->entropy_coding_mutex);
+        }
+    }
+    else
+    {
+        Av1Common *const cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+        const uint16_t tile_cols = (uint16_t)cm->tiles_info.tile_cols;
+        const uint16_t tile_count = (uint16_t)(tile_cols * cm->tiles_info.tile_rows);
+        const uint16_t tile_idx_end = (uint16_t)(rest_results_ptr->tile_index_start + rest_results_ptr->tile_count);
+        uint16_t tile_idx;
+        uint64_t tile_bits = 0;
+        EbBool pic_done;
+
+        assert(tile_count <= picture_control_set_ptr->entropy_coding_tile_count);
+
+        // Entropy Tile Loop, each tile of the job is coded in its own bitstream
+        for (tile_idx = (uint16_t)rest_results_ptr->tile_index_start; tile_idx < tile_idx_end; ++tile_idx)
+        {
+            EntropyCodingTile *tile_ptr = picture_control_set_ptr->entropy_coding_tile_array[tile_idx];
+            const int tile_row = tile_idx / tile_cols;
+            const int tile_col = tile_idx % tile_cols;
+
+            reset_ec_tile(
+                tile_ptr,
+                context_ptr,
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+
+            av1_reset_loop_restoration(tile_ptr);
+
+            for (y_lcu_index = cm->tiles_info.tile_row_start_sb[tile_row]; y_lcu_index < (uint32_t)cm->tiles_info.tile_row_start_sb[tile_row + 1]; ++y_lcu_index)
+            {
+                for (x_lcu_index = cm->tiles_info.tile_col_start_sb[tile_col]; x_lcu_index < (uint32_t)cm->tiles_info.tile_col_start_sb[tile_col + 1]; ++x_lcu_index)
                 {
                     sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
                     sb_ptr = picture_control_set_ptr->sb_ptr_array[sb_index];
-
                     sb_origin_x = x_lcu_index << lcuSizeLog2;
                     sb_origin_y = y_lcu_index << lcuSizeLog2;
                     context_ptr->sb_origin_x = sb_origin_x;
                     context_ptr->sb_origin_y = sb_origin_y;
-                    if (sb_index == 0)
-                        av1_reset_loop_restoration(picture_control_set_ptr);
                     // Configure the LCU
                     EntropyCodingConfigureLcu(
                         context_ptr,
                         sb_ptr,
                         picture_control_set_ptr);
                     sb_ptr->total_bits = 0;
-                    uint32_t prev_pos = sb_index ? picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs : 0;//residual_bc.pos
+                    uint32_t prev_pos = tile_ptr->entropy_coder_ptr->ec_writer.ec.offs;//residual_bc.pos
                     EbPictureBufferDesc *coeff_picture_ptr = sb_ptr->quantized_coeff;
                     write_sb(
                         context_ptr,
                         sb_ptr,
                         picture_control_set_ptr,
-                        picture_control_set_ptr->entropy_coder_ptr,
+                        tile_ptr,
                         coeff_picture_ptr);
-                    sb_ptr->total_bits = (picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs - prev_pos) << 3;
-                    picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += sb_ptr->total_bits;
-                    rowTotalBits += sb_ptr->total_bits;
+                    sb_ptr->total_bits = (tile_ptr->entropy_coder_ptr->ec_writer.ec.offs - prev_pos) << 3;
+                    tile_bits += sb_ptr->total_bits;
                 }
+            }
 
-                // At the end of each LCU-row, send the updated bit-count to Entropy Coding
-                {
-                    EbObjectWrapper *rateControlTaskWrapperPtr;
-                    RateControlTasks *rateControlTaskPtr;
-
-                    // Get Empty EncDec Results
-                    eb_get_empty_object(
-                        context_ptr->rate_control_output_fifo_ptr,
-                        &rateControlTaskWrapperPtr);
-                    rateControlTaskPtr = (RateControlTasks*)rateControlTaskWrapperPtr->object_ptr;
-                    rateControlTaskPtr->task_type = RC_ENTROPY_CODING_ROW_FEEDBACK_RESULT;
-                    rateControlTaskPtr->picture_number = picture_control_set_ptr->picture_number;
-                    rateControlTaskPtr->row_number = y_lcu_index;
-                    rateControlTaskPtr->bit_count = rowTotalBits;
-
-                    rateControlTaskPtr->picture_control_set_wrapper_ptr = 0;
-                    rateControlTaskPtr->segment_index = ~0u;
-
-                    // Post EncDec Results
-                    eb_post_full_object(rateControlTaskWrapperPtr);
-                }
+            encode_slice_finish(tile_ptr->entropy_coder_ptr);
 
-                eb_block_on_mutex(picture_control_set_ptr->entropy_coding_mutex);
-                if (picture_control_set_ptr->entropy_coding_pic_done == EB_FALSE) {
-                    // If the picture is complete, terminate the slice
-                    if (picture_control_set_ptr->entropy_coding_current_row == picture_control_set_ptr->entropy_coding_row_count)
-                    {
-                        uint32_t ref_idx;
+            tile_ptr->tile_size = tile_ptr->entropy_coder_ptr->ec_writer.pos;
+            assert(tile_ptr->tile_size >= AV1_MIN_TILE_SIZE_BYTES);
+        }
 
-                        picture_control_set_ptr->entropy_coding_pic_done = EB_TRUE;
+        eb_block_on_mutex(picture_control_set_ptr->entropy_coding_mutex);
+        picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += tile_bits;
+        picture_control_set_ptr->entropy_coding_tile_done_count += (uint16_t)rest_results_ptr->tile_count;
+        pic_done = (EbBool)(picture_control_set_ptr->entropy_coding_tile_done_count == tile_count);
+        eb_release_mutex(picture_control_set_ptr->entropy_coding_mutex);
 
-                        encode_slice_finish(picture_control_set_ptr->entropy_coder_ptr);
+        // The job completing the last tile terminates the picture
+        if (pic_done)
+        {
+            uint32_t ref_idx;
 
-                        // Release the List 0 Reference Pictures
-                        for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++ref_idx) {
-                            if (picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx] != EB_NULL) {
+            save_frame_context(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
 
-                                eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx]);
-                            }
-                        }
+            // Release the List 0 Reference Pictures
+            for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++ref_idx) {
+                if (picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx] != EB_NULL)
+                    eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx]);
+            }
 
-                        // Release the List 1 Reference Pictures
-                        for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++ref_idx) {
-                            if (picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx] != EB_NULL)
-                                eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx]);
-                        }
+            // Release the List 1 Reference Pictures
+            for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++ref_idx) {
+                if (picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx] != EB_NULL)
+                    eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx]);
+            }
 
-                        // Get Empty Entropy Coding Results
-                        eb_get_empty_object(
-                            context_ptr->entropy_coding_output_fifo_ptr,
-                            &entropyCodingResultsWrapperPtr);
-                        entropyCodingResultsPtr = (EntropyCodingResults*)entropyCodingResultsWrapperPtr->object_ptr;
-                        entropyCodingResultsPtr->picture_control_set_wrapper_ptr = encDecResultsPtr->picture_control_set_wrapper_ptr;
+            // Get Empty Entropy Coding Results
+            eb_get_empty_object(
+                context_ptr->entropy_coding_output_fifo_ptr,
+                &entropyCodingResultsWrapperPtr);
+            entropyCodingResultsPtr = (EntropyCodingResults*)entropyCodingResultsWrapperPtr->object_ptr;
+            entropyCodingResultsPtr->picture_control_set_wrapper_ptr = rest_results_ptr->picture_control_set_wrapper_ptr;
 
-                        // Post EntropyCoding Results
-                        eb_post_full_object(entropyCodingResultsWrapperPtr);
-                    } // End if(PictureCompleteFlag)
-                }
-                eb_release_mutex(picture_control_set_ptr->entropy_coding_mutex);
-            }
+            // Post EntropyCoding Results
+            eb_post_full_object(entropyCodingResultsWrapperPtr);
         }
-        else
-        {
-             struct PictureParentControlSet     *ppcs_ptr = picture_control_set_ptr->parent_pcs_ptr;
-             Av1Common *const cm = ppcs_ptr->av1_cm;
-             uint32_t total_size = 0;
-             int tile_row, tile_col;
-             const int tile_cols = ppcs_ptr->av1_cm->tiles_info.tile_cols;
-             const int tile_rows = ppcs_ptr->av1_cm->tiles_info.tile_rows;
-
-             //Entropy Tile Loop
-             for (tile_row = 0; tile_row < tile_rows; tile_row++)
-             {
-                 TileInfo tile_info;
-                 av1_tile_set_row(&tile_info, ppcs_ptr, tile_row);
-
-                 for (tile_col = 0; tile_col < tile_cols; tile_col++)
-                 {
-                     const int tile_idx = tile_row * tile_cols + tile_col;
-                     uint32_t is_last_tile_in_tg = 0;
-
-                     if ( tile_idx == (tile_cols * tile_rows - 1))
-                         is_last_tile_in_tg = 1;
-                     else
-                         is_last_tile_in_tg = 0;
-                     reset_ec_tile(
-                         total_size,
-                         is_last_tile_in_tg,
-                         context_ptr,
-                         picture_control_set_ptr,
-                         sequence_control_set_ptr);
-
-                     av1_tile_set_col(&tile_info, ppcs_ptr, tile_col);
-
-                     av1_reset_loop_restoration(picture_control_set_ptr);
-
-                     for (y_lcu_index = cm->tiles_info.tile_row_start_sb[tile_row]; y_lcu_index < (uint32_t)cm->tiles_info.tile_row_start_sb[tile_row + 1]; ++y_lcu_index)
-                     {
-                         for (x_lcu_index = cm->tiles_info.tile_col_start_sb[tile_col]; x_lcu_index < (uint32_t)cm->tiles_info.tile_col_start_sb[tile_col + 1]; ++x_lcu_index)
-                         {
-                             int sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
-                             sb_ptr = picture_control_set_ptr->sb_ptr_array[sb_index];
-                             sb_origin_x = x_lcu_index << lcuSizeLog2;
-                             sb_origin_y = y_lcu_index << lcuSizeLog2;
-                             context_ptr->sb_origin_x = sb_origin_x;
-                             context_ptr->sb_origin_y = sb_origin_y;
-                             // Configure the LCU
-                             EntropyCodingConfigureLcu(
-                                 context_ptr,
-                                 sb_ptr,
-                                 picture_control_set_ptr);
-                             sb_ptr->total_bits = 0;
-                             uint32_t prev_pos = sb_index ? picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs : 0;//residual_bc.pos
-                             EbPictureBufferDesc *coeff_picture_ptr = sb_ptr->quantized_coeff;
-                             write_sb(
-                                 context_ptr,
-                                 sb_ptr,
-                                 picture_control_set_ptr,
-                                 picture_control_set_ptr->entropy_coder_ptr,
-                                 coeff_picture_ptr);
-                             sb_ptr->total_bits = (picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs - prev_pos) << 3;
-                             picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += sb_ptr->total_bits;
-                         }
-                     }
-
-                     encode_slice_finish(picture_control_set_ptr->entropy_coder_ptr);
-
-                     int tile_size = picture_control_set_ptr->entropy_coder_ptr->ec_writer.pos;
-                     assert(tile_size >= AV1_MIN_TILE_SIZE_BYTES);
-
-                     if (!is_last_tile_in_tg) {
-                         OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)(picture_control_set_ptr->entropy_coder_ptr->ec_output_bitstream_ptr);
-                         uint8_t *buf_data = output_bitstream_ptr->buffer_av1 + total_size;
-                         mem_put_le32(buf_data, tile_size - AV1_MIN_TILE_SIZE_BYTES);
-                     }
-
-                     if (is_last_tile_in_tg==0)
-                         total_size += 4;
-
-                     total_size += tile_size;
-                 }
-             }
-
-             //the picture is complete, terminate the slice
-             {
-                 uint32_t ref_idx;
-                 picture_control_set_ptr->entropy_coder_ptr->ec_frame_size = total_size;
-
-                 // Release the List 0 Reference Pictures
-                 for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++ref_idx) {
-                     if (picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx] != EB_NULL)
-                         eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx]);
-                 }
-
-                 // Release the List 1 Reference Pictures
-                 for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++ref_idx) {
-                     if (picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx] != EB_NULL)
-                         eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx]);
-                 }
-
-                 // Get Empty Entropy Coding Results
-                 eb_get_empty_object(
-                     context_ptr->entropy_coding_output_fifo_ptr,
-                     &entropyCodingResultsWrapperPtr);
-                 entropyCodingResultsPtr = (EntropyCodingResults*)entropyCodingResultsWrapperPtr->object_ptr;
-                 entropyCodingResultsPtr->picture_control_set_wrapper_ptr = encDecResultsPtr->picture_control_set_wrapper_ptr;
-
-                 // Post EntropyCoding Results
-                 eb_post_full_object(entropyCodingResultsWrapperPtr);
-             }
-        }
-
-        // Release Mode Decision Results
-        eb_release_object(encDecResultsWrapperPtr);
     }
 
+    // Release Rest Results
+    eb_release_object(rest_results_wrapper_ptr);
+}
+
+/******************************************************
+ * Entropy Coding Kernel
+ ******************************************************/
+void* entropy_coding_kernel(void *input_ptr)
+{
+    EntropyCodingContext                  *context_ptr = (EntropyCodingContext*)input_ptr;
+    EbObjectWrapper                       *rest_results_wrapper_ptr;
+
+    for (;;) {
+        // Get Rest Results
+        eb_get_full_object(
+            context_ptr->enc_dec_input_fifo_ptr,
+            &rest_results_wrapper_ptr);
+
+        entropy_coding_task(
+            input_ptr,
+            rest_results_wrapper_ptr);
+    }
     return EB_NULL;
 }
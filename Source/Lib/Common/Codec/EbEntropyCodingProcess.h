@@ -85,6 +85,8 @@ extern EbErrorType entropy_coding_context_ctor(
     EbFifo                *rate_control_output_fifo_ptr,
     EbBool                   is16bit);
 
+extern void entropy_coding_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
+
 extern void* entropy_coding_kernel(void *input_ptr);
 
 #endif // EbEntropyCodingProcess_h
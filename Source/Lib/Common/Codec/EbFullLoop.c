@@ -1160,6 +1160,24 @@ static INLINE int get_lower_levels_ctx_eob(int bwl, int height, int scan_idx) {
     if (scan_idx <= (height << bwl) / 4) return 2;
     return 3;
 }
+// Reference for av1_get_nz_map_contexts: the nz-map contexts of a whole
+// transform block, in the same form as the writer and the rate estimation
+// consume them (indexed by raster position, valid for scan positions < eob).
+void av1_get_nz_map_contexts_c(
+    const uint8_t *const levels,
+    const int16_t *const scan,
+    const uint16_t eob,
+    const TxSize tx_size,
+    const TxClass tx_class,
+    int8_t *const coeff_contexts) {
+    const int bwl = get_txb_bwl(tx_size);
+    const int height = get_txb_high(tx_size);
+    for (int i = 0; i < eob; ++i) {
+        const int pos = scan[i];
+        coeff_contexts[pos] = (int8_t)get_lower_levels_ctx_general(
+            i == eob - 1, i, bwl, height, levels, pos, tx_size, tx_class);
+    }
+}
 
 static INLINE int32_t get_br_ctx(const uint8_t *const levels,
     const int32_t c,  // raster order
@@ -1800,6 +1818,47 @@ static INLINE void set_dc_sign(int32_t *cul_level, int32_t dc_val) {
     else if (dc_val > 0)
         *cul_level += 2 << COEFF_CONTEXT_BITS;
 }
+/****************************************
+ * RDOQ cache: the same coefficients are often quantized several times within
+ * a SB (full loop, tx search, inter depth tx search, then the encode pass);
+ * the cache is emptied at the start of every SB in mode_decision_sb()
+ ****************************************/
+static const RdoqCacheEntry *rdoq_cache_lookup(
+    ModeDecisionContext *md_context,
+    const RdoqCacheKey  *key,
+    const int32_t       *coeff,
+    int32_t              n_coeffs)
+{
+    md_context->rdoq_cache_lookup_count++;
+    for (uint32_t i = 0; i < md_context->rdoq_cache_count; i++) {
+        const RdoqCacheKey *entry_key = &md_context->rdoq_cache_key[i];
+        if (entry_key->crc == key->crc &&
+            !memcmp(entry_key, key, sizeof(*key)) &&
+            !memcmp(md_context->rdoq_cache[i].coeff, coeff, n_coeffs * sizeof(*coeff))) {
+            md_context->rdoq_cache_hit_count++;
+            return &md_context->rdoq_cache[i];
+        }
+    }
+    return NULL;
+}
+static void rdoq_cache_store(
+    ModeDecisionContext *md_context,
+    const RdoqCacheKey  *key,
+    const int32_t       *coeff,
+    const int32_t       *quant_coeff,
+    const int32_t       *recon_coeff,
+    int32_t              n_coeffs,
+    uint16_t             eob)
+{
+    RdoqCacheEntry *entry = &md_context->rdoq_cache[md_context->rdoq_cache_next];
+    md_context->rdoq_cache_key[md_context->rdoq_cache_next] = *key;
+    md_context->rdoq_cache_next = (md_context->rdoq_cache_next + 1) % RDOQ_CACHE_SIZE;
+    md_context->rdoq_cache_count = MIN(md_context->rdoq_cache_count + 1, RDOQ_CACHE_SIZE);
+    entry->eob = eob;
+    memcpy(entry->coeff, coeff, n_coeffs * sizeof(*coeff));
+    memcpy(entry->quant_coeff, quant_coeff, n_coeffs * sizeof(*quant_coeff));
+    memcpy(entry->recon_coeff, recon_coeff, n_coeffs * sizeof(*recon_coeff));
+}
 int32_t av1_quantize_inv_quantize(
     PictureControlSet           *picture_control_set_ptr,
     ModeDecisionContext         *md_context,
@@ -1931,7 +1990,33 @@ int32_t av1_quantize_inv_quantize(
     // Hsan: set to FALSE until adding x86 quantize_fp
     EbBool perform_quantize_fp = picture_control_set_ptr->enc_mode == ENC_M0 ? EB_TRUE: EB_FALSE;
 
-    if (perform_rdoq && perform_quantize_fp && !is_inter)
+    RdoqCacheKey rdoq_cache_key;
+    const RdoqCacheEntry *rdoq_cache_entry = NULL;
+    if (perform_rdoq && n_coeffs >= 64) {
+        assert(n_coeffs <= RDOQ_CACHE_MAX_COEFFS);
+        memset(&rdoq_cache_key, 0, sizeof(rdoq_cache_key));
+        rdoq_cache_key.crc = av1_get_crc32c_value_c(
+            &md_context->rdoq_cache_crc,
+            (uint8_t*)coeff,
+            n_coeffs * sizeof(*coeff));
+        rdoq_cache_key.full_lambda = md_context->full_lambda;
+        rdoq_cache_key.md_rate_estimation_ptr = md_context->md_rate_estimation_ptr;
+        rdoq_cache_key.q_index = (uint16_t)qIndex;
+        rdoq_cache_key.txb_skip_context = txb_skip_context;
+        rdoq_cache_key.dc_sign_context = dc_sign_context;
+        rdoq_cache_key.tx_size = (uint8_t)txsize;
+        rdoq_cache_key.tx_type = (uint8_t)tx_type;
+        rdoq_cache_key.is_inter = (uint8_t)is_inter;
+        rdoq_cache_key.bit_increment = (uint8_t)bit_increment;
+        rdoq_cache_entry = rdoq_cache_lookup(md_context, &rdoq_cache_key, coeff, n_coeffs);
+    }
+
+    if (rdoq_cache_entry) {
+        memcpy(quant_coeff, rdoq_cache_entry->quant_coeff, n_coeffs * sizeof(*quant_coeff));
+        memcpy(recon_coeff, rdoq_cache_entry->recon_coeff, n_coeffs * sizeof(*recon_coeff));
+        *eob = rdoq_cache_entry->eob;
+    }
+    else if (perform_rdoq && perform_quantize_fp && !is_inter)
         av1_quantize_fp_facade(
             (TranLow*)coeff,
             n_coeffs,
@@ -1966,7 +2051,7 @@ int32_t av1_quantize_inv_quantize(
                 scan_order,
                 &qparam);
 
-    if (perform_rdoq && *eob != 0) {
+    if (perform_rdoq && !rdoq_cache_entry && *eob != 0) {
 
         // Perform Trellis
         if (*eob != 0) {
@@ -1990,6 +2075,8 @@ int32_t av1_quantize_inv_quantize(
                 (component_type == COMPONENT_LUMA) ? 0 : 1);
         }
     }
+    if (perform_rdoq && n_coeffs >= 64 && !rdoq_cache_entry)
+        rdoq_cache_store(md_context, &rdoq_cache_key, coeff, quant_coeff, recon_coeff, n_coeffs, *eob);
 
 
     *count_non_zero_coeffs = *eob;
@@ -2144,7 +2231,7 @@ void product_full_loop(
 
             EbSpatialFullDistType spatial_full_dist_type_fun = picture_control_set_ptr->hbd_mode_decision ?
                 full_distortion_kernel16_bits :
-                spatial_full_distortion_kernel_func_ptr_array[asm_type];
+                spatial_full_distortion_kernel;
 
             tuFullDistortion[0][DIST_CALC_PREDICTION] = spatial_full_dist_type_fun(
                 input_picture_ptr->buffer_y,
@@ -2455,7 +2542,7 @@ void product_full_loop_tx_search(
                 uint32_t input_tu_origin_index = (context_ptr->sb_origin_x + txb_origin_x + input_picture_ptr->origin_x) + ((context_ptr->sb_origin_y + txb_origin_y + input_picture_ptr->origin_y) * input_picture_ptr->stride_y);
 
                 EbSpatialFullDistType spatial_full_dist_type_fun = picture_control_set_ptr->hbd_mode_decision ?
-                    full_distortion_kernel16_bits : spatial_full_distortion_kernel_func_ptr_array[asm_type];
+                    full_distortion_kernel16_bits : spatial_full_distortion_kernel;
 
                 tuFullDistortion[0][DIST_CALC_PREDICTION] = spatial_full_dist_type_fun(
                     input_picture_ptr->buffer_y,
@@ -3350,7 +3437,7 @@ void cu_full_distortion_fast_tu_mode_r(
                 uint32_t tu_uv_origin_index = (((txb_origin_x >> 3) << 3) + (((txb_origin_y >> 3) << 3) * candidateBuffer->residual_quant_coeff_ptr->stride_cb)) >> 1;
 
                 EbSpatialFullDistType spatial_full_dist_type_fun = picture_control_set_ptr->hbd_mode_decision ?
-                    full_distortion_kernel16_bits : spatial_full_distortion_kernel_func_ptr_array[asm_type];
+                    full_distortion_kernel16_bits : spatial_full_distortion_kernel;
 
                 tuFullDistortion[1][DIST_CALC_PREDICTION] = spatial_full_dist_type_fun(
                     input_picture_ptr->buffer_cb,
@@ -16,6 +16,7 @@
 #include "EbMotionEstimationContext.h"
 #include "EbUtility.h"
 #include "EbReferenceObject.h"
+#include "EbLadder.h"
 
 /**************************************
 * Macros
@@ -1324,6 +1325,29 @@ void* initial_rate_control_kernel(void *input_ptr)
             //reset intraCodedEstimationLcu
             MeBasedGlobalMotionDetection(
                 picture_control_set_ptr);
+            // Publish the SB MVs of the picture to the predictive full-pel
+            // search of the pictures referencing it
+            {
+                EbPaReferenceObject *pa_reference_object = (EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
+                pa_reference_object->me_mv_distance = (picture_control_set_ptr->slice_type == I_SLICE) ? 0 :
+                    (int64_t)picture_control_set_ptr->picture_number - (int64_t)picture_control_set_ptr->ref_pic_poc_array[REF_LIST_0][0];
+                pa_reference_object->me_mv_done = EB_TRUE;
+                eb_post_semaphore(pa_reference_object->me_mv_done_semaphore);
+            }
+            // Hand the motion of the leader of a ladder to the followers, or
+            // release it in a follower
+            if (encode_context_ptr->ladder && !picture_control_set_ptr->is_overlay) {
+                if (encode_context_ptr->ladder_rendition_index == 0)
+                    eb_ladder_publish_motion(
+                        encode_context_ptr->ladder,
+                        picture_control_set_ptr,
+                        sequence_control_set_ptr->mrp_mode);
+                else
+                    eb_ladder_release(
+                        encode_context_ptr->ladder,
+                        encode_context_ptr->ladder_rendition_index,
+                        picture_control_set_ptr->picture_number);
+            }
             // Release Pa Ref pictures when not needed
             ReleasePaReferenceObjects(
                 sequence_control_set_ptr,
@@ -1560,6 +1584,9 @@ void* initial_rate_control_kernel(void *input_ptr)
                         eb_get_empty_object(
                             sequence_control_set_ptr->encode_context_ptr->reference_picture_pool_fifo_ptr,
                             &reference_picture_wrapper_ptr);
+                        // Rearm the frame context of a recycled reference, all its
+                        // readers are done once it is back in the pool
+                        ((EbReferenceObject*)reference_picture_wrapper_ptr->object_ptr)->frame_context_done = EB_FALSE;
                         if (loop_index) {
                             picture_control_set_ptr->reference_picture_wrapper_ptr = reference_picture_wrapper_ptr;
                             // Give the new Reference a nominal live_count of 1
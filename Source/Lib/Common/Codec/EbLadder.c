@@ -0,0 +1,328 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "EbLadder.h"
+#include "EbUtility.h"
+#include "EbMotionEstimationLcuResults.h"
+
+static void eb_ladder_dctor(EbPtr p)
+{
+    EbSvtLadder *ladder = (EbSvtLadder*)p;
+    uint32_t slot_index, rendition_index;
+
+    if (ladder->slot) {
+        for (slot_index = 0; slot_index < LADDER_SLOT_COUNT; slot_index++) {
+            LadderSlot *slot = &ladder->slot[slot_index];
+            if (slot->free_semaphore)
+                EB_DESTROY_SEMAPHORE(slot->free_semaphore);
+            for (rendition_index = 0; rendition_index < ladder->rendition_count; rendition_index++) {
+                if (slot->scene_change_semaphore[rendition_index])
+                    EB_DESTROY_SEMAPHORE(slot->scene_change_semaphore[rendition_index]);
+                if (slot->motion_semaphore[rendition_index])
+                    EB_DESTROY_SEMAPHORE(slot->motion_semaphore[rendition_index]);
+                EB_FREE_ARRAY(slot->motion_field[rendition_index].sb_mv[0]);
+            }
+            EB_FREE_ARRAY(slot->leader_mv[0]);
+        }
+        EB_FREE_ARRAY(ladder->slot);
+    }
+    EB_DESTROY_MUTEX(ladder->slot_mutex);
+}
+
+/*****************************************
+ * eb_ladder_ctor
+ *****************************************/
+EbErrorType eb_ladder_ctor(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_count)
+{
+    uint32_t slot_index, rendition_index;
+
+    ladder->dctor = eb_ladder_dctor;
+    ladder->rendition_count = rendition_count;
+
+    EB_CREATE_MUTEX(ladder->slot_mutex);
+    EB_CALLOC_ARRAY(ladder->slot, LADDER_SLOT_COUNT);
+    for (slot_index = 0; slot_index < LADDER_SLOT_COUNT; slot_index++) {
+        LadderSlot *slot = &ladder->slot[slot_index];
+        EB_CREATE_SEMAPHORE(slot->free_semaphore, 1, 1);
+        for (rendition_index = 1; rendition_index < rendition_count; rendition_index++) {
+            EB_CREATE_SEMAPHORE(slot->scene_change_semaphore[rendition_index], 0, 1);
+            EB_CREATE_SEMAPHORE(slot->motion_semaphore[rendition_index], 0, 1);
+        }
+    }
+    return EB_ErrorNone;
+}
+
+/*****************************************
+ * eb_ladder_join
+ *   Allocates the motion of the slots at the size of the rendition: the ME
+ *   MVs for the leader, the converted field for a follower
+ *****************************************/
+EbErrorType eb_ladder_join(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint32_t     width,
+    uint32_t     height,
+    uint32_t     sb_sz)
+{
+    const uint32_t sb_count = ((width + sb_sz - 1) / sb_sz) * ((height + sb_sz - 1) / sb_sz);
+    uint32_t slot_index, ref_index;
+
+    if (rendition_index >= ladder->rendition_count || ladder->joined[rendition_index])
+        return EB_ErrorBadParameter;
+
+    for (slot_index = 0; slot_index < LADDER_SLOT_COUNT; slot_index++) {
+        LadderSlot *slot = &ladder->slot[slot_index];
+        if (rendition_index == 0) {
+            EB_MALLOC_ARRAY(slot->leader_mv[0], sb_count * EB_MAX_MOTION_FIELD_REFS);
+            for (ref_index = 1; ref_index < EB_MAX_MOTION_FIELD_REFS; ref_index++)
+                slot->leader_mv[ref_index] = slot->leader_mv[0] + ref_index * sb_count;
+        }
+        else {
+            ExternalMotionField *motion_field = &slot->motion_field[rendition_index];
+            EB_MALLOC_ARRAY(motion_field->sb_mv[0], sb_count * EB_MAX_MOTION_FIELD_REFS);
+            for (ref_index = 1; ref_index < EB_MAX_MOTION_FIELD_REFS; ref_index++)
+                motion_field->sb_mv[ref_index] = motion_field->sb_mv[0] + ref_index * sb_count;
+        }
+    }
+    ladder->width[rendition_index] = width;
+    ladder->height[rendition_index] = height;
+    ladder->sb_sz[rendition_index] = sb_sz;
+    eb_block_on_mutex(ladder->slot_mutex);
+    ladder->joined[rendition_index] = EB_TRUE;
+    eb_release_mutex(ladder->slot_mutex);
+
+    return EB_ErrorNone;
+}
+
+/*****************************************
+ * eb_ladder_is_complete
+ *   True once every rendition has joined. The leader publishes to, and
+ *   waits for, all the followers, so no rendition may start encoding
+ *   before then.
+ *****************************************/
+EbBool eb_ladder_is_complete(
+    EbSvtLadder *ladder)
+{
+    EbBool complete = EB_TRUE;
+    uint32_t rendition_index;
+
+    eb_block_on_mutex(ladder->slot_mutex);
+    for (rendition_index = 0; rendition_index < ladder->rendition_count; rendition_index++)
+        complete = complete && ladder->joined[rendition_index];
+    eb_release_mutex(ladder->slot_mutex);
+
+    return complete;
+}
+
+// Field MVs sampled per SB: MOTION_FIELD_SB_POINTS x MOTION_FIELD_SB_POINTS
+// points at the center of the SB sub-blocks
+#define MOTION_FIELD_SB_POINTS 4
+
+static int16_t median_mv(
+    int16_t  *mv,
+    uint32_t  count)
+{
+    uint32_t i, j;
+
+    for (i = 1; i < count; i++) {
+        const int16_t value = mv[i];
+        for (j = i; j > 0 && mv[j - 1] > value; j--)
+            mv[j] = mv[j - 1];
+        mv[j] = value;
+    }
+    return mv[count >> 1];
+}
+
+/***********************************************
+**** Converts a motion field to one MV per SB and
+**** field reference: the median of the field MVs
+**** sampled over the SB, scaled to the size
+**** (width x height) of the encoded pictures
+************************************************/
+void eb_convert_motion_field(
+    ExternalMotionField      *dst,
+    const EbSvtMotionField   *src,
+    uint32_t                  width,
+    uint32_t                  height,
+    uint32_t                  sb_sz)
+{
+    const uint32_t picture_width_in_sb = (width + sb_sz - 1) / sb_sz;
+    const uint32_t picture_height_in_sb = (height + sb_sz - 1) / sb_sz;
+    int16_t x_mv[MOTION_FIELD_SB_POINTS * MOTION_FIELD_SB_POINTS];
+    int16_t y_mv[MOTION_FIELD_SB_POINTS * MOTION_FIELD_SB_POINTS];
+    uint32_t ref_index, sb_x, sb_y, i, j, count;
+
+    for (ref_index = 0; ref_index < src->ref_count; ref_index++) {
+        for (sb_y = 0; sb_y < picture_height_in_sb; sb_y++) {
+            for (sb_x = 0; sb_x < picture_width_in_sb; sb_x++) {
+                count = 0;
+                for (j = 0; j < MOTION_FIELD_SB_POINTS; j++) {
+                    for (i = 0; i < MOTION_FIELD_SB_POINTS; i++) {
+                        const uint32_t x = MIN(sb_x * sb_sz + (2 * i + 1) * sb_sz / (2 * MOTION_FIELD_SB_POINTS), width - 1);
+                        const uint32_t y = MIN(sb_y * sb_sz + (2 * j + 1) * sb_sz / (2 * MOTION_FIELD_SB_POINTS), height - 1);
+                        const uint32_t field_x = (uint32_t)((uint64_t)x * src->width / width);
+                        const uint32_t field_y = (uint32_t)((uint64_t)y * src->height / height);
+                        const EbSvtMotionVector *mv = &src->mv[ref_index][
+                            (field_y / src->block_size) * src->stride + field_x / src->block_size];
+                        x_mv[count] = (int16_t)CLIP3(INT16_MIN, INT16_MAX, (int32_t)mv->x * (int32_t)width / (int32_t)src->width);
+                        y_mv[count] = (int16_t)CLIP3(INT16_MIN, INT16_MAX, (int32_t)mv->y * (int32_t)height / (int32_t)src->height);
+                        count++;
+                    }
+                }
+                dst->sb_mv[ref_index][sb_x + sb_y * picture_width_in_sb] =
+                    ((uint32_t)(uint16_t)median_mv(y_mv, count) << 16) |
+                    (uint16_t)median_mv(x_mv, count);
+            }
+        }
+        dst->ref_distance[ref_index] = src->ref_distance[ref_index];
+    }
+    dst->ref_count = src->ref_count;
+    dst->refine_only = src->refine_only ? EB_TRUE : EB_FALSE;
+    dst->valid = EB_TRUE;
+}
+
+/*****************************************
+ * eb_ladder_publish_scene_change
+ *   Called by the picture decision of the leader once the scene change of
+ *   a picture is decided. Waits for the followers to be done with the
+ *   picture LADDER_SLOT_COUNT pictures back.
+ *****************************************/
+void eb_ladder_publish_scene_change(
+    EbSvtLadder *ladder,
+    uint64_t     picture_number,
+    EbBool       scene_change_flag)
+{
+    LadderSlot *slot = &ladder->slot[picture_number % LADDER_SLOT_COUNT];
+    uint32_t rendition_index;
+
+    assert(eb_ladder_is_complete(ladder));
+    eb_block_on_semaphore(slot->free_semaphore);
+    slot->picture_number = picture_number;
+    slot->scene_change_flag = scene_change_flag;
+    slot->pending_count = ladder->rendition_count - 1;
+    for (rendition_index = 1; rendition_index < ladder->rendition_count; rendition_index++)
+        eb_post_semaphore(slot->scene_change_semaphore[rendition_index]);
+}
+
+/*****************************************
+ * eb_ladder_publish_motion
+ *   Called by the initial rate control of the leader once the motion
+ *   estimation of a picture is complete: the 64x64 MVs of its references
+ *   are converted to the SBs of every follower
+ *****************************************/
+void eb_ladder_publish_motion(
+    EbSvtLadder                    *ladder,
+    const PictureParentControlSet  *picture_control_set_ptr,
+    uint8_t                         mrp_mode)
+{
+    LadderSlot *slot = &ladder->slot[picture_control_set_ptr->picture_number % LADDER_SLOT_COUNT];
+    const uint32_t picture_width_in_sb = (ladder->width[0] + ladder->sb_sz[0] - 1) / ladder->sb_sz[0];
+    const uint32_t picture_height_in_sb = (ladder->height[0] + ladder->sb_sz[0] - 1) / ladder->sb_sz[0];
+    EbSvtMotionField field;
+    uint32_t list_index, ref_pic_index, rendition_index, sb_index;
+
+    assert(slot->picture_number == picture_control_set_ptr->picture_number);
+
+    field.width = ladder->width[0];
+    field.height = ladder->height[0];
+    field.block_size = ladder->sb_sz[0];
+    field.stride = picture_width_in_sb;
+    field.ref_count = 0;
+    field.refine_only = 0;
+    if (picture_control_set_ptr->slice_type != I_SLICE) {
+        for (list_index = REF_LIST_0; list_index < MAX_NUM_OF_REF_PIC_LIST; list_index++) {
+            const uint32_t ref_count = (list_index == REF_LIST_0) ?
+                picture_control_set_ptr->ref_list0_count :
+                (picture_control_set_ptr->slice_type == B_SLICE) ? picture_control_set_ptr->ref_list1_count : 0;
+            for (ref_pic_index = 0; ref_pic_index < ref_count && field.ref_count < EB_MAX_MOTION_FIELD_REFS; ref_pic_index++) {
+                const uint32_t mv_index = ((list_index && mrp_mode == 0) ? 4 : list_index ? 2 : 0) + ref_pic_index;
+                EbSvtMotionVector *mv = slot->leader_mv[field.ref_count];
+                for (sb_index = 0; sb_index < picture_width_in_sb * picture_height_in_sb; sb_index++) {
+                    const MvCandidate *me_mv = &picture_control_set_ptr->me_results[sb_index]->me_mv_array[0][mv_index];
+                    mv[sb_index].x = me_mv->x_mv;
+                    mv[sb_index].y = me_mv->y_mv;
+                }
+                field.ref_distance[field.ref_count] = (int32_t)((int64_t)picture_control_set_ptr->picture_number -
+                    (int64_t)picture_control_set_ptr->ref_pic_poc_array[list_index][ref_pic_index]);
+                field.mv[field.ref_count++] = mv;
+            }
+        }
+    }
+
+    for (rendition_index = 1; rendition_index < ladder->rendition_count; rendition_index++) {
+        assert(ladder->joined[rendition_index]);
+        eb_convert_motion_field(
+            &slot->motion_field[rendition_index],
+            &field,
+            ladder->width[rendition_index],
+            ladder->height[rendition_index],
+            ladder->sb_sz[rendition_index]);
+        eb_post_semaphore(slot->motion_semaphore[rendition_index]);
+    }
+    if (ladder->rendition_count == 1)
+        eb_post_semaphore(slot->free_semaphore);
+}
+
+/*****************************************
+ * eb_ladder_get_scene_change
+ *   Called by the picture decision of a follower: waits for the scene
+ *   change decision of the leader
+ *****************************************/
+EbBool eb_ladder_get_scene_change(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint64_t     picture_number)
+{
+    LadderSlot *slot = &ladder->slot[picture_number % LADDER_SLOT_COUNT];
+
+    eb_block_on_semaphore(slot->scene_change_semaphore[rendition_index]);
+    assert(slot->picture_number == picture_number);
+    return slot->scene_change_flag;
+}
+
+/*****************************************
+ * eb_ladder_get_motion
+ *   Called by the motion estimation segments of a follower: waits for the
+ *   motion of the leader, converted to the SBs of the follower
+ *****************************************/
+const ExternalMotionField *eb_ladder_get_motion(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint64_t     picture_number)
+{
+    LadderSlot *slot = &ladder->slot[picture_number % LADDER_SLOT_COUNT];
+
+    eb_block_on_semaphore(slot->motion_semaphore[rendition_index]);
+    eb_post_semaphore(slot->motion_semaphore[rendition_index]);
+    assert(slot->picture_number == picture_number);
+    return &slot->motion_field[rendition_index];
+}
+
+/*****************************************
+ * eb_ladder_release
+ *   Called by the initial rate control of a follower once the motion
+ *   estimation of a picture is complete; the last follower frees the slot
+ *****************************************/
+void eb_ladder_release(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint64_t     picture_number)
+{
+    LadderSlot *slot = &ladder->slot[picture_number % LADDER_SLOT_COUNT];
+    uint32_t pending_count;
+
+    eb_block_on_semaphore(slot->motion_semaphore[rendition_index]);
+    assert(slot->picture_number == picture_number);
+    eb_block_on_mutex(ladder->slot_mutex);
+    pending_count = --slot->pending_count;
+    eb_release_mutex(ladder->slot_mutex);
+    if (pending_count == 0)
+        eb_post_semaphore(slot->free_semaphore);
+}
@@ -0,0 +1,114 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbLadder_h
+#define EbLadder_h
+
+#include "EbDefinitions.h"
+#include "EbSvtAv1Enc.h"
+#include "EbThreads.h"
+#include "EbObject.h"
+#include "EbPictureControlSet.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pictures the leader of a ladder may analyze ahead of the slowest
+// follower; larger than the pictures an encoder holds between picture
+// decision and initial rate control
+#define LADDER_SLOT_COUNT 128
+
+/**************************************
+ * Analysis of one picture of the leader
+ **************************************/
+typedef struct LadderSlot
+{
+    uint64_t                picture_number;
+    EbBool                  scene_change_flag;
+    // Posted once the followers are done with the picture of the slot
+    EbHandle                free_semaphore;
+    uint32_t                pending_count;
+    // Per follower: posted once the scene change decision, then the
+    // motion of the picture are published
+    EbHandle                scene_change_semaphore[EB_MAX_LADDER_RENDITIONS];
+    EbHandle                motion_semaphore[EB_MAX_LADDER_RENDITIONS];
+    // 64x64 ME MVs of the leader, then the motion converted to the SBs of
+    // each follower
+    EbSvtMotionVector      *leader_mv[EB_MAX_MOTION_FIELD_REFS];
+    ExternalMotionField     motion_field[EB_MAX_LADDER_RENDITIONS];
+} LadderSlot;
+
+/**************************************
+ * ABR ladder: encoders of renditions of the same source sharing the scene
+ * change decisions and the motion of the leader, rendition 0
+ **************************************/
+struct EbSvtLadder
+{
+    EbDctor                 dctor;
+    uint32_t                rendition_count;
+    EbBool                  joined[EB_MAX_LADDER_RENDITIONS];
+    uint32_t                width[EB_MAX_LADDER_RENDITIONS];
+    uint32_t                height[EB_MAX_LADDER_RENDITIONS];
+    uint32_t                sb_sz[EB_MAX_LADDER_RENDITIONS];
+    EbHandle                slot_mutex;
+    LadderSlot             *slot;
+};
+
+/**************************************
+ * Extern Function Declarations
+ **************************************/
+extern EbErrorType eb_ladder_ctor(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_count);
+
+extern EbErrorType eb_ladder_join(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint32_t     width,
+    uint32_t     height,
+    uint32_t     sb_sz);
+
+extern EbBool eb_ladder_is_complete(
+    EbSvtLadder *ladder);
+
+extern void eb_convert_motion_field(
+    ExternalMotionField      *dst,
+    const EbSvtMotionField   *src,
+    uint32_t                  width,
+    uint32_t                  height,
+    uint32_t                  sb_sz);
+
+// Leader
+extern void eb_ladder_publish_scene_change(
+    EbSvtLadder *ladder,
+    uint64_t     picture_number,
+    EbBool       scene_change_flag);
+
+extern void eb_ladder_publish_motion(
+    EbSvtLadder                    *ladder,
+    const PictureParentControlSet  *picture_control_set_ptr,
+    uint8_t                         mrp_mode);
+
+// Followers
+extern EbBool eb_ladder_get_scene_change(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint64_t     picture_number);
+
+extern const ExternalMotionField *eb_ladder_get_motion(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint64_t     picture_number);
+
+extern void eb_ladder_release(
+    EbSvtLadder *ladder,
+    uint32_t     rendition_index,
+    uint64_t     picture_number);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbLadder_h
@@ -8,6 +8,7 @@
 
 #include "EbMalloc.h"
 #include "EbThreads.h"
+#include "EbArena.h"
 
 #ifdef DEBUG_MEMORY_USAGE
 
@@ -343,6 +344,17 @@ void eb_print_memory_usage()
     printf("    mutex count: %d\r\n", (int)sum.amount[EB_MUTEX]);
     printf("    semaphore count: %d\r\n", (int)sum.amount[EB_SEMAPHORE]);
     printf("    thread count: %d\r\n", (int)sum.amount[EB_THREAD]);
+
+    EbArenaUsage arena;
+    eb_arena_get_usage(&arena);
+    get_memory_usage_and_scale(arena.reserved, &usage, &scale);
+    printf("    arena reserved memory:        %.2lf %cB in %u regions\r\n", usage, scale, arena.region_count);
+    get_memory_usage_and_scale(arena.in_use, &usage, &scale);
+    printf("        in use:                   %.2lf %cB\r\n", usage, scale);
+    get_memory_usage_and_scale(arena.amount[EB_N_PTR], &usage, &scale);
+    printf("        served to malloc:         %.2lf %cB\r\n", usage, scale);
+    get_memory_usage_and_scale(arena.amount[EB_C_PTR], &usage, &scale);
+    printf("        served to calloc:         %.2lf %cB\r\n", usage, scale);
     fulless = (double)sum.occupied / MEM_ENTRY_SIZE;
     printf("    hash table fulless: %f, hash bucket is %s\r\n", fulless, fulless < .3 ? "healthy":"too full" );
 #ifdef PROFILE_MEMORY_USAGE
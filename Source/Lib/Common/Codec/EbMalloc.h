@@ -10,6 +10,10 @@
 #include "EbSvtAv1Enc.h"
 #include "EbDefinitions.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #ifndef NDEBUG
 #define DEBUG_MEMORY_USAGE
 #endif
@@ -31,6 +35,12 @@ void eb_remove_mem_entry(void* ptr, EbPtrType type);
 
 #endif //DEBUG_MEMORY_USAGE
 
+/* malloc / calloc / free, small blocks come from the arena current on the
+   calling thread if any (see EbArena.h) */
+void* eb_malloc(size_t size);
+void* eb_calloc(size_t count, size_t size);
+void eb_free(void* ptr);
+
 #define EB_ADD_MEM(p, size, type) \
     do { \
         if (!p) { \
@@ -42,7 +52,7 @@ void eb_remove_mem_entry(void* ptr, EbPtrType type);
 
 #define EB_NO_THROW_MALLOC(pointer, size) \
     do { \
-        void* p = malloc(size); \
+        void* p = eb_malloc(size); \
         EB_ADD_MEM(p, size, EB_N_PTR); \
         *(void**)&(pointer) = p; \
     } while (0)
@@ -56,7 +66,7 @@ void eb_remove_mem_entry(void* ptr, EbPtrType type);
 
 #define EB_NO_THROW_CALLOC(pointer, count, size) \
     do { \
-        void* p = calloc(count, size); \
+        void* p = eb_calloc(count, size); \
         EB_ADD_MEM(p, count * size, EB_C_PTR); \
         *(void**)&(pointer) = p; \
     } while (0)
@@ -70,7 +80,7 @@ void eb_remove_mem_entry(void* ptr, EbPtrType type);
 
 #define EB_FREE(pointer) \
     do {\
-        free(pointer); \
+        eb_free(pointer); \
         EB_REMOVE_MEM_ENTRY(pointer, EB_N_PTR); \
         pointer = NULL; \
     } while (0)
@@ -184,5 +194,8 @@ void eb_print_memory_usage();
 void eb_increase_component_count();
 void eb_decrease_component_count();
 
+#ifdef __cplusplus
+}
+#endif
 
 #endif //EbMalloc_h
@@ -92,6 +92,8 @@ extern "C" {
         EbFifo                            *mode_decision_configuration_output_fifo_ptr,
         uint16_t                           sb_total_count);
 
+    extern void mode_decision_configuration_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
+
     extern void* mode_decision_configuration_kernel(void *input_ptr);
 #ifdef __cplusplus
 }
@@ -21,7 +21,7 @@ static void mode_decision_context_dctor(EbPtr p)
    }
 #endif
 
-    EB_DELETE_PTR_ARRAY(obj->candidate_buffer_ptr_array, (MAX_NFL + 1 + 1));
+    EB_DELETE_PTR_ARRAY(obj->candidate_buffer_ptr_array, (MAX_NFL + 1 + 1 + FAST_LOOP_BATCH_SIZE));
     EB_DELETE(obj->trans_quant_buffers_ptr);
     if (obj->hbd_mode_decision)
         EB_FREE_ALIGNED_ARRAY(obj->cfl_temp_luma_recon16bit);
@@ -50,6 +50,73 @@ static void mode_decision_context_dctor(EbPtr p)
     EB_FREE_ARRAY(obj->md_local_cu_unit);
     EB_FREE_ARRAY(obj->md_cu_arr_nsq);
     EB_FREE_ARRAY(obj->md_ep_pipe_sb);
+    EB_FREE_ARRAY(obj->rdoq_cache);
+    EB_FREE_ARRAY(obj->md_blk_recon);
+    EB_FREE_ARRAY(obj->md_blk_recon_samples);
+    EB_FREE_ARRAY(obj->md_blk_recon_coeffs);
+}
+
+/******************************************************
+ * Samples and coefficients kept for the winner of a block
+ ******************************************************/
+static void md_blk_recon_size(
+    const BlockGeom *blk_geom,
+    uint32_t        *luma_samples,
+    uint32_t        *chroma_samples,
+    uint32_t        *chroma_coeffs)
+{
+    *luma_samples = blk_geom->bwidth * blk_geom->bheight;
+    *chroma_samples = 0;
+    *chroma_coeffs = 0;
+    if (blk_geom->has_uv) {
+        *chroma_samples = blk_geom->bwidth_uv * blk_geom->bheight_uv;
+        // The chroma transforms of the first transform block
+        *chroma_coeffs = *chroma_samples;
+        for (uint32_t depth = 0; depth <= MAX_VARTX_DEPTH; depth++)
+            *chroma_coeffs = MAX(*chroma_coeffs, (uint32_t)blk_geom->tx_width_uv[depth][0] * blk_geom->tx_height_uv[depth][0]);
+    }
+}
+
+/******************************************************
+ * Carve the buffers of the block winners out of two slabs
+ ******************************************************/
+static EbErrorType md_blk_recon_ctor(ModeDecisionContext *context_ptr)
+{
+    uint32_t luma_samples, chroma_samples, chroma_coeffs;
+    size_t   sample_count = 0;
+    size_t   coeff_count = 0;
+    uint32_t blk_index;
+
+    for (blk_index = 0; blk_index < BLOCK_MAX_COUNT_SB_128; ++blk_index) {
+        md_blk_recon_size(get_blk_geom_mds(blk_index), &luma_samples, &chroma_samples, &chroma_coeffs);
+        // Prediction and reconstruction
+        sample_count += 2 * (luma_samples + 2 * chroma_samples);
+        // The luma transforms tile the block
+        coeff_count += luma_samples + 2 * chroma_coeffs;
+    }
+
+    EB_CALLOC_ARRAY(context_ptr->md_blk_recon, BLOCK_MAX_COUNT_SB_128);
+    EB_MALLOC_ARRAY(context_ptr->md_blk_recon_samples, sample_count);
+    EB_MALLOC_ARRAY(context_ptr->md_blk_recon_coeffs, coeff_count);
+
+    uint8_t *samples = context_ptr->md_blk_recon_samples;
+    int32_t *coeffs = context_ptr->md_blk_recon_coeffs;
+    for (blk_index = 0; blk_index < BLOCK_MAX_COUNT_SB_128; ++blk_index) {
+        MdBlockRecon *blk_recon = &context_ptr->md_blk_recon[blk_index];
+        md_blk_recon_size(get_blk_geom_mds(blk_index), &luma_samples, &chroma_samples, &chroma_coeffs);
+        blk_recon->pred[0] = samples;
+        blk_recon->pred[1] = blk_recon->pred[0] + luma_samples;
+        blk_recon->pred[2] = blk_recon->pred[1] + chroma_samples;
+        blk_recon->recon[0] = blk_recon->pred[2] + chroma_samples;
+        blk_recon->recon[1] = blk_recon->recon[0] + luma_samples;
+        blk_recon->recon[2] = blk_recon->recon[1] + chroma_samples;
+        samples = blk_recon->recon[2] + chroma_samples;
+        blk_recon->coeff[0] = coeffs;
+        blk_recon->coeff[1] = blk_recon->coeff[0] + luma_samples;
+        blk_recon->coeff[2] = blk_recon->coeff[1] + chroma_coeffs;
+        coeffs = blk_recon->coeff[2] + chroma_coeffs;
+    }
+    return EB_ErrorNone;
 }
 
 /******************************************************
@@ -60,7 +127,8 @@ EbErrorType mode_decision_context_ctor(
     EbColorFormat         color_format,
     EbFifo                *mode_decision_configuration_input_fifo_ptr,
     EbFifo                *mode_decision_output_fifo_ptr,
-    EbBool                 enable_hbd_mode_decision )
+    EbBool                 enable_hbd_mode_decision,
+    EbBool                 reuse_md_recon)
 {
     uint32_t bufferIndex;
     uint32_t candidateIndex;
@@ -107,16 +175,28 @@ EbErrorType mode_decision_context_ctor(
         context_ptr->trans_quant_buffers_ptr,
         eb_trans_quant_buffers_ctor);
 
+    // RDOQ Cache
+    EB_MALLOC_ARRAY(context_ptr->rdoq_cache, RDOQ_CACHE_SIZE);
+    av1_crc32c_calculator_init(&context_ptr->rdoq_cache_crc);
+
+    // Block Winners kept for the Encode Pass (8 bit MD only)
+    if (reuse_md_recon && !context_ptr->hbd_mode_decision) {
+        EbErrorType return_error = md_blk_recon_ctor(context_ptr);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
+
     // Cost Arrays
     // Hsan: MAX_NFL + 1 scratch buffer for intra + 1 scratch buffer for inter
-    EB_MALLOC_ARRAY(context_ptr->fast_cost_array, MAX_NFL + 1 + 1);
-    EB_MALLOC_ARRAY(context_ptr->full_cost_array, MAX_NFL + 1 + 1);
-    EB_MALLOC_ARRAY(context_ptr->full_cost_skip_ptr, MAX_NFL + 1 + 1);
-    EB_MALLOC_ARRAY(context_ptr->full_cost_merge_ptr, MAX_NFL + 1 + 1);
+    // + FAST_LOOP_BATCH_SIZE buffers holding the predictions of a fast loop batch
+    EB_MALLOC_ARRAY(context_ptr->fast_cost_array, MAX_NFL + 1 + 1 + FAST_LOOP_BATCH_SIZE);
+    EB_MALLOC_ARRAY(context_ptr->full_cost_array, MAX_NFL + 1 + 1 + FAST_LOOP_BATCH_SIZE);
+    EB_MALLOC_ARRAY(context_ptr->full_cost_skip_ptr, MAX_NFL + 1 + 1 + FAST_LOOP_BATCH_SIZE);
+    EB_MALLOC_ARRAY(context_ptr->full_cost_merge_ptr, MAX_NFL + 1 + 1 + FAST_LOOP_BATCH_SIZE);
     // Candidate Buffers
-    EB_ALLOC_PTR_ARRAY(context_ptr->candidate_buffer_ptr_array, (MAX_NFL + 1 + 1));
+    EB_ALLOC_PTR_ARRAY(context_ptr->candidate_buffer_ptr_array, (MAX_NFL + 1 + 1 + FAST_LOOP_BATCH_SIZE));
 
-    for (bufferIndex = 0; bufferIndex < (MAX_NFL + 1 + 1); ++bufferIndex) {
+    for (bufferIndex = 0; bufferIndex < (MAX_NFL + 1 + 1 + FAST_LOOP_BATCH_SIZE); ++bufferIndex) {
         EB_NEW(
             context_ptr->candidate_buffer_ptr_array[bufferIndex],
             mode_decision_candidate_buffer_ctor,
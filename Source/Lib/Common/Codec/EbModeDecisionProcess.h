@@ -17,6 +17,7 @@
 #include "EbReferenceObject.h"
 #include "EbNeighborArrays.h"
 #include "EbObject.h"
+#include "hash.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,6 +34,8 @@ extern "C" {
 #define DEPTH_ONE_STEP   21
 #define DEPTH_TWO_STEP    5
 #define DEPTH_THREE_STEP  1
+#define RDOQ_CACHE_SIZE            16
+#define RDOQ_CACHE_MAX_COEFFS      (32 * 32) // av1_get_max_eob() of the largest transforms
 
      /**************************************
       * Macros
@@ -42,6 +45,48 @@ extern "C" {
 #define GROUP_OF_4_16x16_BLOCKS(origin_x,origin_y) (((((origin_x >> 3) & 0x2) == 0x2) && (((origin_y >> 3) & 0x2) == 0x2)) ? EB_TRUE : EB_FALSE)
 #define GROUP_OF_4_32x32_BLOCKS(origin_x,origin_y) (((((origin_x >> 3) & 0x4) == 0x4) && (((origin_y >> 3) & 0x4) == 0x4)) ? EB_TRUE : EB_FALSE)
 
+      /**************************************
+       * RDOQ Cache
+       **************************************/
+    // Everything the quantization and RDOQ of a transform block depend on,
+    // besides the coefficients themselves (hashed in crc, compared in full)
+    typedef struct RdoqCacheKey
+    {
+        uint32_t                        crc;
+        uint32_t                        full_lambda;
+        const MdRateEstimationContext  *md_rate_estimation_ptr;
+        uint16_t                        q_index;
+        int16_t                         txb_skip_context;
+        int16_t                         dc_sign_context;
+        uint8_t                         tx_size;
+        uint8_t                         tx_type;
+        uint8_t                         is_inter;
+        uint8_t                         bit_increment;
+    } RdoqCacheKey;
+
+    typedef struct RdoqCacheEntry
+    {
+        uint16_t                        eob;
+        int32_t                         coeff[RDOQ_CACHE_MAX_COEFFS];
+        int32_t                         quant_coeff[RDOQ_CACHE_MAX_COEFFS];
+        int32_t                         recon_coeff[RDOQ_CACHE_MAX_COEFFS];
+    } RdoqCacheEntry;
+
+      /**************************************
+       * MD Reconstruction Reuse
+       **************************************/
+    // Winner of a block as MD coded it, copied by the encode pass when its
+    // own prediction of the block is the same (reuse_md_recon)
+    typedef struct MdBlockRecon
+    {
+        EbBool                          valid;
+        uint8_t                        *pred[3];  // bwidth (bwidth_uv) stride
+        uint8_t                        *recon[3]; // bwidth (bwidth_uv) stride
+        int32_t                        *coeff[3]; // quantized, laid out as in the SB coefficient buffer
+        uint16_t                        eob[3][MAX_TXB_COUNT];
+        int32_t                         quantized_dc[3][MAX_TXB_COUNT]; // level and dc sign context
+    } MdBlockRecon;
+
       /**************************************
        * Coding Loop Context
        **************************************/
@@ -224,6 +269,10 @@ extern "C" {
         uint8_t                         parent_sq_pred_mode[MAX_PARENT_SQ];
         uint8_t                         chroma_level;
         PART                            nsq_table[NSQ_TAB_SIZE];
+        int32_t                         nsq_pruning_feature[NSQ_PRUNING_FEATURE_COUNT];
+        uint16_t                        nsq_pruning_blk_mds; // first block of the NSQ shape the features were derived for
+        EbBool                          nsq_pruning_valid;
+        EbBool                          nsq_pruning_skip;
         uint8_t                         decoupled_fast_loop_search_method;
         uint8_t                         decouple_intra_inter_fast_loop;
         uint8_t                         full_loop_escape;
@@ -241,6 +290,19 @@ extern "C" {
         EbBool                          blk_skip_decision;
         EbBool                          trellis_quant_coeff_optimization;
         EbPictureBufferDesc                 *input_sample16bit_buffer;
+        // RDOQ results of the current SB, reused when the same coefficients
+        // are quantized again by MD or the encode pass
+        RdoqCacheKey                    rdoq_cache_key[RDOQ_CACHE_SIZE]; // kept apart from the entries for a cache friendly lookup
+        RdoqCacheEntry                 *rdoq_cache;
+        uint32_t                        rdoq_cache_count;
+        uint32_t                        rdoq_cache_next;
+        uint64_t                        rdoq_cache_lookup_count;
+        uint64_t                        rdoq_cache_hit_count;
+        CRC32C                          rdoq_cache_crc;
+        // Winners of the blocks of the current SB, NULL unless reuse_md_recon
+        MdBlockRecon                   *md_blk_recon;
+        uint8_t                        *md_blk_recon_samples;
+        int32_t                        *md_blk_recon_coeffs;
     } ModeDecisionContext;
 
     typedef void(*EbAv1LambdaAssignFunc)(
@@ -270,7 +332,8 @@ extern "C" {
         EbColorFormat              color_format,
         EbFifo                    *mode_decision_configuration_input_fifo_ptr,
         EbFifo                    *mode_decision_output_fifo_ptr,
-        EbBool                     enable_hbd_mode_decision);
+        EbBool                     enable_hbd_mode_decision,
+        EbBool                     reuse_md_recon);
 
     extern void reset_mode_decision_neighbor_arrays(
         PictureControlSet *picture_control_set_ptr);
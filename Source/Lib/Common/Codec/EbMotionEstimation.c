@@ -24,6 +24,7 @@
 #include "EbIntraPrediction.h"
 #include "EbLambdaRateTables.h"
 #include "EbPictureOperators.h"
+#include "aom_dsp_rtcd.h"
 #define OIS_TH_COUNT 4
 
 int32_t OisPointTh[3][MAX_TEMPORAL_LAYERS][OIS_TH_COUNT] = {
@@ -4199,6 +4200,432 @@ static void FullPelSearch_LCU(MeContext *context_ptr, uint32_t listIndex,
     }
 }
 
+/*******************************************
+ * GetEightHorizontalSearchPointResultsAll85PUsMultiRef
+ *   GetEightHorizontalSearchPointResultsAll85PUs for several references of
+ *   one list in a single pass: each 16x16 source block is loaded once and
+ *   matched against the same search position of every reference
+ *******************************************/
+static void GetEightHorizontalSearchPointResultsAll85PUsMultiRef(
+    MeContext *context_ptr, uint32_t listIndex,
+    uint32_t num_refs,
+    const uint8_t *ref_pic_index,  // input parameter, the batched references
+    uint32_t searchRegionIndex,
+    const int16_t *x_search_area_origin,  // input parameter, per reference
+    const int16_t *y_search_area_origin,  // input parameter, per reference
+    int32_t xSearchIndex, int32_t ySearchIndex, EbAsm asm_type) {
+    const EbBool sub_sad = (context_ptr->me_search_method == SUB_SAD_SEARCH);
+    const uint32_t src_stride = context_ptr->sb_src_stride;
+    const uint32_t reflumaStride =
+        context_ptr->interpolated_full_stride[listIndex][ref_pic_index[0]];
+    uint8_t *refPtr[MAX_REF_IDX];
+    uint8_t *ref[MAX_REF_IDX];
+    uint32_t currMV[MAX_REF_IDX];
+    uint32_t *p_best_sad8x8[MAX_REF_IDX];
+    uint32_t *p_best_mv8x8[MAX_REF_IDX];
+    uint32_t *p_best_sad16x16[MAX_REF_IDX];
+    uint32_t *p_best_mv16x16[MAX_REF_IDX];
+    uint16_t *p_sad16x16[MAX_REF_IDX];
+    uint32_t r, blockRow, blockCol;
+
+    for (r = 0; r < num_refs; r++) {
+        refPtr[r] = context_ptr->integer_buffer_ptr[listIndex][ref_pic_index[r]] +
+                    (ME_FILTER_TAP >> 1) + ((ME_FILTER_TAP >> 1) * reflumaStride) +
+                    searchRegionIndex;
+        currMV[r] =
+            ((uint32_t)(uint16_t)(ySearchIndex + y_search_area_origin[r]) << 18) |
+            (uint16_t)((uint16_t)(xSearchIndex + x_search_area_origin[r]) << 2);
+    }
+
+    /*
+    ----------------------    ----------------------
+    |  16x16_0  |  16x16_1  |  16x16_4  |  16x16_5  |
+    ----------------------    ----------------------
+    |  16x16_2  |  16x16_3  |  16x16_6  |  16x16_7  |
+    -----------------------   -----------------------
+    |  16x16_8  |  16x16_9  |  16x16_12 |  16x16_13 |
+    ----------------------    ----------------------
+    |  16x16_10 |  16x16_11 |  16x16_14 |  16x16_15 |
+    -----------------------   -----------------------
+    */
+    for (blockRow = 0; blockRow < 4; blockRow++) {
+        for (blockCol = 0; blockCol < 4; blockCol++) {
+            const uint32_t block16x16 = ((blockRow >> 1) << 3) +
+                                        ((blockCol >> 1) << 2) +
+                                        ((blockRow & 1) << 1) + (blockCol & 1);
+            for (r = 0; r < num_refs; r++) {
+                uint32_t *best_sad =
+                    context_ptr->p_sb_best_sad[listIndex][ref_pic_index[r]];
+                uint32_t *best_mv =
+                    context_ptr->p_sb_best_mv[listIndex][ref_pic_index[r]];
+                ref[r] = refPtr[r] + (blockRow << 4) * reflumaStride +
+                         (blockCol << 4);
+                p_best_sad8x8[r] =
+                    &best_sad[ME_TIER_ZERO_PU_8x8_0 + (block16x16 << 2)];
+                p_best_mv8x8[r] =
+                    &best_mv[ME_TIER_ZERO_PU_8x8_0 + (block16x16 << 2)];
+                p_best_sad16x16[r] =
+                    &best_sad[ME_TIER_ZERO_PU_16x16_0 + block16x16];
+                p_best_mv16x16[r] =
+                    &best_mv[ME_TIER_ZERO_PU_16x16_0 + block16x16];
+                p_sad16x16[r] = context_ptr->p_eight_pos_sad16x16 +
+                                r * 8 * 16 + block16x16 * 8;
+            }
+            get_eight_horizontal_search_point_results_8x8_16x16_multi_ref(
+                context_ptr->sb_src_ptr + (blockRow << 4) * src_stride +
+                    (blockCol << 4),
+                src_stride,
+                ref,
+                reflumaStride,
+                num_refs,
+                p_best_sad8x8,
+                p_best_mv8x8,
+                p_best_sad16x16,
+                p_best_mv16x16,
+                currMV,
+                p_sad16x16,
+                sub_sad);
+        }
+    }
+
+    // 32x32 and 64x64
+    for (r = 0; r < num_refs; r++) {
+        uint32_t *best_sad =
+            context_ptr->p_sb_best_sad[listIndex][ref_pic_index[r]];
+        uint32_t *best_mv =
+            context_ptr->p_sb_best_mv[listIndex][ref_pic_index[r]];
+        get_eight_horizontal_search_point_results_32x32_64x64_func_ptr_array
+            [asm_type](context_ptr->p_eight_pos_sad16x16 + r * 8 * 16,
+                       &best_sad[ME_TIER_ZERO_PU_32x32_0],
+                       &best_sad[ME_TIER_ZERO_PU_64x64],
+                       &best_mv[ME_TIER_ZERO_PU_32x32_0],
+                       &best_mv[ME_TIER_ZERO_PU_64x64],
+                       currMV[r]);
+    }
+}
+
+/*******************************************
+ * full_pel_search_sb_multi_ref
+ *   FullPelSearch_LCU for several references of one list at once. Each
+ *   reference is scanned in its own raster order, so the result per
+ *   reference is the one of FullPelSearch_LCU. The search area widths must
+ *   be multiples of 8 and the references must share the same stride.
+ *******************************************/
+static void full_pel_search_sb_multi_ref(
+    MeContext *context_ptr, uint32_t listIndex, uint32_t num_refs,
+    const uint8_t *ref_pic_index, const int16_t *x_search_area_origin,
+    const int16_t *y_search_area_origin, const uint32_t *search_area_width,
+    const uint32_t *search_area_height, EbAsm asm_type) {
+    const uint32_t stride =
+        context_ptr->interpolated_full_stride[listIndex][ref_pic_index[0]];
+    uint32_t max_width = 0, max_height = 0;
+    uint32_t xSearchIndex, ySearchIndex, r;
+
+    for (r = 0; r < num_refs; r++) {
+        max_width = MAX(max_width, search_area_width[r]);
+        max_height = MAX(max_height, search_area_height[r]);
+    }
+
+    for (ySearchIndex = 0; ySearchIndex < max_height; ySearchIndex++) {
+        for (xSearchIndex = 0; xSearchIndex < max_width; xSearchIndex += 8) {
+            uint8_t batch_ref[MAX_REF_IDX];
+            int16_t batch_x_origin[MAX_REF_IDX];
+            int16_t batch_y_origin[MAX_REF_IDX];
+            uint32_t batch_count = 0;
+
+            for (r = 0; r < num_refs; r++) {
+                if (xSearchIndex < search_area_width[r] &&
+                    ySearchIndex < search_area_height[r]) {
+                    batch_ref[batch_count] = ref_pic_index[r];
+                    batch_x_origin[batch_count] = x_search_area_origin[r];
+                    batch_y_origin[batch_count] = y_search_area_origin[r];
+                    batch_count++;
+                }
+            }
+            // this function will do:  xSearchIndex, +1, +2, ..., +7
+            GetEightHorizontalSearchPointResultsAll85PUsMultiRef(
+                context_ptr,
+                listIndex,
+                batch_count,
+                batch_ref,
+                xSearchIndex + ySearchIndex * stride,
+                batch_x_origin,
+                batch_y_origin,
+                (int32_t)xSearchIndex,
+                (int32_t)ySearchIndex,
+                asm_type);
+        }
+    }
+}
+
+/* Full-pel search of one position for all the PUs of the SB */
+typedef void (*MeSearchPointFunc)(MeContext *context_ptr, uint32_t listIndex,
+                                  uint32_t ref_pic_index,
+                                  uint32_t searchRegionIndex,
+                                  int32_t xSearchIndex, int32_t ySearchIndex,
+                                  EbAsm asm_type);
+
+// HME search center, (0,0), left, top and top-right SBs, collocated SB
+#define MAX_ME_PREDICTORS 6
+#define PREDICTIVE_SEARCH_EXIT_SAD (64 * 64 * 2) // Per-SB early termination
+
+/*******************************************
+ * predictive_search_point
+ *   searches one position of the search area, returns whether it improved
+ *   the best 64x64 SAD
+ *******************************************/
+static EbBool predictive_search_point(MeContext *context_ptr,
+                                      MeSearchPointFunc search_point,
+                                      uint32_t listIndex,
+                                      uint32_t ref_pic_index,
+                                      int16_t x_search_area_origin,
+                                      int16_t y_search_area_origin,
+                                      int32_t xSearchIndex,
+                                      int32_t ySearchIndex, EbAsm asm_type) {
+    const uint32_t best_sad = *context_ptr->p_best_sad64x64;
+
+    search_point(
+        context_ptr,
+        listIndex,
+        ref_pic_index,
+        xSearchIndex +
+            ySearchIndex *
+                context_ptr->interpolated_full_stride[listIndex][ref_pic_index],
+        xSearchIndex + x_search_area_origin,
+        ySearchIndex + y_search_area_origin,
+        asm_type);
+    return *context_ptr->p_best_sad64x64 < best_sad;
+}
+
+/*******************************************
+ * predictive_full_pel_search_sb
+ *   predictor seeded search of the search area: the full-pel predictors are
+ *   searched first, then a hexagon walks from the best one until none of its
+ *   positions improves the 64x64 SAD, and the eight positions around the
+ *   final center are searched. The walk is skipped when a predictor already
+ *   matches the SB within PREDICTIVE_SEARCH_EXIT_SAD. Every searched
+ *   position updates the best SAD and MV of all the PUs, as the exhaustive
+ *   search does
+ *******************************************/
+static void predictive_full_pel_search_sb(
+    MeContext *context_ptr, MeSearchPointFunc search_point,
+    uint32_t listIndex, uint32_t ref_pic_index,
+    uint32_t num_predictors,
+    const int32_t *x_predictor,  // input parameter, full-pel MVs
+    const int32_t *y_predictor,  // input parameter, full-pel MVs
+    int16_t x_search_area_origin, int16_t y_search_area_origin,
+    uint32_t search_area_width, uint32_t search_area_height,
+    EbAsm asm_type) {
+    // Circular order: after a move along hexagon[d] only hexagon[d - 1],
+    // hexagon[d] and hexagon[d + 1] are new positions
+    static const int8_t hexagon[6][2] = {
+        {-2, 0}, {-1, 2}, {1, 2}, {2, 0}, {1, -2}, {-1, -2}};
+    static const int8_t square[8][2] = {
+        {-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+    const int32_t max_steps =
+        (int32_t)(MAX(search_area_width, search_area_height) >> 1) + 1;
+    int32_t searched_x[MAX_ME_PREDICTORS];
+    int32_t searched_y[MAX_ME_PREDICTORS];
+    uint32_t searched_count = 0;
+    int32_t best_x = 0;
+    int32_t best_y = 0;
+    int32_t center_x, center_y;
+    int32_t direction, step;
+    uint32_t i, j;
+
+    // Predictors, clipped to the search area
+    for (i = 0; i < num_predictors; i++) {
+        const int32_t x = CLIP3(0,
+                                (int32_t)search_area_width - 1,
+                                x_predictor[i] - x_search_area_origin);
+        const int32_t y = CLIP3(0,
+                                (int32_t)search_area_height - 1,
+                                y_predictor[i] - y_search_area_origin);
+        for (j = 0; j < searched_count; j++)
+            if (searched_x[j] == x && searched_y[j] == y) break;
+        if (j < searched_count) continue;
+        searched_x[searched_count] = x;
+        searched_y[searched_count] = y;
+        searched_count++;
+        if (predictive_search_point(context_ptr,
+                                    search_point,
+                                    listIndex,
+                                    ref_pic_index,
+                                    x_search_area_origin,
+                                    y_search_area_origin,
+                                    x,
+                                    y,
+                                    asm_type)) {
+            best_x = x;
+            best_y = y;
+        }
+    }
+    if (*context_ptr->p_best_sad64x64 <= PREDICTIVE_SEARCH_EXIT_SAD) return;
+
+    // Hexagon walk
+    direction = -1;
+    for (step = 0; step < max_steps; step++) {
+        const uint32_t count = (direction < 0) ? 6 : 3;
+        int32_t next_direction = -1;
+        center_x = best_x;
+        center_y = best_y;
+        for (i = 0; i < count; i++) {
+            const int32_t d =
+                (direction < 0) ? (int32_t)i : (direction + 5 + (int32_t)i) % 6;
+            const int32_t x = center_x + hexagon[d][0];
+            const int32_t y = center_y + hexagon[d][1];
+            if (x < 0 || y < 0 || x >= (int32_t)search_area_width ||
+                y >= (int32_t)search_area_height)
+                continue;
+            if (predictive_search_point(context_ptr,
+                                        search_point,
+                                        listIndex,
+                                        ref_pic_index,
+                                        x_search_area_origin,
+                                        y_search_area_origin,
+                                        x,
+                                        y,
+                                        asm_type)) {
+                best_x = x;
+                best_y = y;
+                next_direction = d;
+            }
+        }
+        if (next_direction < 0) break;
+        direction = next_direction;
+    }
+
+    // Square refinement
+    center_x = best_x;
+    center_y = best_y;
+    for (i = 0; i < 8; i++) {
+        const int32_t x = center_x + square[i][0];
+        const int32_t y = center_y + square[i][1];
+        if (x < 0 || y < 0 || x >= (int32_t)search_area_width ||
+            y >= (int32_t)search_area_height)
+            continue;
+        predictive_search_point(context_ptr,
+                                search_point,
+                                listIndex,
+                                ref_pic_index,
+                                x_search_area_origin,
+                                y_search_area_origin,
+                                x,
+                                y,
+                                asm_type);
+    }
+}
+
+// Hash ME: entries of a hash table bucket scanned per block, and searched
+// positions per SB and reference
+#define HASH_ME_MAX_BUCKET_SCAN 256
+#define HASH_ME_MAX_POINTS 32
+
+/*******************************************
+ * hash_full_pel_search_sb
+ *   exact match search of screen content: the 64x64, 32x32, 16x16 and 8x8
+ *   blocks of the SB are looked up in the block hash table of the
+ *   reference, and the match of each block closest to the SB inside the
+ *   search area is searched for all the PUs. Returns whether the SB matches
+ *   the reference exactly, in which case the full-pel search is not needed
+ *******************************************/
+static EbBool hash_full_pel_search_sb(
+    MeContext *context_ptr, MeSearchPointFunc search_point,
+    const EbPaReferenceObject *src_object, EbPaReferenceObject *ref_object,
+    uint32_t sb_origin_x, uint32_t sb_origin_y, uint32_t listIndex,
+    uint32_t ref_pic_index, int16_t x_search_area_origin,
+    int16_t y_search_area_origin, uint32_t search_area_width,
+    uint32_t search_area_height, EbAsm asm_type) {
+    const uint32_t picture_width = src_object->input_padded_picture_ptr->width;
+    const uint32_t picture_height =
+        src_object->input_padded_picture_ptr->height;
+    int32_t searched_x[HASH_ME_MAX_POINTS];
+    int32_t searched_y[HASH_ME_MAX_POINTS];
+    uint32_t searched_count = 0;
+    int32_t size_index;
+    uint32_t block_x, block_y, i;
+
+    for (size_index = ME_HASH_BLOCK_SIZE_COUNT - 1; size_index >= 0;
+         size_index--) {
+        const uint32_t block_size = 8 << size_index;
+        for (block_y = sb_origin_y; block_y < sb_origin_y + BLOCK_SIZE_64 &&
+                                    block_y + block_size <= picture_height;
+             block_y += block_size) {
+            for (block_x = sb_origin_x;
+                 block_x < sb_origin_x + BLOCK_SIZE_64 &&
+                 block_x + block_size <= picture_width;
+                 block_x += block_size) {
+                const uint32_t index =
+                    (block_y / block_size) *
+                        src_object->aligned_block_hash_stride[size_index] +
+                    block_x / block_size;
+                const uint32_t hash_value1 =
+                    src_object->aligned_block_hash[size_index][0][index];
+                const uint32_t hash_value2 =
+                    src_object->aligned_block_hash[size_index][1][index];
+                Iterator iterator, last;
+                int32_t best_x = 0, best_y = 0;
+                int32_t best_cost = -1;
+                uint32_t scanned;
+
+                if (searched_count == HASH_ME_MAX_POINTS)
+                    return *context_ptr->p_best_sad64x64 == 0;
+                if (av1_hash_table_count(&ref_object->hash_table,
+                                         hash_value1) == 0)
+                    continue;
+                iterator = av1_hash_get_first_iterator(&ref_object->hash_table,
+                                                       hash_value1);
+                last = aom_vector_end(
+                    ref_object->hash_table.p_lookup_table[hash_value1]);
+                for (scanned = 0; scanned < HASH_ME_MAX_BUCKET_SCAN &&
+                                  !iterator_equals(&iterator, &last);
+                     scanned++, iterator_increment(&iterator)) {
+                    const block_hash *match =
+                        (const block_hash *)iterator_get(&iterator);
+                    // Search area relative position of the SB
+                    const int32_t x = match->x - (int32_t)block_x -
+                                      x_search_area_origin;
+                    const int32_t y = match->y - (int32_t)block_y -
+                                      y_search_area_origin;
+                    int32_t cost;
+                    if (match->hash_value2 != hash_value2 || x < 0 || y < 0 ||
+                        x >= (int32_t)search_area_width ||
+                        y >= (int32_t)search_area_height)
+                        continue;
+                    cost = ABS(x + x_search_area_origin) +
+                           ABS(y + y_search_area_origin);
+                    if (best_cost < 0 || cost < best_cost) {
+                        best_cost = cost;
+                        best_x = x;
+                        best_y = y;
+                    }
+                }
+                if (best_cost < 0) continue;
+                for (i = 0; i < searched_count; i++)
+                    if (searched_x[i] == best_x && searched_y[i] == best_y)
+                        break;
+                if (i < searched_count) continue;
+                searched_x[searched_count] = best_x;
+                searched_y[searched_count] = best_y;
+                searched_count++;
+                predictive_search_point(context_ptr,
+                                        search_point,
+                                        listIndex,
+                                        ref_pic_index,
+                                        x_search_area_origin,
+                                        y_search_area_origin,
+                                        best_x,
+                                        best_y,
+                                        asm_type);
+            }
+        }
+        // The SAD is verified: the hashes of a temporally filtered picture
+        // can be out of date
+        if (*context_ptr->p_best_sad64x64 == 0) return EB_TRUE;
+    }
+    return EB_FALSE;
+}
+
 /*******************************************
  * PU_HalfPelRefinement
  *   performs Half Pel refinement for one PU
@@ -4273,7 +4700,7 @@ static void half_pel_refinement_block(
     // Compute SSD for the best full search candidate
     if (context_ptr->fractional_search_method == SSD_SEARCH) {
         uint32_t integer_sse =
-            (uint32_t)spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            (uint32_t)spatial_full_distortion_kernel(
                     context_ptr->sb_src_ptr,
                     src_block_index,
                     context_ptr->sb_src_stride,
@@ -4293,7 +4720,7 @@ static void half_pel_refinement_block(
         (int16_t)context_ptr->interpolated_stride * search_index_y;
     distortion_left_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       context_ptr->sb_src_ptr,
                       src_block_index,
                       context_ptr->sb_src_stride,
@@ -4344,7 +4771,7 @@ static void half_pel_refinement_block(
     search_region_index++;
     distortion_right_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       &(context_ptr->sb_src_ptr[src_block_index]),
                       context_ptr->sb_src_stride,
                       &(pos_b_buffer[search_region_index]),
@@ -4395,7 +4822,7 @@ static void half_pel_refinement_block(
         (int16_t)context_ptr->interpolated_stride * search_index_y;
     distortion_top_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       context_ptr->sb_src_ptr,
                       src_block_index,
                       context_ptr->sb_src_stride,
@@ -4446,7 +4873,7 @@ static void half_pel_refinement_block(
     search_region_index += (int16_t)context_ptr->interpolated_stride;
     distortion_bottom_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       &(context_ptr->sb_src_ptr[src_block_index]),
                       context_ptr->sb_src_stride,
                       &(pos_h_buffer[search_region_index]),
@@ -4497,7 +4924,7 @@ static void half_pel_refinement_block(
         (int16_t)context_ptr->interpolated_stride * search_index_y;
     distortion_topleft_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       context_ptr->sb_src_ptr,
                       src_block_index,
                       context_ptr->sb_src_stride,
@@ -4547,7 +4974,7 @@ static void half_pel_refinement_block(
     search_region_index++;
     distortion_topright_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       context_ptr->sb_src_ptr,
                       src_block_index,
                       context_ptr->sb_src_stride,
@@ -4599,7 +5026,7 @@ static void half_pel_refinement_block(
     search_region_index += (int16_t)context_ptr->interpolated_stride;
     distortion_bottomright_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       context_ptr->sb_src_ptr,
                       src_block_index,
                       context_ptr->sb_src_stride,
@@ -4649,7 +5076,7 @@ static void half_pel_refinement_block(
     search_region_index--;
     distortion_bottomleft_position =
         (context_ptr->fractional_search_method == SSD_SEARCH)
-            ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+            ? spatial_full_distortion_kernel(
                       &(context_ptr->sb_src_ptr[src_block_index]),
                       context_ptr->sb_src_stride,
                       &(pos_j_buffer[search_region_index]),
@@ -5659,6 +6086,117 @@ void InterpolateSearchRegionAVC(
     return;
 }
 
+/*******************************************
+ * interpolate_half_pel_planes
+ *   interpolates the padded picture of a PA reference once into its b, h
+ *   and j half-pel planes, with the kernels and sample positions of
+ *   InterpolateSearchRegionAVC, so the search reads the same values from
+ *   the planes as from an interpolated search region. The picture is
+ *   filtered as one run of samples, as a search region is when its
+ *   rounded width goes past the picture edge; the outer rows only hold
+ *   the taps of the filters.
+ ********************************************/
+void interpolate_half_pel_planes(
+    EbPaReferenceObject *pa_reference_object,  // input/output parameter, PA
+                                               // reference and its planes
+    EbAsm asm_type) {
+    EbPictureBufferDesc *ref_pic_ptr =
+        pa_reference_object->input_padded_picture_ptr;
+    const uint32_t stride = ref_pic_ptr->stride_y;
+    const uint32_t rows = ref_pic_ptr->luma_size / stride;
+
+    // Half pel interpolation of rows 1 to rows - 2 using f1 -> pos_b_plane
+    avc_style_uni_pred_luma_if_function_ptr_array[asm_type][2](
+        ref_pic_ptr->buffer_y + stride,
+        stride,
+        pa_reference_object->pos_b_plane + stride,
+        stride,
+        ((rows - 2) * stride) & ~7,
+        1,
+        NULL,
+        EB_FALSE,
+        2);
+
+    // Half pel interpolation of rows 1 to rows - 3 using f1 -> pos_h_plane
+    avc_style_uni_pred_luma_if_function_ptr_array[asm_type][8](
+        ref_pic_ptr->buffer_y + stride,
+        stride,
+        pa_reference_object->pos_h_plane + stride,
+        stride,
+        ((rows - 3) * stride) & ~7,
+        1,
+        NULL,
+        EB_FALSE,
+        2);
+
+    // Half pel interpolation of rows 2 to rows - 4 using f1 -> pos_j_plane
+    avc_style_uni_pred_luma_if_function_ptr_array[asm_type][8](
+        pa_reference_object->pos_b_plane + 2 * stride,
+        stride,
+        pa_reference_object->pos_j_plane + 2 * stride,
+        stride,
+        ((rows - 5) * stride) & ~7,
+        1,
+        NULL,
+        EB_FALSE,
+        2);
+}
+
+/*******************************************
+ * interpolate_search_region
+ *   points the b, h and j buffers of the search region to the half-pel
+ *   planes of the reference when it carries them, or interpolates the
+ *   search region into the context buffers
+ ********************************************/
+static void interpolate_search_region(
+    MeContext *context_ptr,  // input/output parameter, ME context ptr
+    uint32_t listIndex,      // Refrence picture list index
+    uint32_t ref_pic_index,
+    EbPaReferenceObject *reference_object,  // input parameter, PA reference
+    uint8_t *searchRegionBuffer,  // input parameter, search region index, used
+                                  // to point to reference samples
+    uint32_t lumaStride,          // input parameter, reference Picture stride
+    uint32_t search_area_width,   // input parameter, search area width
+    uint32_t search_area_height,  // input parameter, search area height
+    EbAsm asm_type) {
+    if (reference_object->pos_b_plane) {
+        // Same sample positions as InterpolateSearchRegionAVC writes to the
+        // start of the context buffers
+        const ptrdiff_t search_region_offset =
+            searchRegionBuffer -
+            reference_object->input_padded_picture_ptr->buffer_y;
+        context_ptr->interpolated_stride = lumaStride;
+        context_ptr->pos_b_buffer[listIndex][ref_pic_index] =
+            reference_object->pos_b_plane + search_region_offset -
+            (ME_FILTER_TAP >> 1) * lumaStride - (ME_FILTER_TAP >> 1) + 1;
+        context_ptr->pos_h_buffer[listIndex][ref_pic_index] =
+            reference_object->pos_h_plane + search_region_offset -
+            (ME_FILTER_TAP >> 1) * lumaStride - 1 + lumaStride;
+        context_ptr->pos_j_buffer[listIndex][ref_pic_index] =
+            reference_object->pos_j_plane + search_region_offset -
+            (ME_FILTER_TAP >> 1) * lumaStride - (ME_FILTER_TAP >> 1) + 1 +
+            lumaStride;
+        return;
+    }
+
+    context_ptr->interpolated_stride = context_ptr->search_region_stride;
+    context_ptr->pos_b_buffer[listIndex][ref_pic_index] =
+        context_ptr->search_region_pos_b_buffer[listIndex][ref_pic_index];
+    context_ptr->pos_h_buffer[listIndex][ref_pic_index] =
+        context_ptr->search_region_pos_h_buffer[listIndex][ref_pic_index];
+    context_ptr->pos_j_buffer[listIndex][ref_pic_index] =
+        context_ptr->search_region_pos_j_buffer[listIndex][ref_pic_index];
+    InterpolateSearchRegionAVC(context_ptr,
+                               listIndex,
+                               ref_pic_index,
+                               searchRegionBuffer,
+                               lumaStride,
+                               search_area_width,
+                               search_area_height,
+                               8,
+                               asm_type);
+}
+
 /*******************************************
  * InterpolateSearchRegion AVC
  *   interpolates the search area
@@ -5878,16 +6416,15 @@ static void PU_HalfPelRefinement(
 
     // Compute SSD for the best full search candidate
     if (context_ptr->fractional_search_method == SSD_SEARCH) {
-        *pBestSsd = (uint32_t)spatial_full_distortion_kernel_func_ptr_array
-            [asm_type](
-                context_ptr->sb_src_ptr,
-                puLcuBufferIndex,
-                context_ptr->sb_src_stride,
-                refBuffer,
-                ySearchIndex * ref_stride + xSearchIndex,
-                ref_stride,
-                pu_width,
-                pu_height);
+        *pBestSsd = (uint32_t)spatial_full_distortion_kernel(
+            context_ptr->sb_src_ptr,
+            puLcuBufferIndex,
+            context_ptr->sb_src_stride,
+            refBuffer,
+            ySearchIndex * ref_stride + xSearchIndex,
+            ref_stride,
+            pu_width,
+            pu_height);
     }
     // Use SATD only when QP mod, and RC are OFF
     // QP mod, and RC assume that ME distotion is always SAD.
@@ -5900,7 +6437,7 @@ static void PU_HalfPelRefinement(
             (int16_t)context_ptr->interpolated_stride * ySearchIndex;
         distortionLeftPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -5950,7 +6487,7 @@ static void PU_HalfPelRefinement(
         searchRegionIndex++;
         distortionRightPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -6002,7 +6539,7 @@ static void PU_HalfPelRefinement(
             (int16_t)context_ptr->interpolated_stride * ySearchIndex;
         distortionTopPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -6053,7 +6590,7 @@ static void PU_HalfPelRefinement(
         searchRegionIndex += (int16_t)context_ptr->interpolated_stride;
         distortionBottomPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -6106,7 +6643,7 @@ static void PU_HalfPelRefinement(
             (int16_t)context_ptr->interpolated_stride * ySearchIndex;
         distortionTopLeftPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -6157,7 +6694,7 @@ static void PU_HalfPelRefinement(
         searchRegionIndex++;
         distortionTopRightPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -6209,7 +6746,7 @@ static void PU_HalfPelRefinement(
         searchRegionIndex += (int16_t)context_ptr->interpolated_stride;
         distortionBottomRightPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -6260,7 +6797,7 @@ static void PU_HalfPelRefinement(
         searchRegionIndex--;
         distortionBottomLeftPosition =
             (context_ptr->fractional_search_method == SSD_SEARCH)
-                ? spatial_full_distortion_kernel_func_ptr_array[asm_type](
+                ? spatial_full_distortion_kernel(
                           context_ptr->sb_src_ptr,
                           puLcuBufferIndex,
                           context_ptr->sb_src_stride,
@@ -10589,31 +11126,8 @@ void HmeOneQuadrantLevel0(
             search_area_width,
             search_area_height);
     } else {
-        if (((search_area_width & 15) == 0) && (asm_type == ASM_AVX2)) {
-            sad_loop_kernel_avx2_hme_l0_intrin(
-                &context_ptr->sixteenth_sb_buffer[0],
-                context_ptr->sixteenth_sb_buffer_stride,
-                &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
-                (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-                    ? sixteenthRefPicPtr->stride_y
-                    : sixteenthRefPicPtr->stride_y * 2,
-                (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-                    ? sb_height
-                    : sb_height >> 1,
-                sb_width,
-                // results
-                level0BestSad,
-                xLevel0SearchCenter,
-                yLevel0SearchCenter,
-                // range
-                sixteenthRefPicPtr->stride_y,
-                search_area_width,
-                search_area_height);
-        } else if ((search_area_width & 15) == 0) {
-            // Only width equals 16 (LCU equals 64) is updated
-            // other width sizes work with the old code as the one
-            // in"sad_loop_kernel_sse4_1_intrin"
-            sad_loop_kernel_sse4_1_hme_l0_intrin(
+        if ((search_area_width & 15) == 0) {
+            nxm_sad_loop_kernel_hme_l0(
                 &context_ptr->sixteenth_sb_buffer[0],
                 context_ptr->sixteenth_sb_buffer_stride,
                 &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
@@ -10634,7 +11148,7 @@ void HmeOneQuadrantLevel0(
                 search_area_height);
         } else {
             // Put the first search location into level0 results
-            nxm_sad_loop_kernel_func_ptr_array[asm_type](
+            nxm_sad_loop_kernel(
                 &context_ptr->sixteenth_sb_buffer[0],
                 context_ptr->sixteenth_sb_buffer_stride,
                 &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
@@ -10716,6 +11230,7 @@ void HmeLevel0(
     // Adjust SR size based on the searchAreaShift
 
     (void)picture_control_set_ptr;
+    (void)asm_type;
     // Round up x_HME_L0 to be a multiple of 16
     int16_t search_area_width =
         (int16_t)((((((context_ptr->hme_level0_search_area_in_width_array
@@ -10837,31 +11352,8 @@ void HmeLevel0(
                         yTopLeftSearchRegion * sixteenthRefPicPtr->stride_y;
 
     if (((sb_width & 7) == 0) || (sb_width == 4)) {
-        if (((search_area_width & 15) == 0) && (asm_type == ASM_AVX2)) {
-            sad_loop_kernel_avx2_hme_l0_intrin(
-                &context_ptr->sixteenth_sb_buffer[0],
-                context_ptr->sixteenth_sb_buffer_stride,
-                &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
-                (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-                    ? sixteenthRefPicPtr->stride_y
-                    : sixteenthRefPicPtr->stride_y * 2,
-                (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-                    ? sb_height
-                    : sb_height >> 1,
-                sb_width,
-                // results
-                level0BestSad,
-                xLevel0SearchCenter,
-                yLevel0SearchCenter,
-                // range
-                sixteenthRefPicPtr->stride_y,
-                search_area_width,
-                search_area_height);
-        } else if ((search_area_width & 15) == 0) {
-            // Only width equals 16 (LCU equals 64) is updated
-            // other width sizes work with the old code as the one
-            // in"sad_loop_kernel_sse4_1_intrin"
-            sad_loop_kernel_sse4_1_hme_l0_intrin(
+        if ((search_area_width & 15) == 0) {
+            nxm_sad_loop_kernel_hme_l0(
                 &context_ptr->sixteenth_sb_buffer[0],
                 context_ptr->sixteenth_sb_buffer_stride,
                 &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
@@ -10882,7 +11374,7 @@ void HmeLevel0(
                 search_area_height);
         } else {
             // Put the first search location into level0 results
-            nxm_sad_loop_kernel_func_ptr_array[asm_type](
+            nxm_sad_loop_kernel(
                 &context_ptr->sixteenth_sb_buffer[0],
                 context_ptr->sixteenth_sb_buffer_stride,
                 &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
@@ -10972,6 +11464,7 @@ void HmeLevel1(
     int16_t xTopLeftSearchRegion;
     int16_t yTopLeftSearchRegion;
     uint32_t searchRegionIndex;
+    (void)asm_type;
     // Round up x_HME_L0 to be a multiple of 8
     int16_t search_area_width =
         (int16_t)((hmeLevel1SearchAreaInWidth + 7) & ~0x07);
@@ -11059,7 +11552,7 @@ void HmeLevel1(
 
     if (((sb_width & 7) == 0) || (sb_width == 4)) {
         // Put the first search location into level0 results
-        nxm_sad_loop_kernel_func_ptr_array[asm_type](
+        nxm_sad_loop_kernel(
             &context_ptr->quarter_sb_buffer[0],
             (context_ptr->hme_search_method == FULL_SAD_SEARCH)
                 ? context_ptr->quarter_sb_buffer_stride
@@ -11157,6 +11650,7 @@ void HmeLevel2(
     // 8 or non multiple of 8 SAD calculation performance is the same for
     // searchregion width from 1 to 8
     (void)picture_control_set_ptr;
+    (void)asm_type;
     int16_t hmeLevel2SearchAreaInWidth =
         (int16_t)context_ptr
             ->hme_level2_search_area_in_width_array[searchRegionNumberInWidth];
@@ -11246,7 +11740,7 @@ void HmeLevel2(
         xTopLeftSearchRegion + yTopLeftSearchRegion * refPicPtr->stride_y;
     if ((((sb_width & 7) == 0) && (sb_width != 40) && (sb_width != 56))) {
         // Put the first search location into level0 results
-        nxm_sad_loop_kernel_func_ptr_array[asm_type](
+        nxm_sad_loop_kernel(
             context_ptr->sb_src_ptr,
             (context_ptr->hme_search_method == FULL_SAD_SEARCH)
                 ? context_ptr->sb_src_stride
@@ -13300,6 +13794,389 @@ void SwapMeCandidate(MePredUnit *a, MePredUnit *b) {
     *b = tempPtr;
 }
 
+/*******************************************
+ * sub_pel_search_sb
+ *   half-pel and quarter-pel refinement of the full-pel search results of
+ *   one reference
+ *******************************************/
+static void sub_pel_search_sb(SequenceControlSet *sequence_control_set_ptr,
+                              PictureParentControlSet *picture_control_set_ptr,
+                              MeContext *context_ptr, uint32_t listIndex,
+                              uint32_t ref_pic_index,
+                              EbPaReferenceObject *referenceObject,
+                              int16_t x_search_area_origin,
+                              int16_t y_search_area_origin,
+                              int16_t search_area_width,
+                              int16_t search_area_height, EbAsm asm_type) {
+    EbBool enableHalfPel32x32 = EB_FALSE;
+    EbBool enableHalfPel16x16 = EB_FALSE;
+    EbBool enableHalfPel8x8 = EB_FALSE;
+    EbBool enableQuarterPel = EB_FALSE;
+
+    if (context_ptr->fractional_search_model == 0) {
+        enableHalfPel32x32 = EB_TRUE;
+        enableHalfPel16x16 = EB_TRUE;
+        enableHalfPel8x8 = EB_TRUE;
+        enableQuarterPel = EB_TRUE;
+    } else if (context_ptr->fractional_search_model == 1) {
+        suPelEnable(context_ptr,
+                    picture_control_set_ptr,
+                    listIndex,
+                    0,
+                    &enableHalfPel32x32,
+                    &enableHalfPel16x16,
+                    &enableHalfPel8x8);
+        enableQuarterPel = EB_TRUE;
+    } else {
+        enableHalfPel32x32 = EB_FALSE;
+        enableHalfPel16x16 = EB_FALSE;
+        enableHalfPel8x8 = EB_FALSE;
+        enableQuarterPel = EB_FALSE;
+    }
+    if (enableHalfPel32x32 || enableHalfPel16x16 ||
+        enableHalfPel8x8 || enableQuarterPel) {
+        // if((picture_control_set_ptr->is_used_as_reference_flag ==
+        // EB_TRUE)) {
+
+        // Interpolate the search region for Half-Pel Refinements
+        // H - AVC Style
+
+        if (context_ptr->half_pel_mode ==
+            REFINMENT_HP_MODE) {
+            interpolate_search_region(
+                context_ptr,
+                listIndex,
+                ref_pic_index,
+                referenceObject,
+                context_ptr->integer_buffer_ptr[listIndex]
+                                               [ref_pic_index] +
+                    (ME_FILTER_TAP >> 1) +
+                    ((ME_FILTER_TAP >> 1) *
+                     context_ptr
+                         ->interpolated_full_stride[listIndex]
+                                                   [ref_pic_index]),
+                context_ptr
+                    ->interpolated_full_stride[listIndex]
+                                              [ref_pic_index],
+                (uint32_t)search_area_width + (BLOCK_SIZE_64 - 1),
+                (uint32_t)search_area_height + (BLOCK_SIZE_64 - 1),
+                asm_type);
+
+            // Half-Pel Refinement [8 search positions]
+            HalfPelSearch_LCU(
+                sequence_control_set_ptr,
+                picture_control_set_ptr,
+                context_ptr,
+#if M0_HIGH_PRECISION_INTERPOLATION
+                context_ptr->integer_buffer_ptr[listIndex]
+                                               [ref_pic_index] +
+                    (ME_FILTER_PAD_DISTANCE >> 1) +
+                    ((ME_FILTER_PAD_DISTANCE >> 1) *
+                     context_ptr
+                         ->interpolated_full_stride[listIndex]
+                                                   [ref_pic_index]),
+                context_ptr
+                    ->interpolated_full_stride[listIndex]
+                                              [ref_pic_index],
+                &(context_ptr->pos_b_buffer
+                      [listIndex][ref_pic_index]
+                      [(ME_FILTER_PAD_DISTANCE >> 1) *
+                       context_ptr->interpolated_stride]),
+#else
+                context_ptr->integer_buffer_ptr[listIndex]
+                                               [ref_pic_index] +
+                    (ME_FILTER_TAP >> 1) +
+                    ((ME_FILTER_TAP >> 1) *
+                     context_ptr
+                         ->interpolated_full_stride[listIndex]
+                                                   [ref_pic_index]),
+                context_ptr
+                    ->interpolated_full_stride[listIndex]
+                                              [ref_pic_index],
+                &(context_ptr->pos_b_buffer
+                      [listIndex][ref_pic_index]
+                      [(ME_FILTER_TAP >> 1) *
+                       context_ptr->interpolated_stride]),
+#endif
+                &(context_ptr
+                      ->pos_h_buffer[listIndex][ref_pic_index][1]),
+                &(context_ptr
+                      ->pos_j_buffer[listIndex][ref_pic_index][0]),
+                x_search_area_origin,
+                y_search_area_origin,
+                asm_type,
+                picture_control_set_ptr->cu8x8_mode ==
+                    CU_8x8_MODE_1,
+                enableHalfPel32x32,
+                enableHalfPel16x16,
+                enableHalfPel8x8);
+        }
+
+        if (context_ptr->quarter_pel_mode ==
+            REFINMENT_QP_MODE) {
+            // Quarter-Pel Refinement [8 search positions]
+            QuarterPelSearch_LCU(
+                context_ptr,
+#if M0_HIGH_PRECISION_INTERPOLATION
+                context_ptr->integer_buffer_ptr[listIndex]
+                                               [ref_pic_index] +
+                    (ME_FILTER_PAD_DISTANCE >> 1) +
+                    ((ME_FILTER_PAD_DISTANCE >> 1) *
+                     context_ptr
+                         ->interpolated_full_stride[listIndex]
+                                                   [ref_pic_index]),
+                context_ptr
+                    ->interpolated_full_stride[listIndex]
+                                              [ref_pic_index],
+                &(context_ptr->pos_b_buffer
+                      [listIndex][ref_pic_index]
+                      [(ME_FILTER_PAD_DISTANCE >> 1) *
+                       context_ptr
+                           ->interpolated_stride]),  // points to b
+                                                     // position of
+                                                     // the figure
+                                                     // above
+#else
+                context_ptr->integer_buffer_ptr[listIndex]
+                                               [ref_pic_index] +
+                    (ME_FILTER_TAP >> 1) +
+                    ((ME_FILTER_TAP >> 1) *
+                     context_ptr
+                         ->interpolated_full_stride[listIndex]
+                                                   [ref_pic_index]),
+                context_ptr
+                    ->interpolated_full_stride[listIndex]
+                                              [ref_pic_index],
+                &(context_ptr->pos_b_buffer
+                      [listIndex][ref_pic_index]
+                      [(ME_FILTER_TAP >> 1) *
+                       context_ptr
+                           ->interpolated_stride]),  // points to b
+                                                     // position of
+                                                     // the figure
+                                                     // above
+#endif
+                &(context_ptr
+                      ->pos_h_buffer[listIndex][ref_pic_index]
+                                    [1]),  // points to h position
+                                           // of the figure above
+                &(context_ptr
+                      ->pos_j_buffer[listIndex][ref_pic_index]
+                                    [0]),  // points to j position
+                                           // of the figure above
+                x_search_area_origin,
+                y_search_area_origin,
+                asm_type,
+                picture_control_set_ptr->cu8x8_mode ==
+                    CU_8x8_MODE_1,
+                enableHalfPel32x32,
+                enableHalfPel16x16,
+                enableHalfPel8x8,
+                enableQuarterPel,
+#if TEST5_DISABLE_NSQ_ME
+                EB_FALSE);
+#else
+                picture_control_set_ptr->pic_depth_mode <=
+                    PIC_ALL_C_DEPTH_MODE);
+#endif
+        }
+    }
+}
+
+/*******************************************
+ * set_me_sb_best_pointers
+ *   points the ME context at the best SAD, MV and SSD of one reference
+ *******************************************/
+static void set_me_sb_best_pointers(MeContext *context_ptr, uint32_t listIndex,
+                                    uint32_t ref_pic_index) {
+    context_ptr->p_best_sad64x64 = &(
+        context_ptr->p_sb_best_sad[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_64x64]);
+    context_ptr->p_best_sad32x32 = &(
+        context_ptr->p_sb_best_sad[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_32x32_0]);
+    context_ptr->p_best_sad16x16 = &(
+        context_ptr->p_sb_best_sad[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_16x16_0]);
+    context_ptr->p_best_sad8x8 = &(
+        context_ptr->p_sb_best_sad[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_8x8_0]);
+
+    context_ptr->p_best_mv64x64 = &(
+        context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
+                                 [ME_TIER_ZERO_PU_64x64]);
+    context_ptr->p_best_mv32x32 = &(
+        context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
+                                 [ME_TIER_ZERO_PU_32x32_0]);
+    context_ptr->p_best_mv16x16 = &(
+        context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
+                                 [ME_TIER_ZERO_PU_16x16_0]);
+    context_ptr->p_best_mv8x8 = &(
+        context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
+                                 [ME_TIER_ZERO_PU_8x8_0]);
+
+    context_ptr->p_best_ssd64x64 = &(
+        context_ptr->p_sb_best_ssd[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_64x64]);
+    context_ptr->p_best_ssd32x32 = &(
+        context_ptr->p_sb_best_ssd[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_32x32_0]);
+    context_ptr->p_best_ssd16x16 = &(
+        context_ptr->p_sb_best_ssd[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_16x16_0]);
+    context_ptr->p_best_ssd8x8 = &(
+        context_ptr->p_sb_best_ssd[listIndex][ref_pic_index]
+                                  [ME_TIER_ZERO_PU_8x8_0]);
+}
+
+/*******************************************
+ * get_motion_field_mv
+ *   64x64 MV (quarter-pel) of an SB in the motion field of a reference,
+ *   scaled to the distance between the current picture and the reference
+ *******************************************/
+static INLINE void get_motion_field_mv(const MeMotionField *motion_field,
+                                       uint32_t sb_index, int16_t *x_mv,
+                                       int16_t *y_mv) {
+    const uint32_t mv = motion_field->sb_mv[sb_index];
+    const int64_t x = _MVXT(mv) * motion_field->ref_distance /
+                      motion_field->mv_distance;
+    const int64_t y = _MVYT(mv) * motion_field->ref_distance /
+                      motion_field->mv_distance;
+    *x_mv = (int16_t)CLIP3(INT16_MIN, INT16_MAX, x);
+    *y_mv = (int16_t)CLIP3(INT16_MIN, INT16_MAX, y);
+}
+
+// Largest difference (quarter-pel) between the scaled MVs of neighbouring
+// SBs of a stable motion field: one HME level 0 sample
+#define MOTION_FIELD_STABLE_MV_TH 16
+// Largest 64x64 SAD of the SBs of a stable motion field: 4 per sample
+#define MOTION_FIELD_STABLE_SAD (64 * 64 * 4)
+
+/*******************************************
+ * get_motion_field_hme_center
+ *   returns whether the motion field of the reference is stable around the
+ *   SB: the collocated SB and its four neighbours are well predicted and
+ *   their scaled MVs agree. The collocated MV is then returned (full-pel)
+ *   as the HME search center
+ *******************************************/
+static EbBool get_motion_field_hme_center(
+    SequenceControlSet *sequence_control_set_ptr, MeContext *context_ptr,
+    uint32_t sb_index, uint32_t sb_origin_x, uint32_t sb_origin_y,
+    uint32_t listIndex, uint32_t ref_pic_index, int16_t *x_search_center,
+    int16_t *y_search_center) {
+    const MeMotionField *motion_field =
+        &context_ptr->motion_field[listIndex][ref_pic_index];
+    const uint32_t sb_sz = sequence_control_set_ptr->sb_sz;
+    const uint32_t picture_width_in_sb =
+        (sequence_control_set_ptr->seq_header.max_frame_width + sb_sz - 1) /
+        sb_sz;
+    const uint32_t picture_height_in_sb =
+        (sequence_control_set_ptr->seq_header.max_frame_height + sb_sz - 1) /
+        sb_sz;
+    const uint32_t sb_x = sb_origin_x / sb_sz;
+    const uint32_t sb_y = sb_origin_y / sb_sz;
+    uint32_t neighbor_sb_index[4];
+    uint32_t num_neighbors = 0;
+    int16_t x_mv, y_mv;
+    int16_t x_neighbor_mv, y_neighbor_mv;
+    uint32_t i;
+
+    if (motion_field->sb_mv == NULL ||
+        motion_field->sb_sad[sb_index] > MOTION_FIELD_STABLE_SAD)
+        return EB_FALSE;
+
+    if (sb_x > 0) neighbor_sb_index[num_neighbors++] = sb_index - 1;
+    if (sb_x + 1 < picture_width_in_sb)
+        neighbor_sb_index[num_neighbors++] = sb_index + 1;
+    if (sb_y > 0)
+        neighbor_sb_index[num_neighbors++] = sb_index - picture_width_in_sb;
+    if (sb_y + 1 < picture_height_in_sb)
+        neighbor_sb_index[num_neighbors++] = sb_index + picture_width_in_sb;
+
+    get_motion_field_mv(motion_field, sb_index, &x_mv, &y_mv);
+    for (i = 0; i < num_neighbors; i++) {
+        if (motion_field->sb_sad[neighbor_sb_index[i]] >
+            MOTION_FIELD_STABLE_SAD)
+            return EB_FALSE;
+        get_motion_field_mv(
+            motion_field, neighbor_sb_index[i], &x_neighbor_mv, &y_neighbor_mv);
+        if (ABS(x_neighbor_mv - x_mv) > MOTION_FIELD_STABLE_MV_TH ||
+            ABS(y_neighbor_mv - y_mv) > MOTION_FIELD_STABLE_MV_TH)
+            return EB_FALSE;
+    }
+
+    *x_search_center = (int16_t)((x_mv + 2) >> 2);
+    *y_search_center = (int16_t)((y_mv + 2) >> 2);
+    return EB_TRUE;
+}
+
+// Search area of the refinement of the motion sent with a picture
+#define EXTERNAL_MV_REFINE_AREA_WIDTH 16
+#define EXTERNAL_MV_REFINE_AREA_HEIGHT 16
+
+/*******************************************
+ * get_full_pel_predictors
+ *   full-pel predictors of the predictive search of one reference: the HME
+ *   search center, (0,0), the 64x64 MVs of the left, top and top-right SBs
+ *   already searched by the segment, and the collocated 64x64 MV of the
+ *   motion field of the reference
+ *******************************************/
+static uint32_t get_full_pel_predictors(
+    SequenceControlSet *sequence_control_set_ptr,
+    PictureParentControlSet *picture_control_set_ptr, MeContext *context_ptr,
+    uint32_t sb_index, uint32_t sb_origin_x, uint32_t sb_origin_y,
+    uint32_t listIndex, uint32_t ref_pic_index, int16_t x_search_center,
+    int16_t y_search_center, int32_t *x_predictor, int32_t *y_predictor) {
+    const uint32_t sb_sz = sequence_control_set_ptr->sb_sz;
+    const uint32_t picture_width_in_sb =
+        (sequence_control_set_ptr->seq_header.max_frame_width + sb_sz - 1) /
+        sb_sz;
+    const uint32_t sb_x = sb_origin_x / sb_sz;
+    const uint32_t sb_y = sb_origin_y / sb_sz;
+    const uint32_t mv_index =
+        ((listIndex && sequence_control_set_ptr->mrp_mode == 0)
+             ? 4
+             : listIndex ? 2 : 0) +
+        ref_pic_index;
+    uint32_t neighbor_sb_index[3];
+    uint32_t num_neighbors = 0;
+    uint32_t num_predictors = 0;
+    uint32_t i;
+
+    x_predictor[num_predictors] = x_search_center;
+    y_predictor[num_predictors++] = y_search_center;
+    x_predictor[num_predictors] = 0;
+    y_predictor[num_predictors++] = 0;
+
+    if (sb_x > context_ptr->segment_sb_x_start)
+        neighbor_sb_index[num_neighbors++] = sb_index - 1;
+    if (sb_y > context_ptr->segment_sb_y_start) {
+        neighbor_sb_index[num_neighbors++] = sb_index - picture_width_in_sb;
+        if (sb_x + 1 < context_ptr->segment_sb_x_end)
+            neighbor_sb_index[num_neighbors++] =
+                sb_index - picture_width_in_sb + 1;
+    }
+    for (i = 0; i < num_neighbors; i++) {
+        const MvCandidate *mv =
+            &picture_control_set_ptr->me_results[neighbor_sb_index[i]]
+                 ->me_mv_array[0][mv_index];
+        x_predictor[num_predictors] = (mv->x_mv + 2) >> 2;
+        y_predictor[num_predictors++] = (mv->y_mv + 2) >> 2;
+    }
+
+    if (context_ptr->motion_field[listIndex][ref_pic_index].sb_mv) {
+        int16_t x_mv, y_mv;
+        get_motion_field_mv(&context_ptr->motion_field[listIndex][ref_pic_index],
+                            sb_index,
+                            &x_mv,
+                            &y_mv);
+        x_predictor[num_predictors] = (x_mv + 2) >> 2;
+        y_predictor[num_predictors++] = (y_mv + 2) >> 2;
+    }
+
+    return num_predictors;
+}
+
 /*******************************************
  * motion_estimate_lcu
  *   performs ME (LCU)
@@ -13427,11 +14304,29 @@ EbErrorType motion_estimate_lcu(
     EbBool enable_hme_level2_flag =
         context_ptr->enable_hme_level2_flag;
 
-    EbBool enableHalfPel32x32 = EB_FALSE;
-    EbBool enableHalfPel16x16 = EB_FALSE;
-    EbBool enableHalfPel8x8 = EB_FALSE;
-    EbBool enableQuarterPel = EB_FALSE;
     EbBool oneQuadrantHME = EB_FALSE;
+    // HME level 0 skipped for the current reference: every search region
+    // starts HME level 1 from the motion field MV
+    EbBool skip_hme_level0;
+    // Hash ME: the SB matches the current reference exactly
+    const EbPaReferenceObject *src_object =
+        (EbPaReferenceObject *)picture_control_set_ptr
+            ->pa_reference_picture_wrapper_ptr->object_ptr;
+    EbBool hash_exact_match;
+    // Motion sent with the picture for the current reference
+    const MeMotionField *external_motion_field;
+
+    // Full-pel search of the references of a list batched in one pass
+    uint8_t full_pel_ref_count;
+    uint8_t full_pel_ref[MAX_REF_IDX];
+    EbPaReferenceObject *full_pel_ref_object[MAX_REF_IDX];
+    int16_t full_pel_x_origin[MAX_REF_IDX];
+    int16_t full_pel_y_origin[MAX_REF_IDX];
+    uint32_t full_pel_width[MAX_REF_IDX];
+    uint32_t full_pel_height[MAX_REF_IDX];
+    // Predictors of the predictive full-pel search
+    int32_t x_predictor[MAX_ME_PREDICTORS];
+    int32_t y_predictor[MAX_ME_PREDICTORS];
 
     oneQuadrantHME =
         sequence_control_set_ptr->input_resolution < INPUT_SIZE_4K_RANGE
@@ -13457,6 +14352,7 @@ EbErrorType motion_estimate_lcu(
     // Uni-Prediction motion estimation loop
     // List Loop
     for (listIndex = REF_LIST_0; listIndex <= numOfListToSearch; ++listIndex) {
+        full_pel_ref_count = 0;
 
         if (context_ptr->me_alt_ref == EB_TRUE) {
             num_of_ref_pic_to_search = 1;
@@ -13498,15 +14394,25 @@ EbErrorType motion_estimate_lcu(
 
             refPicPtr = (EbPictureBufferDesc*)referenceObject->input_padded_picture_ptr;
             // Set 1/4 and 1/16 ME reference buffer(s); filtered or decimated
-            quarterRefPicPtr = (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) ?
-                (EbPictureBufferDesc*)referenceObject->quarter_filtered_picture_ptr :
-                (EbPictureBufferDesc*)referenceObject->quarter_decimated_picture_ptr;
-
-            sixteenthRefPicPtr = (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) ?
-                (EbPictureBufferDesc*)referenceObject->sixteenth_filtered_picture_ptr:
-                (EbPictureBufferDesc*)referenceObject->sixteenth_decimated_picture_ptr;
-            if (picture_control_set_ptr->temporal_layer_index > 0 ||
-                listIndex == 0) {
+            quarterRefPicPtr = referenceObject->me_quarter_picture_ptr;
+            sixteenthRefPicPtr = referenceObject->me_sixteenth_picture_ptr;
+            external_motion_field =
+                (context_ptr->me_alt_ref == EB_FALSE &&
+                 context_ptr->external_motion_field[listIndex][ref_pic_index]
+                     .sb_mv)
+                    ? &context_ptr
+                           ->external_motion_field[listIndex][ref_pic_index]
+                    : NULL;
+            if (external_motion_field) {
+                // The motion sent with the picture replaces the HME
+                get_motion_field_mv(external_motion_field,
+                                    sb_index,
+                                    &x_search_center,
+                                    &y_search_center);
+                x_search_center = (int16_t)((x_search_center + 2) >> 2);
+                y_search_center = (int16_t)((y_search_center + 2) >> 2);
+            } else if (picture_control_set_ptr->temporal_layer_index > 0 ||
+                       listIndex == 0) {
                 // A - The MV center for Tier0 search could be either (0,0), or
                 // HME A - Set HME MV Center
                 if (context_ptr->update_hme_search_center_flag)
@@ -13533,6 +14439,27 @@ EbErrorType motion_estimate_lcu(
                         BLOCK_SIZE_64) {  //(searchCenterSad >
                                           // sequence_control_set_ptr->static_config.skipTier0HmeTh))
                                           //{
+                    // Skip HME level 0 when the motion field of the
+                    // reference is stable around the SB; HME level 1 (and 2)
+                    // still refine the motion field MV
+                    skip_hme_level0 = EB_FALSE;
+                    if (context_ptr->hme_level0_skip &&
+                        enable_hme_level0_flag &&
+                        (enable_hme_level1_flag || enable_hme_level2_flag)) {
+                        context_ptr->hme_level0_eligible_count++;
+                        skip_hme_level0 =
+                            get_motion_field_hme_center(sequence_control_set_ptr,
+                                                        context_ptr,
+                                                        sb_index,
+                                                        sb_origin_x,
+                                                        sb_origin_y,
+                                                        listIndex,
+                                                        ref_pic_index,
+                                                        &x_search_center,
+                                                        &y_search_center);
+                        if (skip_hme_level0)
+                            context_ptr->hme_level0_skip_count++;
+                    }
                     while (searchRegionNumberInHeight <
                            context_ptr->number_hme_search_region_in_height) {
                         while (searchRegionNumberInWidth <
@@ -13566,7 +14493,7 @@ EbErrorType motion_estimate_lcu(
 
                     // HME: Level0 search
 
-                    if (enable_hme_level0_flag) {
+                    if (enable_hme_level0_flag && !skip_hme_level0) {
                         if (oneQuadrantHME && !enable_hme_level1_flag &&
                             !enable_hme_level2_flag) {
                             searchRegionNumberInHeight = 0;
@@ -13681,6 +14608,34 @@ EbErrorType motion_estimate_lcu(
                                             ->hme_level1_search_area_in_height_array
                                                 [searchRegionNumberInHeight];
 
+                                    // Without HME level 0 the regions
+                                    // searching the same area around the
+                                    // same center share the results of the
+                                    // first region
+                                    if (skip_hme_level0 &&
+                                        (searchRegionNumberInWidth ||
+                                         searchRegionNumberInHeight) &&
+                                        hmeLevel1SearchAreaInWidth ==
+                                            (int16_t)context_ptr
+                                                ->hme_level1_search_area_in_width_array[0] &&
+                                        hmeLevel1SearchAreaInHeight ==
+                                            (int16_t)context_ptr
+                                                ->hme_level1_search_area_in_height_array[0]) {
+                                        hmeLevel1Sad[searchRegionNumberInWidth]
+                                                    [searchRegionNumberInHeight] =
+                                            hmeLevel1Sad[0][0];
+                                        xHmeLevel1SearchCenter
+                                            [searchRegionNumberInWidth]
+                                            [searchRegionNumberInHeight] =
+                                                xHmeLevel1SearchCenter[0][0];
+                                        yHmeLevel1SearchCenter
+                                            [searchRegionNumberInWidth]
+                                            [searchRegionNumberInHeight] =
+                                                yHmeLevel1SearchCenter[0][0];
+                                        searchRegionNumberInWidth++;
+                                        continue;
+                                    }
+
                                     HmeLevel1(
                                         context_ptr,
                                         origin_x >> 1,
@@ -13730,6 +14685,41 @@ EbErrorType motion_estimate_lcu(
                                     searchRegionNumberInWidth <
                                     context_ptr
                                         ->number_hme_search_region_in_width) {
+                                    // Without HME level 0 the regions
+                                    // searching the same area around the
+                                    // same level 1 center share the results
+                                    // of the first region
+                                    if (skip_hme_level0 &&
+                                        (searchRegionNumberInWidth ||
+                                         searchRegionNumberInHeight) &&
+                                        xHmeLevel1SearchCenter
+                                                [searchRegionNumberInWidth]
+                                                [searchRegionNumberInHeight] ==
+                                            xHmeLevel1SearchCenter[0][0] &&
+                                        yHmeLevel1SearchCenter
+                                                [searchRegionNumberInWidth]
+                                                [searchRegionNumberInHeight] ==
+                                            yHmeLevel1SearchCenter[0][0] &&
+                                        context_ptr->hme_level2_search_area_in_width_array
+                                                [searchRegionNumberInWidth] ==
+                                            context_ptr->hme_level2_search_area_in_width_array[0] &&
+                                        context_ptr->hme_level2_search_area_in_height_array
+                                                [searchRegionNumberInHeight] ==
+                                            context_ptr->hme_level2_search_area_in_height_array[0]) {
+                                        hmeLevel2Sad[searchRegionNumberInWidth]
+                                                    [searchRegionNumberInHeight] =
+                                            hmeLevel2Sad[0][0];
+                                        xHmeLevel2SearchCenter
+                                            [searchRegionNumberInWidth]
+                                            [searchRegionNumberInHeight] =
+                                                xHmeLevel2SearchCenter[0][0];
+                                        yHmeLevel2SearchCenter
+                                            [searchRegionNumberInWidth]
+                                            [searchRegionNumberInHeight] =
+                                                yHmeLevel2SearchCenter[0][0];
+                                        searchRegionNumberInWidth++;
+                                        continue;
+                                    }
                                     HmeLevel2(
                                         picture_control_set_ptr,
                                         context_ptr,
@@ -14003,6 +14993,13 @@ EbErrorType motion_estimate_lcu(
             // Constrain x_ME to be a multiple of 8 (round up)
             search_area_width = (context_ptr->search_area_width + 7) & ~0x07;
             search_area_height = context_ptr->search_area_height;
+            // Refinement only of the motion sent with the picture
+            if (external_motion_field && context_ptr->external_refine_only) {
+                search_area_width = MIN(search_area_width,
+                                        EXTERNAL_MV_REFINE_AREA_WIDTH);
+                search_area_height = MIN(search_area_height,
+                                         EXTERNAL_MV_REFINE_AREA_HEIGHT);
+            }
             if ((x_search_center != 0 || y_search_center != 0) &&
                 (picture_control_set_ptr->is_used_as_reference_flag ==
                  EB_TRUE)) {
@@ -14275,14 +15272,59 @@ EbErrorType motion_estimate_lcu(
                                   ->p_sb_best_ssd[listIndex][ref_pic_index]
                                                  [ME_TIER_ZERO_PU_16x64_0]);
 
-                        open_loop_me_fullpel_search_sblock(context_ptr,
-                                                           listIndex,
-                                                           ref_pic_index,
-                                                           x_search_area_origin,
-                                                           y_search_area_origin,
-                                                           search_area_width,
-                                                           search_area_height,
-                                                           asm_type);
+                        hash_exact_match =
+                            context_ptr->hash_me &&
+                            src_object->hash_table_valid &&
+                            referenceObject->hash_table_valid &&
+                            hash_full_pel_search_sb(
+                                context_ptr,
+                                open_loop_me_get_search_point_results_block,
+                                src_object,
+                                referenceObject,
+                                sb_origin_x,
+                                sb_origin_y,
+                                listIndex,
+                                ref_pic_index,
+                                x_search_area_origin,
+                                y_search_area_origin,
+                                search_area_width,
+                                search_area_height,
+                                asm_type);
+                        if (!hash_exact_match &&
+                            context_ptr->full_pel_mode == PREDICTIVE_FP_MODE)
+                            predictive_full_pel_search_sb(
+                                context_ptr,
+                                open_loop_me_get_search_point_results_block,
+                                listIndex,
+                                ref_pic_index,
+                                get_full_pel_predictors(sequence_control_set_ptr,
+                                                        picture_control_set_ptr,
+                                                        context_ptr,
+                                                        sb_index,
+                                                        sb_origin_x,
+                                                        sb_origin_y,
+                                                        listIndex,
+                                                        ref_pic_index,
+                                                        x_search_center,
+                                                        y_search_center,
+                                                        x_predictor,
+                                                        y_predictor),
+                                x_predictor,
+                                y_predictor,
+                                x_search_area_origin,
+                                y_search_area_origin,
+                                search_area_width,
+                                search_area_height,
+                                asm_type);
+                        else if (!hash_exact_match)
+                            open_loop_me_fullpel_search_sblock(context_ptr,
+                                                               listIndex,
+                                                               ref_pic_index,
+                                                               x_search_area_origin,
+                                                               y_search_area_origin,
+                                                               search_area_width,
+                                                               search_area_height,
+                                                               asm_type);
                         context_ptr->full_quarter_pel_refinement = 0;
 
                         if (context_ptr->half_pel_mode ==
@@ -14299,10 +15341,11 @@ EbErrorType motion_estimate_lcu(
                                 yTopLeftSearchRegion * refPicPtr->stride_y;
                             // Interpolate the search region for Half-Pel
                             // Refinements H - AVC Style
-                            InterpolateSearchRegionAVC(
+                            interpolate_search_region(
                                 context_ptr,
                                 listIndex,
                                 ref_pic_index,
+                                referenceObject,
                                 context_ptr->integer_buffer_ptr[listIndex]
                                                                [ref_pic_index] +
                                     (ME_FILTER_TAP >> 1) +
@@ -14316,7 +15359,6 @@ EbErrorType motion_estimate_lcu(
                                     (BLOCK_SIZE_64 - 1),
                                 (uint32_t)search_area_height +
                                     (BLOCK_SIZE_64 - 1),
-                                8,
                                 asm_type);
 
                             initialize_buffer32bits_func_ptr_array[asm_type](
@@ -14427,237 +15469,99 @@ EbErrorType motion_estimate_lcu(
                             21,
                             1,
                             MAX_SAD_VALUE);
-                        context_ptr->p_best_sad64x64 = &(
-                            context_ptr->p_sb_best_sad[listIndex][ref_pic_index]
-                                                      [ME_TIER_ZERO_PU_64x64]);
-                        context_ptr->p_best_sad32x32 =
-                            &(context_ptr
-                                  ->p_sb_best_sad[listIndex][ref_pic_index]
-                                                 [ME_TIER_ZERO_PU_32x32_0]);
-                        context_ptr->p_best_sad16x16 =
-                            &(context_ptr
-                                  ->p_sb_best_sad[listIndex][ref_pic_index]
-                                                 [ME_TIER_ZERO_PU_16x16_0]);
-                        context_ptr->p_best_sad8x8 = &(
-                            context_ptr->p_sb_best_sad[listIndex][ref_pic_index]
-                                                      [ME_TIER_ZERO_PU_8x8_0]);
-
-                        context_ptr->p_best_mv64x64 = &(
-                            context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
-                                                     [ME_TIER_ZERO_PU_64x64]);
-                        context_ptr->p_best_mv32x32 = &(
-                            context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
-                                                     [ME_TIER_ZERO_PU_32x32_0]);
-                        context_ptr->p_best_mv16x16 = &(
-                            context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
-                                                     [ME_TIER_ZERO_PU_16x16_0]);
-                        context_ptr->p_best_mv8x8 = &(
-                            context_ptr->p_sb_best_mv[listIndex][ref_pic_index]
-                                                     [ME_TIER_ZERO_PU_8x8_0]);
-
-                        context_ptr->p_best_ssd64x64 = &(
-                            context_ptr->p_sb_best_ssd[listIndex][ref_pic_index]
-                                                      [ME_TIER_ZERO_PU_64x64]);
-                        context_ptr->p_best_ssd32x32 =
-                            &(context_ptr
-                                  ->p_sb_best_ssd[listIndex][ref_pic_index]
-                                                 [ME_TIER_ZERO_PU_32x32_0]);
-                        context_ptr->p_best_ssd16x16 =
-                            &(context_ptr
-                                  ->p_sb_best_ssd[listIndex][ref_pic_index]
-                                                 [ME_TIER_ZERO_PU_16x16_0]);
-                        context_ptr->p_best_ssd8x8 = &(
-                            context_ptr->p_sb_best_ssd[listIndex][ref_pic_index]
-                                                      [ME_TIER_ZERO_PU_8x8_0]);
-                        FullPelSearch_LCU(context_ptr,
-                                          listIndex,
-                                          ref_pic_index,
-                                          x_search_area_origin,
-                                          y_search_area_origin,
-                                          search_area_width,
-                                          search_area_height,
-                                          asm_type);
-                    }
-                }
-
-                if (context_ptr->fractional_search_model == 0) {
-                    enableHalfPel32x32 = EB_TRUE;
-                    enableHalfPel16x16 = EB_TRUE;
-                    enableHalfPel8x8 = EB_TRUE;
-                    enableQuarterPel = EB_TRUE;
-                } else if (context_ptr->fractional_search_model == 1) {
-                    suPelEnable(context_ptr,
-                                picture_control_set_ptr,
+                        set_me_sb_best_pointers(
+                            context_ptr, listIndex, ref_pic_index);
+                        hash_exact_match =
+                            context_ptr->hash_me &&
+                            src_object->hash_table_valid &&
+                            referenceObject->hash_table_valid &&
+                            hash_full_pel_search_sb(context_ptr,
+                                                    GetSearchPointResults,
+                                                    src_object,
+                                                    referenceObject,
+                                                    sb_origin_x,
+                                                    sb_origin_y,
+                                                    listIndex,
+                                                    ref_pic_index,
+                                                    x_search_area_origin,
+                                                    y_search_area_origin,
+                                                    search_area_width,
+                                                    search_area_height,
+                                                    asm_type);
+                        if (!hash_exact_match &&
+                            context_ptr->full_pel_mode == EX_FP_MODE &&
+                            num_of_ref_pic_to_search > 1 &&
+                            search_area_width >= 8 &&
+                            (full_pel_ref_count == 0 ||
+                             context_ptr->interpolated_full_stride
+                                     [listIndex][ref_pic_index] ==
+                                 context_ptr->interpolated_full_stride
+                                     [listIndex][full_pel_ref[0]])) {
+                            // Searched with the other references of the list
+                            // once all their search areas are known
+                            full_pel_ref[full_pel_ref_count] = ref_pic_index;
+                            full_pel_ref_object[full_pel_ref_count] =
+                                referenceObject;
+                            full_pel_x_origin[full_pel_ref_count] =
+                                x_search_area_origin;
+                            full_pel_y_origin[full_pel_ref_count] =
+                                y_search_area_origin;
+                            full_pel_width[full_pel_ref_count] =
+                                search_area_width;
+                            full_pel_height[full_pel_ref_count] =
+                                search_area_height;
+                            full_pel_ref_count++;
+                            continue;
+                        }
+                        if (!hash_exact_match &&
+                            context_ptr->full_pel_mode == PREDICTIVE_FP_MODE)
+                            predictive_full_pel_search_sb(
+                                context_ptr,
+                                GetSearchPointResults,
                                 listIndex,
-                                0,
-                                &enableHalfPel32x32,
-                                &enableHalfPel16x16,
-                                &enableHalfPel8x8);
-                    enableQuarterPel = EB_TRUE;
-                } else {
-                    enableHalfPel32x32 = EB_FALSE;
-                    enableHalfPel16x16 = EB_FALSE;
-                    enableHalfPel8x8 = EB_FALSE;
-                    enableQuarterPel = EB_FALSE;
-                }
-                if (enableHalfPel32x32 || enableHalfPel16x16 ||
-                    enableHalfPel8x8 || enableQuarterPel) {
-                    // if((picture_control_set_ptr->is_used_as_reference_flag ==
-                    // EB_TRUE)) {
-                    // Move to the top left of the search region
-                    xTopLeftSearchRegion =
-                        (int16_t)(refPicPtr->origin_x + sb_origin_x) +
-                        x_search_area_origin;
-                    yTopLeftSearchRegion =
-                        (int16_t)(refPicPtr->origin_y + sb_origin_y) +
-                        y_search_area_origin;
-                    searchRegionIndex =
-                        xTopLeftSearchRegion +
-                        yTopLeftSearchRegion * refPicPtr->stride_y;
-
-                    // Interpolate the search region for Half-Pel Refinements
-                    // H - AVC Style
-
-                    if (context_ptr->half_pel_mode ==
-                        REFINMENT_HP_MODE) {
-                        InterpolateSearchRegionAVC(
-                            context_ptr,
-                            listIndex,
-                            ref_pic_index,
-                            context_ptr->integer_buffer_ptr[listIndex]
-                                                           [ref_pic_index] +
-                                (ME_FILTER_TAP >> 1) +
-                                ((ME_FILTER_TAP >> 1) *
-                                 context_ptr
-                                     ->interpolated_full_stride[listIndex]
-                                                               [ref_pic_index]),
-                            context_ptr
-                                ->interpolated_full_stride[listIndex]
-                                                          [ref_pic_index],
-                            (uint32_t)search_area_width + (BLOCK_SIZE_64 - 1),
-                            (uint32_t)search_area_height + (BLOCK_SIZE_64 - 1),
-                            8,
-                            asm_type);
-
-                        // Half-Pel Refinement [8 search positions]
-                        HalfPelSearch_LCU(
-                            sequence_control_set_ptr,
-                            picture_control_set_ptr,
-                            context_ptr,
-#if M0_HIGH_PRECISION_INTERPOLATION
-                            context_ptr->integer_buffer_ptr[listIndex]
-                                                           [ref_pic_index] +
-                                (ME_FILTER_PAD_DISTANCE >> 1) +
-                                ((ME_FILTER_PAD_DISTANCE >> 1) *
-                                 context_ptr
-                                     ->interpolated_full_stride[listIndex]
-                                                               [ref_pic_index]),
-                            context_ptr
-                                ->interpolated_full_stride[listIndex]
-                                                          [ref_pic_index],
-                            &(context_ptr->pos_b_buffer
-                                  [listIndex][ref_pic_index]
-                                  [(ME_FILTER_PAD_DISTANCE >> 1) *
-                                   context_ptr->interpolated_stride]),
-#else
-                            context_ptr->integer_buffer_ptr[listIndex]
-                                                           [ref_pic_index] +
-                                (ME_FILTER_TAP >> 1) +
-                                ((ME_FILTER_TAP >> 1) *
-                                 context_ptr
-                                     ->interpolated_full_stride[listIndex]
-                                                               [ref_pic_index]),
-                            context_ptr
-                                ->interpolated_full_stride[listIndex]
-                                                          [ref_pic_index],
-                            &(context_ptr->pos_b_buffer
-                                  [listIndex][ref_pic_index]
-                                  [(ME_FILTER_TAP >> 1) *
-                                   context_ptr->interpolated_stride]),
-#endif
-                            &(context_ptr
-                                  ->pos_h_buffer[listIndex][ref_pic_index][1]),
-                            &(context_ptr
-                                  ->pos_j_buffer[listIndex][ref_pic_index][0]),
-                            x_search_area_origin,
-                            y_search_area_origin,
-                            asm_type,
-                            picture_control_set_ptr->cu8x8_mode ==
-                                CU_8x8_MODE_1,
-                            enableHalfPel32x32,
-                            enableHalfPel16x16,
-                            enableHalfPel8x8);
-                    }
-
-                    if (context_ptr->quarter_pel_mode ==
-                        REFINMENT_QP_MODE) {
-                        // Quarter-Pel Refinement [8 search positions]
-                        QuarterPelSearch_LCU(
-                            context_ptr,
-#if M0_HIGH_PRECISION_INTERPOLATION
-                            context_ptr->integer_buffer_ptr[listIndex]
-                                                           [ref_pic_index] +
-                                (ME_FILTER_PAD_DISTANCE >> 1) +
-                                ((ME_FILTER_PAD_DISTANCE >> 1) *
-                                 context_ptr
-                                     ->interpolated_full_stride[listIndex]
-                                                               [ref_pic_index]),
-                            context_ptr
-                                ->interpolated_full_stride[listIndex]
-                                                          [ref_pic_index],
-                            &(context_ptr->pos_b_buffer
-                                  [listIndex][ref_pic_index]
-                                  [(ME_FILTER_PAD_DISTANCE >> 1) *
-                                   context_ptr
-                                       ->interpolated_stride]),  // points to b
-                                                                 // position of
-                                                                 // the figure
-                                                                 // above
-#else
-                            context_ptr->integer_buffer_ptr[listIndex]
-                                                           [ref_pic_index] +
-                                (ME_FILTER_TAP >> 1) +
-                                ((ME_FILTER_TAP >> 1) *
-                                 context_ptr
-                                     ->interpolated_full_stride[listIndex]
-                                                               [ref_pic_index]),
-                            context_ptr
-                                ->interpolated_full_stride[listIndex]
-                                                          [ref_pic_index],
-                            &(context_ptr->pos_b_buffer
-                                  [listIndex][ref_pic_index]
-                                  [(ME_FILTER_TAP >> 1) *
-                                   context_ptr
-                                       ->interpolated_stride]),  // points to b
-                                                                 // position of
-                                                                 // the figure
-                                                                 // above
-#endif
-                            &(context_ptr
-                                  ->pos_h_buffer[listIndex][ref_pic_index]
-                                                [1]),  // points to h position
-                                                       // of the figure above
-                            &(context_ptr
-                                  ->pos_j_buffer[listIndex][ref_pic_index]
-                                                [0]),  // points to j position
-                                                       // of the figure above
-                            x_search_area_origin,
-                            y_search_area_origin,
-                            asm_type,
-                            picture_control_set_ptr->cu8x8_mode ==
-                                CU_8x8_MODE_1,
-                            enableHalfPel32x32,
-                            enableHalfPel16x16,
-                            enableHalfPel8x8,
-                            enableQuarterPel,
-#if TEST5_DISABLE_NSQ_ME
-                            EB_FALSE);
-#else
-                            picture_control_set_ptr->pic_depth_mode <=
-                                PIC_ALL_C_DEPTH_MODE);
-#endif
+                                ref_pic_index,
+                                get_full_pel_predictors(sequence_control_set_ptr,
+                                                        picture_control_set_ptr,
+                                                        context_ptr,
+                                                        sb_index,
+                                                        sb_origin_x,
+                                                        sb_origin_y,
+                                                        listIndex,
+                                                        ref_pic_index,
+                                                        x_search_center,
+                                                        y_search_center,
+                                                        x_predictor,
+                                                        y_predictor),
+                                x_predictor,
+                                y_predictor,
+                                x_search_area_origin,
+                                y_search_area_origin,
+                                search_area_width,
+                                search_area_height,
+                                asm_type);
+                        else if (!hash_exact_match)
+                            FullPelSearch_LCU(context_ptr,
+                                              listIndex,
+                                              ref_pic_index,
+                                              x_search_area_origin,
+                                              y_search_area_origin,
+                                              search_area_width,
+                                              search_area_height,
+                                              asm_type);
                     }
                 }
+
+                sub_pel_search_sb(sequence_control_set_ptr,
+                                  picture_control_set_ptr,
+                                  context_ptr,
+                                  listIndex,
+                                  ref_pic_index,
+                                  referenceObject,
+                                  x_search_area_origin,
+                                  y_search_area_origin,
+                                  search_area_width,
+                                  search_area_height,
+                                  asm_type);
                 if (is_nsq_table_used && ref_pic_index == 0) {
                     context_ptr->p_best_nsq64x64 =
                         &(context_ptr->p_sb_best_nsq[listIndex][0]
@@ -14675,6 +15579,37 @@ EbErrorType motion_estimate_lcu(
                 }
         }
     }
+
+        // Batched full-pel search of the deferred references, then their
+        // sub-pel refinement in reference order
+        if (full_pel_ref_count) {
+            full_pel_search_sb_multi_ref(context_ptr,
+                                         listIndex,
+                                         full_pel_ref_count,
+                                         full_pel_ref,
+                                         full_pel_x_origin,
+                                         full_pel_y_origin,
+                                         full_pel_width,
+                                         full_pel_height,
+                                         asm_type);
+            for (uint8_t full_pel_index = 0;
+                 full_pel_index < full_pel_ref_count;
+                 ++full_pel_index) {
+                set_me_sb_best_pointers(
+                    context_ptr, listIndex, full_pel_ref[full_pel_index]);
+                sub_pel_search_sb(sequence_control_set_ptr,
+                                  picture_control_set_ptr,
+                                  context_ptr,
+                                  listIndex,
+                                  full_pel_ref[full_pel_index],
+                                  full_pel_ref_object[full_pel_index],
+                                  full_pel_x_origin[full_pel_index],
+                                  full_pel_y_origin[full_pel_index],
+                                  (int16_t)full_pel_width[full_pel_index],
+                                  (int16_t)full_pel_height[full_pel_index],
+                                  asm_type);
+            }
+        }
 }
 
 if (context_ptr->me_alt_ref == EB_FALSE) {
@@ -14883,6 +15818,7 @@ uint64_t SixteenthDecimatedSearch(MeContext *context_ptr, int16_t origin_x,
     uint64_t best_sad;
     int16_t x_search_center;
     int16_t y_search_center;
+    (void)asm_type;
 
     x_search_area_origin = -(search_area_width >> 1);
     y_search_area_origin = -(search_area_height >> 1);
@@ -14954,27 +15890,8 @@ uint64_t SixteenthDecimatedSearch(MeContext *context_ptr, int16_t origin_x,
     searchRegionIndex = xTopLeftSearchRegion +
                         yTopLeftSearchRegion * sixteenthRefPicPtr->stride_y;
 
-    if (((search_area_width & 15) == 0) && (asm_type == ASM_AVX2)) {
-        sad_loop_kernel_avx2_hme_l0_intrin(
-            &context_ptr->sixteenth_sb_buffer[0],
-            context_ptr->sixteenth_sb_buffer_stride * 2,
-            &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
-            sixteenthRefPicPtr->stride_y * 2,
-            sb_height >> 1,
-            sb_width,
-            // results
-            &best_sad,
-            &x_search_center,
-            &y_search_center,
-            // range
-            sixteenthRefPicPtr->stride_y,
-            search_area_width,
-            search_area_height);
-    } else if ((search_area_width & 15) == 0) {
-        // Only width equals 16 (LCU equals 64) is updated
-        // other width sizes work with the old code as the one
-        // in"sad_loop_kernel_sse4_1_intrin"
-        sad_loop_kernel_sse4_1_hme_l0_intrin(
+    if ((search_area_width & 15) == 0) {
+        nxm_sad_loop_kernel_hme_l0(
             &context_ptr->sixteenth_sb_buffer[0],
             context_ptr->sixteenth_sb_buffer_stride * 2,
             &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
@@ -14991,7 +15908,7 @@ uint64_t SixteenthDecimatedSearch(MeContext *context_ptr, int16_t origin_x,
             search_area_height);
     } else {
         // Put the first search location into level0 results
-        nxm_sad_loop_kernel_func_ptr_array[asm_type](
+        nxm_sad_loop_kernel(
             &context_ptr->sixteenth_sb_buffer[0],
             context_ptr->sixteenth_sb_buffer_stride * 2,
             &sixteenthRefPicPtr->buffer_y[searchRegionIndex],
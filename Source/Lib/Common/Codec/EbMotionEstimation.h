@@ -50,6 +50,10 @@ void interpolate_search_region_AVC_chroma(
         uint32_t                input_bit_depth,
         EbAsm                   asm_type);
 
+void interpolate_half_pel_planes(
+        EbPaReferenceObject     *pa_reference_object,
+        EbAsm                   asm_type);
+
     extern EbErrorType motion_estimate_lcu(
         PictureParentControlSet   *picture_control_set_ptr,
         uint32_t                       sb_index,
@@ -28,9 +28,9 @@ static void me_context_dctor(EbPtr p)
 
     for (listIndex = 0; listIndex < MAX_NUM_OF_REF_PIC_LIST; listIndex++) {
         for (refPicIndex = 0; refPicIndex < MAX_REF_IDX; refPicIndex++) {
-            EB_FREE_ARRAY(obj->pos_b_buffer[listIndex][refPicIndex]);
-            EB_FREE_ARRAY(obj->pos_h_buffer[listIndex][refPicIndex]);
-            EB_FREE_ARRAY(obj->pos_j_buffer[listIndex][refPicIndex]);
+            EB_FREE_ARRAY(obj->search_region_pos_b_buffer[listIndex][refPicIndex]);
+            EB_FREE_ARRAY(obj->search_region_pos_h_buffer[listIndex][refPicIndex]);
+            EB_FREE_ARRAY(obj->search_region_pos_j_buffer[listIndex][refPicIndex]);
         }
     }
 
@@ -66,6 +66,7 @@ EbErrorType me_context_ctor(
     object_ptr->sixteenth_sb_buffer_stride = (BLOCK_SIZE_64 >> 2);
     EB_MALLOC_ALIGNED_ARRAY(object_ptr->sixteenth_sb_buffer, (BLOCK_SIZE_64 >> 2) * object_ptr->sixteenth_sb_buffer_stride);
     object_ptr->interpolated_stride = MIN((uint16_t)MAX_SEARCH_AREA_WIDTH, (uint16_t)(max_input_luma_width + (PAD_VALUE << 1)));
+    object_ptr->search_region_stride = object_ptr->interpolated_stride;
 
     uint16_t max_search_area_height = MIN((uint16_t)MAX_PICTURE_HEIGHT_SIZE, (uint16_t)(max_input_luma_height + (PAD_VALUE << 1)));
     EB_MEMSET(object_ptr->sb_buffer, 0, sizeof(uint8_t) * BLOCK_SIZE_64 * object_ptr->sb_buffer_stride);
@@ -113,9 +114,12 @@ EbErrorType me_context_ctor(
 
     for (listIndex = 0; listIndex < MAX_NUM_OF_REF_PIC_LIST; listIndex++) {
         for (refPicIndex = 0; refPicIndex < MAX_REF_IDX; refPicIndex++) {
-            EB_MALLOC_ARRAY(object_ptr->pos_b_buffer[listIndex][refPicIndex], object_ptr->interpolated_stride * max_search_area_height);
-            EB_MALLOC_ARRAY(object_ptr->pos_h_buffer[listIndex][refPicIndex], object_ptr->interpolated_stride * max_search_area_height);
-            EB_MALLOC_ARRAY(object_ptr->pos_j_buffer[listIndex][refPicIndex], object_ptr->interpolated_stride * max_search_area_height);
+            EB_MALLOC_ARRAY(object_ptr->search_region_pos_b_buffer[listIndex][refPicIndex], object_ptr->search_region_stride * max_search_area_height);
+            EB_MALLOC_ARRAY(object_ptr->search_region_pos_h_buffer[listIndex][refPicIndex], object_ptr->search_region_stride * max_search_area_height);
+            EB_MALLOC_ARRAY(object_ptr->search_region_pos_j_buffer[listIndex][refPicIndex], object_ptr->search_region_stride * max_search_area_height);
+            object_ptr->pos_b_buffer[listIndex][refPicIndex] = object_ptr->search_region_pos_b_buffer[listIndex][refPicIndex];
+            object_ptr->pos_h_buffer[listIndex][refPicIndex] = object_ptr->search_region_pos_h_buffer[listIndex][refPicIndex];
+            object_ptr->pos_j_buffer[listIndex][refPicIndex] = object_ptr->search_region_pos_j_buffer[listIndex][refPicIndex];
         }
     }
 
@@ -131,7 +135,8 @@ EbErrorType me_context_ctor(
     }
 
     EB_MALLOC_ARRAY(object_ptr->avctemp_buffer, object_ptr->interpolated_stride * max_search_area_height);
-    EB_MALLOC_ARRAY(object_ptr->p_eight_pos_sad16x16, 8 * 16);//16= 16 16x16 blocks in a LCU.       8=8search points
+    // One set of 16x16 SADs per reference searched in one full-pel pass
+    EB_MALLOC_ARRAY(object_ptr->p_eight_pos_sad16x16, 8 * 16 * MAX_REF_IDX);//16= 16 16x16 blocks in a LCU.       8=8search points
 
     // Initialize Alt-Ref parameters
     object_ptr->me_alt_ref = EB_FALSE;
@@ -294,6 +294,18 @@ extern "C" {
         MePredUnit  pu[MAX_ME_PU_COUNT];
     } MotionEstimationTierZero;
 
+    // Motion field of a reference picture: the 64x64 MVs (quarter-pel) and
+    // SADs of its SBs against its own list 0 reference, the distance spanned
+    // by these MVs, and the distance from the current picture to the
+    // reference they are scaled to
+    typedef struct MeMotionField
+    {
+        const uint32_t               *sb_mv;
+        const uint32_t               *sb_sad;
+        int64_t                       mv_distance;
+        int64_t                       ref_distance;
+    } MeMotionField;
+
     typedef struct MeContext
     {
         EbDctor                       dctor;
@@ -315,6 +327,12 @@ extern "C" {
         uint8_t                      *pos_b_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
         uint8_t                      *pos_h_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
         uint8_t                      *pos_j_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        // Search region interpolation buffers; pos_b/h/j_buffer point to them,
+        // or into the half-pel planes of the reference when it carries them
+        uint32_t                      search_region_stride;
+        uint8_t                      *search_region_pos_b_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint8_t                      *search_region_pos_h_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        uint8_t                      *search_region_pos_j_buffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
         uint8_t                      *one_d_intermediate_results_buf0;
         uint8_t                      *one_d_intermediate_results_buf1;
         int16_t                       x_search_area_origin[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
@@ -430,10 +448,33 @@ extern "C" {
         EbBool                        use_subpel_flag;
         EbBool                        half_pel_mode;
         EbBool                        quarter_pel_mode;
+        uint8_t                       full_pel_mode;
+        // Exact match search through the block hash tables of the references
+        // before the full-pel search (screen content)
+        EbBool                        hash_me;
 
         // ME
         uint16_t                      search_area_width;
         uint16_t                      search_area_height;
+        // Predictive full-pel search: SB bounds of the segment being
+        // searched (neighbouring SBs are only used as predictors when searched
+        // before the current SB by the same segment)
+        uint32_t                      segment_sb_x_start;
+        uint32_t                      segment_sb_x_end;
+        uint32_t                      segment_sb_y_start;
+        // Motion fields of the references (sb_mv is NULL when unavailable)
+        MeMotionField                 motion_field[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        // HME level 0 is skipped when the motion field of the reference is
+        // stable around the SB; counters of the SB searches eligible for
+        // the skip and of the skipped ones
+        EbBool                        hme_level0_skip;
+        uint64_t                      hme_level0_eligible_count;
+        uint64_t                      hme_level0_skip_count;
+        // Motion sent with the picture, mapped to its references (sb_mv is
+        // NULL when unavailable): replaces the HME search center, and with
+        // external_refine_only the search area is reduced to a refinement
+        MeMotionField                 external_motion_field[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
+        EbBool                        external_refine_only;
         // HME
         uint16_t                      number_hme_search_region_in_width;
         uint16_t                      number_hme_search_region_in_height;
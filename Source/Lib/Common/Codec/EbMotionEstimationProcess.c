@@ -20,6 +20,7 @@
 #include "emmintrin.h"
 
 #include "EbTemporalFiltering.h"
+#include "EbLadder.h"
 
 /* --32x32-
 |00||01|
@@ -245,6 +246,25 @@ EbErrorType signal_derivation_me_kernel_oq(
     context_ptr->me_context_ptr->me_search_method = (picture_control_set_ptr->enc_mode <= ENC_M1) ?
         FULL_SAD_SEARCH :
         SUB_SAD_SEARCH;
+    // Full-Pel Search Mode
+    // EX_FP_MODE: exhaustive search of the search area
+    // PREDICTIVE_FP_MODE: hexagon search seeded with the HME, spatial and
+    // collocated predictors
+    if (picture_control_set_ptr->enc_mode >= ENC_M8)
+        context_ptr->me_context_ptr->full_pel_mode = PREDICTIVE_FP_MODE;
+    else
+        context_ptr->me_context_ptr->full_pel_mode = EX_FP_MODE;
+    // HME Level 0 Skip
+    // Skip the HME level 0 search of the SBs where the motion field of the
+    // reference is stable, and start HME level 1 from the scaled motion
+    // field MV
+    context_ptr->me_context_ptr->hme_level0_skip =
+        (picture_control_set_ptr->enc_mode >= ENC_M6) ? EB_TRUE : EB_FALSE;
+    // Hash ME
+    // Search the exact matches of the SB blocks in the references of screen
+    // content pictures, and skip the full-pel search of the references
+    // holding the whole SB
+    context_ptr->me_context_ptr->hash_me = picture_control_set_ptr->sc_content_detected ? EB_TRUE : EB_FALSE;
     return return_error;
 };
 
@@ -401,6 +421,9 @@ EbErrorType tf_signal_derivation_me_kernel_oq(
         context_ptr->me_context_ptr->me_search_method = (picture_control_set_ptr->enc_mode <= ENC_M1) ?
         FULL_SAD_SEARCH :
         SUB_SAD_SEARCH;
+    context_ptr->me_context_ptr->full_pel_mode = EX_FP_MODE;
+    context_ptr->me_context_ptr->hme_level0_skip = EB_FALSE;
+    context_ptr->me_context_ptr->hash_me = EB_FALSE;
     return return_error;
 };
 
@@ -535,22 +558,47 @@ EbErrorType ComputeDecimatedZzSad(
     return return_error;
 }
 
-/************************************************
- * Motion Analysis Kernel
- * The Motion Analysis performs  Motion Estimation
- * This process has access to the current input picture as well as
- * the input pictures, which the current picture references according
- * to the prediction structure pattern.  The Motion Analysis process is multithreaded,
- * so pictures can be processed out of order as long as all inputs are available.
- ************************************************/
-void* motion_estimation_kernel(void *input_ptr)
+/******************************************************
+ * set_external_motion_field
+ *   Maps the motion sent with the picture to one of its references: the
+ *   field reference at the same distance, else the nearest one on the same
+ *   side, whose MVs are then scaled
+ ******************************************************/
+static void set_external_motion_field(
+    const ExternalMotionField *external_field,
+    int64_t                    ref_distance,
+    MeMotionField             *motion_field)
+{
+    uint32_t field_ref_index;
+
+    motion_field->sb_mv = NULL;
+    motion_field->sb_sad = NULL;
+    motion_field->ref_distance = ref_distance;
+    for (field_ref_index = 0; field_ref_index < external_field->ref_count; field_ref_index++) {
+        const int64_t mv_distance = external_field->ref_distance[field_ref_index];
+        if ((mv_distance > 0) != (ref_distance > 0))
+            continue;
+        if (motion_field->sb_mv == NULL ||
+            ABS(mv_distance - ref_distance) < ABS(motion_field->mv_distance - ref_distance)) {
+            motion_field->sb_mv = external_field->sb_mv[field_ref_index];
+            motion_field->mv_distance = mv_distance;
+        }
+    }
+}
+
+/******************************************************
+ * Motion Estimation Task
+ *   Processes one input object of the Motion Estimation process and
+ *   releases it. Called by motion_estimation_kernel, or directly by the
+ *   encoder task scheduler when the task pool is enabled.
+ ******************************************************/
+void motion_estimation_task(void *input_ptr, EbObjectWrapper *inputResultsWrapperPtr)
 {
     MotionEstimationContext_t   *context_ptr = (MotionEstimationContext_t*)input_ptr;
 
     PictureParentControlSet   *picture_control_set_ptr;
     SequenceControlSet        *sequence_control_set_ptr;
 
-    EbObjectWrapper           *inputResultsWrapperPtr;
     PictureDecisionResults    *inputResultsPtr;
 
     EbObjectWrapper           *outputResultsWrapperPtr;
@@ -572,6 +620,8 @@ void* motion_estimation_kernel(void *input_ptr)
     uint32_t                       sb_width;
     uint32_t                       sb_height;
     uint32_t                       lcuRow;
+    uint32_t                       list_index;
+    uint32_t                       ref_pic_index;
 
     EbPaReferenceObject       *paReferenceObject;
     EbPictureBufferDesc       *quarter_picture_ptr;
@@ -590,316 +640,392 @@ void* motion_estimation_kernel(void *input_ptr)
     EbAsm                      asm_type;
     MdRateEstimationContext   *md_rate_estimation_array;
 
-    for (;;) {
-        // Get Input Full Object
-        eb_get_full_object(
-            context_ptr->picture_decision_results_input_fifo_ptr,
-            &inputResultsWrapperPtr);
+    inputResultsPtr = (PictureDecisionResults*)inputResultsWrapperPtr->object_ptr;
+    picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
+    sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+
+    paReferenceObject = (EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
+    // Set 1/4 and 1/16 ME input buffer(s); filtered or decimated
+    quarter_picture_ptr = paReferenceObject->me_quarter_picture_ptr;
+    sixteenth_picture_ptr = paReferenceObject->me_sixteenth_picture_ptr;
+    input_padded_picture_ptr = (EbPictureBufferDesc*)paReferenceObject->input_padded_picture_ptr;
+
+    input_picture_ptr = picture_control_set_ptr->enhanced_picture_ptr;
+
+    asm_type = sequence_control_set_ptr->encode_context_ptr->asm_type;
+    // Increment the MD Rate Estimation array pointer to point to the right address based on the QP and slice type
+    md_rate_estimation_array = (MdRateEstimationContext*)sequence_control_set_ptr->encode_context_ptr->md_rate_estimation_array;
+    md_rate_estimation_array += picture_control_set_ptr->slice_type * TOTAL_NUMBER_OF_QP_VALUES + picture_control_set_ptr->picture_qp;
+    // Reset MD rate Estimation table to initial values by copying from md_rate_estimation_array
+    EB_MEMCPY(&(context_ptr->me_context_ptr->mvd_bits_array[0]), &(md_rate_estimation_array->mvd_bits[0]), sizeof(EbBitFraction)*NUMBER_OF_MVD_CASES);
+    ///context_ptr->me_context_ptr->lambda = lambda_mode_decision_ld_sad_qp_scaling[picture_control_set_ptr->picture_qp];
+    context_ptr->me_context_ptr->me_alt_ref = inputResultsPtr->task_type == 1 ? EB_TRUE : EB_FALSE;
+
+    // Lambda Assignement
+    if (sequence_control_set_ptr->static_config.pred_structure == EB_PRED_RANDOM_ACCESS) {
+        if (picture_control_set_ptr->temporal_layer_index == 0)
+            context_ptr->me_context_ptr->lambda = lambda_mode_decision_ra_sad[picture_control_set_ptr->picture_qp];
+        else if (picture_control_set_ptr->temporal_layer_index < 3)
+            context_ptr->me_context_ptr->lambda = lambda_mode_decision_ra_sad_qp_scaling_l1[picture_control_set_ptr->picture_qp];
+        else
+            context_ptr->me_context_ptr->lambda = lambda_mode_decision_ra_sad_qp_scaling_l3[picture_control_set_ptr->picture_qp];
+    }
+    else {
+        if (picture_control_set_ptr->temporal_layer_index == 0)
+            context_ptr->me_context_ptr->lambda = lambda_mode_decision_ld_sad[picture_control_set_ptr->picture_qp];
+        else
+            context_ptr->me_context_ptr->lambda = lambda_mode_decision_ld_sad_qp_scaling[picture_control_set_ptr->picture_qp];
+    }
+    if (inputResultsPtr->task_type == 0)
+    {
 
-        inputResultsPtr = (PictureDecisionResults*)inputResultsWrapperPtr->object_ptr;
-        picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
-        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-
-        paReferenceObject = (EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
-        // Set 1/4 and 1/16 ME input buffer(s); filtered or decimated
-        quarter_picture_ptr = (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) ?
-            (EbPictureBufferDesc*)paReferenceObject->quarter_filtered_picture_ptr :
-            (EbPictureBufferDesc*)paReferenceObject->quarter_decimated_picture_ptr;
-
-        sixteenth_picture_ptr = (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) ?
-            (EbPictureBufferDesc*)paReferenceObject->sixteenth_filtered_picture_ptr :
-            (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr;
-        input_padded_picture_ptr = (EbPictureBufferDesc*)paReferenceObject->input_padded_picture_ptr;
-
-        input_picture_ptr = picture_control_set_ptr->enhanced_picture_ptr;
-
-        asm_type = sequence_control_set_ptr->encode_context_ptr->asm_type;
-        // Increment the MD Rate Estimation array pointer to point to the right address based on the QP and slice type
-        md_rate_estimation_array = (MdRateEstimationContext*)sequence_control_set_ptr->encode_context_ptr->md_rate_estimation_array;
-        md_rate_estimation_array += picture_control_set_ptr->slice_type * TOTAL_NUMBER_OF_QP_VALUES + picture_control_set_ptr->picture_qp;
-        // Reset MD rate Estimation table to initial values by copying from md_rate_estimation_array
-        EB_MEMCPY(&(context_ptr->me_context_ptr->mvd_bits_array[0]), &(md_rate_estimation_array->mvd_bits[0]), sizeof(EbBitFraction)*NUMBER_OF_MVD_CASES);
-        ///context_ptr->me_context_ptr->lambda = lambda_mode_decision_ld_sad_qp_scaling[picture_control_set_ptr->picture_qp];
-        context_ptr->me_context_ptr->me_alt_ref = inputResultsPtr->task_type == 1 ? EB_TRUE : EB_FALSE;
-
-        // Lambda Assignement
-        if (sequence_control_set_ptr->static_config.pred_structure == EB_PRED_RANDOM_ACCESS) {
-            if (picture_control_set_ptr->temporal_layer_index == 0)
-                context_ptr->me_context_ptr->lambda = lambda_mode_decision_ra_sad[picture_control_set_ptr->picture_qp];
-            else if (picture_control_set_ptr->temporal_layer_index < 3)
-                context_ptr->me_context_ptr->lambda = lambda_mode_decision_ra_sad_qp_scaling_l1[picture_control_set_ptr->picture_qp];
-            else
-                context_ptr->me_context_ptr->lambda = lambda_mode_decision_ra_sad_qp_scaling_l3[picture_control_set_ptr->picture_qp];
-        }
-        else {
-            if (picture_control_set_ptr->temporal_layer_index == 0)
-                context_ptr->me_context_ptr->lambda = lambda_mode_decision_ld_sad[picture_control_set_ptr->picture_qp];
-            else
-                context_ptr->me_context_ptr->lambda = lambda_mode_decision_ld_sad_qp_scaling[picture_control_set_ptr->picture_qp];
-        }
-        if (inputResultsPtr->task_type == 0)
-        {
+        // ME Kernel Signal(s) derivation
+        signal_derivation_me_kernel_oq(
+            sequence_control_set_ptr,
+            picture_control_set_ptr,
+            context_ptr);
 
-            // ME Kernel Signal(s) derivation
-            signal_derivation_me_kernel_oq(
-                sequence_control_set_ptr,
-                picture_control_set_ptr,
-                context_ptr);
-
-            // Segments
-            segment_index = inputResultsPtr->segment_index;
-            picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
-            picture_height_in_sb = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
-            SEGMENT_CONVERT_IDX_TO_XY(segment_index, xSegmentIndex, ySegmentIndex, picture_control_set_ptr->me_segments_column_count);
-            xLcuStartIndex = SEGMENT_START_IDX(xSegmentIndex, picture_width_in_sb, picture_control_set_ptr->me_segments_column_count);
-            xLcuEndIndex = SEGMENT_END_IDX(xSegmentIndex, picture_width_in_sb, picture_control_set_ptr->me_segments_column_count);
-            yLcuStartIndex = SEGMENT_START_IDX(ySegmentIndex, picture_height_in_sb, picture_control_set_ptr->me_segments_row_count);
-            yLcuEndIndex = SEGMENT_END_IDX(ySegmentIndex, picture_height_in_sb, picture_control_set_ptr->me_segments_row_count);
-            // *** MOTION ESTIMATION CODE ***
-            if (picture_control_set_ptr->slice_type != I_SLICE) {
-                // SB Loop
-                for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
-                    for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
-                        sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
-                        sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
-                        sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
+        // Segments
+        segment_index = inputResultsPtr->segment_index;
+        picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
+        picture_height_in_sb = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
+        SEGMENT_CONVERT_IDX_TO_XY(segment_index, xSegmentIndex, ySegmentIndex, picture_control_set_ptr->me_segments_column_count);
+        xLcuStartIndex = SEGMENT_START_IDX(xSegmentIndex, picture_width_in_sb, picture_control_set_ptr->me_segments_column_count);
+        xLcuEndIndex = SEGMENT_END_IDX(xSegmentIndex, picture_width_in_sb, picture_control_set_ptr->me_segments_column_count);
+        yLcuStartIndex = SEGMENT_START_IDX(ySegmentIndex, picture_height_in_sb, picture_control_set_ptr->me_segments_row_count);
+        yLcuEndIndex = SEGMENT_END_IDX(ySegmentIndex, picture_height_in_sb, picture_control_set_ptr->me_segments_row_count);
+        // *** MOTION ESTIMATION CODE ***
+        if (picture_control_set_ptr->slice_type != I_SLICE) {
+            // Motion sent with the picture, or the motion of the leader for
+            // the followers of a ladder
+            const ExternalMotionField *external_field = picture_control_set_ptr->external_motion_field;
+            EncodeContext *encode_context_ptr = sequence_control_set_ptr->encode_context_ptr;
+            if (encode_context_ptr->ladder && encode_context_ptr->ladder_rendition_index && !picture_control_set_ptr->is_overlay)
+                external_field = eb_ladder_get_motion(
+                    encode_context_ptr->ladder,
+                    encode_context_ptr->ladder_rendition_index,
+                    picture_control_set_ptr->picture_number);
+            context_ptr->me_context_ptr->segment_sb_x_start = xLcuStartIndex;
+            context_ptr->me_context_ptr->segment_sb_x_end = xLcuEndIndex;
+            context_ptr->me_context_ptr->segment_sb_y_start = yLcuStartIndex;
+            context_ptr->me_context_ptr->hme_level0_eligible_count = 0;
+            context_ptr->me_context_ptr->hme_level0_skip_count = 0;
+            context_ptr->me_context_ptr->external_refine_only =
+                (external_field && external_field->refine_only) ? EB_TRUE : EB_FALSE;
+            for (list_index = REF_LIST_0; list_index < MAX_NUM_OF_REF_PIC_LIST; ++list_index) {
+                const uint8_t ref_count = (list_index == REF_LIST_0) ?
+                    picture_control_set_ptr->ref_list0_count :
+                    (picture_control_set_ptr->slice_type == B_SLICE) ? picture_control_set_ptr->ref_list1_count : 0;
+                for (ref_pic_index = 0; ref_pic_index < MAX_REF_IDX; ++ref_pic_index) {
+                    MeMotionField *motion_field = &context_ptr->me_context_ptr->motion_field[list_index][ref_pic_index];
+                    MeMotionField *external_motion_field = &context_ptr->me_context_ptr->external_motion_field[list_index][ref_pic_index];
+                    motion_field->sb_mv = NULL;
+                    external_motion_field->sb_mv = NULL;
+                    if (ref_pic_index >= ref_count)
+                        continue;
+                    const int64_t ref_distance = (int64_t)picture_control_set_ptr->picture_number -
+                        (int64_t)picture_control_set_ptr->ref_pic_poc_array[list_index][ref_pic_index];
+                    if (external_field)
+                        set_external_motion_field(
+                            external_field,
+                            ref_distance,
+                            external_motion_field);
+                    if (context_ptr->me_context_ptr->full_pel_mode != PREDICTIVE_FP_MODE && !context_ptr->me_context_ptr->hme_level0_skip)
+                        continue;
+                    // Motion field of the reference: pictures are dispatched
+                    // to ME in display order, so only the references
+                    // preceding this picture can be waited for
+                    EbPaReferenceObject *field_reference_object =
+                        (EbPaReferenceObject*)picture_control_set_ptr->ref_pa_pic_ptr_array[list_index][ref_pic_index]->object_ptr;
+                    if (ref_distance > 0 && field_reference_object->slice_type != I_SLICE) {
+                        eb_block_on_semaphore(field_reference_object->me_mv_done_semaphore);
+                        eb_post_semaphore(field_reference_object->me_mv_done_semaphore);
+                        if (field_reference_object->me_mv_distance > 0) {
+                            motion_field->sb_mv = field_reference_object->sb_me_mv;
+                            motion_field->sb_sad = field_reference_object->sb_me_sad;
+                            motion_field->mv_distance = field_reference_object->me_mv_distance;
+                            motion_field->ref_distance = ref_distance;
+                        }
+                    }
+                }
+            }
+            // SB Loop
+            for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
+                for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
+                    sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
+                    sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
+                    sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
 
-                        sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : BLOCK_SIZE_64;
-                        sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : BLOCK_SIZE_64;
+                    sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : BLOCK_SIZE_64;
+                    sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : BLOCK_SIZE_64;
 
-                        // Load the SB from the input to the intermediate SB buffer
-                        bufferIndex = (input_picture_ptr->origin_y + sb_origin_y) * input_picture_ptr->stride_y + input_picture_ptr->origin_x + sb_origin_x;
+                    // Load the SB from the input to the intermediate SB buffer
+                    bufferIndex = (input_picture_ptr->origin_y + sb_origin_y) * input_picture_ptr->stride_y + input_picture_ptr->origin_x + sb_origin_x;
 
-                        context_ptr->me_context_ptr->hme_search_type = HME_RECTANGULAR;
+                    context_ptr->me_context_ptr->hme_search_type = HME_RECTANGULAR;
 
-                        for (lcuRow = 0; lcuRow < BLOCK_SIZE_64; lcuRow++) {
-                            EB_MEMCPY((&(context_ptr->me_context_ptr->sb_buffer[lcuRow * BLOCK_SIZE_64])), (&(input_picture_ptr->buffer_y[bufferIndex + lcuRow * input_picture_ptr->stride_y])), BLOCK_SIZE_64 * sizeof(uint8_t));
-                        }
+                    for (lcuRow = 0; lcuRow < BLOCK_SIZE_64; lcuRow++) {
+                        EB_MEMCPY((&(context_ptr->me_context_ptr->sb_buffer[lcuRow * BLOCK_SIZE_64])), (&(input_picture_ptr->buffer_y[bufferIndex + lcuRow * input_picture_ptr->stride_y])), BLOCK_SIZE_64 * sizeof(uint8_t));
+                    }
+
+                    {
+                        uint8_t * src_ptr = &input_padded_picture_ptr->buffer_y[bufferIndex];
 
+                        //_MM_HINT_T0     //_MM_HINT_T1    //_MM_HINT_T2//_MM_HINT_NTA
+                        uint32_t i;
+                        for (i = 0; i < sb_height; i++)
                         {
-                            uint8_t * src_ptr = &input_padded_picture_ptr->buffer_y[bufferIndex];
-
-                            //_MM_HINT_T0     //_MM_HINT_T1    //_MM_HINT_T2//_MM_HINT_NTA
-                            uint32_t i;
-                            for (i = 0; i < sb_height; i++)
-                            {
-                                char const* p = (char const*)(src_ptr + i * input_padded_picture_ptr->stride_y);
-                                _mm_prefetch(p, _MM_HINT_T2);
-                            }
+                            char const* p = (char const*)(src_ptr + i * input_padded_picture_ptr->stride_y);
+                            _mm_prefetch(p, _MM_HINT_T2);
                         }
+                    }
 
-                        context_ptr->me_context_ptr->sb_src_ptr = &input_padded_picture_ptr->buffer_y[bufferIndex];
-                        context_ptr->me_context_ptr->sb_src_stride = input_padded_picture_ptr->stride_y;
-                        // Load the 1/4 decimated SB from the 1/4 decimated input to the 1/4 intermediate SB buffer
-                        if (context_ptr->me_context_ptr->enable_hme_level1_flag) {
-                            bufferIndex = (quarter_picture_ptr->origin_y + (sb_origin_y >> 1)) * quarter_picture_ptr->stride_y + quarter_picture_ptr->origin_x + (sb_origin_x >> 1);
+                    context_ptr->me_context_ptr->sb_src_ptr = &input_padded_picture_ptr->buffer_y[bufferIndex];
+                    context_ptr->me_context_ptr->sb_src_stride = input_padded_picture_ptr->stride_y;
+                    // Load the 1/4 decimated SB from the 1/4 decimated input to the 1/4 intermediate SB buffer
+                    if (context_ptr->me_context_ptr->enable_hme_level1_flag) {
+                        bufferIndex = (quarter_picture_ptr->origin_y + (sb_origin_y >> 1)) * quarter_picture_ptr->stride_y + quarter_picture_ptr->origin_x + (sb_origin_x >> 1);
 
-                            for (lcuRow = 0; lcuRow < (sb_height >> 1); lcuRow++) {
-                                EB_MEMCPY((&(context_ptr->me_context_ptr->quarter_sb_buffer[lcuRow * context_ptr->me_context_ptr->quarter_sb_buffer_stride])), (&(quarter_picture_ptr->buffer_y[bufferIndex + lcuRow * quarter_picture_ptr->stride_y])), (sb_width >> 1) * sizeof(uint8_t));
-                            }
+                        for (lcuRow = 0; lcuRow < (sb_height >> 1); lcuRow++) {
+                            EB_MEMCPY((&(context_ptr->me_context_ptr->quarter_sb_buffer[lcuRow * context_ptr->me_context_ptr->quarter_sb_buffer_stride])), (&(quarter_picture_ptr->buffer_y[bufferIndex + lcuRow * quarter_picture_ptr->stride_y])), (sb_width >> 1) * sizeof(uint8_t));
                         }
+                    }
+
+                    // Load the 1/16 decimated SB from the 1/16 decimated input to the 1/16 intermediate SB buffer
+                    if (context_ptr->me_context_ptr->enable_hme_level0_flag) {
+                        bufferIndex = (sixteenth_picture_ptr->origin_y + (sb_origin_y >> 2)) * sixteenth_picture_ptr->stride_y + sixteenth_picture_ptr->origin_x + (sb_origin_x >> 2);
 
-                        // Load the 1/16 decimated SB from the 1/16 decimated input to the 1/16 intermediate SB buffer
-                        if (context_ptr->me_context_ptr->enable_hme_level0_flag) {
-                            bufferIndex = (sixteenth_picture_ptr->origin_y + (sb_origin_y >> 2)) * sixteenth_picture_ptr->stride_y + sixteenth_picture_ptr->origin_x + (sb_origin_x >> 2);
-
-                            {
-                                uint8_t  *framePtr = &sixteenth_picture_ptr->buffer_y[bufferIndex];
-                                uint8_t  *localPtr = context_ptr->me_context_ptr->sixteenth_sb_buffer;
-                                if (context_ptr->me_context_ptr->hme_search_method == FULL_SAD_SEARCH) {
-                                    for (lcuRow = 0; lcuRow < (sb_height >> 2); lcuRow += 1) {
-                                        EB_MEMCPY(localPtr, framePtr, (sb_width >> 2) * sizeof(uint8_t));
-                                        localPtr += 16;
-                                        framePtr += sixteenth_picture_ptr->stride_y;
-                                    }
+                        {
+                            uint8_t  *framePtr = &sixteenth_picture_ptr->buffer_y[bufferIndex];
+                            uint8_t  *localPtr = context_ptr->me_context_ptr->sixteenth_sb_buffer;
+                            if (context_ptr->me_context_ptr->hme_search_method == FULL_SAD_SEARCH) {
+                                for (lcuRow = 0; lcuRow < (sb_height >> 2); lcuRow += 1) {
+                                    EB_MEMCPY(localPtr, framePtr, (sb_width >> 2) * sizeof(uint8_t));
+                                    localPtr += 16;
+                                    framePtr += sixteenth_picture_ptr->stride_y;
                                 }
-                                else {
-                                    for (lcuRow = 0; lcuRow < (sb_height >> 2); lcuRow += 2) {
-                                        EB_MEMCPY(localPtr, framePtr, (sb_width >> 2) * sizeof(uint8_t));
-                                        localPtr += 16;
-                                        framePtr += sixteenth_picture_ptr->stride_y << 1;
-                                    }
+                            }
+                            else {
+                                for (lcuRow = 0; lcuRow < (sb_height >> 2); lcuRow += 2) {
+                                    EB_MEMCPY(localPtr, framePtr, (sb_width >> 2) * sizeof(uint8_t));
+                                    localPtr += 16;
+                                    framePtr += sixteenth_picture_ptr->stride_y << 1;
                                 }
                             }
                         }
-                        context_ptr->me_context_ptr->me_alt_ref = EB_FALSE;
-
-                        motion_estimate_lcu(
-                            picture_control_set_ptr,
-                            sb_index,
-                            sb_origin_x,
-                            sb_origin_y,
-                            context_ptr->me_context_ptr,
-                            input_picture_ptr);
                     }
+                    context_ptr->me_context_ptr->me_alt_ref = EB_FALSE;
+
+                    motion_estimate_lcu(
+                        picture_control_set_ptr,
+                        sb_index,
+                        sb_origin_x,
+                        sb_origin_y,
+                        context_ptr->me_context_ptr,
+                        input_picture_ptr);
+
+                    // Motion field of the pictures referencing this one
+                    paReferenceObject->sb_me_mv[sb_index] =
+                        ((uint32_t)(uint16_t)picture_control_set_ptr->me_results[sb_index]->me_mv_array[0][0].y_mv << 16) |
+                        (uint16_t)picture_control_set_ptr->me_results[sb_index]->me_mv_array[0][0].x_mv;
+                    paReferenceObject->sb_me_sad[sb_index] =
+                        context_ptr->me_context_ptr->p_sb_best_sad[REF_LIST_0][0][ME_TIER_ZERO_PU_64x64];
                 }
             }
-        if ( picture_control_set_ptr->intra_pred_mode > 4)
-                // *** OPEN LOOP INTRA CANDIDATE SEARCH CODE ***
-            {
-                // SB Loop
-                for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
-                    for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
-                        sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
-                        sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
-
-                        sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
-
-                        open_loop_intra_search_sb(
-                            picture_control_set_ptr,
-                            sb_index,
-                            context_ptr,
-                            input_picture_ptr,
-                            asm_type);
-                    }
+            if (context_ptr->me_context_ptr->hme_level0_eligible_count) {
+                eb_block_on_mutex(encode_context_ptr->hme_level0_stat_mutex);
+                encode_context_ptr->hme_level0_eligible_count += context_ptr->me_context_ptr->hme_level0_eligible_count;
+                encode_context_ptr->hme_level0_skip_count += context_ptr->me_context_ptr->hme_level0_skip_count;
+                eb_release_mutex(encode_context_ptr->hme_level0_stat_mutex);
+            }
+        }
+    if ( picture_control_set_ptr->intra_pred_mode > 4)
+            // *** OPEN LOOP INTRA CANDIDATE SEARCH CODE ***
+        {
+            // SB Loop
+            for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
+                for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
+                    sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
+                    sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
+
+                    sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
+
+                    open_loop_intra_search_sb(
+                        picture_control_set_ptr,
+                        sb_index,
+                        context_ptr,
+                        input_picture_ptr,
+                        asm_type);
                 }
             }
+        }
 
-            // ZZ SADs Computation
-            // 1 lookahead frame is needed to get valid (0,0) SAD
-            if (sequence_control_set_ptr->static_config.look_ahead_distance != 0) {
-                // when DG is ON, the ZZ SADs are computed @ the PD process
-                {
-                    // ZZ SADs Computation using decimated picture
-                    if (picture_control_set_ptr->picture_number > 0) {
-                        ComputeDecimatedZzSad(
-                            context_ptr,
-                            sequence_control_set_ptr,
-                            picture_control_set_ptr,
-                            (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr, // Hsan: always use decimated for ZZ SAD derivation until studying the trade offs and regenerating the activity threshold
-                            xLcuStartIndex,
-                            xLcuEndIndex,
-                            yLcuStartIndex,
-                            yLcuEndIndex);
-                    }
+        // ZZ SADs Computation
+        // 1 lookahead frame is needed to get valid (0,0) SAD
+        if (sequence_control_set_ptr->static_config.look_ahead_distance != 0) {
+            // when DG is ON, the ZZ SADs are computed @ the PD process
+            {
+                // ZZ SADs Computation using decimated picture
+                if (picture_control_set_ptr->picture_number > 0) {
+                    ComputeDecimatedZzSad(
+                        context_ptr,
+                        sequence_control_set_ptr,
+                        picture_control_set_ptr,
+                        (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr, // Hsan: always use decimated for ZZ SAD derivation until studying the trade offs and regenerating the activity threshold
+                        xLcuStartIndex,
+                        xLcuEndIndex,
+                        yLcuStartIndex,
+                        yLcuEndIndex);
                 }
             }
+        }
 
-            // Calculate the ME Distortion and OIS Historgrams
-
-            eb_block_on_mutex(picture_control_set_ptr->rc_distortion_histogram_mutex);
+        // Calculate the ME Distortion and OIS Historgrams
 
-            if (sequence_control_set_ptr->static_config.rate_control_mode) {
-                if (picture_control_set_ptr->slice_type != I_SLICE) {
-                    uint16_t sadIntervalIndex;
-                    for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
-                        for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
-                            sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
-                            sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
-                            sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : BLOCK_SIZE_64;
-                            sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : BLOCK_SIZE_64;
+        eb_block_on_mutex(picture_control_set_ptr->rc_distortion_histogram_mutex);
 
-                            sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
-                            picture_control_set_ptr->inter_sad_interval_index[sb_index] = 0;
-                            picture_control_set_ptr->intra_sad_interval_index[sb_index] = 0;
+        if (sequence_control_set_ptr->static_config.rate_control_mode) {
+            if (picture_control_set_ptr->slice_type != I_SLICE) {
+                uint16_t sadIntervalIndex;
+                for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
+                    for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
+                        sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
+                        sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
+                        sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : BLOCK_SIZE_64;
+                        sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : BLOCK_SIZE_64;
 
-                            if (sb_width == BLOCK_SIZE_64 && sb_height == BLOCK_SIZE_64) {
-                                sadIntervalIndex = (uint16_t)(picture_control_set_ptr->rc_me_distortion[sb_index] >> (12 - SAD_PRECISION_INTERVAL));//change 12 to 2*log2(64)
+                        sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
+                        picture_control_set_ptr->inter_sad_interval_index[sb_index] = 0;
+                        picture_control_set_ptr->intra_sad_interval_index[sb_index] = 0;
 
-                                // printf("%d\n", sadIntervalIndex);
+                        if (sb_width == BLOCK_SIZE_64 && sb_height == BLOCK_SIZE_64) {
+                            sadIntervalIndex = (uint16_t)(picture_control_set_ptr->rc_me_distortion[sb_index] >> (12 - SAD_PRECISION_INTERVAL));//change 12 to 2*log2(64)
 
-                                sadIntervalIndex = (uint16_t)(sadIntervalIndex >> 2);
-                                if (sadIntervalIndex > (NUMBER_OF_SAD_INTERVALS >> 1) - 1) {
-                                    uint16_t sadIntervalIndexTemp = sadIntervalIndex - ((NUMBER_OF_SAD_INTERVALS >> 1) - 1);
+                            sadIntervalIndex = (uint16_t)(sadIntervalIndex >> 2);
+                            if (sadIntervalIndex > (NUMBER_OF_SAD_INTERVALS >> 1) - 1) {
+                                uint16_t sadIntervalIndexTemp = sadIntervalIndex - ((NUMBER_OF_SAD_INTERVALS >> 1) - 1);
 
-                                    sadIntervalIndex = ((NUMBER_OF_SAD_INTERVALS >> 1) - 1) + (sadIntervalIndexTemp >> 3);
-                                }
-                                if (sadIntervalIndex >= NUMBER_OF_SAD_INTERVALS - 1)
-                                    sadIntervalIndex = NUMBER_OF_SAD_INTERVALS - 1;
+                                sadIntervalIndex = ((NUMBER_OF_SAD_INTERVALS >> 1) - 1) + (sadIntervalIndexTemp >> 3);
+                            }
+                            if (sadIntervalIndex >= NUMBER_OF_SAD_INTERVALS - 1)
+                                sadIntervalIndex = NUMBER_OF_SAD_INTERVALS - 1;
 
-                                picture_control_set_ptr->inter_sad_interval_index[sb_index] = sadIntervalIndex;
+                            picture_control_set_ptr->inter_sad_interval_index[sb_index] = sadIntervalIndex;
 
-                                picture_control_set_ptr->me_distortion_histogram[sadIntervalIndex] ++;
+                            picture_control_set_ptr->me_distortion_histogram[sadIntervalIndex] ++;
 
-                                intra_sad_interval_index = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64] >> 4;
-                                intra_sad_interval_index = (uint16_t)(intra_sad_interval_index >> 2);
-                                if (intra_sad_interval_index > (NUMBER_OF_SAD_INTERVALS >> 1) - 1) {
-                                    uint32_t sadIntervalIndexTemp = intra_sad_interval_index - ((NUMBER_OF_SAD_INTERVALS >> 1) - 1);
+                            intra_sad_interval_index = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64] >> 4;
+                            intra_sad_interval_index = (uint16_t)(intra_sad_interval_index >> 2);
+                            if (intra_sad_interval_index > (NUMBER_OF_SAD_INTERVALS >> 1) - 1) {
+                                uint32_t sadIntervalIndexTemp = intra_sad_interval_index - ((NUMBER_OF_SAD_INTERVALS >> 1) - 1);
 
-                                    intra_sad_interval_index = ((NUMBER_OF_SAD_INTERVALS >> 1) - 1) + (sadIntervalIndexTemp >> 3);
-                                }
-                                if (intra_sad_interval_index >= NUMBER_OF_SAD_INTERVALS - 1)
-                                    intra_sad_interval_index = NUMBER_OF_SAD_INTERVALS - 1;
+                                intra_sad_interval_index = ((NUMBER_OF_SAD_INTERVALS >> 1) - 1) + (sadIntervalIndexTemp >> 3);
+                            }
+                            if (intra_sad_interval_index >= NUMBER_OF_SAD_INTERVALS - 1)
+                                intra_sad_interval_index = NUMBER_OF_SAD_INTERVALS - 1;
 
-                                picture_control_set_ptr->intra_sad_interval_index[sb_index] = intra_sad_interval_index;
+                            picture_control_set_ptr->intra_sad_interval_index[sb_index] = intra_sad_interval_index;
 
-                                picture_control_set_ptr->ois_distortion_histogram[intra_sad_interval_index] ++;
+                            picture_control_set_ptr->ois_distortion_histogram[intra_sad_interval_index] ++;
 
-                                ++picture_control_set_ptr->full_sb_count;
-                            }
+                            ++picture_control_set_ptr->full_sb_count;
                         }
                     }
                 }
-                else {
-                    for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
-                        for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
-                            sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
-                            sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
-                            sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : BLOCK_SIZE_64;
-                            sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : BLOCK_SIZE_64;
+            }
+            else {
+                for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
+                    for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
+                        sb_origin_x = x_lcu_index * sequence_control_set_ptr->sb_sz;
+                        sb_origin_y = y_lcu_index * sequence_control_set_ptr->sb_sz;
+                        sb_width = (sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_width - sb_origin_x : BLOCK_SIZE_64;
+                        sb_height = (sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y) < BLOCK_SIZE_64 ? sequence_control_set_ptr->seq_header.max_frame_height - sb_origin_y : BLOCK_SIZE_64;
 
-                            sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
+                        sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
 
-                            picture_control_set_ptr->inter_sad_interval_index[sb_index] = 0;
-                            picture_control_set_ptr->intra_sad_interval_index[sb_index] = 0;
+                        picture_control_set_ptr->inter_sad_interval_index[sb_index] = 0;
+                        picture_control_set_ptr->intra_sad_interval_index[sb_index] = 0;
 
-                            if (sb_width == BLOCK_SIZE_64 && sb_height == BLOCK_SIZE_64) {
+                        if (sb_width == BLOCK_SIZE_64 && sb_height == BLOCK_SIZE_64) {
 
-                                intra_sad_interval_index = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64] >> 4;
-                                intra_sad_interval_index = (uint16_t)(intra_sad_interval_index >> 2);
-                                if (intra_sad_interval_index > (NUMBER_OF_SAD_INTERVALS >> 1) - 1) {
-                                    uint32_t sadIntervalIndexTemp = intra_sad_interval_index - ((NUMBER_OF_SAD_INTERVALS >> 1) - 1);
+                            intra_sad_interval_index = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64] >> 4;
+                            intra_sad_interval_index = (uint16_t)(intra_sad_interval_index >> 2);
+                            if (intra_sad_interval_index > (NUMBER_OF_SAD_INTERVALS >> 1) - 1) {
+                                uint32_t sadIntervalIndexTemp = intra_sad_interval_index - ((NUMBER_OF_SAD_INTERVALS >> 1) - 1);
 
-                                    intra_sad_interval_index = ((NUMBER_OF_SAD_INTERVALS >> 1) - 1) + (sadIntervalIndexTemp >> 3);
-                                }
-                                if (intra_sad_interval_index >= NUMBER_OF_SAD_INTERVALS - 1)
-                                    intra_sad_interval_index = NUMBER_OF_SAD_INTERVALS - 1;
+                                intra_sad_interval_index = ((NUMBER_OF_SAD_INTERVALS >> 1) - 1) + (sadIntervalIndexTemp >> 3);
+                            }
+                            if (intra_sad_interval_index >= NUMBER_OF_SAD_INTERVALS - 1)
+                                intra_sad_interval_index = NUMBER_OF_SAD_INTERVALS - 1;
 
-                                picture_control_set_ptr->intra_sad_interval_index[sb_index] = intra_sad_interval_index;
+                            picture_control_set_ptr->intra_sad_interval_index[sb_index] = intra_sad_interval_index;
 
-                                picture_control_set_ptr->ois_distortion_histogram[intra_sad_interval_index] ++;
+                            picture_control_set_ptr->ois_distortion_histogram[intra_sad_interval_index] ++;
 
-                                ++picture_control_set_ptr->full_sb_count;
-                            }
+                            ++picture_control_set_ptr->full_sb_count;
                         }
                     }
                 }
             }
+        }
 
-            eb_release_mutex(picture_control_set_ptr->rc_distortion_histogram_mutex);
+        eb_release_mutex(picture_control_set_ptr->rc_distortion_histogram_mutex);
 
-            // Get Empty Results Object
-            eb_get_empty_object(
-                context_ptr->motion_estimation_results_output_fifo_ptr,
-                &outputResultsWrapperPtr);
+        // Get Empty Results Object
+        eb_get_empty_object(
+            context_ptr->motion_estimation_results_output_fifo_ptr,
+            &outputResultsWrapperPtr);
 
-            outputResultsPtr = (MotionEstimationResults*)outputResultsWrapperPtr->object_ptr;
-            outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
-            outputResultsPtr->segment_index = segment_index;
+        outputResultsPtr = (MotionEstimationResults*)outputResultsWrapperPtr->object_ptr;
+        outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
+        outputResultsPtr->segment_index = segment_index;
 
-            // Release the Input Results
-            eb_release_object(inputResultsWrapperPtr);
+        // Release the Input Results
+        eb_release_object(inputResultsWrapperPtr);
 
-            // Post the Full Results Object
-            eb_post_full_object(outputResultsWrapperPtr);
+        // Post the Full Results Object
+        eb_post_full_object(outputResultsWrapperPtr);
 
-        }
-        else {
+    }
+    else {
 
-        // ME Kernel Signal(s) derivation
-        tf_signal_derivation_me_kernel_oq(
-            sequence_control_set_ptr,
-            picture_control_set_ptr,
-            context_ptr);
+    // ME Kernel Signal(s) derivation
+    tf_signal_derivation_me_kernel_oq(
+        sequence_control_set_ptr,
+        picture_control_set_ptr,
+        context_ptr);
 
-        // temporal filtering start
-        context_ptr->me_context_ptr->me_alt_ref = EB_TRUE;
-        init_temporal_filtering(picture_control_set_ptr->temp_filt_pcs_list, picture_control_set_ptr, context_ptr, inputResultsPtr->segment_index);
+    // temporal filtering start
+    context_ptr->me_context_ptr->me_alt_ref = EB_TRUE;
+    init_temporal_filtering(picture_control_set_ptr->temp_filt_pcs_list, picture_control_set_ptr, context_ptr, inputResultsPtr->segment_index);
 
-        // Release the Input Results
-        eb_release_object(inputResultsWrapperPtr);
-        }
+    // Release the Input Results
+    eb_release_object(inputResultsWrapperPtr);
     }
+}
+
+/************************************************
+ * Motion Analysis Kernel
+ * The Motion Analysis performs  Motion Estimation
+ * This process has access to the current input picture as well as
+ * the input pictures, which the current picture references according
+ * to the prediction structure pattern.  The Motion Analysis process is multithreaded,
+ * so pictures can be processed out of order as long as all inputs are available.
+ ************************************************/
+void* motion_estimation_kernel(void *input_ptr)
+{
+    MotionEstimationContext_t   *context_ptr = (MotionEstimationContext_t*)input_ptr;
+    EbObjectWrapper           *inputResultsWrapperPtr;
+
+    for (;;) {
+        // Get Input Full Object
+        eb_get_full_object(
+            context_ptr->picture_decision_results_input_fifo_ptr,
+            &inputResultsWrapperPtr);
 
+        motion_estimation_task(
+            input_ptr,
+            inputResultsWrapperPtr);
+    }
     return EB_NULL;
 }
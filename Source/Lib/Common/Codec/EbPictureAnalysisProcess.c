@@ -4598,8 +4598,10 @@ void DownsampleDecimationInputPicture(
     EbPictureBufferDesc           *input_padded_picture_ptr,
     EbPictureBufferDesc           *quarter_decimated_picture_ptr,
     EbPictureBufferDesc           *sixteenth_decimated_picture_ptr) {
-    // Decimate input picture for HME L0 and L1
-    if (picture_control_set_ptr->enable_hme_flag || picture_control_set_ptr->tf_enable_hme_flag) {
+    EbBool quarter_decimated = EB_FALSE;
+    // Decimate input picture for HME L0 and L1, no quarter picture is kept
+    // when the motion searches use the filtered one
+    if (quarter_decimated_picture_ptr && (picture_control_set_ptr->enable_hme_flag || picture_control_set_ptr->tf_enable_hme_flag)) {
         if (picture_control_set_ptr->enable_hme_level1_flag || picture_control_set_ptr->tf_enable_hme_level1_flag) {
             decimation_2d(
                 &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x + input_padded_picture_ptr->origin_y * input_padded_picture_ptr->stride_y],
@@ -4616,19 +4618,31 @@ void DownsampleDecimationInputPicture(
                 quarter_decimated_picture_ptr->height,
                 quarter_decimated_picture_ptr->origin_x,
                 quarter_decimated_picture_ptr->origin_y);
+            quarter_decimated = EB_TRUE;
         }
     }
 
     // Always perform 1/16th decimation as
-    // Sixteenth Input Picture Decimation
-    decimation_2d(
-        &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x + input_padded_picture_ptr->origin_y * input_padded_picture_ptr->stride_y],
-        input_padded_picture_ptr->stride_y,
-        input_padded_picture_ptr->width,
-        input_padded_picture_ptr->height,
-        &sixteenth_decimated_picture_ptr->buffer_y[sixteenth_decimated_picture_ptr->origin_x + sixteenth_decimated_picture_ptr->origin_x*sixteenth_decimated_picture_ptr->stride_y],
-        sixteenth_decimated_picture_ptr->stride_y,
-        4);
+    // Sixteenth Input Picture Decimation, every other sample of the quarter
+    // picture is every fourth sample of the input so it is read instead
+    if (quarter_decimated)
+        decimation_2d(
+            &quarter_decimated_picture_ptr->buffer_y[quarter_decimated_picture_ptr->origin_x + quarter_decimated_picture_ptr->origin_y * quarter_decimated_picture_ptr->stride_y],
+            quarter_decimated_picture_ptr->stride_y,
+            input_padded_picture_ptr->width >> 1,
+            input_padded_picture_ptr->height >> 1,
+            &sixteenth_decimated_picture_ptr->buffer_y[sixteenth_decimated_picture_ptr->origin_x + sixteenth_decimated_picture_ptr->origin_x*sixteenth_decimated_picture_ptr->stride_y],
+            sixteenth_decimated_picture_ptr->stride_y,
+            2);
+    else
+        decimation_2d(
+            &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x + input_padded_picture_ptr->origin_y * input_padded_picture_ptr->stride_y],
+            input_padded_picture_ptr->stride_y,
+            input_padded_picture_ptr->width,
+            input_padded_picture_ptr->height,
+            &sixteenth_decimated_picture_ptr->buffer_y[sixteenth_decimated_picture_ptr->origin_x + sixteenth_decimated_picture_ptr->origin_x*sixteenth_decimated_picture_ptr->stride_y],
+            sixteenth_decimated_picture_ptr->stride_y,
+            4);
 
     generate_padding(
         &sixteenth_decimated_picture_ptr->buffer_y[0],
@@ -4798,22 +4812,140 @@ void DownsampleFilteringInputPicture(
     }
 }
 
-/************************************************
- * Picture Analysis Kernel
- * The Picture Analysis Process pads & decimates the input pictures.
- * The Picture Analysis also includes creating an n-bin Histogram,
- * gathering picture 1st and 2nd moment statistics for each 8x8 block,
- * which are used to compute variance.
- * The Picture Analysis process is multithreaded, so pictures can be
- * processed out of order as long as all inputs are available.
- ************************************************/
-void* picture_analysis_kernel(void *input_ptr)
+/******************************************************
+ * build_picture_pyramid
+ *   Builds the 1/4 and 1/16 levels of the pyramid of a PA reference object,
+ *   and its half-pel planes when it has them, from its padded input picture.
+ *   The levels are read as they are by the open loop ME of every picture
+ *   referencing this one, by the temporal filtering ME and by the picture
+ *   statistics, so they are only rebuilt when the input picture changes
+ *   (temporal filtering, overlay).
+ ******************************************************/
+void build_picture_pyramid(
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPaReferenceObject           *pa_reference_object) {
+    // 1/4 & 1/16 input picture decimation
+    DownsampleDecimationInputPicture(
+        picture_control_set_ptr,
+        pa_reference_object->input_padded_picture_ptr,
+        pa_reference_object->quarter_decimated_picture_ptr,
+        pa_reference_object->sixteenth_decimated_picture_ptr);
+
+    // 1/4 & 1/16 input picture downsampling through filtering
+    if (pa_reference_object->quarter_filtered_picture_ptr)
+        DownsampleFilteringInputPicture(
+            picture_control_set_ptr,
+            pa_reference_object->input_padded_picture_ptr,
+            pa_reference_object->quarter_filtered_picture_ptr,
+            pa_reference_object->sixteenth_filtered_picture_ptr);
+
+    // Half-pel planes of the full resolution picture
+    if (pa_reference_object->pos_b_plane) {
+        SequenceControlSet *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+        interpolate_half_pel_planes(
+            pa_reference_object,
+            sequence_control_set_ptr->encode_context_ptr->asm_type);
+    }
+}
+
+/******************************************************
+ * build_me_hash_table
+ *   Builds the hash ME data of a screen content picture from its padded
+ *   input picture: the 8x8 to 64x64 blocks at every position are added to
+ *   the hash table of its PA reference object, searched by the pictures
+ *   referencing it, and the keys of its aligned blocks are kept for its own
+ *   hash ME. The table is left invalid when the scratch buffers cannot be
+ *   allocated.
+ ******************************************************/
+static void build_me_hash_table(
+    EbPaReferenceObject           *pa_reference_object) {
+    EbPictureBufferDesc *input_padded_picture_ptr = pa_reference_object->input_padded_picture_ptr;
+    const int pic_width = input_padded_picture_ptr->width;
+    const int pic_height = input_padded_picture_ptr->height;
+    const size_t pic_size = (size_t)pic_width * pic_height;
+    uint32_t *block_hash_values[2][2];
+    int8_t *is_block_same[2][3];
+    CRC_CALCULATOR crc_calculator1;
+    CRC_CALCULATOR crc_calculator2;
+    Yv12BufferConfig picture;
+    EbBool allocated = EB_TRUE;
+    int src, block_size, k, j;
+
+    pa_reference_object->hash_table_valid = EB_FALSE;
+    if (av1_hash_table_create(&pa_reference_object->hash_table) != EB_ErrorNone)
+        return;
+
+    for (k = 0; k < 2; k++) {
+        for (j = 0; j < 2; j++) {
+            block_hash_values[k][j] = malloc(sizeof(uint32_t) * pic_size);
+            allocated = allocated && block_hash_values[k][j];
+        }
+        for (j = 0; j < 3; j++) {
+            is_block_same[k][j] = malloc(sizeof(int8_t) * pic_size);
+            allocated = allocated && is_block_same[k][j];
+        }
+    }
+
+    if (allocated) {
+        link_Eb_to_aom_buffer_desc_8bit(
+            input_padded_picture_ptr,
+            &picture);
+        av1_crc_calculator_init(&crc_calculator1, 24, 0x5D6DCB);
+        av1_crc_calculator_init(&crc_calculator2, 24, 0x864CFB);
+
+        av1_generate_block_2x2_hash_value(&picture, block_hash_values[0],
+            is_block_same[0], &crc_calculator1, &crc_calculator2);
+        // 4x4 to 64x64, alternating between the two scratch buffers
+        src = 0;
+        for (block_size = 4; block_size <= (int)BLOCK_SIZE_64; block_size <<= 1) {
+            av1_generate_block_hash_value(&picture, block_size,
+                block_hash_values[src], block_hash_values[!src],
+                is_block_same[src], is_block_same[!src],
+                &crc_calculator1, &crc_calculator2);
+            src = !src;
+            if (block_size >= 8) {
+                const int size_index = block_size == 8 ? 0 : block_size == 16 ? 1 : block_size == 32 ? 2 : 3;
+                const uint32_t stride = pa_reference_object->aligned_block_hash_stride[size_index];
+                int x, y;
+
+                av1_add_to_hash_map_by_row_with_precal_data(
+                    &pa_reference_object->hash_table, block_hash_values[src], is_block_same[src][2],
+                    pic_width, pic_height, block_size);
+                for (y = 0; y + block_size <= pic_height; y += block_size) {
+                    for (x = 0; x + block_size <= pic_width; x += block_size) {
+                        const int pos = y * pic_width + x;
+                        const uint32_t index = (y / block_size) * stride + x / block_size;
+                        pa_reference_object->aligned_block_hash[size_index][0][index] =
+                            av1_get_hash_value1(block_hash_values[src][0][pos], block_size);
+                        pa_reference_object->aligned_block_hash[size_index][1][index] =
+                            block_hash_values[src][1][pos];
+                    }
+                }
+            }
+        }
+        pa_reference_object->hash_table_valid = EB_TRUE;
+    }
+
+    for (k = 0; k < 2; k++) {
+        for (j = 0; j < 2; j++)
+            free(block_hash_values[k][j]);
+        for (j = 0; j < 3; j++)
+            free(is_block_same[k][j]);
+    }
+}
+
+/******************************************************
+ * Picture Analysis Task
+ *   Processes one input object of the Picture Analysis process and
+ *   releases it. Called by picture_analysis_kernel, or directly by the
+ *   encoder task scheduler when the task pool is enabled.
+ ******************************************************/
+void picture_analysis_task(void *input_ptr, EbObjectWrapper *inputResultsWrapperPtr)
 {
     PictureAnalysisContext        *context_ptr = (PictureAnalysisContext*)input_ptr;
     PictureParentControlSet       *picture_control_set_ptr;
     SequenceControlSet            *sequence_control_set_ptr;
 
-    EbObjectWrapper               *inputResultsWrapperPtr;
     ResourceCoordinationResults   *inputResultsPtr;
     EbObjectWrapper               *outputResultsWrapperPtr;
     PictureAnalysisResults        *outputResultsPtr;
@@ -4828,113 +4960,125 @@ void* picture_analysis_kernel(void *input_ptr)
     uint32_t                        sb_total_count;
     EbAsm                           asm_type;
 
-    for (;;) {
-        // Get Input Full Object
-        eb_get_full_object(
-            context_ptr->resource_coordination_results_input_fifo_ptr,
-            &inputResultsWrapperPtr);
+    inputResultsPtr = (ResourceCoordinationResults*)inputResultsWrapperPtr->object_ptr;
+    picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
 
-        inputResultsPtr = (ResourceCoordinationResults*)inputResultsWrapperPtr->object_ptr;
-        picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
+    // There is no need to do processing for overlay picture. Overlay and AltRef share the same results.
+    if (!picture_control_set_ptr->is_overlay)
+    {
+        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+        input_picture_ptr = picture_control_set_ptr->enhanced_picture_ptr;
 
-        // There is no need to do processing for overlay picture. Overlay and AltRef share the same results.
-        if (!picture_control_set_ptr->is_overlay)
-        {
-            sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-            input_picture_ptr = picture_control_set_ptr->enhanced_picture_ptr;
+        paReferenceObject = (EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
+        input_padded_picture_ptr = (EbPictureBufferDesc*)paReferenceObject->input_padded_picture_ptr;
+        // Variance
+        picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
+        pictureHeighInLcu = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
+        sb_total_count = picture_width_in_sb * pictureHeighInLcu;
 
-            paReferenceObject = (EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
-            input_padded_picture_ptr = (EbPictureBufferDesc*)paReferenceObject->input_padded_picture_ptr;
-            // Variance
-            picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
-            pictureHeighInLcu = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
-            sb_total_count = picture_width_in_sb * pictureHeighInLcu;
+        asm_type = sequence_control_set_ptr->encode_context_ptr->asm_type;
 
-            asm_type = sequence_control_set_ptr->encode_context_ptr->asm_type;
+        // Set picture parameters to account for subpicture, picture scantype, and set regions by resolutions
+        SetPictureParametersForStatisticsGathering(
+            sequence_control_set_ptr);
 
-            // Set picture parameters to account for subpicture, picture scantype, and set regions by resolutions
-            SetPictureParametersForStatisticsGathering(
-                sequence_control_set_ptr);
+        // Pad pictures to multiple min cu size
+        PadPictureToMultipleOfMinCuSizeDimensions(
+            sequence_control_set_ptr,
+            input_picture_ptr);
 
-            // Pad pictures to multiple min cu size
-            PadPictureToMultipleOfMinCuSizeDimensions(
-                sequence_control_set_ptr,
-                input_picture_ptr);
+        // Pre processing operations performed on the input picture
+        PicturePreProcessingOperations(
+            picture_control_set_ptr,
+            sequence_control_set_ptr,
+            sb_total_count,
+            asm_type);
+        if (input_picture_ptr->color_format >= EB_YUV422) {
+            // Jing: Do the conversion of 422/444=>420 here since it's multi-threaded kernel
+            //       Reuse the Y, only add cb/cr in the newly created buffer desc
+            //       NOTE: since denoise may change the src, so this part is after PicturePreProcessingOperations()
+            picture_control_set_ptr->chroma_downsampled_picture_ptr->buffer_y = input_picture_ptr->buffer_y;
+            DownSampleChroma(input_picture_ptr, picture_control_set_ptr->chroma_downsampled_picture_ptr);
+        }
+        else
+            picture_control_set_ptr->chroma_downsampled_picture_ptr = input_picture_ptr;
+        // Pad input picture to complete border LCUs
+        PadPictureToMultipleOfLcuDimensions(
+            input_padded_picture_ptr);
+        // 1/4 & 1/16 input pictures
+        build_picture_pyramid(
+            picture_control_set_ptr,
+            paReferenceObject);
+       // Gathering statistics of input picture, including Variance Calculation, Histogram Bins
+        GatheringPictureStatistics(
+            sequence_control_set_ptr,
+            picture_control_set_ptr,
+            picture_control_set_ptr->chroma_downsampled_picture_ptr, //420 input_picture_ptr
+            input_padded_picture_ptr,
+            (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr, // Hsan: always use decimated until studying the trade offs
+            sb_total_count,
+            asm_type);
 
-            // Pre processing operations performed on the input picture
-            PicturePreProcessingOperations(
-                picture_control_set_ptr,
-                sequence_control_set_ptr,
-                sb_total_count,
-                asm_type);
-            if (input_picture_ptr->color_format >= EB_YUV422) {
-                // Jing: Do the conversion of 422/444=>420 here since it's multi-threaded kernel
-                //       Reuse the Y, only add cb/cr in the newly created buffer desc
-                //       NOTE: since denoise may change the src, so this part is after PicturePreProcessingOperations()
-                picture_control_set_ptr->chroma_downsampled_picture_ptr->buffer_y = input_picture_ptr->buffer_y;
-                DownSampleChroma(input_picture_ptr, picture_control_set_ptr->chroma_downsampled_picture_ptr);
-            }
-            else
-                picture_control_set_ptr->chroma_downsampled_picture_ptr = input_picture_ptr;
-            // Pad input picture to complete border LCUs
-            PadPictureToMultipleOfLcuDimensions(
-                input_padded_picture_ptr);
-            // 1/4 & 1/16 input picture decimation
-            DownsampleDecimationInputPicture(
+        if (sequence_control_set_ptr->static_config.screen_content_mode == 2){ // auto detect
+            is_screen_content(
                 picture_control_set_ptr,
-                input_padded_picture_ptr,
-                (EbPictureBufferDesc*)paReferenceObject->quarter_decimated_picture_ptr,
-                (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr);
-
-            // 1/4 & 1/16 input picture downsampling through filtering
-            if (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) {
-                DownsampleFilteringInputPicture(
-                    picture_control_set_ptr,
-                    input_padded_picture_ptr,
-                    (EbPictureBufferDesc*)paReferenceObject->quarter_filtered_picture_ptr,
-                    (EbPictureBufferDesc*)paReferenceObject->sixteenth_filtered_picture_ptr);
-            }
-           // Gathering statistics of input picture, including Variance Calculation, Histogram Bins
-            GatheringPictureStatistics(
-                sequence_control_set_ptr,
-                picture_control_set_ptr,
-                picture_control_set_ptr->chroma_downsampled_picture_ptr, //420 input_picture_ptr
-                input_padded_picture_ptr,
-                (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr, // Hsan: always use decimated until studying the trade offs
-                sb_total_count,
-                asm_type);
-
-            if (sequence_control_set_ptr->static_config.screen_content_mode == 2){ // auto detect
-                is_screen_content(
-                    picture_control_set_ptr,
-                    input_picture_ptr->buffer_y + input_picture_ptr->origin_x + input_picture_ptr->origin_y*input_picture_ptr->stride_y,
-                    0,
-                    input_picture_ptr->stride_y,
-                    sequence_control_set_ptr->seq_header.max_frame_width, sequence_control_set_ptr->seq_header.max_frame_height);
-            }
-            else // off / on
-                picture_control_set_ptr->sc_content_detected = sequence_control_set_ptr->static_config.screen_content_mode;
-
-            // Hold the 64x64 variance and mean in the reference frame
-            uint32_t sb_index;
-            for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
-                paReferenceObject->variance[sb_index] = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64];
-                paReferenceObject->y_mean[sb_index] = picture_control_set_ptr->y_mean[sb_index][ME_TIER_ZERO_PU_64x64];
-            }
+                input_picture_ptr->buffer_y + input_picture_ptr->origin_x + input_picture_ptr->origin_y*input_picture_ptr->stride_y,
+                0,
+                input_picture_ptr->stride_y,
+                sequence_control_set_ptr->seq_header.max_frame_width, sequence_control_set_ptr->seq_header.max_frame_height);
+        }
+        else // off / on
+            picture_control_set_ptr->sc_content_detected = sequence_control_set_ptr->static_config.screen_content_mode;
+
+        // Hash ME data of screen content pictures
+        if (picture_control_set_ptr->sc_content_detected && paReferenceObject->aligned_block_hash[0][0])
+            build_me_hash_table(paReferenceObject);
+
+        // Hold the 64x64 variance and mean in the reference frame
+        uint32_t sb_index;
+        for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+            paReferenceObject->variance[sb_index] = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64];
+            paReferenceObject->y_mean[sb_index] = picture_control_set_ptr->y_mean[sb_index][ME_TIER_ZERO_PU_64x64];
         }
-        // Get Empty Results Object
-        eb_get_empty_object(
-            context_ptr->picture_analysis_results_output_fifo_ptr,
-            &outputResultsWrapperPtr);
+    }
+    // Get Empty Results Object
+    eb_get_empty_object(
+        context_ptr->picture_analysis_results_output_fifo_ptr,
+        &outputResultsWrapperPtr);
+
+    outputResultsPtr = (PictureAnalysisResults*)outputResultsWrapperPtr->object_ptr;
+    outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
 
-        outputResultsPtr = (PictureAnalysisResults*)outputResultsWrapperPtr->object_ptr;
-        outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
+    // Release the Input Results
+    eb_release_object(inputResultsWrapperPtr);
 
-        // Release the Input Results
-        eb_release_object(inputResultsWrapperPtr);
+    // Post the Full Results Object
+    eb_post_full_object(outputResultsWrapperPtr);
+}
+
+/************************************************
+ * Picture Analysis Kernel
+ * The Picture Analysis Process pads & decimates the input pictures.
+ * The Picture Analysis also includes creating an n-bin Histogram,
+ * gathering picture 1st and 2nd moment statistics for each 8x8 block,
+ * which are used to compute variance.
+ * The Picture Analysis process is multithreaded, so pictures can be
+ * processed out of order as long as all inputs are available.
+ ************************************************/
+void* picture_analysis_kernel(void *input_ptr)
+{
+    PictureAnalysisContext        *context_ptr = (PictureAnalysisContext*)input_ptr;
+    EbObjectWrapper               *inputResultsWrapperPtr;
+
+    for (;;) {
+        // Get Input Full Object
+        eb_get_full_object(
+            context_ptr->resource_coordination_results_input_fifo_ptr,
+            &inputResultsWrapperPtr);
 
-        // Post the Full Results Object
-        eb_post_full_object(outputResultsWrapperPtr);
+        picture_analysis_task(
+            input_ptr,
+            inputResultsWrapperPtr);
     }
     return EB_NULL;
 }
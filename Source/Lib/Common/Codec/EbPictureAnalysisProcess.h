@@ -10,6 +10,7 @@
 #include "EbSystemResourceManager.h"
 #include "EbNoiseExtractAVX2.h"
 #include "EbObject.h"
+#include "EbReferenceObject.h"
 /**************************************
  * Context
  **************************************/
@@ -34,6 +35,8 @@ extern EbErrorType picture_analysis_context_ctor(
     EbFifo                      *resource_coordination_results_input_fifo_ptr,
     EbFifo                      *picture_analysis_results_output_fifo_ptr);
 
+extern void picture_analysis_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
+
 extern void* picture_analysis_kernel(void *input_ptr);
 
 void noise_extract_luma_weak(
@@ -49,6 +52,10 @@ void DownsampleFilteringInputPicture(
     EbPictureBufferDesc           *quarter_picture_ptr,
     EbPictureBufferDesc *sixteenth_picture_ptr);
 
+void build_picture_pyramid(
+    PictureParentControlSet       *picture_control_set_ptr,
+    EbPaReferenceObject           *pa_reference_object);
+
 typedef void(*EbWeakLumaFilterType)(
     EbPictureBufferDesc *input_picture_ptr,
     EbPictureBufferDesc *denoised_picture_ptr,
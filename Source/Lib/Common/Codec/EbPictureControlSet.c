@@ -141,23 +141,10 @@ void picture_control_set_dctor(EbPtr p)
     EB_DELETE(obj->ep_luma_dc_sign_level_coeff_neighbor_array);
     EB_DELETE(obj->ep_cb_dc_sign_level_coeff_neighbor_array);
     EB_DELETE(obj->ep_cr_dc_sign_level_coeff_neighbor_array);
-    EB_DELETE(obj->mode_type_neighbor_array);
-    EB_DELETE(obj->partition_context_neighbor_array);
-    EB_DELETE(obj->skip_flag_neighbor_array);
-    EB_DELETE(obj->skip_coeff_neighbor_array);
-    EB_DELETE(obj->luma_dc_sign_level_coeff_neighbor_array);
-    EB_DELETE(obj->cr_dc_sign_level_coeff_neighbor_array);
-    EB_DELETE(obj->cb_dc_sign_level_coeff_neighbor_array);
-    EB_DELETE(obj->inter_pred_dir_neighbor_array);
-    EB_DELETE(obj->ref_frame_type_neighbor_array);
-    EB_DELETE(obj->intra_luma_mode_neighbor_array);
-    EB_DELETE(obj->txfm_context_array);
-    EB_DELETE(obj->segmentation_id_pred_array);
     EB_DELETE(obj->segmentation_neighbor_map);
     EB_DELETE(obj->ep_luma_recon_neighbor_array16bit);
     EB_DELETE(obj->ep_cb_recon_neighbor_array16bit);
     EB_DELETE(obj->ep_cr_recon_neighbor_array16bit);
-    EB_DELETE(obj->interpolation_type_neighbor_array);
 
     for (depth = 0; depth < NEIGHBOR_ARRAY_TOTAL_COUNT; depth++) {
         EB_DELETE(obj->md_intra_luma_mode_neighbor_array[depth]);
@@ -191,7 +178,7 @@ void picture_control_set_dctor(EbPtr p)
     EB_DELETE_PTR_ARRAY(obj->sb_ptr_array, obj->sb_total_count);
     EB_DELETE(obj->coeff_est_entropy_coder_ptr);
     EB_DELETE(obj->bitstream_ptr);
-    EB_DELETE(obj->entropy_coder_ptr);
+    EB_DELETE_PTR_ARRAY(obj->entropy_coding_tile_array, obj->entropy_coding_tile_count);
     EB_DELETE(obj->recon_picture32bit_ptr);
     EB_DELETE(obj->recon_picture16bit_ptr);
     EB_DELETE(obj->recon_picture_ptr);
@@ -252,6 +239,169 @@ EbErrorType create_neighbor_array_units(InitData* data, size_t count)
     return EB_ErrorNone;
 }
 
+static void entropy_coding_tile_dctor(EbPtr p)
+{
+    EntropyCodingTile *obj = (EntropyCodingTile*)p;
+    EB_DELETE(obj->mode_type_neighbor_array);
+    EB_DELETE(obj->partition_context_neighbor_array);
+    EB_DELETE(obj->skip_flag_neighbor_array);
+    EB_DELETE(obj->skip_coeff_neighbor_array);
+    EB_DELETE(obj->luma_dc_sign_level_coeff_neighbor_array);
+    EB_DELETE(obj->cr_dc_sign_level_coeff_neighbor_array);
+    EB_DELETE(obj->cb_dc_sign_level_coeff_neighbor_array);
+    EB_DELETE(obj->inter_pred_dir_neighbor_array);
+    EB_DELETE(obj->ref_frame_type_neighbor_array);
+    EB_DELETE(obj->intra_luma_mode_neighbor_array);
+    EB_DELETE(obj->txfm_context_array);
+    EB_DELETE(obj->segmentation_id_pred_array);
+    EB_DELETE(obj->interpolation_type_neighbor_array);
+    EB_DELETE(obj->entropy_coder_ptr);
+}
+
+static EbErrorType entropy_coding_tile_ctor(
+    EntropyCodingTile *object_ptr,
+    uint32_t           buffer_size)
+{
+    EbErrorType return_error;
+    object_ptr->dctor = entropy_coding_tile_dctor;
+
+    EB_NEW(
+        object_ptr->entropy_coder_ptr,
+        entropy_coder_ctor,
+        buffer_size);
+
+    // Entropy Coding Neighbor Arrays
+    {
+        InitData data[] = {
+            {
+                &object_ptr->mode_type_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->partition_context_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(struct PartitionContext),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->skip_flag_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->skip_coeff_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            // for each 4x4
+            {
+                &object_ptr->luma_dc_sign_level_coeff_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            // for each 4x4
+            {
+                &object_ptr->cr_dc_sign_level_coeff_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            // for each 4x4
+            {
+                &object_ptr->cb_dc_sign_level_coeff_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->inter_pred_dir_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->ref_frame_type_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->intra_luma_mode_neighbor_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->txfm_context_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(TXFM_CONTEXT),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
+            },
+            {
+                &object_ptr->segmentation_id_pred_array,
+                MAX_PICTURE_WIDTH_SIZE,
+                MAX_PICTURE_HEIGHT_SIZE,
+                sizeof(uint8_t),
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                PU_NEIGHBOR_ARRAY_GRANULARITY,
+                NEIGHBOR_ARRAY_UNIT_FULL_MASK,
+            },
+        };
+        return_error = create_neighbor_array_units(data, DIM(data));
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+    }
+    EB_NEW(
+        object_ptr->interpolation_type_neighbor_array,
+        neighbor_array_unit_ctor32,
+        MAX_PICTURE_WIDTH_SIZE,
+        MAX_PICTURE_HEIGHT_SIZE,
+        sizeof(uint32_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    return EB_ErrorNone;
+}
+
 EbErrorType picture_control_set_ctor(
     PictureControlSet *object_ptr,
     EbPtr object_init_data_ptr)
@@ -366,11 +516,16 @@ EbErrorType picture_control_set_ctor(
             eb_picture_buffer_desc_ctor,
             (EbPtr)&coeffBufferDescInitData);
     }
-    // Entropy Coder
-    EB_NEW(
-        object_ptr->entropy_coder_ptr,
-        entropy_coder_ctor,
-        SEGMENT_ENTROPY_BUFFER_SIZE);
+    // Entropy Coding Tiles, sharing the entropy bitstream buffer size
+    object_ptr->entropy_coding_tile_count = MAX(initDataPtr->tile_count, 1);
+    EB_ALLOC_PTR_ARRAY(object_ptr->entropy_coding_tile_array, object_ptr->entropy_coding_tile_count);
+    for (uint16_t tile_idx = 0; tile_idx < object_ptr->entropy_coding_tile_count; ++tile_idx) {
+        EB_NEW(
+            object_ptr->entropy_coding_tile_array[tile_idx],
+            entropy_coding_tile_ctor,
+            SEGMENT_ENTROPY_BUFFER_SIZE / object_ptr->entropy_coding_tile_count);
+    }
+    object_ptr->entropy_coder_ptr = object_ptr->entropy_coding_tile_array[0]->entropy_coder_ptr;
 
     // Packetization process Bitstream
     EB_NEW(
@@ -788,118 +943,6 @@ EbErrorType picture_control_set_ctor(
                 NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
             },
 
-            // Entropy Coding Neighbor Arrays
-            {
-                &object_ptr->mode_type_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->partition_context_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(struct PartitionContext),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->skip_flag_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->skip_coeff_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            // for each 4x4
-            {
-                &object_ptr->luma_dc_sign_level_coeff_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            // for each 4x4
-            {
-                &object_ptr->cr_dc_sign_level_coeff_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            // for each 4x4
-            {
-                &object_ptr->cb_dc_sign_level_coeff_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->inter_pred_dir_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->ref_frame_type_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->intra_luma_mode_neighbor_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->txfm_context_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(TXFM_CONTEXT),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK,
-            },
-            {
-                &object_ptr->segmentation_id_pred_array,
-                MAX_PICTURE_WIDTH_SIZE,
-                MAX_PICTURE_HEIGHT_SIZE,
-                sizeof(uint8_t),
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                PU_NEIGHBOR_ARRAY_GRANULARITY,
-                NEIGHBOR_ARRAY_UNIT_FULL_MASK,
-            },
         };
         return_error = create_neighbor_array_units(data, DIM(data));
         if (return_error == EB_ErrorInsufficientResources)
@@ -944,16 +987,6 @@ EbErrorType picture_control_set_ctor(
         object_ptr->ep_cb_recon_neighbor_array16bit = 0;
         object_ptr->ep_cr_recon_neighbor_array16bit = 0;
     }
-    EB_NEW(
-        object_ptr->interpolation_type_neighbor_array,
-        neighbor_array_unit_ctor32,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint32_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
     //Segmentation neighbor arrays
     EB_NEW(
         object_ptr->segmentation_neighbor_map,
@@ -13679,6 +13679,36 @@ extern "C" {
         MeshPattern mesh_patterns[MAX_MESH_STEP];
     } SpeedFeatures;
 
+    /**************************************
+     * Entropy Coding Tile
+     *   State of the entropy coding of one tile. Tiles are coded
+     *   independently, each in its own bitstream buffer.
+     **************************************/
+    typedef struct EntropyCodingTile
+    {
+        EbDctor                            dctor;
+        EntropyCoder                       *entropy_coder_ptr;
+        uint32_t                           tile_size; // bytes of the coded tile
+        // Entropy Coding Neighbor Arrays
+        NeighborArrayUnit                  *mode_type_neighbor_array;
+        NeighborArrayUnit                  *partition_context_neighbor_array;
+        NeighborArrayUnit                  *intra_luma_mode_neighbor_array;
+        NeighborArrayUnit                  *skip_flag_neighbor_array;
+        NeighborArrayUnit                  *skip_coeff_neighbor_array;
+        NeighborArrayUnit                  *luma_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits (COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit                  *cr_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit                  *cb_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit                  *txfm_context_array;
+        NeighborArrayUnit                  *inter_pred_dir_neighbor_array;
+        NeighborArrayUnit                  *ref_frame_type_neighbor_array;
+        NeighborArrayUnit32                *interpolation_type_neighbor_array;
+
+        NeighborArrayUnit                  *segmentation_id_pred_array;
+        int32_t                            cdef_preset[4];
+        WienerInfo                         wiener_info[MAX_MB_PLANE];
+        SgrprojInfo                        sgrproj_info[MAX_MB_PLANE];
+    } EntropyCodingTile;
+
     typedef struct PictureControlSet
     {
         EbDctor                            dctor;
@@ -13693,7 +13723,7 @@ extern "C" {
 
         struct PictureParentControlSet     *parent_pcs_ptr;  //The parent of this PCS.
         EbObjectWrapper                    *picture_parent_control_set_wrapper_ptr;
-        EntropyCoder                       *entropy_coder_ptr;
+        EntropyCoder                       *entropy_coder_ptr; // entropy coder of the first tile
         // Packetization (used to encode SPS, PPS, etc)
         Bitstream                          *bitstream_ptr;
 
@@ -13720,6 +13750,10 @@ extern "C" {
         EbHandle                              entropy_coding_mutex;
         EbBool                                entropy_coding_in_progress;
         EbBool                                entropy_coding_pic_done;
+        // Entropy Process Tiles
+        EntropyCodingTile                   **entropy_coding_tile_array;
+        uint16_t                              entropy_coding_tile_count;
+        uint16_t                              entropy_coding_tile_done_count;
         EbHandle                              intra_mutex;
         uint32_t                              intra_coded_area;
         uint32_t                              tot_seg_searched_cdef;
@@ -13812,21 +13846,6 @@ extern "C" {
         NeighborArrayUnit                  *ep_luma_dc_sign_level_coeff_neighbor_array;
         NeighborArrayUnit                  *ep_cr_dc_sign_level_coeff_neighbor_array;
         NeighborArrayUnit                  *ep_cb_dc_sign_level_coeff_neighbor_array;
-        // Entropy Coding Neighbor Arrays
-        NeighborArrayUnit                  *mode_type_neighbor_array;
-        NeighborArrayUnit                  *partition_context_neighbor_array;
-        NeighborArrayUnit                  *intra_luma_mode_neighbor_array;
-        NeighborArrayUnit                  *skip_flag_neighbor_array;
-        NeighborArrayUnit                  *skip_coeff_neighbor_array;
-        NeighborArrayUnit                  *luma_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits (COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit                  *cr_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit                  *cb_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit                  *txfm_context_array;
-        NeighborArrayUnit                  *inter_pred_dir_neighbor_array;
-        NeighborArrayUnit                  *ref_frame_type_neighbor_array;
-        NeighborArrayUnit32                *interpolation_type_neighbor_array;
-
-        NeighborArrayUnit                  *segmentation_id_pred_array;
         SegmentationNeighborMap              *segmentation_neighbor_map;
 
         ModeInfo                            **mi_grid_base; //2 SB Rows of mi Data are enough
@@ -13848,9 +13867,6 @@ extern "C" {
         EbEncMode                             enc_mode;
         EbBool                                intra_md_open_loop_flag;
         EbBool                                limit_intra;
-        int32_t                               cdef_preset[4];
-        WienerInfo                            wiener_info[MAX_MB_PLANE];
-        SgrprojInfo                           sgrproj_info[MAX_MB_PLANE];
         SpeedFeatures sf;
         SearchSiteConfig ss_cfg;//CHKN this might be a seq based
         HashTable hash_table;
@@ -13917,6 +13933,32 @@ extern "C" {
         uint8_t           low_dist_logo;
     } SbStat;
 
+    // Motion sent with an input picture (eb_svt_enc_send_picture_with_motion):
+    // per field reference, its distance and the MV of each SB, packed as
+    // the ME motion fields (quarter-pel, x in the low 16 bits)
+    typedef struct ExternalMotionField
+    {
+        EbBool                              valid;
+        EbBool                              refine_only;
+        uint32_t                            ref_count;
+        int32_t                             ref_distance[EB_MAX_MOTION_FIELD_REFS];
+        uint32_t                           *sb_mv[EB_MAX_MOTION_FIELD_REFS];
+    } ExternalMotionField;
+
+    // Input buffer object: the header passed down the pipeline, the motion
+    // sent with the picture and, while a picture sent in place is
+    // referenced, its release callback and the library planes it replaced
+    typedef struct EbInputBufferHeader
+    {
+        EbBufferHeaderType                  header;
+        ExternalMotionField                 motion_field;
+        EbInputReleaseCallback              release_callback;
+        void                               *release_context;
+        uint8_t                            *buffer_y;
+        uint8_t                            *buffer_cb;
+        uint8_t                            *buffer_cr;
+    } EbInputBufferHeader;
+
     //CHKN
     // Add the concept of PictureParentControlSet which is a subset of the old PictureControlSet.
     // It actually holds only high level Picture based control data:(GOP management,when to start a picture, when to release the PCS, ....).
@@ -13927,6 +13969,8 @@ extern "C" {
         EbDctor                            dctor;
         EbObjectWrapper                    *sequence_control_set_wrapper_ptr;
         EbObjectWrapper                    *input_picture_wrapper_ptr;
+        // Motion sent with the input picture, NULL when none
+        const ExternalMotionField          *external_motion_field;
         EbObjectWrapper                    *reference_picture_wrapper_ptr;
         EbObjectWrapper                    *pa_reference_picture_wrapper_ptr;
         EbPictureBufferDesc                *enhanced_picture_ptr;
@@ -14189,6 +14233,9 @@ extern "C" {
         int16_t                               tiltMvx;
         int16_t                               tiltMvy;
         EbWarpedMotionParams                  global_motion[TOTAL_REFS_PER_FRAME];
+        // Global motion of the primary_ref_frame, the global motion of the
+        // picture is coded relative to it
+        EbWarpedMotionParams                  prev_global_motion[TOTAL_REFS_PER_FRAME];
         PictureControlSet                    *childPcs;
         Macroblock                           *av1x;
         int32_t                               film_grain_params_present; //todo (AN): Do we need this flag at picture level?
@@ -14206,6 +14253,7 @@ extern "C" {
         uint8_t                               interpolation_search_level;
         uint8_t                               nsq_search_level;
         uint8_t                               nsq_max_shapes_md; // max number of shapes to be tested in MD
+        uint8_t                               nsq_pruning_level; // 0: OFF, 1..2: skip the NSQ shapes the built-in model predicts to lose, from the most to the least conservative
         uint8_t                              sc_content_detected;
         uint8_t                              ibc_mode;
         SkipModeInfo                         skip_mode_info;
@@ -14261,6 +14309,7 @@ extern "C" {
         uint32_t                           compressed_ten_bit_format;
         uint16_t                           enc_dec_segment_col;
         uint16_t                           enc_dec_segment_row;
+        uint16_t                           tile_count;
         EbEncMode                          enc_mode;
         uint8_t                            speed_control;
         EbBool                             hbd_mode_decision;
@@ -22,6 +22,7 @@
 #include "EbReferenceObject.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "EbTemporalFiltering.h"
+#include "EbLadder.h"
 
 /************************************************
  * Defines
@@ -894,6 +895,17 @@ EbErrorType signal_derivation_multi_processes_oq(
         if (picture_control_set_ptr->pic_depth_mode <= PIC_ALL_C_DEPTH_MODE) picture_control_set_ptr->pic_depth_mode = PIC_SQ_DEPTH_MODE;
     if (picture_control_set_ptr->pic_depth_mode > PIC_SQ_DEPTH_MODE)
         assert(picture_control_set_ptr->nsq_search_level == NSQ_SEARCH_OFF);
+
+    // NSQ pruning Level                              Settings
+    // 0                                              OFF
+    // 1                                              Skip the NSQ shapes the built-in model predicts to lose, conservative threshold
+    // 2                                              Skip the NSQ shapes the built-in model predicts to lose, aggressive threshold
+    if (MR_MODE || sc_content_detected || picture_control_set_ptr->nsq_search_level == NSQ_SEARCH_OFF)
+        picture_control_set_ptr->nsq_pruning_level = 0;
+    else if (picture_control_set_ptr->enc_mode <= ENC_M1)
+        picture_control_set_ptr->nsq_pruning_level = 1;
+    else
+        picture_control_set_ptr->nsq_pruning_level = 2;
     // Interpolation search Level                     Settings
     // 0                                              OFF
     // 1                                              Interpolation search at inter-depth
@@ -2439,21 +2451,10 @@ void perform_simple_picture_analysis_for_overlay(PictureParentControlSet     *pi
     // Pad input picture to complete border LCUs
     PadPictureToMultipleOfLcuDimensions(
         input_padded_picture_ptr);
-    // 1/4 & 1/16 input picture decimation
-    DownsampleDecimationInputPicture(
+    // 1/4 & 1/16 input pictures
+    build_picture_pyramid(
         picture_control_set_ptr,
-        input_padded_picture_ptr,
-        (EbPictureBufferDesc*)paReferenceObject->quarter_decimated_picture_ptr,
-        (EbPictureBufferDesc*)paReferenceObject->sixteenth_decimated_picture_ptr);
-
-    // 1/4 & 1/16 input picture downsampling through filtering
-    if (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) {
-        DownsampleFilteringInputPicture(
-            picture_control_set_ptr,
-            input_padded_picture_ptr,
-            (EbPictureBufferDesc*)paReferenceObject->quarter_filtered_picture_ptr,
-            (EbPictureBufferDesc*)paReferenceObject->sixteenth_filtered_picture_ptr);
-    }
+        paReferenceObject);
     // Gathering statistics of input picture, including Variance Calculation, Histogram Bins
     GatheringPictureStatistics(
         sequence_control_set_ptr,
@@ -2711,7 +2712,9 @@ void* picture_decision_kernel(void *input_ptr)
                 context_ptr->last_solid_color_frame_poc = 0xFFFFFFFF;
 
             if (windowAvail == EB_TRUE) {
-                if (sequence_control_set_ptr->static_config.scene_change_detection) {
+                // The followers of a ladder take the scene changes of the leader
+                if (sequence_control_set_ptr->static_config.scene_change_detection &&
+                    !(encode_context_ptr->ladder && encode_context_ptr->ladder_rendition_index)) {
                     picture_control_set_ptr->scene_change_flag = SceneTransitionDetector(
                         context_ptr,
                         sequence_control_set_ptr,
@@ -2741,6 +2744,25 @@ void* picture_decision_kernel(void *input_ptr)
                 picture_control_set_ptr->picture_number = (encode_context_ptr->current_input_poc + 1) /*& ((1 << sequence_control_set_ptr->bits_for_picture_order_count)-1)*/;
                 encode_context_ptr->current_input_poc = picture_control_set_ptr->picture_number;
 
+                // Share the scene change decision across the ladder
+                if (encode_context_ptr->ladder) {
+                    if (encode_context_ptr->ladder_rendition_index == 0)
+                        eb_ladder_publish_scene_change(
+                            encode_context_ptr->ladder,
+                            picture_control_set_ptr->picture_number,
+                            picture_control_set_ptr->scene_change_flag);
+                    else {
+                        picture_control_set_ptr->scene_change_flag = eb_ladder_get_scene_change(
+                            encode_context_ptr->ladder,
+                            encode_context_ptr->ladder_rendition_index,
+                            picture_control_set_ptr->picture_number);
+                        picture_control_set_ptr->cra_flag = (picture_control_set_ptr->scene_change_flag == EB_TRUE) ?
+                            EB_TRUE :
+                            picture_control_set_ptr->cra_flag;
+                        context_ptr->is_scene_change_detected = picture_control_set_ptr->scene_change_flag;
+                    }
+                }
+
                 picture_control_set_ptr->pred_structure = EB_PRED_RANDOM_ACCESS;
 
                 picture_control_set_ptr->hierarchical_layers_diff = 0;
@@ -650,7 +650,7 @@ void* picture_manager_kernel(void *input_ptr)
                             picture_width_in_sb,
                             picture_height_in_sb);
 
-                        // Entropy Coding Rows
+                        // Entropy Coding Rows and Tiles
                         {
                             unsigned row_index;
 
@@ -658,6 +658,7 @@ void* picture_manager_kernel(void *input_ptr)
                             ChildPictureControlSetPtr->entropy_coding_current_available_row = 0;
                             ChildPictureControlSetPtr->entropy_coding_row_count = picture_height_in_sb;
                             ChildPictureControlSetPtr->entropy_coding_in_progress = EB_FALSE;
+                            ChildPictureControlSetPtr->entropy_coding_tile_done_count = 0;
 
                             for (row_index = 0; row_index < MAX_LCU_ROWS; ++row_index)
                                 ChildPictureControlSetPtr->entropy_coding_row_array[row_index] = EB_FALSE;
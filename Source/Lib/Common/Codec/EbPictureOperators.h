@@ -413,13 +413,6 @@ extern "C" {
         uint32_t   area_width,
         uint32_t   area_height);
 
-    static EbSpatialFullDistType FUNC_TABLE spatial_full_distortion_kernel_func_ptr_array[ASM_TYPE_TOTAL] = {
-        // NON_AVX2
-        spatial_full_distortion_kernel_c,
-        // ASM_AVX2
-        spatial_full_distortion_kernel_avx2
-    };
-
     void picture_addition_kernel16_bit(
         uint16_t *pred_ptr,
         uint32_t  pred_stride,
@@ -31,6 +31,7 @@
 #include "EbAvcStyleMcp.h"
 #include "aom_dsp_rtcd.h"
 #include "EbCodingLoop.h"
+#include "av1me.h"
 
 #define TH_NFL_BIAS             7
 
@@ -55,6 +56,8 @@ EbErrorType ProductGenerateMdCandidatesCu(
 
 const EbPredictionFunc  ProductPredictionFunTable[3] = { NULL, inter_pu_prediction_av1, av1_intra_prediction_cl};
 
+extern aom_variance_fn_ptr_t mefn_ptr[BlockSizeS_ALL];
+
 const EbFastCostFunc   Av1ProductFastCostFuncTable[3] =
 {
     NULL,
@@ -1464,6 +1467,296 @@ void generate_intra_reference_samples(
     const Av1Common         *cm,
     ModeDecisionContext   *md_context_ptr);
 
+/***************************************************
+* Swaps two candidate buffers; the cost pointers stay
+* with the buffer array positions
+***************************************************/
+static INLINE void swap_candidate_buffers(
+    ModeDecisionCandidateBuffer **buffer0,
+    ModeDecisionCandidateBuffer **buffer1)
+{
+    ModeDecisionCandidateBuffer *tmp_buffer = *buffer0;
+    uint64_t                    *tmp_cost_ptr;
+    *buffer0 = *buffer1;
+    *buffer1 = tmp_buffer;
+
+    tmp_cost_ptr = (*buffer0)->fast_cost_ptr;
+    (*buffer0)->fast_cost_ptr = (*buffer1)->fast_cost_ptr;
+    (*buffer1)->fast_cost_ptr = tmp_cost_ptr;
+    tmp_cost_ptr = (*buffer0)->full_cost_ptr;
+    (*buffer0)->full_cost_ptr = (*buffer1)->full_cost_ptr;
+    (*buffer1)->full_cost_ptr = tmp_cost_ptr;
+    tmp_cost_ptr = (*buffer0)->full_cost_skip_ptr;
+    (*buffer0)->full_cost_skip_ptr = (*buffer1)->full_cost_skip_ptr;
+    (*buffer1)->full_cost_skip_ptr = tmp_cost_ptr;
+    tmp_cost_ptr = (*buffer0)->full_cost_merge_ptr;
+    (*buffer0)->full_cost_merge_ptr = (*buffer1)->full_cost_merge_ptr;
+    (*buffer1)->full_cost_merge_ptr = tmp_cost_ptr;
+}
+
+/***************************************************
+* Returns the index of the buffer with the highest
+* fast cost
+***************************************************/
+static uint32_t find_highest_cost_buffer(
+    const uint64_t *fast_cost_array,
+    uint32_t        candidate_buffer_start_index,
+    uint32_t        maxBuffers)
+{
+    // maxCost is volatile to prevent the compiler from loading 0xFFFFFFFFFFFFFF
+    //   as a const at the early-out. Loading a large constant on intel x64 processors
+    //   clogs the i-cache/intstruction decode. This still reloads the variable from
+    //   the stack each pass, so a better solution would be to register the variable,
+    //   but this might require asm.
+    volatile uint64_t maxCost = MAX_CU_COST;
+    const uint32_t bufferIndexStart = candidate_buffer_start_index;
+    const uint32_t bufferIndexEnd = bufferIndexStart + maxBuffers;
+    uint32_t highestCostIndex = bufferIndexStart;
+    uint32_t bufferIndex = bufferIndexStart + 1;
+    uint64_t highestCost;
+
+    do {
+        highestCost = fast_cost_array[highestCostIndex];
+        if (highestCost == maxCost)
+            break;
+
+        if (fast_cost_array[bufferIndex] > highestCost)
+            highestCostIndex = bufferIndex;
+    } while (++bufferIndex < bufferIndexEnd);
+
+    return highestCostIndex;
+}
+
+/***************************************************
+* Fast loop luma distortion of one candidate buffer
+***************************************************/
+static uint64_t fast_loop_luma_distortion(
+    ModeDecisionContext               *context_ptr,
+    ModeDecisionCandidateBuffer       *candidateBuffer,
+    EbPictureBufferDesc               *input_picture_ptr,
+    uint32_t                           inputOriginIndex,
+    uint32_t                           cuOriginIndex,
+    EbBool                             use_ssd,
+    EbAsm                              asm_type)
+{
+    EbPictureBufferDesc *prediction_ptr = candidateBuffer->prediction_ptr;
+    uint64_t             lumaFastDistortion;
+
+    if (use_ssd) {
+        EbSpatialFullDistType spatial_full_dist_type_fun = context_ptr->hbd_mode_decision ?
+                full_distortion_kernel16_bits : spatial_full_distortion_kernel;
+
+        lumaFastDistortion = spatial_full_dist_type_fun(
+            input_picture_ptr->buffer_y,
+            inputOriginIndex,
+            input_picture_ptr->stride_y,
+            prediction_ptr->buffer_y,
+            cuOriginIndex,
+            prediction_ptr->stride_y,
+            context_ptr->blk_geom->bwidth,
+            context_ptr->blk_geom->bheight);
+    }
+    else {
+        assert((context_ptr->blk_geom->bwidth >> 3) < 17);
+        if (!context_ptr->hbd_mode_decision) {
+            lumaFastDistortion = nxm_sad_kernel_sub_sampled_func_ptr_array[asm_type][context_ptr->blk_geom->bwidth >> 3](
+                input_picture_ptr->buffer_y + inputOriginIndex,
+                input_picture_ptr->stride_y,
+                prediction_ptr->buffer_y + cuOriginIndex,
+                prediction_ptr->stride_y,
+                context_ptr->blk_geom->bheight,
+                context_ptr->blk_geom->bwidth);
+        } else {
+            lumaFastDistortion = sad_16b_kernel(
+                     ((uint16_t *) input_picture_ptr->buffer_y) + inputOriginIndex,
+                     input_picture_ptr->stride_y,
+                     ((uint16_t *) prediction_ptr->buffer_y) + cuOriginIndex,
+                     prediction_ptr->stride_y,
+                     context_ptr->blk_geom->bheight,
+                     context_ptr->blk_geom->bwidth);
+        }
+    }
+
+    return lumaFastDistortion;
+}
+
+/***************************************************
+* Fast loop chroma distortion of one candidate buffer
+***************************************************/
+static uint64_t fast_loop_chroma_distortion(
+    ModeDecisionContext               *context_ptr,
+    ModeDecisionCandidateBuffer       *candidateBuffer,
+    EbPictureBufferDesc               *input_picture_ptr,
+    uint32_t                           inputCbOriginIndex,
+    uint32_t                           inputCrOriginIndex,
+    uint32_t                           cuChromaOriginIndex,
+    EbBool                             use_ssd,
+    EbAsm                              asm_type)
+{
+    EbPictureBufferDesc *prediction_ptr = candidateBuffer->prediction_ptr;
+    uint64_t             chromaFastDistortion;
+
+    if (context_ptr->blk_geom->has_uv && context_ptr->chroma_level <= CHROMA_MODE_1) {
+        if (use_ssd) {
+            EbSpatialFullDistType spatial_full_dist_type_fun = context_ptr->hbd_mode_decision ?
+                full_distortion_kernel16_bits : spatial_full_distortion_kernel;
+
+            chromaFastDistortion = spatial_full_dist_type_fun(
+                input_picture_ptr->buffer_cb,
+                inputCbOriginIndex,
+                input_picture_ptr->stride_cb,
+                prediction_ptr->buffer_cb,
+                cuChromaOriginIndex,
+                prediction_ptr->stride_cb,
+                context_ptr->blk_geom->bwidth_uv,
+                context_ptr->blk_geom->bheight_uv);
+
+            chromaFastDistortion += spatial_full_dist_type_fun(
+                input_picture_ptr->buffer_cr,
+                inputCrOriginIndex,
+                input_picture_ptr->stride_cb,
+                prediction_ptr->buffer_cr,
+                cuChromaOriginIndex,
+                prediction_ptr->stride_cr,
+                context_ptr->blk_geom->bwidth_uv,
+                context_ptr->blk_geom->bheight_uv);
+        }
+        else {
+            assert((context_ptr->blk_geom->bwidth_uv >> 3) < 17);
+
+            if (!context_ptr->hbd_mode_decision) {
+                chromaFastDistortion = nxm_sad_kernel_sub_sampled_func_ptr_array[asm_type][context_ptr->blk_geom->bwidth_uv >> 3](
+                    input_picture_ptr->buffer_cb + inputCbOriginIndex,
+                    input_picture_ptr->stride_cb,
+                    prediction_ptr->buffer_cb + cuChromaOriginIndex,
+                    prediction_ptr->stride_cb,
+                    context_ptr->blk_geom->bheight_uv,
+                    context_ptr->blk_geom->bwidth_uv);
+
+                chromaFastDistortion += nxm_sad_kernel_sub_sampled_func_ptr_array[asm_type][context_ptr->blk_geom->bwidth_uv >> 3](
+                    input_picture_ptr->buffer_cr + inputCrOriginIndex,
+                    input_picture_ptr->stride_cr,
+                    prediction_ptr->buffer_cr + cuChromaOriginIndex,
+                    prediction_ptr->stride_cr,
+                    context_ptr->blk_geom->bheight_uv,
+                    context_ptr->blk_geom->bwidth_uv);
+            } else {
+                chromaFastDistortion = sad_16b_kernel (
+                    ((uint16_t *) input_picture_ptr->buffer_cb) + inputCbOriginIndex,
+                    input_picture_ptr->stride_cb,
+                    ((uint16_t *) prediction_ptr->buffer_cb) + cuChromaOriginIndex,
+                    prediction_ptr->stride_cb,
+                    context_ptr->blk_geom->bheight_uv,
+                    context_ptr->blk_geom->bwidth_uv);
+
+                chromaFastDistortion += sad_16b_kernel (
+                    ((uint16_t *) input_picture_ptr->buffer_cr) + inputCrOriginIndex,
+                    input_picture_ptr->stride_cr,
+                    ((uint16_t *) prediction_ptr->buffer_cr) + cuChromaOriginIndex,
+                    prediction_ptr->stride_cr,
+                    context_ptr->blk_geom->bheight_uv,
+                    context_ptr->blk_geom->bwidth_uv);
+            }
+        }
+    }
+    else
+        chromaFastDistortion = 0;
+
+    return chromaFastDistortion;
+}
+
+/***************************************************
+* Fast loop distortion of a batch of candidate
+* buffers. The 8 bit SAD of the batch is computed
+* with one x4d kernel call per plane
+***************************************************/
+static void fast_loop_batch_distortion(
+    ModeDecisionContext               *context_ptr,
+    ModeDecisionCandidateBuffer      **batchBufferPtrArray,
+    uint32_t                           batchCount,
+    EbPictureBufferDesc               *input_picture_ptr,
+    uint32_t                           inputOriginIndex,
+    uint32_t                           inputCbOriginIndex,
+    uint32_t                           inputCrOriginIndex,
+    uint32_t                           cuOriginIndex,
+    uint32_t                           cuChromaOriginIndex,
+    EbBool                             use_ssd,
+    uint64_t                          *luma_distortion,
+    uint64_t                          *chroma_distortion,
+    EbAsm                              asm_type)
+{
+    const BlockGeom *blk_geom = context_ptr->blk_geom;
+    const EbBool     batch_sad = !use_ssd && !context_ptr->hbd_mode_decision && batchCount > 1;
+    const EbBool     fast_chroma = blk_geom->has_uv && context_ptr->chroma_level <= CHROMA_MODE_1;
+    const uint8_t   *ref[4];
+    uint32_t         sad[4];
+    uint32_t         batchIndex;
+
+    // Y
+    if (batch_sad) {
+        for (batchIndex = 0; batchIndex < 4; ++batchIndex)
+            ref[batchIndex] = batchBufferPtrArray[MIN(batchIndex, batchCount - 1)]->prediction_ptr->buffer_y + cuOriginIndex;
+        mefn_ptr[blk_geom->bsize].sdx4df(
+            input_picture_ptr->buffer_y + inputOriginIndex,
+            input_picture_ptr->stride_y,
+            ref,
+            batchBufferPtrArray[0]->prediction_ptr->stride_y,
+            sad);
+        for (batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+            luma_distortion[batchIndex] = sad[batchIndex];
+    }
+    else {
+        for (batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+            luma_distortion[batchIndex] = fast_loop_luma_distortion(
+                context_ptr,
+                batchBufferPtrArray[batchIndex],
+                input_picture_ptr,
+                inputOriginIndex,
+                cuOriginIndex,
+                use_ssd,
+                asm_type);
+    }
+
+    // Cb and Cr; the chroma of the 4xN blocks has no block size of its own
+    if (batch_sad && fast_chroma && blk_geom->bsize_uv < BlockSizeS_ALL &&
+        block_size_wide[blk_geom->bsize_uv] == blk_geom->bwidth_uv &&
+        block_size_high[blk_geom->bsize_uv] == blk_geom->bheight_uv) {
+        for (batchIndex = 0; batchIndex < 4; ++batchIndex)
+            ref[batchIndex] = batchBufferPtrArray[MIN(batchIndex, batchCount - 1)]->prediction_ptr->buffer_cb + cuChromaOriginIndex;
+        mefn_ptr[blk_geom->bsize_uv].sdx4df(
+            input_picture_ptr->buffer_cb + inputCbOriginIndex,
+            input_picture_ptr->stride_cb,
+            ref,
+            batchBufferPtrArray[0]->prediction_ptr->stride_cb,
+            sad);
+        for (batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+            chroma_distortion[batchIndex] = sad[batchIndex];
+
+        for (batchIndex = 0; batchIndex < 4; ++batchIndex)
+            ref[batchIndex] = batchBufferPtrArray[MIN(batchIndex, batchCount - 1)]->prediction_ptr->buffer_cr + cuChromaOriginIndex;
+        mefn_ptr[blk_geom->bsize_uv].sdx4df(
+            input_picture_ptr->buffer_cr + inputCrOriginIndex,
+            input_picture_ptr->stride_cr,
+            ref,
+            batchBufferPtrArray[0]->prediction_ptr->stride_cr,
+            sad);
+        for (batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+            chroma_distortion[batchIndex] += sad[batchIndex];
+    }
+    else {
+        for (batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+            chroma_distortion[batchIndex] = fast_loop_chroma_distortion(
+                context_ptr,
+                batchBufferPtrArray[batchIndex],
+                input_picture_ptr,
+                inputCbOriginIndex,
+                inputCrOriginIndex,
+                cuChromaOriginIndex,
+                use_ssd,
+                asm_type);
+    }
+}
+
 void perform_fast_loop(
     PictureControlSet                 *picture_control_set_ptr,
     ModeDecisionContext               *context_ptr,
@@ -1487,7 +1780,6 @@ void perform_fast_loop(
     uint64_t lumaFastDistortion;
     uint64_t chromaFastDistortion;
     uint32_t highestCostIndex;
-    uint64_t highestCost;
     uint64_t bestFirstFastCostSearchCandidateCost = MAX_CU_COST;
     int32_t  bestFirstFastCostSearchCandidateIndex = INVALID_FAST_CANDIDATE_INDEX;
     // 1st fast loop: src-to-src
@@ -1535,175 +1827,101 @@ void perform_fast_loop(
     }
 
     // 2nd fast loop: src-to-recon
+    // Candidates are processed in batches of FAST_LOOP_BATCH_SIZE: the candidates of a batch are
+    // predicted into the batch buffers, their distortion is computed at once, then each one is
+    // swapped into the buffer with the highest cost, in the same order as a one-by-one evaluation
+    ModeDecisionCandidateBuffer **batchBufferPtrArray = &candidateBufferPtrArrayBase[MAX_NFL + 1 + 1];
     highestCostIndex = candidate_buffer_start_index;
     fastLoopCandidateIndex = fast_candidate_end_index;
     while (fastLoopCandidateIndex >= fast_candidate_start_index)
     {
-        ModeDecisionCandidateBuffer *candidateBuffer = candidateBufferPtrArrayBase[highestCostIndex];
-        ModeDecisionCandidate       *candidate_ptr = candidateBuffer->candidate_ptr = &fast_candidate_array[fastLoopCandidateIndex];
-        EbPictureBufferDesc         *prediction_ptr = candidateBuffer->prediction_ptr;
-        // Initialize tx_depth
-        candidateBuffer->candidate_ptr->tx_depth = 0;
-        if (!candidate_ptr->distortion_ready || fastLoopCandidateIndex == bestFirstFastCostSearchCandidateIndex) {
-            // Prediction
-            ProductMdFastPuPrediction(
-                picture_control_set_ptr,
-                candidateBuffer,
-                context_ptr,
-                candidate_ptr->type,
-                candidate_ptr,
-                fastLoopCandidateIndex,
-                bestFirstFastCostSearchCandidateIndex,
-                asm_type);
-
-            // Distortion
-            // Y
-            if (use_ssd) {
-                EbSpatialFullDistType spatial_full_dist_type_fun = context_ptr->hbd_mode_decision ?
-                        full_distortion_kernel16_bits : spatial_full_distortion_kernel_func_ptr_array[asm_type];
-
-                candidateBuffer->candidate_ptr->luma_fast_distortion = (uint32_t)(lumaFastDistortion = spatial_full_dist_type_fun(
-                    input_picture_ptr->buffer_y,
-                    inputOriginIndex,
-                    input_picture_ptr->stride_y,
-                    prediction_ptr->buffer_y,
-                    cuOriginIndex,
-                    prediction_ptr->stride_y,
-                    context_ptr->blk_geom->bwidth,
-                    context_ptr->blk_geom->bheight));
-            }
-            else {
-                assert((context_ptr->blk_geom->bwidth >> 3) < 17);
-                if (!context_ptr->hbd_mode_decision) {
-                    candidateBuffer->candidate_ptr->luma_fast_distortion = (uint32_t)(lumaFastDistortion = nxm_sad_kernel_sub_sampled_func_ptr_array[asm_type][context_ptr->blk_geom->bwidth >> 3](
-                        input_picture_ptr->buffer_y + inputOriginIndex,
-                        input_picture_ptr->stride_y,
-                        prediction_ptr->buffer_y + cuOriginIndex,
-                        prediction_ptr->stride_y,
-                        context_ptr->blk_geom->bheight,
-                        context_ptr->blk_geom->bwidth));
-                } else {
-                    candidateBuffer->candidate_ptr->luma_fast_distortion = (uint32_t)(lumaFastDistortion = sad_16b_kernel(
-                             ((uint16_t *) input_picture_ptr->buffer_y) + inputOriginIndex,
-                             input_picture_ptr->stride_y,
-                             ((uint16_t *) prediction_ptr->buffer_y) + cuOriginIndex,
-                             prediction_ptr->stride_y,
-                             context_ptr->blk_geom->bheight,
-                             context_ptr->blk_geom->bwidth));
-                }
+        const int32_t batchEndIndex = MAX(fastLoopCandidateIndex - FAST_LOOP_BATCH_SIZE + 1, fast_candidate_start_index);
+        uint64_t      lumaBatchDistortion[FAST_LOOP_BATCH_SIZE];
+        uint64_t      chromaBatchDistortion[FAST_LOOP_BATCH_SIZE];
+        uint32_t      batchCount = 0;
+        int32_t       candidateIndex;
+
+        // Prediction
+        for (candidateIndex = fastLoopCandidateIndex; candidateIndex >= batchEndIndex; --candidateIndex) {
+            ModeDecisionCandidate *candidate_ptr = &fast_candidate_array[candidateIndex];
+            // Initialize tx_depth
+            candidate_ptr->tx_depth = 0;
+            if (!candidate_ptr->distortion_ready || candidateIndex == bestFirstFastCostSearchCandidateIndex) {
+                ModeDecisionCandidateBuffer *candidateBuffer = batchBufferPtrArray[batchCount++];
+                candidateBuffer->candidate_ptr = candidate_ptr;
+                ProductMdFastPuPrediction(
+                    picture_control_set_ptr,
+                    candidateBuffer,
+                    context_ptr,
+                    candidate_ptr->type,
+                    candidate_ptr,
+                    candidateIndex,
+                    bestFirstFastCostSearchCandidateIndex,
+                    asm_type);
             }
+        }
 
-            if (context_ptr->blk_geom->has_uv && context_ptr->chroma_level <= CHROMA_MODE_1) {
-                if (use_ssd) {
-                    EbSpatialFullDistType spatial_full_dist_type_fun = context_ptr->hbd_mode_decision ?
-                        full_distortion_kernel16_bits : spatial_full_distortion_kernel_func_ptr_array[asm_type];
+        // Distortion
+        if (batchCount)
+            fast_loop_batch_distortion(
+                context_ptr,
+                batchBufferPtrArray,
+                batchCount,
+                input_picture_ptr,
+                inputOriginIndex,
+                inputCbOriginIndex,
+                inputCrOriginIndex,
+                cuOriginIndex,
+                cuChromaOriginIndex,
+                use_ssd,
+                lumaBatchDistortion,
+                chromaBatchDistortion,
+                asm_type);
 
-                    chromaFastDistortion = spatial_full_dist_type_fun(
-                        input_picture_ptr->buffer_cb,
-                        inputCbOriginIndex,
-                        input_picture_ptr->stride_cb,
-                        candidateBuffer->prediction_ptr->buffer_cb,
-                        cuChromaOriginIndex,
-                        prediction_ptr->stride_cb,
-                        context_ptr->blk_geom->bwidth_uv,
-                        context_ptr->blk_geom->bheight_uv);
-
-                    chromaFastDistortion += spatial_full_dist_type_fun(
-                        input_picture_ptr->buffer_cr,
-                        inputCrOriginIndex,
-                        input_picture_ptr->stride_cb,
-                        candidateBuffer->prediction_ptr->buffer_cr,
-                        cuChromaOriginIndex,
-                        prediction_ptr->stride_cr,
-                        context_ptr->blk_geom->bwidth_uv,
-                        context_ptr->blk_geom->bheight_uv);
-                }
-                else {
-                    assert((context_ptr->blk_geom->bwidth_uv >> 3) < 17);
-
-                    if (!context_ptr->hbd_mode_decision) {
-                        chromaFastDistortion = nxm_sad_kernel_sub_sampled_func_ptr_array[asm_type][context_ptr->blk_geom->bwidth_uv >> 3](
-                            input_picture_ptr->buffer_cb + inputCbOriginIndex,
-                            input_picture_ptr->stride_cb,
-                            candidateBuffer->prediction_ptr->buffer_cb + cuChromaOriginIndex,
-                            prediction_ptr->stride_cb,
-                            context_ptr->blk_geom->bheight_uv,
-                            context_ptr->blk_geom->bwidth_uv);
-
-                        chromaFastDistortion += nxm_sad_kernel_sub_sampled_func_ptr_array[asm_type][context_ptr->blk_geom->bwidth_uv >> 3](
-                            input_picture_ptr->buffer_cr + inputCrOriginIndex,
-                            input_picture_ptr->stride_cr,
-                            candidateBuffer->prediction_ptr->buffer_cr + cuChromaOriginIndex,
-                            prediction_ptr->stride_cr,
-                            context_ptr->blk_geom->bheight_uv,
-                            context_ptr->blk_geom->bwidth_uv);
-                    } else {
-                        chromaFastDistortion = sad_16b_kernel (
-                            ((uint16_t *) input_picture_ptr->buffer_cb) + inputCbOriginIndex,
-                            input_picture_ptr->stride_cb,
-                            ((uint16_t *) candidateBuffer->prediction_ptr->buffer_cb) + cuChromaOriginIndex,
-                            prediction_ptr->stride_cb,
-                            context_ptr->blk_geom->bheight_uv,
-                            context_ptr->blk_geom->bwidth_uv);
-
-                        chromaFastDistortion += sad_16b_kernel (
-                            ((uint16_t *) input_picture_ptr->buffer_cr) + inputCrOriginIndex,
-                            input_picture_ptr->stride_cr,
-                            ((uint16_t *) candidateBuffer->prediction_ptr->buffer_cr) + cuChromaOriginIndex,
-                            prediction_ptr->stride_cr,
-                            context_ptr->blk_geom->bheight_uv,
-                            context_ptr->blk_geom->bwidth_uv);
-                    }
-                }
+        // Fast Cost
+        batchCount = 0;
+        for (candidateIndex = fastLoopCandidateIndex; candidateIndex >= batchEndIndex; --candidateIndex) {
+            ModeDecisionCandidate *candidate_ptr = &fast_candidate_array[candidateIndex];
+            if (!candidate_ptr->distortion_ready || candidateIndex == bestFirstFastCostSearchCandidateIndex) {
+                ModeDecisionCandidateBuffer *candidateBuffer = batchBufferPtrArray[batchCount];
+                // The prediction takes the place of the highest cost buffer, which becomes a batch buffer
+                swap_candidate_buffers(
+                    &candidateBufferPtrArrayBase[highestCostIndex],
+                    &batchBufferPtrArray[batchCount]);
+
+                lumaFastDistortion = lumaBatchDistortion[batchCount];
+                chromaFastDistortion = chromaBatchDistortion[batchCount];
+                candidate_ptr->luma_fast_distortion = (uint32_t)lumaFastDistortion;
+                ++batchCount;
+
+                *(candidateBuffer->fast_cost_ptr) = Av1ProductFastCostFuncTable[candidate_ptr->type](
+                    cu_ptr,
+                    candidate_ptr,
+                    cu_ptr->qp,
+                    lumaFastDistortion,
+                    chromaFastDistortion,
+                    use_ssd ? context_ptr->full_lambda : context_ptr->fast_lambda,
+                    use_ssd,
+                    picture_control_set_ptr,
+                    &(context_ptr->md_local_cu_unit[context_ptr->blk_geom->blkidx_mds].ed_ref_mv_stack[candidate_ptr->ref_frame_type][0]),
+                    context_ptr->blk_geom,
+                    context_ptr->cu_origin_y >> MI_SIZE_LOG2,
+                    context_ptr->cu_origin_x >> MI_SIZE_LOG2,
+                    1,
+                    context_ptr->intra_luma_left_mode,
+                    context_ptr->intra_luma_top_mode);
             }
             else
-                chromaFastDistortion = 0;
-            // Fast Cost
-            *(candidateBuffer->fast_cost_ptr) = Av1ProductFastCostFuncTable[candidate_ptr->type](
-                cu_ptr,
-                candidateBuffer->candidate_ptr,
-                cu_ptr->qp,
-                lumaFastDistortion,
-                chromaFastDistortion,
-                use_ssd ? context_ptr->full_lambda : context_ptr->fast_lambda,
-                use_ssd,
-                picture_control_set_ptr,
-                &(context_ptr->md_local_cu_unit[context_ptr->blk_geom->blkidx_mds].ed_ref_mv_stack[candidate_ptr->ref_frame_type][0]),
-                context_ptr->blk_geom,
-                context_ptr->cu_origin_y >> MI_SIZE_LOG2,
-                context_ptr->cu_origin_x >> MI_SIZE_LOG2,
-                1,
-                context_ptr->intra_luma_left_mode,
-                context_ptr->intra_luma_top_mode);
-        }
-
-        // Find the buffer with the highest cost
-        if (fastLoopCandidateIndex || scratch_buffer_pesent_flag)
-        {
-            // maxCost is volatile to prevent the compiler from loading 0xFFFFFFFFFFFFFF
-            //   as a const at the early-out. Loading a large constant on intel x64 processors
-            //   clogs the i-cache/intstruction decode. This still reloads the variable from
-            //   the stack each pass, so a better solution would be to register the variable,
-            //   but this might require asm.
-            volatile uint64_t maxCost = MAX_CU_COST;
-            const uint64_t *fast_cost_array = context_ptr->fast_cost_array;
-            const uint32_t bufferIndexStart = candidate_buffer_start_index;
-            const uint32_t bufferIndexEnd = bufferIndexStart + maxBuffers;
-            uint32_t bufferIndex;
-
-            highestCostIndex = bufferIndexStart;
-            bufferIndex = bufferIndexStart + 1;
-
-            do {
-                highestCost = fast_cost_array[highestCostIndex];
-                if (highestCost == maxCost)
-                    break;
-
-                if (fast_cost_array[bufferIndex] > highestCost)
-                    highestCostIndex = bufferIndex;
-            } while (++bufferIndex < bufferIndexEnd);
+                candidateBufferPtrArrayBase[highestCostIndex]->candidate_ptr = candidate_ptr;
+
+            // Find the buffer with the highest cost
+            if (candidateIndex || scratch_buffer_pesent_flag)
+                highestCostIndex = find_highest_cost_buffer(
+                    context_ptr->fast_cost_array,
+                    candidate_buffer_start_index,
+                    maxBuffers);
         }
-        --fastLoopCandidateIndex;
+        fastLoopCandidateIndex = batchEndIndex - 1;
     }
 
     // Set the cost of the scratch canidate to max to get discarded @ the sorting phase
@@ -3302,7 +3520,7 @@ void perform_intra_tx_partitioning(
                         asm_type);
 
                 EbSpatialFullDistType spatial_full_dist_type_fun = context_ptr->hbd_mode_decision ?
-                        full_distortion_kernel16_bits : spatial_full_distortion_kernel_func_ptr_array[asm_type];
+                        full_distortion_kernel16_bits : spatial_full_distortion_kernel;
 
                 tuFullDistortion[0][DIST_CALC_PREDICTION] = spatial_full_dist_type_fun(
                     input_picture_ptr->buffer_y,
@@ -3445,7 +3663,7 @@ void perform_intra_tx_partitioning(
                     asm_type);
 
             EbSpatialFullDistType spatial_full_dist_type_fun = context_ptr->hbd_mode_decision ?
-                full_distortion_kernel16_bits : spatial_full_distortion_kernel_func_ptr_array[asm_type];
+                full_distortion_kernel16_bits : spatial_full_distortion_kernel;
 
             tuFullDistortion[0][DIST_CALC_PREDICTION] = spatial_full_dist_type_fun(
                 input_picture_ptr->buffer_y,
@@ -3708,7 +3926,7 @@ void perform_intra_tx_partitioning(
                     asm_type);
 
             EbSpatialFullDistType spatial_full_dist_type_fun = context_ptr->hbd_mode_decision ?
-                full_distortion_kernel16_bits : spatial_full_distortion_kernel_func_ptr_array[asm_type];
+                full_distortion_kernel16_bits : spatial_full_distortion_kernel;
 
             tuFullDistortion[0][DIST_CALC_PREDICTION] = spatial_full_dist_type_fun(
                 input_picture_ptr->buffer_y,
@@ -4886,6 +5104,114 @@ void  order_nsq_table(
         }
     }
 }
+/****************************************************
+* NSQ pruning model
+* Linear model scoring the chance of an NSQ shape to
+* beat the best partition of its square so far, from
+* the features of derive_nsq_pruning_features().
+* Trained offline from NSQ_PRUNING_STATS dumps by
+* tools/nsq_pruning_train.py: score = bias + sum(weight * feature)
+****************************************************/
+static const int32_t nsq_pruning_bias = -5391;
+static const int32_t nsq_pruning_weight[NSQ_PRUNING_FEATURE_COUNT] = {
+    -180, // rank of the shape in nsq_table
+    -649, // number of blocks of the shape
+    913, // log2 of the square size
+    20, // log2 of the source variance (Q4)
+    -2, // ME SAD of the shape over the ME SAD of the square (Q8)
+    2686, // parent square has coefficients
+    39, // log2 of the best cost per sample of the square over lambda (Q4)
+};
+// Score under which a shape is skipped, per nsq_pruning_level
+static const int32_t nsq_pruning_threshold[3] = { INT32_MIN, -1795, -233 };
+
+/****************************************************
+* Derive the NSQ pruning features of the current NSQ
+* shape, when evaluating its first block
+****************************************************/
+static void derive_nsq_pruning_features(
+    PictureControlSet            *picture_control_set_ptr,
+    ModeDecisionContext          *context_ptr,
+    const SequenceControlSet     *sequence_control_set_ptr,
+    uint32_t                      lcuAddr) {
+    PictureParentControlSet *parent_pcs_ptr = picture_control_set_ptr->parent_pcs_ptr;
+    const BlockGeom *blk_geom = context_ptr->blk_geom;
+    int32_t *feature = context_ptr->nsq_pruning_feature;
+    uint32_t me_sb_addr;
+    uint32_t geom_offset_x = 0;
+    uint32_t geom_offset_y = 0;
+    if (sequence_control_set_ptr->seq_header.sb_size == BLOCK_128X128) {
+        uint32_t me_sb_size = sequence_control_set_ptr->sb_sz;
+        uint32_t me_pic_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + sequence_control_set_ptr->sb_sz - 1) / me_sb_size;
+        uint32_t me_sb_x = (context_ptr->cu_origin_x / me_sb_size);
+        uint32_t me_sb_y = (context_ptr->cu_origin_y / me_sb_size);
+        me_sb_addr = me_sb_x + me_sb_y * me_pic_width_in_sb;
+        geom_offset_x = (me_sb_x & 0x1) * me_sb_size;
+        geom_offset_y = (me_sb_y & 0x1) * me_sb_size;
+    }
+    else
+        me_sb_addr = lcuAddr;
+
+    // Rank of the shape in the reordered nsq_table
+    feature[0] = NSQ_TAB_SIZE;
+    for (int i = 0; i < NSQ_TAB_SIZE; i++) {
+        if (context_ptr->nsq_table[i] == blk_geom->shape) {
+            feature[0] = i;
+            break;
+        }
+    }
+    feature[1] = blk_geom->totns;
+    feature[2] = Log2f(blk_geom->sq_size);
+
+    // Source variance of the square; the first block of a shape starts at the origin of the square
+    uint32_t sq_x = context_ptr->cu_origin_x & 63;
+    uint32_t sq_y = context_ptr->cu_origin_y & 63;
+    uint32_t variance_index =
+        blk_geom->sq_size >= 64 ? ME_TIER_ZERO_PU_64x64 :
+        blk_geom->sq_size == 32 ? ME_TIER_ZERO_PU_32x32_0 + (sq_y >> 5) * 2 + (sq_x >> 5) :
+        blk_geom->sq_size == 16 ? ME_TIER_ZERO_PU_16x16_0 + (sq_y >> 4) * 4 + (sq_x >> 4) :
+        ME_TIER_ZERO_PU_8x8_0 + (sq_y >> 3) * 8 + (sq_x >> 3);
+    feature[3] = (int32_t)log2f_high_precision(parent_pcs_ptr->variance[me_sb_addr][variance_index] + 1, 4);
+
+    // ME SAD of the blocks of the shape relative to the ME SAD of the square, when ME covers both
+    feature[4] = 1 << 8;
+    if (blk_geom->sq_size > 8 && blk_geom->sq_size < 128) {
+        const MeLcuResults *me_results = parent_pcs_ptr->me_results[me_sb_addr];
+        uint32_t max_number_of_pus_per_sb = parent_pcs_ptr->max_number_of_pus_per_sb;
+        uint32_t sq_pu_index = get_me_info_index(max_number_of_pus_per_sb, get_blk_geom_mds(blk_geom->sqi_mds), geom_offset_x, geom_offset_y);
+        if (sq_pu_index < max_number_of_pus_per_sb && me_results->total_me_candidate_index[sq_pu_index]) {
+            uint64_t shape_sad = 0;
+            uint32_t blk_it;
+            for (blk_it = 0; blk_it < blk_geom->totns; blk_it++) {
+                uint32_t pu_index = get_me_info_index(max_number_of_pus_per_sb, get_blk_geom_mds(blk_geom->blkidx_mds + blk_it), geom_offset_x, geom_offset_y);
+                if (pu_index >= max_number_of_pus_per_sb || !me_results->total_me_candidate_index[pu_index])
+                    break;
+                shape_sad += me_results->me_candidate[pu_index][0].distortion;
+            }
+            if (blk_it == blk_geom->totns)
+                feature[4] = (int32_t)MIN((shape_sad << 8) / MAX(me_results->me_candidate[sq_pu_index][0].distortion, 1), 2 << 8);
+        }
+    }
+
+    feature[5] = context_ptr->parent_sq_has_coeff[LOG2F(blk_geom->sq_size) - 2];
+
+    // Best cost of the square so far, per sample and relative to lambda
+    uint64_t sq_cost = MIN(context_ptr->md_local_cu_unit[blk_geom->sqi_mds].cost >> (2 * Log2f(blk_geom->sq_size)), (uint64_t)1 << 40);
+    feature[6] = (int32_t)log2f_high_precision(sq_cost + 1, 4) - (int32_t)log2f_high_precision((uint64_t)context_ptr->full_lambda + 1, 4);
+}
+
+/****************************************************
+* Decide whether the current NSQ shape is skipped by
+* the NSQ pruning model
+****************************************************/
+static EbBool nsq_pruning_decision(
+    ModeDecisionContext          *context_ptr,
+    uint8_t                       nsq_pruning_level) {
+    int64_t score = nsq_pruning_bias;
+    for (int i = 0; i < NSQ_PRUNING_FEATURE_COUNT; i++)
+        score += (int64_t)nsq_pruning_weight[i] * context_ptr->nsq_pruning_feature[i];
+    return score < nsq_pruning_threshold[nsq_pruning_level] ? EB_TRUE : EB_FALSE;
+}
 uint8_t check_skip_sub_blks(
     PictureControlSet              *picture_control_set_ptr,
     ModeDecisionContext            *context_ptr,
@@ -5128,6 +5454,96 @@ void search_best_independent_uv_mode(
     // End uv search path
     context_ptr->uv_search_path = EB_FALSE;
 }
+
+/*******************************************
+* Keep the prediction, the reconstruction and the quantized
+* coefficients of the winner of the block for the Encode Pass
+* (reuse_md_recon). Only 8 bit inter blocks coded without merge,
+* with their chroma coded in MD in a single transform block (MD
+* keeps the chroma dc sign level of one), are kept.
+*******************************************/
+static void md_blk_recon_store(
+    PictureControlSet           *picture_control_set_ptr,
+    ModeDecisionContext         *context_ptr,
+    ModeDecisionCandidateBuffer *candidateBuffer,
+    CodingUnit                  *cu_ptr)
+{
+    const BlockGeom *blk_geom = context_ptr->blk_geom;
+    MdBlockRecon    *blk_recon = &context_ptr->md_blk_recon[cu_ptr->mds_idx];
+    uint8_t          tx_depth = candidateBuffer->candidate_ptr->tx_depth;
+    uint32_t         txb_count = blk_geom->txb_count[tx_depth];
+    uint32_t         coeff_count_uv = 0;
+    uint32_t         txb_itr, j;
+
+    blk_recon->valid = EB_FALSE;
+    if (picture_control_set_ptr->intra_md_open_loop_flag ||
+        cu_ptr->prediction_mode_flag != INTER_MODE ||
+        cu_ptr->prediction_unit_array[0].merge_flag ||
+        cu_ptr->tx_depth != tx_depth ||
+        (blk_geom->has_uv && (context_ptr->chroma_level > CHROMA_MODE_1 || (tx_depth == 0 && txb_count > 1))))
+        return;
+
+    for (txb_itr = 0; txb_itr < txb_count; txb_itr++) {
+        TransformUnit *txb_ptr = &cu_ptr->transform_unit_array[txb_itr];
+        blk_recon->eob[0][txb_itr] = txb_ptr->y_has_coeff ? candidateBuffer->candidate_ptr->eob[0][txb_itr] : 0;
+        blk_recon->quantized_dc[0][txb_itr] = txb_ptr->y_has_coeff ? candidateBuffer->candidate_ptr->quantized_dc[0][txb_itr] : 0;
+        if (blk_geom->has_uv && txb_itr == 0) {
+            blk_recon->eob[1][txb_itr] = txb_ptr->u_has_coeff ? candidateBuffer->candidate_ptr->eob[1][txb_itr] : 0;
+            blk_recon->eob[2][txb_itr] = txb_ptr->v_has_coeff ? candidateBuffer->candidate_ptr->eob[2][txb_itr] : 0;
+            blk_recon->quantized_dc[1][txb_itr] = txb_ptr->u_has_coeff ? candidateBuffer->candidate_ptr->quantized_dc[1][txb_itr] : 0;
+            blk_recon->quantized_dc[2][txb_itr] = txb_ptr->v_has_coeff ? candidateBuffer->candidate_ptr->quantized_dc[2][txb_itr] : 0;
+            coeff_count_uv += blk_geom->tx_width_uv[tx_depth][txb_itr] * blk_geom->tx_height_uv[tx_depth][txb_itr];
+        }
+    }
+
+    uint32_t luma_offset = blk_geom->origin_x + blk_geom->origin_y * candidateBuffer->recon_ptr->stride_y;
+    for (j = 0; j < blk_geom->bheight; j++) {
+        memcpy(blk_recon->pred[0] + j * blk_geom->bwidth, candidateBuffer->prediction_ptr->buffer_y + luma_offset + j * candidateBuffer->prediction_ptr->stride_y, blk_geom->bwidth);
+        memcpy(blk_recon->recon[0] + j * blk_geom->bwidth, candidateBuffer->recon_ptr->buffer_y + luma_offset + j * candidateBuffer->recon_ptr->stride_y, blk_geom->bwidth);
+    }
+    memcpy(blk_recon->coeff[0], candidateBuffer->residual_quant_coeff_ptr->buffer_y, blk_geom->bwidth * blk_geom->bheight * sizeof(int32_t));
+
+    if (blk_geom->has_uv) {
+        uint32_t cb_offset = ((((blk_geom->origin_x >> 3) << 3) + ((blk_geom->origin_y >> 3) << 3) * candidateBuffer->recon_ptr->stride_cb) >> 1);
+        uint32_t cr_offset = ((((blk_geom->origin_x >> 3) << 3) + ((blk_geom->origin_y >> 3) << 3) * candidateBuffer->recon_ptr->stride_cr) >> 1);
+        for (j = 0; j < blk_geom->bheight_uv; j++) {
+            memcpy(blk_recon->pred[1] + j * blk_geom->bwidth_uv, candidateBuffer->prediction_ptr->buffer_cb + cb_offset + j * candidateBuffer->prediction_ptr->stride_cb, blk_geom->bwidth_uv);
+            memcpy(blk_recon->pred[2] + j * blk_geom->bwidth_uv, candidateBuffer->prediction_ptr->buffer_cr + cr_offset + j * candidateBuffer->prediction_ptr->stride_cr, blk_geom->bwidth_uv);
+            memcpy(blk_recon->recon[1] + j * blk_geom->bwidth_uv, candidateBuffer->recon_ptr->buffer_cb + cb_offset + j * candidateBuffer->recon_ptr->stride_cb, blk_geom->bwidth_uv);
+            memcpy(blk_recon->recon[2] + j * blk_geom->bwidth_uv, candidateBuffer->recon_ptr->buffer_cr + cr_offset + j * candidateBuffer->recon_ptr->stride_cr, blk_geom->bwidth_uv);
+        }
+        memcpy(blk_recon->coeff[1], candidateBuffer->residual_quant_coeff_ptr->buffer_cb, coeff_count_uv * sizeof(int32_t));
+        memcpy(blk_recon->coeff[2], candidateBuffer->residual_quant_coeff_ptr->buffer_cr, coeff_count_uv * sizeof(int32_t));
+    }
+    blk_recon->valid = EB_TRUE;
+}
+
+/*******************************************
+* Copy the kept winner of a redundant block
+*******************************************/
+static void md_blk_recon_copy(
+    ModeDecisionContext *context_ptr,
+    uint16_t             src_mds,
+    uint16_t             dst_mds)
+{
+    const BlockGeom    *blk_geom = get_blk_geom_mds(dst_mds);
+    const MdBlockRecon *src = &context_ptr->md_blk_recon[src_mds];
+    MdBlockRecon       *dst = &context_ptr->md_blk_recon[dst_mds];
+
+    dst->valid = src->valid;
+    if (!src->valid)
+        return;
+    uint32_t luma_samples = blk_geom->bwidth * blk_geom->bheight;
+    uint32_t chroma_samples = blk_geom->has_uv ? blk_geom->bwidth_uv * blk_geom->bheight_uv : 0;
+    // The samples of a block are contiguous, from pred[0] to the end of recon[2]
+    memcpy(dst->pred[0], src->pred[0], 2 * (luma_samples + 2 * chroma_samples));
+    // Same for the coefficients: luma, then two chroma slots of the same size
+    size_t coeff_count = (size_t)(dst->coeff[1] - dst->coeff[0]) + 2 * (size_t)(dst->coeff[2] - dst->coeff[1]);
+    memcpy(dst->coeff[0], src->coeff[0], coeff_count * sizeof(int32_t));
+    memcpy(dst->eob, src->eob, sizeof(dst->eob));
+    memcpy(dst->quantized_dc, src->quantized_dc, sizeof(dst->quantized_dc));
+}
+
 void md_encode_block(
     SequenceControlSet             *sequence_control_set_ptr,
     PictureControlSet              *picture_control_set_ptr,
@@ -5172,8 +5588,27 @@ void md_encode_block(
 
     uint8_t                            is_complete_sb = sequence_control_set_ptr->sb_geom[lcuAddr].is_complete_sb;
 
-    if (allowed_ns_cu(
-        is_nsq_table_used, picture_control_set_ptr->parent_pcs_ptr->nsq_max_shapes_md,context_ptr,is_complete_sb ))
+    EbBool is_allowed_ns_cu = allowed_ns_cu(
+        is_nsq_table_used, picture_control_set_ptr->parent_pcs_ptr->nsq_max_shapes_md,context_ptr,is_complete_sb );
+    // Skip the NSQ shapes the pruning model predicts to lose; decided at the first block of the shape
+    if (is_allowed_ns_cu && is_nsq_table_used && context_ptr->blk_geom->shape != PART_N &&
+        (picture_control_set_ptr->parent_pcs_ptr->nsq_pruning_level || NSQ_PRUNING_STATS)) {
+        if (context_ptr->blk_geom->nsi == 0) {
+            derive_nsq_pruning_features(
+                picture_control_set_ptr,
+                context_ptr,
+                sequence_control_set_ptr,
+                lcuAddr);
+            context_ptr->nsq_pruning_blk_mds = context_ptr->blk_geom->blkidx_mds;
+            context_ptr->nsq_pruning_valid = EB_TRUE;
+            context_ptr->nsq_pruning_skip = NSQ_PRUNING_STATS ? EB_FALSE :
+                nsq_pruning_decision(context_ptr, picture_control_set_ptr->parent_pcs_ptr->nsq_pruning_level);
+        }
+        if (context_ptr->nsq_pruning_valid && context_ptr->nsq_pruning_blk_mds == context_ptr->blk_geom->blkidx_mds - context_ptr->blk_geom->nsi)
+            is_allowed_ns_cu = !context_ptr->nsq_pruning_skip;
+    }
+
+    if (is_allowed_ns_cu)
     {
         ProductCodingLoopInitFastLoop(
             context_ptr,
@@ -5451,6 +5886,13 @@ void md_encode_block(
             }
         }
 
+        if (context_ptr->md_blk_recon && !context_ptr->hbd_mode_decision)
+            md_blk_recon_store(
+                picture_control_set_ptr,
+                context_ptr,
+                candidateBuffer,
+                cu_ptr);
+
 #if NO_ENCDEC
         //copy recon
         uint32_t  tu_origin_index = context_ptr->blk_geom->origin_x + (context_ptr->blk_geom->origin_y * 128);
@@ -5539,6 +5981,13 @@ EB_EXTERN EbErrorType mode_decision_sb(
     uint32_t                               leaf_count = mdcResultTbPtr->leaf_count;
     const EbMdcLeafData *const           leaf_data_array = mdcResultTbPtr->leaf_data_array;
     context_ptr->sb_ptr = sb_ptr;
+    // The RDOQ results of the previous SB were derived with its rate tables
+    context_ptr->rdoq_cache_count = 0;
+    context_ptr->rdoq_cache_next = 0;
+    // The kept winners are those of the blocks of this SB only
+    if (context_ptr->md_blk_recon)
+        for (cuIdx = 0; cuIdx < sequence_control_set_ptr->max_block_cnt; ++cuIdx)
+            context_ptr->md_blk_recon[cuIdx].valid = EB_FALSE;
     if (picture_control_set_ptr->parent_pcs_ptr->pic_depth_mode <= PIC_SQ_DEPTH_MODE) {
         init_nsq_block(
             sequence_control_set_ptr,
@@ -5690,6 +6139,10 @@ EB_EXTERN EbErrorType mode_decision_sb(
             else
                 cu_ptr->av1xd->left_mbmi = NULL;
 
+        // The NSQ pruning features are derived again for each shape
+        if (blk_geom->nsi == 0)
+            context_ptr->nsq_pruning_valid = EB_FALSE;
+
         uint8_t redundant_blk_avail = 0;
         uint16_t redundant_blk_mds;
 
@@ -5722,6 +6175,8 @@ EB_EXTERN EbErrorType mode_decision_sb(
             }
 
             memcpy(&context_ptr->md_ep_pipe_sb[cu_ptr->mds_idx], &context_ptr->md_ep_pipe_sb[redundant_blk_mds], sizeof(MdEncPassCuData));
+            if (context_ptr->md_blk_recon)
+                md_blk_recon_copy(context_ptr, redundant_blk_mds, cu_ptr->mds_idx);
             if (context_ptr->blk_geom->shape == PART_N) {
                 uint8_t sq_index = LOG2F(context_ptr->blk_geom->sq_size) - 2;
                 context_ptr->parent_sq_type[sq_index] = src_cu->prediction_mode_flag;
@@ -5768,6 +6223,16 @@ EB_EXTERN EbErrorType mode_decision_sb(
 #endif
         if (blk_geom->nsi + 1 == blk_geom->totns)
             d1_non_square_block_decision(context_ptr);
+#if NSQ_PRUNING_STATS
+        // Features of the shape, then whether the shape became the best partition of the square
+        if (sequence_control_set_ptr->static_config.stat_report && blk_geom->shape != PART_N && blk_geom->nsi + 1 == blk_geom->totns &&
+            context_ptr->nsq_pruning_valid && context_ptr->nsq_pruning_blk_mds == blk_geom->blkidx_mds - blk_geom->nsi) {
+            const int32_t *feature = context_ptr->nsq_pruning_feature;
+            SVT_LOG("NSQ,%d,%d,%d,%d,%d,%d,%d,%d\n",
+                feature[0], feature[1], feature[2], feature[3], feature[4], feature[5], feature[6],
+                context_ptr->md_cu_arr_nsq[blk_geom->sqi_mds].best_d1_blk == context_ptr->nsq_pruning_blk_mds);
+        }
+#endif
 
         if (blk_geom->shape != PART_N) {
             if (blk_geom->nsi + 1 < blk_geom->totns)
@@ -8,6 +8,7 @@
 
 #include "EbPictureBufferDesc.h"
 #include "EbReferenceObject.h"
+#include "EbThreads.h"
 
 void InitializeSamplesNeighboringReferencePicture16Bit(
     EbByte  reconSamplesBufferPtr,
@@ -126,6 +127,8 @@ static void eb_reference_object_dctor(EbPtr p)
     EbReferenceObject *obj = (EbReferenceObject*)p;
     EB_DELETE(obj->reference_picture16bit);
     EB_DELETE(obj->reference_picture);
+    EB_FREE(obj->frame_context);
+    EB_DESTROY_MUTEX(obj->frame_context_mutex);
 }
 
 
@@ -180,6 +183,10 @@ EbErrorType eb_reference_object_ctor(
     }
     memset(&referenceObject->film_grain_params, 0, sizeof(referenceObject->film_grain_params));
 
+    if (((EbReferenceObjectDescInitData*)object_init_data_ptr)->frame_end_cdf_update)
+        EB_MALLOC(referenceObject->frame_context, sizeof(*referenceObject->frame_context));
+    EB_CREATE_MUTEX(referenceObject->frame_context_mutex);
+
     return EB_ErrorNone;
 }
 
@@ -199,6 +206,7 @@ EbErrorType eb_reference_object_creator(
 static void eb_pa_reference_object_dctor(EbPtr p)
 {
     EbPaReferenceObject* obj = (EbPaReferenceObject*)p;
+    uint32_t i;
     EB_DELETE(obj->input_padded_picture_ptr);
     EB_DELETE(obj->quarter_decimated_picture_ptr);
     EB_DELETE(obj->sixteenth_decimated_picture_ptr);
@@ -206,6 +214,15 @@ static void eb_pa_reference_object_dctor(EbPtr p)
     EB_DELETE(obj->quarter_filtered_picture_ptr);
     EB_DELETE(obj->sixteenth_filtered_picture_ptr);
 #endif
+    EB_FREE_ARRAY(obj->pos_b_plane);
+    EB_FREE_ARRAY(obj->pos_h_plane);
+    EB_FREE_ARRAY(obj->pos_j_plane);
+    EB_DESTROY_SEMAPHORE(obj->me_mv_done_semaphore);
+    av1_hash_table_destroy(&obj->hash_table);
+    for (i = 0; i < ME_HASH_BLOCK_SIZE_COUNT; i++) {
+        EB_FREE_ARRAY(obj->aligned_block_hash[i][0]);
+        EB_FREE_ARRAY(obj->aligned_block_hash[i][1]);
+    }
 }
 
 /*****************************************
@@ -219,6 +236,7 @@ EbErrorType eb_pa_reference_object_ctor(
     EbPtr   object_init_data_ptr)
 {
     EbPictureBufferDescInitData       *pictureBufferDescInitDataPtr = (EbPictureBufferDescInitData*)object_init_data_ptr;
+    uint32_t i;
 
     paReferenceObject->dctor = eb_pa_reference_object_dctor;
 
@@ -227,11 +245,14 @@ EbErrorType eb_pa_reference_object_ctor(
         paReferenceObject->input_padded_picture_ptr,
         eb_picture_buffer_desc_ctor,
         (EbPtr)pictureBufferDescInitDataPtr);
-    // Quarter Decim reference picture constructor
-    EB_NEW(
-        paReferenceObject->quarter_decimated_picture_ptr,
-        eb_picture_buffer_desc_ctor,
-        (EbPtr)(pictureBufferDescInitDataPtr + 1));
+    // Quarter Decim reference picture constructor, only the motion searches
+    // read it so it is not needed when they use the filtered picture
+    if (!(pictureBufferDescInitDataPtr + 1)->down_sampled_filtered) {
+        EB_NEW(
+            paReferenceObject->quarter_decimated_picture_ptr,
+            eb_picture_buffer_desc_ctor,
+            (EbPtr)(pictureBufferDescInitDataPtr + 1));
+    }
     EB_NEW(
         paReferenceObject->sixteenth_decimated_picture_ptr,
         eb_picture_buffer_desc_ctor,
@@ -250,6 +271,31 @@ EbErrorType eb_pa_reference_object_ctor(
             eb_picture_buffer_desc_ctor,
             (EbPtr)(pictureBufferDescInitDataPtr + 2));
     }
+    paReferenceObject->me_quarter_picture_ptr = (pictureBufferDescInitDataPtr + 1)->down_sampled_filtered ?
+        paReferenceObject->quarter_filtered_picture_ptr : paReferenceObject->quarter_decimated_picture_ptr;
+    paReferenceObject->me_sixteenth_picture_ptr = (pictureBufferDescInitDataPtr + 2)->down_sampled_filtered ?
+        paReferenceObject->sixteenth_filtered_picture_ptr : paReferenceObject->sixteenth_decimated_picture_ptr;
+    // Half-pel planes read by the open loop motion search instead of
+    // interpolating the search region of every SB
+    if (((EbPaReferenceObjectDescInitData*)object_init_data_ptr)->half_pel_planes) {
+        const uint32_t plane_size = paReferenceObject->input_padded_picture_ptr->luma_size;
+        EB_MALLOC_ARRAY(paReferenceObject->pos_b_plane, plane_size);
+        EB_MALLOC_ARRAY(paReferenceObject->pos_h_plane, plane_size);
+        EB_MALLOC_ARRAY(paReferenceObject->pos_j_plane, plane_size);
+    }
+    EB_CREATE_SEMAPHORE(paReferenceObject->me_mv_done_semaphore, 0, 1);
+    // Keys of the aligned blocks of the hash ME; the hash table itself is
+    // created with the first screen content picture
+    if (((EbPaReferenceObjectDescInitData*)object_init_data_ptr)->hash_me) {
+        for (i = 0; i < ME_HASH_BLOCK_SIZE_COUNT; i++) {
+            const uint32_t block_size = 8 << i;
+            const uint32_t stride = (pictureBufferDescInitDataPtr->max_width + block_size - 1) / block_size;
+            const uint32_t rows = (pictureBufferDescInitDataPtr->max_height + block_size - 1) / block_size;
+            paReferenceObject->aligned_block_hash_stride[i] = stride;
+            EB_MALLOC_ARRAY(paReferenceObject->aligned_block_hash[i][0], stride * rows);
+            EB_MALLOC_ARRAY(paReferenceObject->aligned_block_hash[i][1], stride * rows);
+        }
+    }
 
     return EB_ErrorNone;
 }
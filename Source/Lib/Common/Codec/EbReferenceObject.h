@@ -9,7 +9,12 @@
 #include "EbDefinitions.h"
 #include "EbDefinitions.h"
 #include "EbAdaptiveMotionVectorPrediction.h"
+#include "EbCabacContextModel.h"
 #include "EbObject.h"
+#include "hash_motion.h"
+
+// Block sizes of the hash ME of screen content: 8x8 to 64x64
+#define ME_HASH_BLOCK_SIZE_COUNT 4
 
 typedef struct EbReferenceObject
 {
@@ -34,10 +39,24 @@ typedef struct EbReferenceObject
     aom_film_grain_t                film_grain_params; //Film grain parameters for a reference frame
     uint32_t                        cdef_frame_strength;
     int8_t                          sg_frame_ep;
+    // Frame end CDF update: CDFs the entropy coding of the picture ended
+    // with (counters reset) and global motion parameters of the picture as
+    // the decoder rebuilds them, read by the pictures using it as
+    // primary_ref_frame. frame_context_done is set once the entropy coding
+    // of the picture is complete; until then the entropy coding inputs of
+    // the readers are queued on frame_context_waiting (linked by next_ptr)
+    // and posted again when it is set. frame_context is only allocated with
+    // frame_end_cdf_update
+    FRAME_CONTEXT                  *frame_context;
+    EbWarpedMotionParams            global_motion[TOTAL_REFS_PER_FRAME];
+    EbHandle                        frame_context_mutex;
+    EbBool                          frame_context_done;
+    EbObjectWrapper                *frame_context_waiting;
 } EbReferenceObject;
 
 typedef struct EbReferenceObjectDescInitData {
     EbPictureBufferDescInitData   reference_picture_desc_init_data;
+    EbBool                        frame_end_cdf_update;
 } EbReferenceObjectDescInitData;
 
 typedef struct EbPaReferenceObject
@@ -48,9 +67,39 @@ typedef struct EbPaReferenceObject
     EbPictureBufferDesc          *sixteenth_decimated_picture_ptr;
     EbPictureBufferDesc          *quarter_filtered_picture_ptr;
     EbPictureBufferDesc          *sixteenth_filtered_picture_ptr;
+    // Levels of the pyramid read by the open loop and temporal filtering
+    // motion searches: the filtered pictures when the encoder downsamples
+    // by filtering, the decimated ones otherwise
+    EbPictureBufferDesc          *me_quarter_picture_ptr;
+    EbPictureBufferDesc          *me_sixteenth_picture_ptr;
+    // Half-pel planes of the padded picture, laid out as the luma buffer of
+    // input_padded_picture_ptr; only allocated when half_pel_planes is set
+    uint8_t                      *pos_b_plane;
+    uint8_t                      *pos_h_plane;
+    uint8_t                      *pos_j_plane;
     uint16_t                      variance[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
     uint8_t                       y_mean[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
     EB_SLICE                      slice_type;
+    // Motion field of the picture: 64x64 MV (quarter-pel, list 0, reference
+    // 0) and full-pel SAD of every SB, read by the ME of the pictures
+    // referencing it (collocated predictors and HME level 0 skip).
+    // me_mv_done_semaphore is posted once the ME of the picture is complete;
+    // readers block on it then post it back. me_mv_distance is the distance
+    // spanned by the MVs
+    uint32_t                      sb_me_mv[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
+    uint32_t                      sb_me_sad[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
+    int64_t                       me_mv_distance;
+    EbHandle                      me_mv_done_semaphore;
+    EbBool                        me_mv_done;
+    // Hash ME of screen content: table of the 8x8 to 64x64 blocks of the
+    // picture at every position, and table keys (hash_value1, hash_value2)
+    // of its blocks aligned on their size, indexed by block row and column.
+    // Only allocated when screen content can be detected; hash_table_valid
+    // is set once both are built for the picture
+    HashTable                     hash_table;
+    uint32_t                     *aligned_block_hash[ME_HASH_BLOCK_SIZE_COUNT][2];
+    uint32_t                      aligned_block_hash_stride[ME_HASH_BLOCK_SIZE_COUNT];
+    EbBool                        hash_table_valid;
     uint32_t                      dependent_pictures_count; //number of pic using this reference frame
 
 } EbPaReferenceObject;
@@ -60,6 +109,8 @@ typedef struct EbPaReferenceObjectDescInitData
     EbPictureBufferDescInitData   reference_picture_desc_init_data;
     EbPictureBufferDescInitData   quarter_picture_desc_init_data;
     EbPictureBufferDescInitData   sixteenth_picture_desc_init_data;
+    EbBool                        half_pel_planes;
+    EbBool                        hash_me;
 } EbPaReferenceObjectDescInitData;
 
 /**************************************
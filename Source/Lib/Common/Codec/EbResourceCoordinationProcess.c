@@ -715,6 +715,8 @@ void* resource_coordination_kernel(void *input_ptr)
             picture_control_set_ptr->sequence_control_set_wrapper_ptr = context_ptr->sequenceControlSetActiveArray[instance_index];
             picture_control_set_ptr->sequence_control_set_ptr = sequence_control_set_ptr;
             picture_control_set_ptr->input_picture_wrapper_ptr = input_picture_wrapper_ptr;
+            picture_control_set_ptr->external_motion_field = ((EbInputBufferHeader*)ebInputPtr)->motion_field.valid ?
+                &((EbInputBufferHeader*)ebInputPtr)->motion_field : NULL;
             picture_control_set_ptr->end_of_sequence_flag = end_of_sequence_flag;
 
             if (loop_index == 1) {
@@ -737,6 +739,7 @@ void* resource_coordination_kernel(void *input_ptr)
                 picture_control_set_ptr->input_ptr = (EbBufferHeaderType*)input_pic_wrapper_ptr->object_ptr;
                 picture_control_set_ptr->enhanced_picture_ptr = (EbPictureBufferDesc*)picture_control_set_ptr->input_ptr->p_buffer;
                 picture_control_set_ptr->input_picture_wrapper_ptr = input_pic_wrapper_ptr;
+                picture_control_set_ptr->external_motion_field = NULL;
             }
             // Set Picture Control Flags
             picture_control_set_ptr->idr_flag = sequence_control_set_ptr->encode_context_ptr->initial_picture || (picture_control_set_ptr->input_ptr->pic_type == EB_AV1_KEY_PICTURE);
@@ -810,6 +813,14 @@ void* resource_coordination_kernel(void *input_ptr)
                 &reference_picture_wrapper_ptr);
 
             picture_control_set_ptr->pa_reference_picture_wrapper_ptr = reference_picture_wrapper_ptr;
+            // Rearm the ME MVs latch of a recycled reference, all its readers
+            // are done once it is back in the pool
+            if (((EbPaReferenceObject*)reference_picture_wrapper_ptr->object_ptr)->me_mv_done) {
+                eb_block_on_semaphore(((EbPaReferenceObject*)reference_picture_wrapper_ptr->object_ptr)->me_mv_done_semaphore);
+                ((EbPaReferenceObject*)reference_picture_wrapper_ptr->object_ptr)->me_mv_done = EB_FALSE;
+            }
+            // The hash ME data is rebuilt by the picture analysis
+            ((EbPaReferenceObject*)reference_picture_wrapper_ptr->object_ptr)->hash_table_valid = EB_FALSE;
             // Since overlay pictures are not added to PA_Reference queue in PD and not released there, the life count is only set to 1
             if (picture_control_set_ptr->is_overlay)
                 // Give the new Reference a nominal live_count of 1
@@ -197,9 +197,62 @@ void   get_own_recon(
 }
 
 /******************************************************
- * Rest Kernel
+ * Setup Frame Context
+ *   Frame end CDF update: the entropy coding of the picture starts
+ *   from the CDFs its LAST reference ended with, and the picture
+ *   keeps its own with its reference. The global motion of the
+ *   picture is coded relative to the one of its primary_ref_frame.
  ******************************************************/
-void* rest_kernel(void *input_ptr)
+static void setup_frame_context(
+    PictureControlSet                     *picture_control_set_ptr)
+{
+    PictureParentControlSet *parent_pcs_ptr = picture_control_set_ptr->parent_pcs_ptr;
+    FrameHeader *frm_hdr = &parent_pcs_ptr->frm_hdr;
+    const EbBool intra_only = (EbBool)(frm_hdr->frame_type == KEY_FRAME || frm_hdr->frame_type == INTRA_ONLY_FRAME);
+
+    parent_pcs_ptr->refresh_frame_context = REFRESH_FRAME_CONTEXT_BACKWARD;
+
+    // The segmentation parameters are only coded without primary_ref_frame
+    if (!intra_only && !frm_hdr->error_resilient_mode &&
+        !frm_hdr->segmentation_params.segmentation_enabled &&
+        parent_pcs_ptr->ref_list0_count &&
+        picture_control_set_ptr->ref_pic_ptr_array[REF_LIST_0][0] != EB_NULL)
+    {
+        EbReferenceObject *ref_obj_l0 = (EbReferenceObject*)picture_control_set_ptr->ref_pic_ptr_array[REF_LIST_0][0]->object_ptr;
+        frm_hdr->primary_ref_frame = 0; // LAST_FRAME
+        memcpy(parent_pcs_ptr->prev_global_motion, ref_obj_l0->global_motion, sizeof(parent_pcs_ptr->prev_global_motion));
+    }
+
+    if (parent_pcs_ptr->is_used_as_reference_flag) {
+        EbReferenceObject *reference_object = (EbReferenceObject*)parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr;
+        for (int32_t frame = LAST_FRAME; frame <= ALTREF_FRAME; ++frame) {
+            const EbWarpedMotionParams *params = &parent_pcs_ptr->global_motion[frame];
+            EbWarpedMotionParams *coded_params = &reference_object->global_motion[frame];
+            // Only the translation of TRANSLATION parameters is coded
+            *coded_params = default_warp_params;
+            if (intra_only || params->wmtype == IDENTITY)
+                continue;
+            if (params->wmtype == TRANSLATION) {
+                const int32_t trans_prec_diff = GM_TRANS_ONLY_PREC_DIFF + !frm_hdr->allow_high_precision_mv;
+                coded_params->wmtype = TRANSLATION;
+                coded_params->wmmat[0] = (params->wmmat[0] >> trans_prec_diff) * (1 << trans_prec_diff);
+                coded_params->wmmat[1] = (params->wmmat[1] >> trans_prec_diff) * (1 << trans_prec_diff);
+            }
+            else
+                *coded_params = *params;
+        }
+        // Held until the entropy coding saved the CDFs of the picture
+        eb_object_inc_live_count(parent_pcs_ptr->reference_picture_wrapper_ptr, 1);
+    }
+}
+
+/******************************************************
+ * Rest Task
+ *   Processes one input object of the Rest process and
+ *   releases it. Called by rest_kernel, or directly by the
+ *   encoder task scheduler when the task pool is enabled.
+ ******************************************************/
+void rest_task(void *input_ptr, EbObjectWrapper *cdef_results_wrapper_ptr)
 {
     // Context & SCS & PCS
     RestContext                            *context_ptr = (RestContext*)input_ptr;
@@ -208,7 +261,6 @@ void* rest_kernel(void *input_ptr)
     FrameHeader                           *frm_hdr;
 
     //// Input
-    EbObjectWrapper                       *cdef_results_wrapper_ptr;
     CdefResults                         *cdef_results_ptr;
 
     //// Output
@@ -218,126 +270,129 @@ void* rest_kernel(void *input_ptr)
     PictureDemuxResults                   *picture_demux_results_rtr;
     // SB Loop variables
 
-    for (;;) {
-        // Get Cdef Results
-        eb_get_full_object(
-            context_ptr->rest_input_fifo_ptr,
-            &cdef_results_wrapper_ptr);
+    cdef_results_ptr = (CdefResults*)cdef_results_wrapper_ptr->object_ptr;
+    picture_control_set_ptr = (PictureControlSet*)cdef_results_ptr->picture_control_set_wrapper_ptr->object_ptr;
+    sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    frm_hdr = &picture_control_set_ptr->parent_pcs_ptr->frm_hdr;
+    uint8_t lcuSizeLog2 = (uint8_t)Log2f(sequence_control_set_ptr->sb_size_pix);
+    EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
 
-        cdef_results_ptr = (CdefResults*)cdef_results_wrapper_ptr->object_ptr;
-        picture_control_set_ptr = (PictureControlSet*)cdef_results_ptr->picture_control_set_wrapper_ptr->object_ptr;
-        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-        frm_hdr = &picture_control_set_ptr->parent_pcs_ptr->frm_hdr;
-        uint8_t lcuSizeLog2 = (uint8_t)Log2f(sequence_control_set_ptr->sb_size_pix);
-        EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
-        Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+    if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0)
+    {
+        get_own_recon(sequence_control_set_ptr, picture_control_set_ptr, context_ptr, is16bit);
 
-        if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0)
-        {
-            get_own_recon(sequence_control_set_ptr, picture_control_set_ptr, context_ptr, is16bit);
-
-            Yv12BufferConfig cpi_source;
-            link_eb_to_aom_buffer_desc(
-                is16bit ? picture_control_set_ptr->input_frame16bit : picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
-                &cpi_source);
-
-            Yv12BufferConfig trial_frame_rst;
-            link_eb_to_aom_buffer_desc(
-                context_ptr->trial_frame_rst,
-                &trial_frame_rst);
-
-            Yv12BufferConfig org_fts;
-            link_eb_to_aom_buffer_desc(
-                context_ptr->org_rec_frame,
-                &org_fts);
-
-            restoration_seg_search(
-                context_ptr,
-                &org_fts,
-                &cpi_source,
-                &trial_frame_rst,
-                picture_control_set_ptr,
-                cdef_results_ptr->segment_index);
-        }
+        Yv12BufferConfig cpi_source;
+        link_eb_to_aom_buffer_desc(
+            is16bit ? picture_control_set_ptr->input_frame16bit : picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
+            &cpi_source);
 
-        //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
-        eb_block_on_mutex(picture_control_set_ptr->rest_search_mutex);
+        Yv12BufferConfig trial_frame_rst;
+        link_eb_to_aom_buffer_desc(
+            context_ptr->trial_frame_rst,
+            &trial_frame_rst);
 
-        picture_control_set_ptr->tot_seg_searched_rest++;
-        if (picture_control_set_ptr->tot_seg_searched_rest == picture_control_set_ptr->rest_segments_total_count)
-        {
-            if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0) {
-                rest_finish_search(
-                    picture_control_set_ptr->parent_pcs_ptr->av1x,
-                    picture_control_set_ptr->parent_pcs_ptr->av1_cm);
-
-                if (cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
-                    cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
-                    cm->rst_info[2].frame_restoration_type != RESTORE_NONE)
-                {
-                    av1_loop_restoration_filter_frame(
-                        cm->frame_to_show,
-                        cm,
-                        0);
-                }
-            }
-            else {
-                cm->rst_info[0].frame_restoration_type = RESTORE_NONE;
-                cm->rst_info[1].frame_restoration_type = RESTORE_NONE;
-                cm->rst_info[2].frame_restoration_type = RESTORE_NONE;
-            }
+        Yv12BufferConfig org_fts;
+        link_eb_to_aom_buffer_desc(
+            context_ptr->org_rec_frame,
+            &org_fts);
+
+        restoration_seg_search(
+            context_ptr,
+            &org_fts,
+            &cpi_source,
+            &trial_frame_rst,
+            picture_control_set_ptr,
+            cdef_results_ptr->segment_index);
+    }
 
-            uint8_t best_ep_cnt = 0;
-            uint8_t best_ep = 0;
-            for (uint8_t i = 0; i < SGRPROJ_PARAMS; i++) {
-                if (cm->sg_frame_ep_cnt[i] > best_ep_cnt) {
-                    best_ep = i;
-                    best_ep_cnt = cm->sg_frame_ep_cnt[i];
-                }
-            }
-            cm->sg_frame_ep = best_ep;
+    //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
+    eb_block_on_mutex(picture_control_set_ptr->rest_search_mutex);
 
-            if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL) {
-                // copy stat to ref object (intra_coded_area, Luminance, Scene change detection flags)
-                CopyStatisticsToRefObject(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
+    picture_control_set_ptr->tot_seg_searched_rest++;
+    if (picture_control_set_ptr->tot_seg_searched_rest == picture_control_set_ptr->rest_segments_total_count)
+    {
+        if (sequence_control_set_ptr->seq_header.enable_restoration && frm_hdr->allow_intrabc == 0) {
+            rest_finish_search(
+                picture_control_set_ptr->parent_pcs_ptr->av1x,
+                picture_control_set_ptr->parent_pcs_ptr->av1_cm);
+
+            if (cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
+                cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
+                cm->rst_info[2].frame_restoration_type != RESTORE_NONE)
+            {
+                av1_loop_restoration_filter_frame(
+                    cm->frame_to_show,
+                    cm,
+                    0);
             }
+        }
+        else {
+            cm->rst_info[0].frame_restoration_type = RESTORE_NONE;
+            cm->rst_info[1].frame_restoration_type = RESTORE_NONE;
+            cm->rst_info[2].frame_restoration_type = RESTORE_NONE;
+        }
 
-            // PSNR Calculation
-            if (sequence_control_set_ptr->static_config.stat_report)
-                psnr_calculations(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
-
-            // Pad the reference picture and set up TMVP flag and ref POC
-            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-                PadRefAndSetFlags(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
-            if (sequence_control_set_ptr->static_config.recon_enabled) {
-                ReconOutput(
-                    picture_control_set_ptr,
-                    sequence_control_set_ptr);
+        uint8_t best_ep_cnt = 0;
+        uint8_t best_ep = 0;
+        for (uint8_t i = 0; i < SGRPROJ_PARAMS; i++) {
+            if (cm->sg_frame_ep_cnt[i] > best_ep_cnt) {
+                best_ep = i;
+                best_ep_cnt = cm->sg_frame_ep_cnt[i];
             }
+        }
+        cm->sg_frame_ep = best_ep;
 
-            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag)
-            {
-                // Get Empty PicMgr Results
-                eb_get_empty_object(
-                    context_ptr->picture_demux_fifo_ptr,
-                    &picture_demux_results_wrapper_ptr);
-
-                picture_demux_results_rtr = (PictureDemuxResults*)picture_demux_results_wrapper_ptr->object_ptr;
-                picture_demux_results_rtr->reference_picture_wrapper_ptr = picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr;
-                picture_demux_results_rtr->sequence_control_set_wrapper_ptr = picture_control_set_ptr->sequence_control_set_wrapper_ptr;
-                picture_demux_results_rtr->picture_number = picture_control_set_ptr->picture_number;
-                picture_demux_results_rtr->picture_type = EB_PIC_REFERENCE;
-
-                // Post Reference Picture
-                eb_post_full_object(picture_demux_results_wrapper_ptr);
-            }
+        if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL) {
+            // copy stat to ref object (intra_coded_area, Luminance, Scene change detection flags)
+            CopyStatisticsToRefObject(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+        }
+
+        // PSNR Calculation
+        if (sequence_control_set_ptr->static_config.stat_report)
+            psnr_calculations(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+
+        // Pad the reference picture and set up TMVP flag and ref POC
+        if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
+            PadRefAndSetFlags(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+        if (sequence_control_set_ptr->static_config.recon_enabled) {
+            ReconOutput(
+                picture_control_set_ptr,
+                sequence_control_set_ptr);
+        }
+
+        if (sequence_control_set_ptr->static_config.frame_end_cdf_update)
+            setup_frame_context(picture_control_set_ptr);
+
+        if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag)
+        {
+            // Get Empty PicMgr Results
+            eb_get_empty_object(
+                context_ptr->picture_demux_fifo_ptr,
+                &picture_demux_results_wrapper_ptr);
+
+            picture_demux_results_rtr = (PictureDemuxResults*)picture_demux_results_wrapper_ptr->object_ptr;
+            picture_demux_results_rtr->reference_picture_wrapper_ptr = picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr;
+            picture_demux_results_rtr->sequence_control_set_wrapper_ptr = picture_control_set_ptr->sequence_control_set_wrapper_ptr;
+            picture_demux_results_rtr->picture_number = picture_control_set_ptr->picture_number;
+            picture_demux_results_rtr->picture_type = EB_PIC_REFERENCE;
+
+            // Post Reference Picture
+            eb_post_full_object(picture_demux_results_wrapper_ptr);
+        }
 
+        // One EC job per tile, so that the tiles are coded in parallel. The
+        // segment ids are predicted across the tile boundaries, the tiles of
+        // segmented pictures are coded in order by one job
+        const uint32_t tile_count = cm->tiles_info.tile_cols * cm->tiles_info.tile_rows;
+        const uint32_t job_tile_count = frm_hdr->segmentation_params.segmentation_enabled ? tile_count : 1;
+        for (uint32_t tile_idx = 0; tile_idx < tile_count; tile_idx += job_tile_count) {
             // Get Empty rest Results to EC
             eb_get_empty_object(
                 context_ptr->rest_output_fifo_ptr,
@@ -346,14 +401,35 @@ void* rest_kernel(void *input_ptr)
             rest_results_ptr->picture_control_set_wrapper_ptr = cdef_results_ptr->picture_control_set_wrapper_ptr;
             rest_results_ptr->completed_lcu_row_index_start = 0;
             rest_results_ptr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
+            rest_results_ptr->tile_index_start = tile_idx;
+            rest_results_ptr->tile_count = job_tile_count;
             // Post Rest Results
             eb_post_full_object(rest_results_wrapper_ptr);
         }
-        eb_release_mutex(picture_control_set_ptr->rest_search_mutex);
-
-        // Release input Results
-        eb_release_object(cdef_results_wrapper_ptr);
     }
+    eb_release_mutex(picture_control_set_ptr->rest_search_mutex);
+
+    // Release input Results
+    eb_release_object(cdef_results_wrapper_ptr);
+}
+
+/******************************************************
+ * Rest Kernel
+ ******************************************************/
+void* rest_kernel(void *input_ptr)
+{
+    RestContext                            *context_ptr = (RestContext*)input_ptr;
+    EbObjectWrapper                       *cdef_results_wrapper_ptr;
 
+    for (;;) {
+        // Get Cdef Results
+        eb_get_full_object(
+            context_ptr->rest_input_fifo_ptr,
+            &cdef_results_wrapper_ptr);
+
+        rest_task(
+            input_ptr,
+            cdef_results_wrapper_ptr);
+    }
     return EB_NULL;
 }
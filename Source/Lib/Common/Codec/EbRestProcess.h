@@ -52,6 +52,8 @@ extern EbErrorType rest_context_ctor(
     uint32_t                max_input_luma_height
    );
 
+extern void rest_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
+
 extern void* rest_kernel(void *input_ptr);
 
 #endif
@@ -352,114 +352,129 @@ void SpatialHighContrastClassifier(
         }
     }
 }
-/************************************************
- * Source Based Operations Kernel
- ************************************************/
-void* source_based_operations_kernel(void *input_ptr)
+/******************************************************
+ * Source Based Operations Task
+ *   Processes one input object of the Source Based Operations process and
+ *   releases it. Called by source_based_operations_kernel, or directly by the
+ *   encoder task scheduler when the task pool is enabled.
+ ******************************************************/
+void source_based_operations_task(void *input_ptr, EbObjectWrapper *inputResultsWrapperPtr)
 {
     SourceBasedOperationsContext    *context_ptr = (SourceBasedOperationsContext*)input_ptr;
     PictureParentControlSet       *picture_control_set_ptr;
     SequenceControlSet            *sequence_control_set_ptr;
-    EbObjectWrapper               *inputResultsWrapperPtr;
     InitialRateControlResults        *inputResultsPtr;
     EbObjectWrapper               *outputResultsWrapperPtr;
     PictureDemuxResults           *outputResultsPtr;
 
-    for (;;) {
-        // Get Input Full Object
-        eb_get_full_object(
-            context_ptr->initial_rate_control_results_input_fifo_ptr,
-            &inputResultsWrapperPtr);
+    inputResultsPtr = (InitialRateControlResults*)inputResultsWrapperPtr->object_ptr;
+    picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
+    sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
 
-        inputResultsPtr = (InitialRateControlResults*)inputResultsWrapperPtr->object_ptr;
-        picture_control_set_ptr = (PictureParentControlSet*)inputResultsPtr->picture_control_set_wrapper_ptr->object_ptr;
-        sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    picture_control_set_ptr->dark_back_groundlight_fore_ground = EB_FALSE;
+    context_ptr->picture_num_grass_sb = 0;
 
-        picture_control_set_ptr->dark_back_groundlight_fore_ground = EB_FALSE;
-        context_ptr->picture_num_grass_sb = 0;
+    context_ptr->sb_cmplx_contrast_count = 0;
+    context_ptr->sb_high_contrast_count = 0;
+    context_ptr->complete_sb_count = 0;
+    uint32_t sb_total_count = picture_control_set_ptr->sb_total_count;
+    uint32_t sb_index;
 
-        context_ptr->sb_cmplx_contrast_count = 0;
-        context_ptr->sb_high_contrast_count = 0;
-        context_ptr->complete_sb_count = 0;
-        uint32_t sb_total_count = picture_control_set_ptr->sb_total_count;
-        uint32_t sb_index;
+    /***********************************************LCU-based operations************************************************************/
+    for (sb_index = 0; sb_index < sb_total_count; ++sb_index) {
+        SbParams *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
+        EbBool is_complete_sb = sb_params->is_complete_sb;
+        uint8_t  *y_mean_ptr = picture_control_set_ptr->y_mean[sb_index];
 
-        /***********************************************LCU-based operations************************************************************/
-        for (sb_index = 0; sb_index < sb_total_count; ++sb_index) {
-            SbParams *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
-            EbBool is_complete_sb = sb_params->is_complete_sb;
-            uint8_t  *y_mean_ptr = picture_control_set_ptr->y_mean[sb_index];
+        _mm_prefetch((const char*)y_mean_ptr, _MM_HINT_T0);
+        uint8_t  *cr_mean_ptr = picture_control_set_ptr->crMean[sb_index];
+        uint8_t  *cb_mean_ptr = picture_control_set_ptr->cbMean[sb_index];
 
-            _mm_prefetch((const char*)y_mean_ptr, _MM_HINT_T0);
-            uint8_t  *cr_mean_ptr = picture_control_set_ptr->crMean[sb_index];
-            uint8_t  *cb_mean_ptr = picture_control_set_ptr->cbMean[sb_index];
+        _mm_prefetch((const char*)cr_mean_ptr, _MM_HINT_T0);
+        _mm_prefetch((const char*)cb_mean_ptr, _MM_HINT_T0);
 
-            _mm_prefetch((const char*)cr_mean_ptr, _MM_HINT_T0);
-            _mm_prefetch((const char*)cb_mean_ptr, _MM_HINT_T0);
+        context_ptr->y_mean_ptr = y_mean_ptr;
+        context_ptr->cr_mean_ptr = cr_mean_ptr;
+        context_ptr->cb_mean_ptr = cb_mean_ptr;
 
-            context_ptr->y_mean_ptr = y_mean_ptr;
-            context_ptr->cr_mean_ptr = cr_mean_ptr;
-            context_ptr->cb_mean_ptr = cb_mean_ptr;
+        // Grass detection
+        GrassLcu(
+            context_ptr,
+            sequence_control_set_ptr,
+            picture_control_set_ptr,
+            sb_index);
 
-            // Grass detection
-            GrassLcu(
+        // Spatial high contrast classifier
+        if (is_complete_sb) {
+            SpatialHighContrastClassifier(
                 context_ptr,
-                sequence_control_set_ptr,
                 picture_control_set_ptr,
                 sb_index);
-
-            // Spatial high contrast classifier
-            if (is_complete_sb) {
-                SpatialHighContrastClassifier(
-                    context_ptr,
-                    picture_control_set_ptr,
-                    sb_index);
-            }
-
-            if (is_complete_sb) {
-                context_ptr->complete_sb_count++;
-            }
         }
 
-        /*********************************************Picture-based operations**********************************************************/
-        // Delta QP range adjustments
-        SetDefaultDeltaQpRange(
-            context_ptr,
-            picture_control_set_ptr,
-            picture_control_set_ptr->slice_type == I_SLICE ? EB_FALSE : picture_control_set_ptr->scene_transition_flag[REF_LIST_0]);
-        // Dark density derivation (histograms not available when no SCD)
-
-        DeriveHighDarkAreaDensityFlag(
-            sequence_control_set_ptr,
-            picture_control_set_ptr);
-        // Detect aura areas in lighter background when subject is moving similar to background
-        DetermineMorePotentialAuraAreas(
-            sequence_control_set_ptr,
-            picture_control_set_ptr);
-
-        // Activity statistics derivation
-        DerivePictureActivityStatistics(
-            sequence_control_set_ptr,
-            picture_control_set_ptr);
+        if (is_complete_sb) {
+            context_ptr->complete_sb_count++;
+        }
+    }
 
-        // Skin & Grass detection
-        GrassSkinPicture(
-            context_ptr,
-            picture_control_set_ptr);
-        // Get Empty Results Object
-        eb_get_empty_object(
-            context_ptr->picture_demux_results_output_fifo_ptr,
-            &outputResultsWrapperPtr);
+    /*********************************************Picture-based operations**********************************************************/
+    // Delta QP range adjustments
+    SetDefaultDeltaQpRange(
+        context_ptr,
+        picture_control_set_ptr,
+        picture_control_set_ptr->slice_type == I_SLICE ? EB_FALSE : picture_control_set_ptr->scene_transition_flag[REF_LIST_0]);
+    // Dark density derivation (histograms not available when no SCD)
+
+    DeriveHighDarkAreaDensityFlag(
+        sequence_control_set_ptr,
+        picture_control_set_ptr);
+    // Detect aura areas in lighter background when subject is moving similar to background
+    DetermineMorePotentialAuraAreas(
+        sequence_control_set_ptr,
+        picture_control_set_ptr);
+
+    // Activity statistics derivation
+    DerivePictureActivityStatistics(
+        sequence_control_set_ptr,
+        picture_control_set_ptr);
+
+    // Skin & Grass detection
+    GrassSkinPicture(
+        context_ptr,
+        picture_control_set_ptr);
+    // Get Empty Results Object
+    eb_get_empty_object(
+        context_ptr->picture_demux_results_output_fifo_ptr,
+        &outputResultsWrapperPtr);
+
+    outputResultsPtr = (PictureDemuxResults*)outputResultsWrapperPtr->object_ptr;
+    outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
+    outputResultsPtr->picture_type = EB_PIC_INPUT;
+
+    // Release the Input Results
+    eb_release_object(inputResultsWrapperPtr);
+
+    // Post the Full Results Object
+    eb_post_full_object(outputResultsWrapperPtr);
+}
 
-        outputResultsPtr = (PictureDemuxResults*)outputResultsWrapperPtr->object_ptr;
-        outputResultsPtr->picture_control_set_wrapper_ptr = inputResultsPtr->picture_control_set_wrapper_ptr;
-        outputResultsPtr->picture_type = EB_PIC_INPUT;
+/************************************************
+ * Source Based Operations Kernel
+ ************************************************/
+void* source_based_operations_kernel(void *input_ptr)
+{
+    SourceBasedOperationsContext    *context_ptr = (SourceBasedOperationsContext*)input_ptr;
+    EbObjectWrapper               *inputResultsWrapperPtr;
 
-        // Release the Input Results
-        eb_release_object(inputResultsWrapperPtr);
+    for (;;) {
+        // Get Input Full Object
+        eb_get_full_object(
+            context_ptr->initial_rate_control_results_input_fifo_ptr,
+            &inputResultsWrapperPtr);
 
-        // Post the Full Results Object
-        eb_post_full_object(outputResultsWrapperPtr);
+        source_based_operations_task(
+            input_ptr,
+            inputResultsWrapperPtr);
     }
     return EB_NULL;
 }
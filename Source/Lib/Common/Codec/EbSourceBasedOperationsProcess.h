@@ -61,6 +61,8 @@ extern EbErrorType source_based_operations_context_ctor(
     EbFifo                        *picture_demux_results_output_fifo_ptr,
     SequenceControlSet            *sequence_control_set_ptr);
 
+extern void source_based_operations_task(void *input_ptr, EbObjectWrapper *input_wrapper_ptr);
+
 extern void* source_based_operations_kernel(void *input_ptr);
 
 #endif // EbSourceBasedOperations_h
@@ -10,7 +10,8 @@
 void EbFifoDctor(EbPtr p)
 {
     EbFifo *obj = (EbFifo*)p;
-    EB_DESTROY_SEMAPHORE(obj->counting_semaphore);
+    if (obj->counting_semaphore)
+        EB_DESTROY_SEMAPHORE(obj->counting_semaphore);
     EB_DESTROY_MUTEX(obj->lockout_mutex);
 }
 /**************************************
@@ -25,11 +26,17 @@ static EbErrorType EbFifoCtor(
     EbMuxingQueue    *queue_ptr)
 {
     fifoPtr->dctor = EbFifoDctor;
+#if LOCK_FREE_FIFO
+    // The process Fifo is only a handle to its MuxingQueue ring
+    (void)initial_count;
+    (void)max_count;
+#else
     // Create Counting Semaphore
     EB_CREATE_SEMAPHORE(fifoPtr->counting_semaphore, initial_count, max_count);
 
     // Create Buffer Pool Mutex
     EB_CREATE_MUTEX(fifoPtr->lockout_mutex);
+#endif
 
     // Initialize Fifo First & Last ptrs
     fifoPtr->first_ptr = firstWrapperPtr;
@@ -41,6 +48,7 @@ static EbErrorType EbFifoCtor(
     return EB_ErrorNone;
 }
 
+#if !LOCK_FREE_FIFO
 /**************************************
  * EbFifoPushBack
  **************************************/
@@ -181,6 +189,117 @@ static EbErrorType EbCircularBufferPushFront(
     return return_error;
 }
 
+#endif
+
+#if LOCK_FREE_FIFO
+// Number of pause iterations before a waiting thread parks (or yields)
+#define EB_RING_SPIN_COUNT 1024
+
+/**************************************
+ * EbRingWaitSequence
+ *   Waits for a ring cell to reach the expected sequence. The wait is
+ *   bounded by a peer that already owns the cell and is in the middle of
+ *   its copy, so it spins and then yields the core to that peer.
+ **************************************/
+static void EbRingWaitSequence(
+    volatile int32_t   *sequence,
+    int32_t             expected)
+{
+    uint32_t spin = 0;
+    while (eb_atomic_load(sequence) != expected) {
+        if (++spin < EB_RING_SPIN_COUNT)
+            eb_cpu_pause();
+        else
+            eb_yield_thread();
+    }
+}
+
+/**************************************
+ * EbRingPush
+ **************************************/
+static void EbRingPush(
+    EbMuxingQueue    *queue_ptr,
+    EbObjectWrapper  *wrapper_ptr)
+{
+    // Claim a slot
+    int32_t pos = eb_atomic_fetch_add(&queue_ptr->enqueue_pos, 1);
+    EbRingCell *cell = &queue_ptr->ring[(uint32_t)pos & queue_ptr->ring_mask];
+
+    // Wait until the consumer of the previous lap has emptied the slot
+    EbRingWaitSequence(&cell->sequence, pos);
+
+    cell->wrapper_ptr = wrapper_ptr;
+    eb_atomic_store(&cell->sequence, (int32_t)((uint32_t)pos + 1));
+
+    // Publish the object; wake one parked consumer if any
+    if (eb_atomic_fetch_add(&queue_ptr->available_count, 1) < 0)
+        eb_post_semaphore(queue_ptr->park_semaphore);
+}
+
+/**************************************
+ * EbRingTryClaim
+ *   Reserves one published object without blocking.
+ **************************************/
+static EbBool EbRingTryClaim(
+    EbMuxingQueue    *queue_ptr)
+{
+    int32_t count = eb_atomic_load(&queue_ptr->available_count);
+
+    while (count > 0) {
+        if (eb_atomic_compare_exchange(&queue_ptr->available_count, count, count - 1))
+            return EB_TRUE;
+        count = eb_atomic_load(&queue_ptr->available_count);
+    }
+    return EB_FALSE;
+}
+
+/**************************************
+ * EbRingClaim
+ *   Spin-then-park reservation of one published object. The spin budget
+ *   adapts per queue: it grows when spinning pays off and shrinks when
+ *   the consumer ends up parking anyway (e.g. oversubscribed cores).
+ **************************************/
+static void EbRingClaim(
+    EbMuxingQueue    *queue_ptr)
+{
+    int32_t spin_limit = queue_ptr->spin_limit;
+    int32_t spin;
+
+    for (spin = 0; spin <= spin_limit; ++spin) {
+        if (EbRingTryClaim(queue_ptr)) {
+            if (spin > 0)
+                queue_ptr->spin_limit = AOMMIN(EB_RING_SPIN_COUNT, spin_limit + (spin_limit >> 1) + 16);
+            return;
+        }
+        eb_cpu_pause();
+    }
+    queue_ptr->spin_limit = spin_limit >> 1;
+
+    // Reserve unconditionally; if nothing was available the producer that
+    // brings available_count back up posts the park semaphore.
+    if (eb_atomic_fetch_add(&queue_ptr->available_count, -1) <= 0)
+        eb_block_on_semaphore(queue_ptr->park_semaphore);
+}
+
+/**************************************
+ * EbRingPop
+ *   Dequeues the object reserved by a previous claim.
+ **************************************/
+static void EbRingPop(
+    EbMuxingQueue    *queue_ptr,
+    EbObjectWrapper **wrapper_dbl_ptr)
+{
+    int32_t pos = eb_atomic_fetch_add(&queue_ptr->dequeue_pos, 1);
+    EbRingCell *cell = &queue_ptr->ring[(uint32_t)pos & queue_ptr->ring_mask];
+
+    // Wait until the producer owning the slot has finished writing it
+    EbRingWaitSequence(&cell->sequence, (int32_t)((uint32_t)pos + 1));
+
+    *wrapper_dbl_ptr = cell->wrapper_ptr;
+    eb_atomic_store(&cell->sequence, (int32_t)((uint32_t)pos + queue_ptr->ring_mask + 1));
+}
+#endif
+
 void EbMuxingQueueDctor(EbPtr p)
 {
     EbMuxingQueue* obj = (EbMuxingQueue*)p;
@@ -188,6 +307,11 @@ void EbMuxingQueueDctor(EbPtr p)
     EB_DELETE(obj->object_queue);
     EB_DELETE(obj->process_queue);
     EB_DESTROY_MUTEX(obj->lockout_mutex);
+#if LOCK_FREE_FIFO
+    if (obj->park_semaphore)
+        EB_DESTROY_SEMAPHORE(obj->park_semaphore);
+    EB_FREE(obj->ring);
+#endif
 }
 
 /**************************************
@@ -205,6 +329,21 @@ static EbErrorType EbMuxingQueueCtor(
     queue_ptr->dctor = EbMuxingQueueDctor;
     queue_ptr->process_total_count = process_total_count;
 
+#if LOCK_FREE_FIFO
+    {
+        // The ring never holds more than object_total_count wrappers
+        uint32_t ringSize = 1;
+        uint32_t cellIndex;
+        while (ringSize < object_total_count)
+            ringSize <<= 1;
+        queue_ptr->ring_mask = ringSize - 1;
+        queue_ptr->spin_limit = EB_RING_SPIN_COUNT;
+        EB_CALLOC(queue_ptr->ring, ringSize, sizeof(EbRingCell));
+        for (cellIndex = 0; cellIndex < ringSize; ++cellIndex)
+            queue_ptr->ring[cellIndex].sequence = (int32_t)cellIndex;
+        EB_CREATE_SEMAPHORE(queue_ptr->park_semaphore, 0, object_total_count + process_total_count);
+    }
+#else
     // Lockout Mutex
     EB_CREATE_MUTEX(queue_ptr->lockout_mutex);
 
@@ -218,6 +357,7 @@ static EbErrorType EbMuxingQueueCtor(
         queue_ptr->process_queue,
         EbCircularBufferCtor,
         queue_ptr->process_total_count);
+#endif
     // Construct the Process Fifos
     EB_ALLOC_PTR_ARRAY(queue_ptr->process_fifo_ptr_array, queue_ptr->process_total_count);
 
@@ -237,6 +377,7 @@ static EbErrorType EbMuxingQueueCtor(
     return return_error;
 }
 
+#if !LOCK_FREE_FIFO
 /**************************************
  * EbMuxingQueueAssignation
  **************************************/
@@ -278,6 +419,8 @@ static EbErrorType EbMuxingQueueAssignation(
     return return_error;
 }
 
+#endif
+
 /**************************************
  * EbMuxingQueueObjectPushBack
  **************************************/
@@ -287,15 +430,22 @@ static EbErrorType EbMuxingQueueObjectPushBack(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    EbRingPush(
+        queue_ptr,
+        object_ptr);
+#else
     EbCircularBufferPushBack(
         queue_ptr->object_queue,
         object_ptr);
 
     EbMuxingQueueAssignation(queue_ptr);
+#endif
 
     return return_error;
 }
 
+#if !LOCK_FREE_FIFO
 /**************************************
 * EbMuxingQueueObjectPushFront
 **************************************/
@@ -314,6 +464,8 @@ static EbErrorType EbMuxingQueueObjectPushFront(
     return return_error;
 }
 
+#endif
+
 /*********************************************************************
  * eb_object_release_enable
  *   Enables the release_enable member of EbObjectWrapper.  Used by
@@ -333,11 +485,15 @@ EbErrorType eb_object_release_enable(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    wrapper_ptr->release_enable = EB_TRUE;
+#else
     eb_block_on_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     wrapper_ptr->release_enable = EB_TRUE;
 
     eb_release_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -361,11 +517,15 @@ EbErrorType eb_object_release_disable(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    wrapper_ptr->release_enable = EB_FALSE;
+#else
     eb_block_on_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     wrapper_ptr->release_enable = EB_FALSE;
 
     eb_release_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -390,11 +550,15 @@ EbErrorType eb_object_inc_live_count(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    eb_atomic_fetch_add((volatile int32_t*)&wrapper_ptr->live_count, (int32_t)increment_number);
+#else
     eb_block_on_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     wrapper_ptr->live_count += increment_number;
 
     eb_release_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -536,6 +700,7 @@ EbErrorType eb_system_resource_ctor(
     return return_error;
 }
 
+#if !LOCK_FREE_FIFO
 /*********************************************************************
  * EbSystemResourceReleaseProcess
  *********************************************************************/
@@ -557,6 +722,8 @@ static EbErrorType EbReleaseProcess(
     return return_error;
 }
 
+#endif
+
 /*********************************************************************
  * EbSystemResourcePostObject
  *   Queues a full EbObjectWrapper to the SystemResource. This
@@ -576,6 +743,18 @@ EbErrorType eb_post_full_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+    if (object_ptr->system_resource_ptr->post_callback) {
+        object_ptr->system_resource_ptr->post_callback(
+            object_ptr->system_resource_ptr->post_context_ptr,
+            object_ptr);
+        return return_error;
+    }
+
+#if LOCK_FREE_FIFO
+    EbRingPush(
+        object_ptr->system_resource_ptr->full_queue,
+        object_ptr);
+#else
     eb_block_on_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
 
     EbMuxingQueueObjectPushBack(
@@ -583,6 +762,7 @@ EbErrorType eb_post_full_object(
         object_ptr);
 
     eb_release_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -602,6 +782,36 @@ EbErrorType eb_release_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    volatile int32_t *live_count = (volatile int32_t*)&object_ptr->live_count;
+    int32_t count;
+    int32_t new_count;
+    EbBool  released;
+
+    // Decrement live_count and mark the wrapper released in one step
+    do {
+        count = eb_atomic_load(live_count);
+        new_count = (count == 0) ? count : count - 1;
+        released = (object_ptr->release_enable == EB_TRUE) && (new_count == 0);
+        if (released)
+            new_count = (int32_t)EB_ObjectWrapperReleasedValue;
+    } while (!eb_atomic_compare_exchange(live_count, count, new_count));
+
+    if (released && object_ptr->system_resource_ptr->release_callback)
+        object_ptr->system_resource_ptr->release_callback(
+            object_ptr->system_resource_ptr->release_context_ptr,
+            object_ptr);
+
+    // The ring has no front insertion; released wrappers go to the back
+    if (released)
+        EbRingPush(
+            object_ptr->system_resource_ptr->empty_queue,
+            object_ptr);
+
+    return return_error;
+#else
+    EbBool released = EB_FALSE;
+
     eb_block_on_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     // Decrement live_count
@@ -610,15 +820,32 @@ EbErrorType eb_release_object(
     if ((object_ptr->release_enable == EB_TRUE) && (object_ptr->live_count == 0)) {
         // Set live_count to EB_ObjectWrapperReleasedValue
         object_ptr->live_count = EB_ObjectWrapperReleasedValue;
+        released = EB_TRUE;
 
+        if (!object_ptr->system_resource_ptr->release_callback)
+            EbMuxingQueueObjectPushFront(
+                object_ptr->system_resource_ptr->empty_queue,
+                object_ptr);
+    }
+
+    eb_release_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+
+    // The callback runs outside of the lock, it may call back into the
+    //   library (e.g. to send the next picture)
+    if (released && object_ptr->system_resource_ptr->release_callback) {
+        object_ptr->system_resource_ptr->release_callback(
+            object_ptr->system_resource_ptr->release_context_ptr,
+            object_ptr);
+
+        eb_block_on_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
         EbMuxingQueueObjectPushFront(
             object_ptr->system_resource_ptr->empty_queue,
             object_ptr);
+        eb_release_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
     }
 
-    eb_release_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
-
     return return_error;
+#endif
 }
 
 /*********************************************************************
@@ -642,6 +869,19 @@ EbErrorType eb_get_empty_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    EbRingClaim(empty_fifo_ptr->queue_ptr);
+
+    EbRingPop(
+        empty_fifo_ptr->queue_ptr,
+        wrapper_dbl_ptr);
+
+    // Reset the wrapper's live_count
+    (*wrapper_dbl_ptr)->live_count = 0;
+
+    // Object release enable
+    (*wrapper_dbl_ptr)->release_enable = EB_TRUE;
+#else
     // Queue the Fifo requesting the empty fifo
     EbReleaseProcess(empty_fifo_ptr);
 
@@ -664,6 +904,7 @@ EbErrorType eb_get_empty_object(
 
     // Release Mutex
     eb_release_mutex(empty_fifo_ptr->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -689,6 +930,13 @@ EbErrorType eb_get_full_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    EbRingClaim(full_fifo_ptr->queue_ptr);
+
+    EbRingPop(
+        full_fifo_ptr->queue_ptr,
+        wrapper_dbl_ptr);
+#else
     // Queue the Fifo requesting the full fifo
     EbReleaseProcess(full_fifo_ptr);
 
@@ -704,10 +952,12 @@ EbErrorType eb_get_full_object(
 
     // Release Mutex
     eb_release_mutex(full_fifo_ptr->lockout_mutex);
+#endif
 
     return return_error;
 }
 
+#if !LOCK_FREE_FIFO
 /**************************************
 * EbFifoPopFront
 **************************************/
@@ -720,12 +970,21 @@ static EbBool EbFifoPeakFront(
     else
         return EB_FALSE;
 }
+#endif
 
 EbErrorType eb_get_full_object_non_blocking(
     EbFifo   *full_fifo_ptr,
     EbObjectWrapper **wrapper_dbl_ptr)
 {
     EbErrorType return_error = EB_ErrorNone;
+#if LOCK_FREE_FIFO
+    if (EbRingTryClaim(full_fifo_ptr->queue_ptr))
+        EbRingPop(
+            full_fifo_ptr->queue_ptr,
+            wrapper_dbl_ptr);
+    else
+        *wrapper_dbl_ptr = (EbObjectWrapper*)EB_NULL;
+#else
     EbBool      fifoEmpty;
     // Queue the Fifo requesting the full fifo
     EbReleaseProcess(full_fifo_ptr);
@@ -745,6 +1004,7 @@ EbErrorType eb_get_full_object_non_blocking(
             wrapper_dbl_ptr);
     else
         *wrapper_dbl_ptr = (EbObjectWrapper*)EB_NULL;
+#endif
 
     return return_error;
 }
@@ -94,8 +94,28 @@ extern "C" {
         uint32_t  current_count;
     } EbCircularBuffer;
 
+#if LOCK_FREE_FIFO
+    /*********************************************************************
+     * RingCell
+     *   One slot of the lock-free ring. sequence tells producers and
+     *   consumers whose turn it is to touch the slot (Vyukov bounded
+     *   MPMC queue).
+     *********************************************************************/
+    typedef struct EbRingCell
+    {
+        volatile int32_t  sequence;
+        EbObjectWrapper  *wrapper_ptr;
+    } EbRingCell;
+
+#define EB_RING_CACHE_LINE_SIZE 64
+#endif
+
     /*********************************************************************
      * MuxingQueue
+     *   With LOCK_FREE_FIFO the object/process circular buffers are
+     *   replaced by a single bounded ring shared by every process Fifo of
+     *   the queue. Consumers spin for a while on available_count and only
+     *   then park on park_semaphore.
      *********************************************************************/
     typedef struct EbMuxingQueue
     {
@@ -105,6 +125,24 @@ extern "C" {
         EbCircularBuffer *process_queue;
         uint32_t              process_total_count;
         EbFifo          **process_fifo_ptr_array;
+#if LOCK_FREE_FIFO
+        EbRingCell        *ring;
+        uint32_t           ring_mask;
+        EbHandle           park_semaphore;
+        // spin_limit - adaptive number of spins before a consumer parks
+        volatile int32_t   spin_limit;
+        // Producer and consumer positions live on separate cache lines so
+        //   the two sides do not false-share.
+        uint8_t            pad0[EB_RING_CACHE_LINE_SIZE];
+        volatile int32_t   enqueue_pos;
+        uint8_t            pad1[EB_RING_CACHE_LINE_SIZE - sizeof(int32_t)];
+        volatile int32_t   dequeue_pos;
+        uint8_t            pad2[EB_RING_CACHE_LINE_SIZE - sizeof(int32_t)];
+        // available_count - number of posted objects not yet claimed by a
+        //   consumer. A negative value is the number of parked consumers.
+        volatile int32_t   available_count;
+        uint8_t            pad3[EB_RING_CACHE_LINE_SIZE - sizeof(int32_t)];
+#endif
     } EbMuxingQueue;
 
     /*********************************************************************
@@ -116,6 +154,26 @@ extern "C" {
      *   fullFifo provides downstream pipeline data flow control.  The
      *   emptyFifo provides upstream pipeline backpressure flow control.
      *********************************************************************/
+    /*********************************************************************
+     * EbPostCallback
+     *   Consumer hook for a SystemResource's full objects.  When set, a
+     *   posted full object is handed to the callback instead of being
+     *   queued to the full FIFO (used by the encoder task scheduler).
+     *********************************************************************/
+    typedef void(*EbPostCallback)(
+        EbPtr            post_context_ptr,
+        EbObjectWrapper *wrapper_ptr);
+
+    /*********************************************************************
+     * EbReleaseCallback
+     *   Called when the last user of an object releases it, before the
+     *   object is queued back to the empty FIFO (used to hand caller
+     *   owned input pictures back to the application).
+     *********************************************************************/
+    typedef void(*EbReleaseCallback)(
+        EbPtr            release_context_ptr,
+        EbObjectWrapper *wrapper_ptr);
+
     typedef struct EbSystemResource
     {
         EbDctor               dctor;
@@ -132,6 +190,16 @@ extern "C" {
 
         // The full FIFO contains a queue of completed buffers
         EbMuxingQueue     *full_queue;
+
+        // post_callback - When non-NULL, full objects bypass full_queue and
+        //   are passed to post_callback along with post_context_ptr.
+        EbPostCallback     post_callback;
+        EbPtr              post_context_ptr;
+
+        // release_callback - When non-NULL, called with release_context_ptr
+        //   for every object released back to empty_queue.
+        EbReleaseCallback  release_callback;
+        EbPtr              release_context_ptr;
     } EbSystemResource;
 
     /*********************************************************************
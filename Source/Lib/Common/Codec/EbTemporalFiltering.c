@@ -276,15 +276,9 @@ void create_ME_context_and_picture_control(MotionEstimationContext_t *context_pt
     // set the buffers with the original, quarter and sixteenth pixels version of the source frame
     EbPaReferenceObject *src_object = (EbPaReferenceObject*)picture_control_set_ptr_central->pa_reference_picture_wrapper_ptr->object_ptr;
     EbPictureBufferDesc *padded_pic_ptr = src_object->input_padded_picture_ptr;
-    SequenceControlSet *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr_central->sequence_control_set_wrapper_ptr->object_ptr;
     // Set 1/4 and 1/16 ME reference buffer(s); filtered or decimated
-    EbPictureBufferDesc * quarter_pic_ptr = (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) ?
-        (EbPictureBufferDesc*)src_object->quarter_filtered_picture_ptr :
-        (EbPictureBufferDesc*)src_object->quarter_decimated_picture_ptr;
-
-    EbPictureBufferDesc *sixteenth_pic_ptr = (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED) ?
-        (EbPictureBufferDesc*)src_object->sixteenth_filtered_picture_ptr :
-        (EbPictureBufferDesc*)src_object->sixteenth_decimated_picture_ptr;
+    EbPictureBufferDesc *quarter_pic_ptr = src_object->me_quarter_picture_ptr;
+    EbPictureBufferDesc *sixteenth_pic_ptr = src_object->me_sixteenth_picture_ptr;
     // Parts from MotionEstimationKernel()
     uint32_t sb_origin_x = (uint32_t)(blk_col * BW);
     uint32_t sb_origin_y = (uint32_t)(blk_row * BH);
@@ -1664,21 +1658,10 @@ int pad_and_decimate_filtered_pic(PictureParentControlSet *picture_control_set_p
         padded_pic_ptr->origin_x,
         padded_pic_ptr->origin_y);
 
-    // 1/4 & 1/16 input picture decimation
-    DownsampleDecimationInputPicture(
+    // The filtered picture replaces the input, rebuild its 1/4 & 1/16 pictures
+    build_picture_pyramid(
         picture_control_set_ptr_central,
-        padded_pic_ptr,
-        (EbPictureBufferDesc*)src_object->quarter_decimated_picture_ptr,
-        (EbPictureBufferDesc*)src_object->sixteenth_decimated_picture_ptr);
-
-    // 1/4 & 1/16 input picture downsampling through filtering
-    SequenceControlSet *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr_central->sequence_control_set_wrapper_ptr->object_ptr;
-    if (sequence_control_set_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
-        DownsampleFilteringInputPicture(
-            picture_control_set_ptr_central,
-            padded_pic_ptr,
-            (EbPictureBufferDesc*)src_object->quarter_filtered_picture_ptr,
-            (EbPictureBufferDesc*)src_object->sixteenth_filtered_picture_ptr);
+        src_object);
     return 0;
 }
 
@@ -25,6 +25,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <pthread.h>
+#include <sched.h>
 #include <semaphore.h>
 #include <time.h>
 #include <unistd.h>
@@ -171,6 +172,20 @@ EbErrorType eb_destroy_thread(
 
     return error_return;
 }
+
+/****************************************
+ * eb_yield_thread
+ ****************************************/
+void eb_yield_thread(
+    void)
+{
+#ifdef _WIN32
+    SwitchToThread();
+#elif defined(__linux__) || defined(__APPLE__)
+    sched_yield();
+#endif // _WIN32
+}
+
 #if defined(__APPLE__)
 static int32_t semaphore_id(void)
 {
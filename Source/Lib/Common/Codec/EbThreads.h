@@ -35,6 +35,9 @@ extern "C" {
     extern EbErrorType eb_destroy_thread(
         EbHandle thread_handle);
 
+    extern void eb_yield_thread(
+        void);
+
     /**************************************
      * Semaphores
      **************************************/
@@ -70,6 +73,66 @@ extern "C" {
     extern EbErrorType eb_destroy_mutex(
         EbHandle mutex_handle);
 
+    /**************************************
+     * Atomics
+     *   Sequentially consistent 32-bit
+     *   primitives used by the lock-free
+     *   queues.
+     **************************************/
+#ifdef _WIN32
+    static INLINE int32_t eb_atomic_fetch_add(volatile int32_t *ptr, int32_t value)
+    {
+        return (int32_t)InterlockedExchangeAdd((volatile LONG*)ptr, (LONG)value);
+    }
+
+    static INLINE EbBool eb_atomic_compare_exchange(volatile int32_t *ptr, int32_t expected, int32_t desired)
+    {
+        return (InterlockedCompareExchange((volatile LONG*)ptr, (LONG)desired, (LONG)expected) == (LONG)expected) ? EB_TRUE : EB_FALSE;
+    }
+
+    static INLINE int32_t eb_atomic_load(volatile int32_t *ptr)
+    {
+        return (int32_t)InterlockedCompareExchange((volatile LONG*)ptr, 0, 0);
+    }
+
+    static INLINE void eb_atomic_store(volatile int32_t *ptr, int32_t value)
+    {
+        InterlockedExchange((volatile LONG*)ptr, (LONG)value);
+    }
+
+    static INLINE void eb_cpu_pause(void)
+    {
+        YieldProcessor();
+    }
+#else
+    static INLINE int32_t eb_atomic_fetch_add(volatile int32_t *ptr, int32_t value)
+    {
+        return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+    }
+
+    static INLINE EbBool eb_atomic_compare_exchange(volatile int32_t *ptr, int32_t expected, int32_t desired)
+    {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? EB_TRUE : EB_FALSE;
+    }
+
+    static INLINE int32_t eb_atomic_load(volatile int32_t *ptr)
+    {
+        return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+    }
+
+    static INLINE void eb_atomic_store(volatile int32_t *ptr, int32_t value)
+    {
+        __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+    }
+
+    static INLINE void eb_cpu_pause(void)
+    {
+#if defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+#endif
+    }
+#endif
+
     extern    EbMemoryMapEntry *memory_map;                // library Memory table
     extern    uint32_t         *memory_map_index;          // library memory index
     extern    uint64_t         *total_lib_memory;          // library Memory malloc'd
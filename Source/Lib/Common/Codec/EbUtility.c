@@ -438,6 +438,76 @@ inline uint64_t Log2f64(uint64_t x)
     return 64 - n;
 }
 
+/**************************************
+* Instruction Set Support
+**************************************/
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+// Helper Functions
+void RunCpuid(uint32_t eax, uint32_t ecx, int32_t* abcd)
+{
+#if defined(_MSC_VER)
+    __cpuidex(abcd, eax, ecx);
+#else
+    uint32_t ebx = 0, edx = 0;
+# if defined( __i386__ ) && defined ( __PIC__ )
+    /* in case of PIC under 32-bit EBX cannot be clobbered */
+    __asm__("movl %%ebx, %%edi \n\t cpuid \n\t xchgl %%ebx, %%edi" : "=D" (ebx),
+# else
+    __asm__("cpuid" : "+b" (ebx),
+# endif
+        "+a" (eax), "+c" (ecx), "=d" (edx));
+    abcd[0] = eax; abcd[1] = ebx; abcd[2] = ecx; abcd[3] = edx;
+#endif
+}
+static uint32_t GetXcr0()
+{
+    uint32_t xcr0;
+#if defined(_MSC_VER)
+    xcr0 = (uint32_t)_xgetbv(0);  /* min VS2010 SP1 compiler is required */
+#else
+    __asm__("xgetbv" : "=a" (xcr0) : "c" (0) : "%edx");
+#endif
+    return xcr0;
+}
+int32_t CheckXcr0Ymm()
+{
+    return ((GetXcr0() & 6) == 6); /* checking if xmm and ymm state are enabled in XCR0 */
+}
+static int32_t CheckAvx512Features()
+{
+    int32_t abcd[4];
+    int32_t avx512_f_dq_bw_vl_mask = (1 << 16) | (1 << 17) | (1 << 30) | (1 << 31);
+
+    /* CPUID.(EAX=01H, ECX=0H):ECX.OSXSAVE[bit 27]==1 */
+    RunCpuid(1, 0, abcd);
+    if ((abcd[2] & (1 << 27)) == 0)
+        return 0;
+
+    /* xmm, ymm, opmask and zmm state enabled in XCR0 */
+    if ((GetXcr0() & 0xE6) != 0xE6)
+        return 0;
+
+    /*  CPUID.(EAX=07H, ECX=0H):EBX.AVX512F[bit 16]==1  &&
+        CPUID.(EAX=07H, ECX=0H):EBX.AVX512DQ[bit 17]==1 &&
+        CPUID.(EAX=07H, ECX=0H):EBX.AVX512BW[bit 30]==1 &&
+        CPUID.(EAX=07H, ECX=0H):EBX.AVX512VL[bit 31]==1 */
+    RunCpuid(0, 0, abcd);
+    if (abcd[0] < 7)
+        return 0;
+    RunCpuid(7, 0, abcd);
+    return (abcd[1] & avx512_f_dq_bw_vl_mask) == avx512_f_dq_bw_vl_mask;
+}
+int32_t CanUseAvx512Features()
+{
+    static int32_t avx512_features_available = -1;
+    /* test is performed once */
+    if (avx512_features_available < 0)
+        avx512_features_available = CheckAvx512Features();
+    return avx512_features_available;
+}
+
 /*****************************************
  * Endian Swap
  *****************************************/
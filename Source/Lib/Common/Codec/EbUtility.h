@@ -170,6 +170,11 @@ extern "C" {
     extern uint64_t Log2f64(uint64_t x);
     extern uint32_t endian_swap(uint32_t ui);
 
+    extern void RunCpuid(uint32_t eax, uint32_t ecx, int32_t* abcd);
+    extern int32_t CheckXcr0Ymm();
+    /* 1 when the CPU and the OS support AVX-512 F, DQ, BW and VL */
+    extern int32_t CanUseAvx512Features();
+
     /****************************
      * MACROS
      ****************************/
@@ -39,6 +39,7 @@
 #define HAS_AVX 0x40
 #define HAS_AVX2 0x80
 #define HAS_SSE4_2 0x100
+#define HAS_AVX512 0x200
 
 #ifdef __cplusplus
 extern "C" {
@@ -76,6 +77,7 @@ extern "C" {
 
     void cdef_filter_block_c(uint8_t *dst8, uint16_t *dst16, int32_t dstride, const uint16_t *in, int32_t pri_strength, int32_t sec_strength, int32_t dir, int32_t pri_damping, int32_t sec_damping, int32_t bsize, int32_t max, int32_t coeff_shift);
     void cdef_filter_block_avx2(uint8_t *dst8, uint16_t *dst16, int32_t dstride, const uint16_t *in, int32_t pri_strength, int32_t sec_strength, int32_t dir, int32_t pri_damping, int32_t sec_damping, int32_t bsize, int32_t max, int32_t coeff_shift);
+    void cdef_filter_block_avx512(uint8_t *dst8, uint16_t *dst16, int32_t dstride, const uint16_t *in, int32_t pri_strength, int32_t sec_strength, int32_t dir, int32_t pri_damping, int32_t sec_damping, int32_t bsize, int32_t max, int32_t coeff_shift);
     RTCD_EXTERN void(*cdef_filter_block)(uint8_t *dst8, uint16_t *dst16, int32_t dstride, const uint16_t *in, int32_t pri_strength, int32_t sec_strength, int32_t dir, int32_t pri_damping, int32_t sec_damping, int32_t bsize, int32_t max, int32_t coeff_shift);
 
     uint64_t compute_cdef_dist_c(const uint16_t *dst, int32_t dstride, const uint16_t *src, const cdef_list *dlist, int32_t cdef_count, BlockSize bsize, int32_t coeff_shift, int32_t pli);
@@ -1321,18 +1323,22 @@ extern "C" {
 
     uint32_t aom_sad128x128_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad128x128_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad128x128_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad128x128)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad128x128x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad128x128x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad128x128x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad128x128x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad128x64_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad128x64_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad128x64_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad128x64)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad128x64x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad128x64x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad128x64x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad128x64x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad16x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
@@ -1377,34 +1383,42 @@ extern "C" {
 
     uint32_t aom_sad32x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad32x16_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad32x16_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad32x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad32x16x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad32x16x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad32x16x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad32x16x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad32x32_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad32x32_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad32x32_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad32x32)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad32x32x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad32x32x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad32x32x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad32x32x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad32x64_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad32x64_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad32x64_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad32x64)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad32x64x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad32x64x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad32x64x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad32x64x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad32x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad32x8_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad32x8_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad32x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad32x8x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad32x8x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad32x8x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad32x8x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad4x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
@@ -1433,34 +1447,42 @@ extern "C" {
 
     uint32_t aom_sad64x128_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad64x128_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad64x128_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad64x128)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad64x128x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad64x128x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad64x128x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad64x128x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad64x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad64x16_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad64x16_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad64x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad64x16x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad64x16x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad64x16x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad64x16x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad64x32_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad64x32_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad64x32_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad64x32)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad64x32x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad64x32x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad64x32x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad64x32x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad64x64_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     uint32_t aom_sad64x64_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+    uint32_t aom_sad64x64_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
     RTCD_EXTERN uint32_t(*aom_sad64x64)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
     void aom_sad64x64x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     void aom_sad64x64x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
+    void aom_sad64x64x4d_avx512(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
     RTCD_EXTERN void(*aom_sad64x64x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_ptr[], int ref_stride, uint32_t *sad_array);
 
     uint32_t aom_sad8x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
@@ -2354,7 +2376,7 @@ extern "C" {
     void av1_filter_intra_predictor_c(uint8_t *dst, ptrdiff_t stride, TxSize tx_size, const uint8_t *above, const uint8_t *left, int32_t mode);
     RTCD_EXTERN void (*av1_filter_intra_predictor) (uint8_t *dst, ptrdiff_t stride, TxSize tx_size, const uint8_t *above, const uint8_t *left, int32_t mode);
 
-    //void av1_get_nz_map_contexts_c(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
+    void av1_get_nz_map_contexts_c(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
     void av1_get_nz_map_contexts_sse2(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
     RTCD_EXTERN void(*av1_get_nz_map_contexts)(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
 
@@ -2364,8 +2386,30 @@ extern "C" {
 
     void residual_kernel_c(uint8_t *input, uint32_t input_stride, uint8_t *pred, uint32_t pred_stride, int16_t *residual, uint32_t residual_stride, uint32_t area_width, uint32_t area_height);
     void ResidualKernel_avx2(uint8_t *input, uint32_t input_stride, uint8_t *pred, uint32_t pred_stride, int16_t *residual, uint32_t residual_stride, uint32_t area_width, uint32_t area_height);
+    void residual_kernel_avx512(uint8_t *input, uint32_t input_stride, uint8_t *pred, uint32_t pred_stride, int16_t *residual, uint32_t residual_stride, uint32_t area_width, uint32_t area_height);
     RTCD_EXTERN void(*ResidualKernel)(uint8_t *input, uint32_t input_stride, uint8_t *pred, uint32_t pred_stride, int16_t *residual, uint32_t residual_stride, uint32_t area_width, uint32_t area_height);
 
+    void get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_c(uint8_t *src, uint32_t src_stride, uint8_t **ref, uint32_t ref_stride, uint32_t num_refs, uint32_t **p_best_sad8x8, uint32_t **p_best_mv8x8, uint32_t **p_best_sad16x16, uint32_t **p_best_mv16x16, uint32_t *mv, uint16_t **p_sad16x16, EbBool sub_sad);
+    void get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx2(uint8_t *src, uint32_t src_stride, uint8_t **ref, uint32_t ref_stride, uint32_t num_refs, uint32_t **p_best_sad8x8, uint32_t **p_best_mv8x8, uint32_t **p_best_sad16x16, uint32_t **p_best_mv16x16, uint32_t *mv, uint16_t **p_sad16x16, EbBool sub_sad);
+    void get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx512(uint8_t *src, uint32_t src_stride, uint8_t **ref, uint32_t ref_stride, uint32_t num_refs, uint32_t **p_best_sad8x8, uint32_t **p_best_mv8x8, uint32_t **p_best_sad16x16, uint32_t **p_best_mv16x16, uint32_t *mv, uint16_t **p_sad16x16, EbBool sub_sad);
+    RTCD_EXTERN void(*get_eight_horizontal_search_point_results_8x8_16x16_multi_ref)(uint8_t *src, uint32_t src_stride, uint8_t **ref, uint32_t ref_stride, uint32_t num_refs, uint32_t **p_best_sad8x8, uint32_t **p_best_mv8x8, uint32_t **p_best_sad16x16, uint32_t **p_best_mv16x16, uint32_t *mv, uint16_t **p_sad16x16, EbBool sub_sad);
+
+    void sad_loop_kernel(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+    void sad_loop_kernel_sse4_1_intrin(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+    void sad_loop_kernel_avx2_intrin(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+    void sad_loop_kernel_avx512_intrin(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+    RTCD_EXTERN void(*nxm_sad_loop_kernel)(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+
+    void sad_loop_kernel_sse4_1_hme_l0_intrin(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+    void sad_loop_kernel_avx2_hme_l0_intrin(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+    void sad_loop_kernel_avx512_hme_l0_intrin(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+    RTCD_EXTERN void(*nxm_sad_loop_kernel_hme_l0)(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t height, uint32_t width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, int16_t search_area_width, int16_t search_area_height);
+
+    uint64_t spatial_full_distortion_kernel_c(uint8_t *input, uint32_t input_offset, uint32_t input_stride, uint8_t *recon, uint32_t recon_offset, uint32_t recon_stride, uint32_t area_width, uint32_t area_height);
+    uint64_t spatial_full_distortion_kernel_avx2(uint8_t *input, uint32_t input_offset, uint32_t input_stride, uint8_t *recon, uint32_t recon_offset, uint32_t recon_stride, uint32_t area_width, uint32_t area_height);
+    uint64_t spatial_full_distortion_kernel_avx512(uint8_t *input, uint32_t input_offset, uint32_t input_stride, uint8_t *recon, uint32_t recon_offset, uint32_t recon_stride, uint32_t area_width, uint32_t area_height);
+    RTCD_EXTERN uint64_t(*spatial_full_distortion_kernel)(uint8_t *input, uint32_t input_offset, uint32_t input_stride, uint8_t *recon, uint32_t recon_offset, uint32_t recon_stride, uint32_t area_width, uint32_t area_height);
+
     void av1_txb_init_levels_c(const TranLow *const coeff, const int32_t width, const int32_t height, uint8_t *const levels);
     void av1_txb_init_levels_avx2(const TranLow *const coeff, const int32_t width, const int32_t height, uint8_t *const levels);
     RTCD_EXTERN void(*av1_txb_init_levels)(const TranLow *const coeff, const int32_t width, const int32_t height, uint8_t *const levels);
@@ -2380,6 +2424,8 @@ extern "C" {
 
         if (asm_type == ASM_AVX2)
             flags |= HAS_AVX2;
+        if (asm_type == ASM_AVX2 && CanUseAvx512Features())
+            flags |= HAS_AVX512;
         //if (asm_type == ASM_NON_AVX2)
         //    flags = ~HAS_AVX2;
 
@@ -2402,6 +2448,7 @@ extern "C" {
 
         cdef_filter_block = cdef_filter_block_c;
         if (flags & HAS_AVX2) cdef_filter_block = cdef_filter_block_avx2;
+        if (flags & HAS_AVX512) cdef_filter_block = cdef_filter_block_avx512;
         compute_cdef_dist = compute_cdef_dist_c;
         if (flags & HAS_AVX2) compute_cdef_dist = compute_cdef_dist_avx2;
 
@@ -2616,11 +2663,26 @@ extern "C" {
         if (flags & HAS_AVX2) av1_highbd_dr_prediction_z2 = av1_highbd_dr_prediction_z2_avx2;
         av1_highbd_dr_prediction_z3 = av1_highbd_dr_prediction_z3_c;
         if (flags & HAS_AVX2) av1_highbd_dr_prediction_z3 = av1_highbd_dr_prediction_z3_avx2;
-        //av1_get_nz_map_contexts = av1_get_nz_map_contexts_c;
+        av1_get_nz_map_contexts = av1_get_nz_map_contexts_c;
         if (flags & HAS_SSE2) av1_get_nz_map_contexts = av1_get_nz_map_contexts_sse2;
 
         ResidualKernel = residual_kernel_c;
         if (flags & HAS_AVX2) ResidualKernel = ResidualKernel_avx2;
+        if (flags & HAS_AVX512) ResidualKernel = residual_kernel_avx512;
+        get_eight_horizontal_search_point_results_8x8_16x16_multi_ref = get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_c;
+        if (flags & HAS_AVX2) get_eight_horizontal_search_point_results_8x8_16x16_multi_ref = get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx2;
+        if (flags & HAS_AVX512) get_eight_horizontal_search_point_results_8x8_16x16_multi_ref = get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx512;
+        nxm_sad_loop_kernel = sad_loop_kernel;
+        if (flags & HAS_SSE4_1) nxm_sad_loop_kernel = sad_loop_kernel_sse4_1_intrin;
+        if (flags & HAS_AVX2) nxm_sad_loop_kernel = sad_loop_kernel_avx2_intrin;
+        if (flags & HAS_AVX512) nxm_sad_loop_kernel = sad_loop_kernel_avx512_intrin;
+        nxm_sad_loop_kernel_hme_l0 = sad_loop_kernel;
+        if (flags & HAS_SSE4_1) nxm_sad_loop_kernel_hme_l0 = sad_loop_kernel_sse4_1_hme_l0_intrin;
+        if (flags & HAS_AVX2) nxm_sad_loop_kernel_hme_l0 = sad_loop_kernel_avx2_hme_l0_intrin;
+        if (flags & HAS_AVX512) nxm_sad_loop_kernel_hme_l0 = sad_loop_kernel_avx512_hme_l0_intrin;
+        spatial_full_distortion_kernel = spatial_full_distortion_kernel_c;
+        if (flags & HAS_AVX2) spatial_full_distortion_kernel = spatial_full_distortion_kernel_avx2;
+        if (flags & HAS_AVX512) spatial_full_distortion_kernel = spatial_full_distortion_kernel_avx512;
 
         av1_txb_init_levels = av1_txb_init_levels_c;
         if (flags & HAS_AVX2) av1_txb_init_levels = av1_txb_init_levels_avx2;
@@ -3079,20 +3141,28 @@ extern "C" {
         if (flags & HAS_AVX2) aom_sad4x8x4d = aom_sad4x8x4d_avx2;
         aom_sad64x128 = aom_sad64x128_c;
         if (flags & HAS_AVX2) aom_sad64x128 = aom_sad64x128_avx2;
+        if (flags & HAS_AVX512) aom_sad64x128 = aom_sad64x128_avx512;
         aom_sad64x128x4d = aom_sad64x128x4d_c;
         if (flags & HAS_AVX2) aom_sad64x128x4d = aom_sad64x128x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad64x128x4d = aom_sad64x128x4d_avx512;
         aom_sad64x16 = aom_sad64x16_c;
         if (flags & HAS_AVX2) aom_sad64x16 = aom_sad64x16_avx2;
+        if (flags & HAS_AVX512) aom_sad64x16 = aom_sad64x16_avx512;
         aom_sad64x16x4d = aom_sad64x16x4d_c;
         if (flags & HAS_AVX2) aom_sad64x16x4d = aom_sad64x16x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad64x16x4d = aom_sad64x16x4d_avx512;
         aom_sad64x32 = aom_sad64x32_c;
         if (flags & HAS_AVX2) aom_sad64x32 = aom_sad64x32_avx2;
+        if (flags & HAS_AVX512) aom_sad64x32 = aom_sad64x32_avx512;
         aom_sad64x32x4d = aom_sad64x32x4d_c;
         if (flags & HAS_AVX2) aom_sad64x32x4d = aom_sad64x32x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad64x32x4d = aom_sad64x32x4d_avx512;
         aom_sad64x64 = aom_sad64x64_c;
         if (flags & HAS_AVX2) aom_sad64x64 = aom_sad64x64_avx2;
+        if (flags & HAS_AVX512) aom_sad64x64 = aom_sad64x64_avx512;
         aom_sad64x64x4d = aom_sad64x64x4d_c;
         if (flags & HAS_AVX2) aom_sad64x64x4d = aom_sad64x64x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad64x64x4d = aom_sad64x64x4d_avx512;
         aom_sad8x16 = aom_sad8x16_c;
         if (flags & HAS_AVX2) aom_sad8x16 = aom_sad8x16_avx2;
         aom_sad8x16x4d = aom_sad8x16x4d_c;
@@ -3111,36 +3181,48 @@ extern "C" {
         if (flags & HAS_AVX2) aom_sad16x4x4d = aom_sad16x4x4d_avx2;
         aom_sad32x8 = aom_sad32x8_c;
         if (flags & HAS_AVX2) aom_sad32x8 = aom_sad32x8_avx2;
+        if (flags & HAS_AVX512) aom_sad32x8 = aom_sad32x8_avx512;
         aom_sad32x8x4d = aom_sad32x8x4d_c;
         if (flags & HAS_AVX2) aom_sad32x8x4d = aom_sad32x8x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad32x8x4d = aom_sad32x8x4d_avx512;
         aom_sad16x64 = aom_sad16x64_c;
         if (flags & HAS_AVX2) aom_sad16x64 = aom_sad16x64_avx2;
         aom_sad16x64x4d = aom_sad16x64x4d_c;
         if (flags & HAS_AVX2) aom_sad16x64x4d = aom_sad16x64x4d_avx2;
         aom_sad128x128 = aom_sad128x128_c;
         if (flags & HAS_AVX2) aom_sad128x128 = aom_sad128x128_avx2;
+        if (flags & HAS_AVX512) aom_sad128x128 = aom_sad128x128_avx512;
         aom_sad128x128x4d = aom_sad128x128x4d_c;
         if (flags & HAS_AVX2) aom_sad128x128x4d = aom_sad128x128x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad128x128x4d = aom_sad128x128x4d_avx512;
         aom_sad128x64 = aom_sad128x64_c;
         if (flags & HAS_AVX2) aom_sad128x64 = aom_sad128x64_avx2;
+        if (flags & HAS_AVX512) aom_sad128x64 = aom_sad128x64_avx512;
         aom_sad128x64x4d = aom_sad128x64x4d_c;
         if (flags & HAS_AVX2) aom_sad128x64x4d = aom_sad128x64x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad128x64x4d = aom_sad128x64x4d_avx512;
         aom_sad32x16 = aom_sad32x16_c;
         if (flags & HAS_AVX2) aom_sad32x16 = aom_sad32x16_avx2;
+        if (flags & HAS_AVX512) aom_sad32x16 = aom_sad32x16_avx512;
         aom_sad32x16x4d = aom_sad32x16x4d_c;
         if (flags & HAS_AVX2) aom_sad32x16x4d = aom_sad32x16x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad32x16x4d = aom_sad32x16x4d_avx512;
         aom_sad16x32 = aom_sad16x32_c;
         if (flags & HAS_AVX2) aom_sad16x32 = aom_sad16x32_avx2;
         aom_sad16x32x4d = aom_sad16x32x4d_c;
         if (flags & HAS_AVX2) aom_sad16x32x4d = aom_sad16x32x4d_avx2;
         aom_sad32x64 = aom_sad32x64_c;
         if (flags & HAS_AVX2) aom_sad32x64 = aom_sad32x64_avx2;
+        if (flags & HAS_AVX512) aom_sad32x64 = aom_sad32x64_avx512;
         aom_sad32x64x4d = aom_sad32x64x4d_c;
         if (flags & HAS_AVX2) aom_sad32x64x4d = aom_sad32x64x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad32x64x4d = aom_sad32x64x4d_avx512;
         aom_sad32x32 = aom_sad32x32_c;
         if (flags & HAS_AVX2) aom_sad32x32 = aom_sad32x32_avx2;
+        if (flags & HAS_AVX512) aom_sad32x32 = aom_sad32x32_avx512;
         aom_sad32x32x4d = aom_sad32x32x4d_c;
         if (flags & HAS_AVX2) aom_sad32x32x4d = aom_sad32x32x4d_avx2;
+        if (flags & HAS_AVX512) aom_sad32x32x4d = aom_sad32x32x4d_avx512;
         aom_sad16x16 = aom_sad16x16_c;
         if (flags & HAS_AVX2) aom_sad16x16 = aom_sad16x16_avx2;
         aom_sad16x16x4d = aom_sad16x16x4d_c;
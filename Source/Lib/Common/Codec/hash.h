@@ -43,6 +43,7 @@ typedef struct _CRC32C {
 
 // init table for software version crc32c
 void av1_crc32c_calculator_init(CRC32C *p_crc32c);
+uint32_t av1_get_crc32c_value_c(CRC32C *p, uint8_t *buf, size_t len);
 
 #define AOM_BUFFER_SIZE_FOR_BLOCK_HASH (4096)
 
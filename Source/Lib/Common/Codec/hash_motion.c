@@ -16,7 +16,6 @@
 #include "hash_motion.h"
 #include "EbPictureControlSet.h"
 
-void aom_free(void *memblk);
 static const int crc_bits = 16;
 static const int block_size_bits = 3;
 
@@ -27,7 +26,7 @@ static void hash_table_clear_all(HashTable *p_hash_table) {
   for (int i = 0; i < max_addr; i++) {
     if (p_hash_table->p_lookup_table[i] != NULL) {
       aom_vector_destroy(p_hash_table->p_lookup_table[i]);
-      aom_free(p_hash_table->p_lookup_table[i]);
+      free(p_hash_table->p_lookup_table[i]);
       p_hash_table->p_lookup_table[i] = NULL;
     }
   }
@@ -173,7 +172,8 @@ int32_t av1_has_exact_match(HashTable *p_hash_table, uint32_t hash_value1,
 void av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
                                        uint32_t *pic_block_hash[2],
                                        int8_t *pic_block_same_info[3],
-                                       PictureControlSet * pcs) {
+                                       CRC_CALCULATOR *crc_calculator1,
+                                       CRC_CALCULATOR *crc_calculator2) {
   const int width = 2;
   const int height = 2;
   const int x_end = picture->y_crop_width - width + 1;
@@ -193,9 +193,9 @@ void av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
         pic_block_same_info[1][pos] = is_block16_2x2_col_same_value(p);
 
         pic_block_hash[0][pos] = av1_get_crc_value(
-            &pcs->crc_calculator1, (uint8_t *)p, length * sizeof(p[0]));
+            crc_calculator1, (uint8_t *)p, length * sizeof(p[0]));
         pic_block_hash[1][pos] = av1_get_crc_value(
-            &pcs->crc_calculator2, (uint8_t *)p, length * sizeof(p[0]));
+            crc_calculator2, (uint8_t *)p, length * sizeof(p[0]));
         pos++;
       }
       pos += width - 1;
@@ -212,9 +212,9 @@ void av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
         pic_block_same_info[1][pos] = is_block_2x2_col_same_value(p);
 
         pic_block_hash[0][pos] =
-            av1_get_crc_value(&pcs->crc_calculator1, p, length * sizeof(p[0]));
+            av1_get_crc_value(crc_calculator1, p, length * sizeof(p[0]));
         pic_block_hash[1][pos] =
-            av1_get_crc_value(&pcs->crc_calculator2, p, length * sizeof(p[0]));
+            av1_get_crc_value(crc_calculator2, p, length * sizeof(p[0]));
         pos++;
       }
       pos += width - 1;
@@ -228,7 +228,8 @@ void av1_generate_block_hash_value(const Yv12BufferConfig *picture,
                                    uint32_t *dst_pic_block_hash[2],
                                    int8_t *src_pic_block_same_info[3],
                                    int8_t *dst_pic_block_same_info[3],
-                                   PictureControlSet * pcs  ) {
+                                   CRC_CALCULATOR *crc_calculator1,
+                                   CRC_CALCULATOR *crc_calculator2) {
   const int pic_width = picture->y_crop_width;
   const int x_end = picture->y_crop_width - block_size + 1;
   const int y_end = picture->y_crop_height - block_size + 1;
@@ -247,14 +248,14 @@ void av1_generate_block_hash_value(const Yv12BufferConfig *picture,
       p[2] = src_pic_block_hash[0][pos + src_size * pic_width];
       p[3] = src_pic_block_hash[0][pos + src_size * pic_width + src_size];
       dst_pic_block_hash[0][pos] =
-          av1_get_crc_value(&pcs->crc_calculator1, (uint8_t *)p, length);
+          av1_get_crc_value(crc_calculator1, (uint8_t *)p, length);
 
       p[0] = src_pic_block_hash[1][pos];
       p[1] = src_pic_block_hash[1][pos + src_size];
       p[2] = src_pic_block_hash[1][pos + src_size * pic_width];
       p[3] = src_pic_block_hash[1][pos + src_size * pic_width + src_size];
       dst_pic_block_hash[1][pos] =
-          av1_get_crc_value(&pcs->crc_calculator2, (uint8_t *)p, length);
+          av1_get_crc_value(crc_calculator2, (uint8_t *)p, length);
 
       dst_pic_block_same_info[0][pos] =
           src_pic_block_same_info[0][pos] &&
@@ -292,6 +293,12 @@ void av1_generate_block_hash_value(const Yv12BufferConfig *picture,
   }
 }
 
+uint32_t av1_get_hash_value1(uint32_t crc_value, int block_size) {
+  const int add_value = hash_block_size_to_index(block_size) << crc_bits;
+  assert(add_value >= 0);
+  return (crc_value & ((1 << crc_bits) - 1)) + add_value;
+}
+
 void av1_add_to_hash_map_by_row_with_precal_data(HashTable *p_hash_table,
                                                  uint32_t *pic_hash[2],
                                                  int8_t *pic_is_same,
@@ -19,6 +19,7 @@
 #include "EbDefinitions.h"
 #include "EbCodingUnit.h"
 #include "vector.h"
+#include "hash.h"
 #include "EbPictureBufferDesc.h"
 
 #ifdef __cplusplus
@@ -50,14 +51,18 @@ int32_t av1_has_exact_match(HashTable *p_hash_table, uint32_t hash_value1,
 void av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
                                        uint32_t *pic_block_hash[2],
                                        int8_t *pic_block_same_info[3],
-                                      struct PictureControlSet * pcs);
+                                       CRC_CALCULATOR *crc_calculator1,
+                                       CRC_CALCULATOR *crc_calculator2);
 void av1_generate_block_hash_value(const Yv12BufferConfig *picture,
                                    int block_size,
                                    uint32_t *src_pic_block_hash[2],
                                    uint32_t *dst_pic_block_hash[2],
                                    int8_t *src_pic_block_same_info[3],
                                    int8_t *dst_pic_block_same_info[3],
-                                   struct PictureControlSet * pcs);
+                                   CRC_CALCULATOR *crc_calculator1,
+                                   CRC_CALCULATOR *crc_calculator2);
+// hash_value1 of the table entries of the blocks with the given crc value
+uint32_t av1_get_hash_value1(uint32_t crc_value, int block_size);
 void av1_add_to_hash_map_by_row_with_precal_data(HashTable *p_hash_table,
                                                  uint32_t *pic_hash[2],
                                                  int8_t *pic_is_same,
@@ -80,7 +80,59 @@ int aom_read_symbol_(SvtReader   *r,
                                    int          nsymbs ACCT_STR_PARAM)
 {
   int ret;
-  ret = svt_read_cdf(r, cdf, nsymbs, ACCT_STR_NAME);
+  ret = svt_read_cdf(r, cdf, nsymbs, NULL);
   if (r->allow_update_cdf) dec_update_cdf(cdf, ret, nsymbs);
   return ret;
 }
+
+static INLINE int inv_recenter_nonneg(int r, int v) {
+  if (v > (r << 1))
+    return v;
+  else if ((v & 1) == 0)
+    return (v >> 1) + r;
+  else
+    return r - ((v + 1) >> 1);
+}
+
+static INLINE int inv_recenter_finite_nonneg(int n, int r, int v) {
+  if ((r << 1) <= n)
+    return inv_recenter_nonneg(r, v);
+  else
+    return n - 1 - inv_recenter_nonneg(n - 1 - r, v);
+}
+
+int svt_read_primitive_quniform(SvtReader *r, uint16_t n ACCT_STR_PARAM) {
+  if (n <= 1) return 0;
+  const int l = get_msb(n) + 1;
+  const int m = (1 << l) - n;
+  const int v = svt_read_literal(r, l - 1, NULL);
+  return v < m ? v : (v << 1) - m + svt_read_bit(r, NULL);
+}
+
+int svt_read_primitive_subexpfin(SvtReader *r, uint16_t n,
+    uint16_t k ACCT_STR_PARAM)
+{
+  int i = 0;
+  int mk = 0;
+
+  while (1) {
+    const int b = (i ? k + i - 1 : k);
+    const int a = (1 << b);
+
+    if (n <= mk + 3 * a)
+      return svt_read_primitive_quniform(r, (uint16_t)(n - mk)) + mk;
+
+    if (!svt_read_bit(r, NULL))
+      return svt_read_literal(r, b, NULL) + mk;
+
+    i = i + 1;
+    mk += a;
+  }
+}
+
+int svt_read_primitive_refsubexpfin(SvtReader *r, uint16_t n, uint16_t k,
+    uint16_t ref ACCT_STR_PARAM)
+{
+  return inv_recenter_finite_nonneg(n, ref,
+      svt_read_primitive_subexpfin(r, n, k));
+}
@@ -67,6 +67,15 @@ int aom_read_symbol_(SvtReader   *r,
     AomCdfProb *cdf,
     int          nsymbs ACCT_STR_PARAM);
 
+/* Finite sub-exponential codes used by the loop restoration coefficients */
+int svt_read_primitive_quniform(SvtReader *r, uint16_t n ACCT_STR_PARAM);
+
+int svt_read_primitive_subexpfin(SvtReader *r, uint16_t n,
+    uint16_t k ACCT_STR_PARAM);
+
+int svt_read_primitive_refsubexpfin(SvtReader *r, uint16_t n, uint16_t k,
+    uint16_t ref ACCT_STR_PARAM);
+
 #ifdef __cplusplus
 }
 #endif
@@ -340,10 +340,6 @@ typedef struct PartitionInfo {
     /*!< Pointer to local warp params based on nieghbour mv sample projection */
     EbWarpedMotionParams local_warp_params;
 
-    WienerInfo wiener_info[MAX_MB_PLANE];
-
-    SgrprojInfo sgrproj_info[MAX_MB_PLANE];
-
     /*!< Motion vectors available in the stack */
     CandidateMv_dec ref_mv_stack[MODE_CTX_REF_FRAMES][MAX_REF_MV_STACK_SIZE];
 
@@ -0,0 +1,296 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbUtility.h"
+#include "EbCdef.h"
+#include "aom_dsp_rtcd.h"
+
+#include "EbDecStruct.h"
+#include "EbDecBlock.h"
+#include "EbDecHandle.h"
+#include "EbObuParse.h"
+#include "EbDecNbr.h"
+#include "EbDecUtils.h"
+#include "EbDecInverseQuantize.h"
+
+#include "EbDecCdef.h"
+
+static INLINE void fill_rect(uint16_t *dst, int32_t dstride, int32_t v, int32_t h,
+    uint16_t x)
+{
+    for (int32_t i = 0; i < v; i++) {
+        for (int32_t j = 0; j < h; j++)
+            dst[i * dstride + j] = x;
+    }
+}
+
+static INLINE void copy_rect(uint16_t *dst, int32_t dstride, const uint16_t *src,
+    int32_t sstride, int32_t v, int32_t h)
+{
+    for (int32_t i = 0; i < v; i++)
+        memcpy(dst + i * dstride, src + i * sstride, h * sizeof(*dst));
+}
+
+/* Copies a rect of the recon plane, 8 or 16 bit, to a 16 bit buffer */
+static void copy_sb_16(uint16_t *dst, int32_t dstride, const void *src,
+    int32_t is16bit, int32_t src_voffset, int32_t src_hoffset, int32_t sstride,
+    int32_t vsize, int32_t hsize)
+{
+    if (is16bit)
+        copy_rect(dst, dstride, (const uint16_t *)src + src_voffset * sstride +
+            src_hoffset, sstride, vsize, hsize);
+    else
+        copy_rect8_8bit_to_16bit(dst, dstride, (const uint8_t *)src +
+            src_voffset * sstride + src_hoffset, sstride, vsize, hsize);
+}
+
+static int32_t is_8x8_block_skip(EbDecHandle *dec_handle_ptr, int32_t mi_row,
+    int32_t mi_col)
+{
+    int32_t is_skip = 1;
+    for (int32_t r = 0; r < mi_size_high[BLOCK_8X8]; ++r)
+        for (int32_t c = 0; c < mi_size_wide[BLOCK_8X8]; ++c)
+            is_skip &= get_cur_mode_info(dec_handle_ptr, mi_row + r, mi_col + c,
+                NULL)->skip;
+    return is_skip;
+}
+
+static int32_t fb_compute_cdef_list(EbDecHandle *dec_handle_ptr, int32_t mi_row,
+    int32_t mi_col, cdef_list *dlist)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    int32_t maxr = AOMMIN((int32_t)frame_header->mi_rows - mi_row, MI_SIZE_64X64);
+    int32_t maxc = AOMMIN((int32_t)frame_header->mi_cols - mi_col, MI_SIZE_64X64);
+    int32_t count = 0;
+
+    for (int32_t r = 0; r < maxr; r += mi_size_high[BLOCK_8X8]) {
+        for (int32_t c = 0; c < maxc; c += mi_size_wide[BLOCK_8X8]) {
+            if (!is_8x8_block_skip(dec_handle_ptr, mi_row + r, mi_col + c)) {
+                dlist[count].by = (uint8_t)(r >> 1);
+                dlist[count].bx = (uint8_t)(c >> 1);
+                dlist[count].skip = 0;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/* Strength index of the fb, -1 when all its blocks are skipped */
+static int8_t get_fb_cdef_idx(EbDecHandle *dec_handle_ptr, int32_t fbr, int32_t fbc)
+{
+    FrameMiMap *frame_mi_map = &dec_handle_ptr->master_frame_buf.frame_mi_map;
+    int32_t sb_shift = frame_mi_map->sb_size_log2 - CDEF_BLOCKSIZE_LOG2;
+    SBInfo *sb_info = frame_mi_map->pps_sb_info[(fbr >> sb_shift) *
+        frame_mi_map->sb_cols + (fbc >> sb_shift)];
+    int32_t index = sb_shift ? (fbc & 1) + 2 * (fbr & 1) : 0;
+
+    return sb_info->sb_cdef_strength[index];
+}
+
+void dec_cdef_frame_init(EbDecHandle *dec_handle_ptr, DecCdefCtxt *cdef_ctxt)
+{
+    const int32_t nhfb = (dec_handle_ptr->frame_header.mi_cols + MI_SIZE_64X64 - 1) /
+        MI_SIZE_64X64;
+
+    memset(cdef_ctxt->row_cdef, 1, sizeof(*cdef_ctxt->row_cdef) * (nhfb + 2) * 2);
+    cdef_ctxt->prev_row_cdef = cdef_ctxt->row_cdef + 1;
+    cdef_ctxt->curr_row_cdef = cdef_ctxt->prev_row_cdef + nhfb + 2;
+}
+
+void dec_cdef_fb_row(EbDecHandle *dec_handle_ptr, DecCdefCtxt *cdef_ctxt,
+                     int32_t fbr)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    CDEFParams *cdef_params = &frame_header->CDEF_params;
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+    const int32_t is16bit = recon_picture_buf->bit_depth != EB_8BIT;
+    const int32_t num_planes = av1_num_planes(color_config);
+    const int32_t mi_rows = frame_header->mi_rows;
+    const int32_t mi_cols = frame_header->mi_cols;
+    const int32_t nvfb = (mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    const int32_t nhfb = (mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    const int32_t coeff_shift = AOMMAX(color_config->bit_depth - 8, 0);
+    const int32_t stride = cdef_ctxt->linebuf_stride;
+    uint16_t *src = cdef_ctxt->src;
+    uint8_t *prev_row_cdef = cdef_ctxt->prev_row_cdef;
+    uint8_t *curr_row_cdef = cdef_ctxt->curr_row_cdef;
+    cdef_list dlist[MI_SIZE_64X64 * MI_SIZE_64X64];
+    int32_t dir[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
+    int32_t var[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
+    int32_t xdec[MAX_MB_PLANE], ydec[MAX_MB_PLANE];
+    int32_t mi_wide_l2[MAX_MB_PLANE], mi_high_l2[MAX_MB_PLANE];
+    void *plane_buf[MAX_MB_PLANE];
+    int32_t plane_stride[MAX_MB_PLANE];
+    int32_t cdef_count;
+
+    for (int32_t pli = 0; pli < num_planes; pli++) {
+        xdec[pli] = pli ? color_config->subsampling_x : 0;
+        ydec[pli] = pli ? color_config->subsampling_y : 0;
+        mi_wide_l2[pli] = MI_SIZE_LOG2 - xdec[pli];
+        mi_high_l2[pli] = MI_SIZE_LOG2 - ydec[pli];
+        derive_blk_pointers(recon_picture_buf, pli, 0, 0, &plane_buf[pli],
+            &plane_stride[pli], xdec[pli], ydec[pli]);
+
+        const int32_t block_height =
+            (MI_SIZE_64X64 << mi_high_l2[pli]) + 2 * CDEF_VBORDER;
+        fill_rect(cdef_ctxt->colbuf[pli], CDEF_HBORDER, block_height, CDEF_HBORDER,
+            CDEF_VERY_LARGE);
+    }
+
+    int32_t cdef_left = 1;
+    for (int32_t fbc = 0; fbc < nhfb; fbc++) {
+        int32_t level, sec_strength;
+        int32_t uv_level, uv_sec_strength;
+        int32_t cstart = 0;
+        curr_row_cdef[fbc] = 0;
+
+        const int8_t cdef_idx = get_fb_cdef_idx(dec_handle_ptr, fbr, fbc);
+        if (cdef_idx == -1) {
+            cdef_left = 0;
+            continue;
+        }
+        if (!cdef_left) cstart = -CDEF_HBORDER;
+
+        const int32_t nhb = AOMMIN(MI_SIZE_64X64, mi_cols - MI_SIZE_64X64 * fbc);
+        const int32_t nvb = AOMMIN(MI_SIZE_64X64, mi_rows - MI_SIZE_64X64 * fbr);
+        const int32_t mi_row = MI_SIZE_64X64 * fbr;
+        const int32_t mi_col = MI_SIZE_64X64 * fbc;
+        const int32_t frame_top = (mi_row == 0) ? 1 : 0;
+        const int32_t frame_left = (mi_col == 0) ? 1 : 0;
+        const int32_t frame_bottom = (fbr == nvfb - 1) ||
+            (mi_row + MI_SIZE_64X64 == mi_rows);
+        const int32_t frame_right = (fbc == nhfb - 1) ||
+            (mi_col + MI_SIZE_64X64 == mi_cols);
+
+        level = cdef_params->cdef_y_strength[cdef_idx] / CDEF_SEC_STRENGTHS;
+        sec_strength = cdef_params->cdef_y_strength[cdef_idx] % CDEF_SEC_STRENGTHS;
+        sec_strength += sec_strength == 3;
+        uv_level = cdef_params->cdef_uv_strength[cdef_idx] / CDEF_SEC_STRENGTHS;
+        uv_sec_strength = cdef_params->cdef_uv_strength[cdef_idx] % CDEF_SEC_STRENGTHS;
+        uv_sec_strength += uv_sec_strength == 3;
+        if ((level == 0 && sec_strength == 0 && uv_level == 0 && uv_sec_strength == 0) ||
+            (cdef_count = fb_compute_cdef_list(dec_handle_ptr, mi_row, mi_col, dlist)) == 0)
+        {
+            cdef_left = 0;
+            continue;
+        }
+
+        curr_row_cdef[fbc] = 1;
+        for (int32_t pli = 0; pli < num_planes; pli++) {
+            const int32_t damping = cdef_params->cdef_damping;
+            const int32_t hsize = nhb << mi_wide_l2[pli];
+            const int32_t vsize = nvb << mi_high_l2[pli];
+            const int32_t cend = (fbc == nhfb - 1) ? hsize : hsize + CDEF_HBORDER;
+            const int32_t rend = (fbr == nvfb - 1) ? vsize : vsize + CDEF_VBORDER;
+            const int32_t coffset = fbc * MI_SIZE_64X64 << mi_wide_l2[pli];
+            const int32_t roffset = fbr * MI_SIZE_64X64 << mi_high_l2[pli];
+            uint16_t *linebuf = cdef_ctxt->linebuf[pli];
+            uint16_t *colbuf = cdef_ctxt->colbuf[pli];
+            void *rec_buf = plane_buf[pli];
+            int32_t rec_stride = plane_stride[pli];
+
+            if (pli) {
+                level = uv_level;
+                sec_strength = uv_sec_strength;
+            }
+
+            /* On the last fb column / row, fill in the right / bottom border
+               with CDEF_VERY_LARGE to avoid filtering with the outside */
+            if (fbc == nhfb - 1)
+                fill_rect(&src[cend + CDEF_HBORDER], CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, hsize + CDEF_HBORDER - cend,
+                    CDEF_VERY_LARGE);
+            if (fbr == nvfb - 1)
+                fill_rect(&src[(rend + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
+                    CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
+
+            /* Copy in the pixels we need from the current fb */
+            copy_sb_16(&src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER + cstart],
+                CDEF_BSTRIDE, rec_buf, is16bit, roffset, coffset + cstart,
+                rec_stride, rend, cend - cstart);
+
+            /* Rows above come from the line buffer when the fb above has
+               already been filtered in place */
+            if (!prev_row_cdef[fbc])
+                copy_sb_16(&src[CDEF_HBORDER], CDEF_BSTRIDE, rec_buf, is16bit,
+                    roffset - CDEF_VBORDER, coffset, rec_stride, CDEF_VBORDER, hsize);
+            else if (fbr > 0)
+                copy_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, &linebuf[coffset],
+                    stride, CDEF_VBORDER, hsize);
+            else
+                fill_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER, hsize,
+                    CDEF_VERY_LARGE);
+
+            if (!prev_row_cdef[fbc - 1])
+                copy_sb_16(src, CDEF_BSTRIDE, rec_buf, is16bit, roffset - CDEF_VBORDER,
+                    coffset - CDEF_HBORDER, rec_stride, CDEF_VBORDER, CDEF_HBORDER);
+            else if (fbr > 0 && fbc > 0)
+                copy_rect(src, CDEF_BSTRIDE, &linebuf[coffset - CDEF_HBORDER],
+                    stride, CDEF_VBORDER, CDEF_HBORDER);
+            else
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+
+            if (!prev_row_cdef[fbc + 1])
+                copy_sb_16(&src[CDEF_HBORDER + hsize], CDEF_BSTRIDE, rec_buf,
+                    is16bit, roffset - CDEF_VBORDER, coffset + hsize, rec_stride,
+                    CDEF_VBORDER, CDEF_HBORDER);
+            else if (fbr > 0 && fbc < nhfb - 1)
+                copy_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    &linebuf[coffset + hsize], stride, CDEF_VBORDER, CDEF_HBORDER);
+            else
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER,
+                    CDEF_HBORDER, CDEF_VERY_LARGE);
+
+            /* Left columns come from the column buffer when the fb on the
+               left has already been filtered in place */
+            if (cdef_left)
+                copy_rect(src, CDEF_BSTRIDE, colbuf, CDEF_HBORDER,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+
+            if (fbc < nhfb - 1)
+                copy_rect(colbuf, CDEF_HBORDER, src + hsize, CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+
+            if (fbr < nvfb - 1)
+                copy_sb_16(&linebuf[coffset], stride, rec_buf, is16bit,
+                    roffset + (MI_SIZE_64X64 << mi_high_l2[pli]) - CDEF_VBORDER,
+                    coffset, rec_stride, CDEF_VBORDER, hsize);
+
+            if (frame_top)
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, hsize + 2 * CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            if (frame_left)
+                fill_rect(src, CDEF_BSTRIDE, vsize + 2 * CDEF_VBORDER, CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            if (frame_bottom)
+                fill_rect(&src[(vsize + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
+                    CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
+            if (frame_right)
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    vsize + 2 * CDEF_VBORDER, CDEF_HBORDER, CDEF_VERY_LARGE);
+
+            if (is16bit)
+                cdef_filter_fb(NULL, (uint16_t *)rec_buf + roffset * rec_stride + coffset,
+                    rec_stride, &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER],
+                    xdec[pli], ydec[pli], dir, NULL, var, pli, dlist, cdef_count,
+                    level, sec_strength, damping, damping, coeff_shift);
+            else
+                cdef_filter_fb((uint8_t *)rec_buf + roffset * rec_stride + coffset, NULL,
+                    rec_stride, &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER],
+                    xdec[pli], ydec[pli], dir, NULL, var, pli, dlist, cdef_count,
+                    level, sec_strength, damping, damping, coeff_shift);
+        }
+        cdef_left = 1;
+    }
+
+    cdef_ctxt->prev_row_cdef = curr_row_cdef;
+    cdef_ctxt->curr_row_cdef = prev_row_cdef;
+}
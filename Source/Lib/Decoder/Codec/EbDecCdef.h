@@ -0,0 +1,44 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecCdef_h
+#define EbDecCdef_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* State carried from one 64x64 filter block row to the next, so that the
+   rows can be filtered as soon as the deblocked rows below are ready */
+typedef struct DecCdefCtxt {
+    /*!< Unfiltered rows above the current fb row, per plane */
+    uint16_t    *linebuf[MAX_MB_PLANE];
+    int32_t     linebuf_stride;
+
+    /*!< Unfiltered columns right of the previous fb, per plane */
+    uint16_t    *colbuf[MAX_MB_PLANE];
+
+    /*!< Flags of the fbs filtered in the previous and current fb rows */
+    uint8_t     *row_cdef;
+    uint8_t     *prev_row_cdef;
+    uint8_t     *curr_row_cdef;
+
+    /*!< 16 bit copy of the fb with its borders */
+    uint16_t    *src;
+} DecCdefCtxt;
+
+/* Resets the fb row state at the start of a frame */
+void dec_cdef_frame_init(EbDecHandle *dec_handle_ptr, DecCdefCtxt *cdef_ctxt);
+
+/* Filters one row of 64x64 filter blocks. Needs the fb row below to be
+   deblocked and the fb row above to be filtered */
+void dec_cdef_fb_row(EbDecHandle *dec_handle_ptr, DecCdefCtxt *cdef_ctxt,
+                     int32_t fbr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbDecCdef_h
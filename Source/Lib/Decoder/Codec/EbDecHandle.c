@@ -24,9 +24,14 @@
 #include <errno.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef _WIN32
+#include <windows.h>
 #endif
 
 #define RTCD_C
+#include "EbUtility.h"
 #include "aom_dsp_rtcd.h"
 
 /**************************************
@@ -54,6 +59,17 @@ void init_intra_predictors_internal(void);
 EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr,
                                 uint8_t **data, size_t data_size);
 
+//Get Number of logical processors
+static uint32_t get_num_processors(void) {
+#ifdef _WIN32
+    SYSTEM_INFO sysinfo;
+    GetSystemInfo(&sysinfo);
+    return sysinfo.dwNumberOfProcessors;
+#else
+    return sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
 void SwitchToRealTime(){
 #if defined(__linux__) || defined(__APPLE__)
 
@@ -92,22 +108,63 @@ static EbErrorType eb_dec_handle_ctor(
     svt_dec_memory_map_index = &dec_handle_ptr->memory_map_index;
     svt_dec_lib_malloc_count = 0;
 
+    dec_handle_ptr->mem_init_done = 0;
+    dec_handle_ptr->frame_buf_cbs.allocate_buffer = NULL;
+    dec_handle_ptr->frame_buf_cbs.release_buffer = NULL;
+    dec_handle_ptr->frame_buf_cbs.priv_data = NULL;
+
     return return_error;
 }
 
-/* Copy from recon buffer to out buffer! */
-int svt_dec_out_buf(
+/* Returns the planes of the output picture without copying them. They stay
+   valid until the application buffer is released to the allocator */
+static int svt_dec_out_buf_ref(
     EbDecHandle         *dec_handle_ptr,
     EbBufferHeaderType  *p_buffer)
 {
-    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+    EbDecPicBuf         *out_pic_buf = dec_handle_ptr->out_pic_buf;
+    EbPictureBufferDesc *recon_picture_buf = out_pic_buf->ps_pic_buf;
     EbSvtIOFormat       *out_img = (EbSvtIOFormat*)p_buffer->p_buffer;
+    const int32_t bytes_per_pixel = recon_picture_buf->bit_depth == EB_8BIT ? 1 : 2;
+    const int32_t sx = 1, sy = 1;
+
+    assert(recon_picture_buf->color_format == EB_YUV420);
+
+    out_img->luma = recon_picture_buf->buffer_y + bytes_per_pixel *
+        (recon_picture_buf->origin_x +
+        recon_picture_buf->origin_y * recon_picture_buf->stride_y);
+    out_img->cb = recon_picture_buf->buffer_cb + bytes_per_pixel *
+        ((recon_picture_buf->origin_x >> sx) +
+        (recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cb);
+    out_img->cr = recon_picture_buf->buffer_cr + bytes_per_pixel *
+        ((recon_picture_buf->origin_x >> sx) +
+        (recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cr);
+    out_img->y_stride = recon_picture_buf->stride_y;
+    out_img->cb_stride = recon_picture_buf->stride_cb;
+    out_img->cr_stride = recon_picture_buf->stride_cr;
+    out_img->width = dec_handle_ptr->frame_header.frame_size.frame_width;
+    out_img->height = dec_handle_ptr->frame_header.frame_size.frame_height;
+    out_img->origin_x = 0;
+    out_img->origin_y = 0;
+
+    p_buffer->p_app_private = out_pic_buf->ext_frame_buf.private_data;
 
-    /* TODO: Should add logic for show_existing_frame */
-    if (0 == dec_handle_ptr->show_frame) {
-        assert(0 == dec_handle_ptr->show_existing_frame);
+    return 1;
+}
+
+/* Copy from recon buffer to out buffer! */
+int svt_dec_out_buf(
+    EbDecHandle         *dec_handle_ptr,
+    EbBufferHeaderType  *p_buffer)
+{
+    if (0 == dec_handle_ptr->show_frame || NULL == dec_handle_ptr->out_pic_buf)
         return 0;
-    }
+
+    if (dec_handle_ptr->frame_buf_cbs.allocate_buffer)
+        return svt_dec_out_buf_ref(dec_handle_ptr, p_buffer);
+
+    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->out_pic_buf->ps_pic_buf;
+    EbSvtIOFormat       *out_img = (EbSvtIOFormat*)p_buffer->p_buffer;
 
     int wd = dec_handle_ptr->frame_header.frame_size.frame_width;
     int ht = dec_handle_ptr->frame_header.frame_size.frame_height;
@@ -229,7 +286,7 @@ EbErrorType eb_svt_dec_set_default_parameter(
     config_ptr->max_bit_depth = EB_EIGHT_BIT;
     config_ptr->max_color_format = EB_YUV420;
     config_ptr->asm_type = 0;
-    config_ptr->threads = 1;
+    config_ptr->threads = 0;
 
     // Application Specific parameters
     config_ptr->channel_id = 0;
@@ -352,6 +409,12 @@ EB_API EbErrorType eb_init_decoder(
     dec_handle_ptr->seq_header_done = 0;
     dec_handle_ptr->mem_init_done   = 0;
 
+    /* Tiles are decoded by the calling thread and threads - 1 workers */
+    if (0 == dec_handle_ptr->dec_config.threads)
+        dec_handle_ptr->dec_config.threads = get_num_processors();
+    if (dec_handle_ptr->dec_config.threads > DEC_MAX_NUM_THREADS)
+        dec_handle_ptr->dec_config.threads = DEC_MAX_NUM_THREADS;
+
     dec_handle_ptr->seen_frame_header   = 0;
     dec_handle_ptr->show_existing_frame = 0;
     dec_handle_ptr->show_frame          = 0;
@@ -435,7 +498,8 @@ EB_API EbErrorType eb_svt_dec_get_picture(
         return EB_ErrorBadParameter;
 
     EbDecHandle     *dec_handle_ptr = (EbDecHandle   *)svt_dec_component->p_component_private;
-    /* Copy from recon pointer and return! TODO: Should remove the memcpy! */
+    /* Copies from the recon picture, or references it when the application
+       allocates the frame buffers */
     if (0 == svt_dec_out_buf(dec_handle_ptr, p_buffer))
         return_error = EB_DecNoOutputPicture;
     return return_error;
@@ -453,6 +517,10 @@ EB_API EbErrorType eb_deinit_decoder(
     EbErrorType return_error    = EB_ErrorNone;
 
     if (dec_handle_ptr) {
+        /* Give the frame buffers still held back to the application */
+        if (dec_handle_ptr->mem_init_done)
+            dec_pic_mgr_deinit((EbDecPicMgr *)dec_handle_ptr->pv_pic_mgr);
+
         if (svt_dec_memory_map) {
             // Loop through the ptr table and free all malloc'd pointers per channel
             EbMemoryMapEntry*    memory_entry = svt_dec_memory_map;
@@ -534,10 +602,19 @@ EB_API EbErrorType eb_dec_set_frame_buffer_callbacks(
   eb_release_frame_buffer     release_buffer,
   void                        *priv_data)
 {
-    (void)svt_dec_component;
-    (void)allocate_buffer;
-    (void)release_buffer;
-    (void)priv_data;
+    if (svt_dec_component == NULL ||
+        (allocate_buffer == NULL) != (release_buffer == NULL))
+        return EB_ErrorBadParameter;
+
+    EbDecHandle *dec_handle_ptr = (EbDecHandle*)svt_dec_component->p_component_private;
+
+    /* The picture buffers are allocated once the sequence header is read */
+    if (dec_handle_ptr->mem_init_done)
+        return EB_ErrorBadParameter;
+
+    dec_handle_ptr->frame_buf_cbs.allocate_buffer = allocate_buffer;
+    dec_handle_ptr->frame_buf_cbs.release_buffer = release_buffer;
+    dec_handle_ptr->frame_buf_cbs.priv_data = priv_data;
 
     return EB_ErrorNone;
 }
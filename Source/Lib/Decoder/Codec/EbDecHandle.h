@@ -26,6 +26,8 @@ extern "C" {
 
 /* Maximum number of frames in parallel */
 #define DEC_MAX_NUM_FRM_PRLL    1
+/* Maximum number of threads decoding tiles */
+#define DEC_MAX_NUM_THREADS     64
 /** Maximum picture buffers needed **/
 #define MAX_PIC_BUFS (REF_FRAMES + 1 + DEC_MAX_NUM_FRM_PRLL)
 
@@ -42,12 +44,23 @@ typedef struct EbDecPicBuf {
     uint32_t            order_hint;
     uint32_t            ref_order_hints[INTER_REFS_PER_FRAME];
 
+    /*!< Frame type, checked when the frame is shown again */
+    FrameType           frame_type;
+
     EbPictureBufferDesc *ps_pic_buf;
 
+    /*!< Application buffer backing ps_pic_buf planes, buffer is NULL when
+         the planes are allocated by the library */
+    EbExtFrameBuf       ext_frame_buf;
+
     FRAME_CONTEXT       final_frm_ctx;
 
     GlobalMotionParams  global_motion[REF_FRAMES];
 
+    /*!< Loop filter deltas, inherited through primary_ref_frame */
+    int8_t              lf_ref_deltas[REF_FRAMES];
+    int8_t              lf_mode_deltas[MAX_MODE_LF_DELTAS];
+
     /* MV at 8x8 lvl */
     /* seg map */
     /* order hint */
@@ -55,6 +68,13 @@ typedef struct EbDecPicBuf {
 
 } EbDecPicBuf;
 
+/** External frame buffer callbacks, see eb_dec_set_frame_buffer_callbacks **/
+typedef struct EbDecFrameBufCallbacks {
+    eb_allocate_frame_buffer    allocate_buffer;
+    eb_release_frame_buffer     release_buffer;
+    void                        *priv_data;
+} EbDecFrameBufCallbacks;
+
 /* Frame level buffers */
 typedef struct CurFrameBuf {
     SBInfo          *sb_info;
@@ -72,6 +92,12 @@ typedef struct CurFrameBuf {
     /* Tile Map at SB level : TODO. Can be removed? */
     uint8_t         *tile_map_sb;
 
+    /*!< Loop restoration unit params, raster order per plane */
+    RestorationUnitInfo *lr_unit[MAX_MB_PLANE];
+    /*!< Number of restoration units in a row / column of each plane */
+    int32_t         lr_unit_cols[MAX_MB_PLANE];
+    int32_t         lr_unit_rows[MAX_MB_PLANE];
+
     /*!< Global warp params of current frame */
     EbWarpedMotionParams global_motion_warp[REF_FRAMES];
 
@@ -153,12 +179,17 @@ typedef struct EbDecHandle {
     uint8_t showable_frame;  // frame can be used as show existing frame in future
 
     // Thread Handles
+    /** Tile threads context, see EbDecTileThreads.h */
+    void   *pv_tile_thrd_ctxt;
 
     // Module Contexts
     void   *pv_parse_ctxt;
 
     void   *pv_dec_mod_ctxt;
 
+    /** Row pipelined post filters, see EbDecPostFilter.h */
+    void   *pv_post_filter_ctxt;
+
     /** Pointer to Picture manager structure **/
     void   *pv_pic_mgr;
 
@@ -188,7 +219,11 @@ typedef struct EbDecHandle {
     /* TODO: Move to buffer pool. */
     EbDecPicBuf *cur_pic_buf[DEC_MAX_NUM_FRM_PRLL];
 
+    /* Last shown picture, referenced until the next one is shown */
+    EbDecPicBuf *out_pic_buf;
+
     // Callbacks
+    EbDecFrameBufCallbacks  frame_buf_cbs;
 
     //DPB + MV, ... buf
 
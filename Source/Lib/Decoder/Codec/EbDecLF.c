@@ -0,0 +1,351 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbUtility.h"
+#include "EbDeblockingFilter.h"
+
+#include "EbDecStruct.h"
+#include "EbDecBlock.h"
+#include "EbDecHandle.h"
+#include "EbObuParse.h"
+#include "EbDecNbr.h"
+#include "EbDecUtils.h"
+#include "EbDecParseHelper.h"
+#include "EbDecInverseQuantize.h"
+
+#include "EbDecLF.h"
+
+static const int32_t mode_lf_lut[MB_MODE_COUNT] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // INTRA_MODES
+    1, 1, 0, 1,                             // INTER_MODES (GLOBALMV == 0)
+    1, 1, 1, 1, 1, 1, 0, 1  // INTER_COMPOUND_MODES (GLOBAL_GLOBALMV == 0)
+};
+
+static void update_sharpness(LoopFilterInfoN *lfi, int32_t sharpness_lvl) {
+    for (int32_t lvl = 0; lvl <= MAX_LOOP_FILTER; lvl++) {
+        int32_t block_inside_limit = lvl >> ((sharpness_lvl > 0) + (sharpness_lvl > 4));
+
+        if (sharpness_lvl > 0) {
+            if (block_inside_limit > (9 - sharpness_lvl))
+                block_inside_limit = (9 - sharpness_lvl);
+        }
+        if (block_inside_limit < 1) block_inside_limit = 1;
+
+        memset(lfi->lfthr[lvl].lim, block_inside_limit, SIMD_WIDTH);
+        memset(lfi->lfthr[lvl].mblim, (2 * (lvl + 2) + block_inside_limit),
+            SIMD_WIDTH);
+        memset(lfi->lfthr[lvl].hev_thr, (lvl >> 4), SIMD_WIDTH);
+    }
+}
+
+void dec_lf_frame_init(EbDecHandle *dec_handle_ptr, DecLFCtxt *lf_ctxt)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    struct LoopFilter *lf = &frame_header->loop_filter_params;
+    SegmentationParams *seg_params = &frame_header->segmentation_params;
+    LoopFilterInfoN *lfi = &lf_ctxt->lf_info;
+    const int32_t filt_lvl[MAX_MB_PLANE][2] = {
+        { lf->filter_level[0], lf->filter_level[1] },
+        { lf->filter_level_u, lf->filter_level_u },
+        { lf->filter_level_v, lf->filter_level_v } };
+
+    update_sharpness(lfi, lf->sharpness_level);
+    memset(lfi->lvl, 0, sizeof(lfi->lvl));
+
+    if (!lf->filter_level[0] && !lf->filter_level[1])
+        return;
+
+    for (int32_t plane = 0; plane < MAX_MB_PLANE; plane++) {
+        if (plane && !filt_lvl[plane][0])
+            continue;
+        for (int32_t seg_id = 0; seg_id < MAX_SEGMENTS; seg_id++) {
+            for (int32_t dir = 0; dir < 2; ++dir) {
+                int32_t lvl_seg = filt_lvl[plane][dir];
+                const SEG_LVL_FEATURES feature = (SEG_LVL_FEATURES)
+                    (SEG_LVL_ALT_LF_Y_V + (plane == 0 ? dir : plane + 1));
+
+                if (seg_feature_active_idx(seg_params, seg_id, feature))
+                    lvl_seg = clamp(lvl_seg + seg_params->feature_data[seg_id][feature],
+                        0, MAX_LOOP_FILTER);
+
+                if (!lf->mode_ref_delta_enabled) {
+                    memset(lfi->lvl[plane][seg_id][dir], lvl_seg,
+                        sizeof(lfi->lvl[plane][seg_id][dir]));
+                    continue;
+                }
+
+                const int32_t scale = 1 << (lvl_seg >> 5);
+                const int32_t intra_lvl = lvl_seg + lf->ref_deltas[INTRA_FRAME] * scale;
+                lfi->lvl[plane][seg_id][dir][INTRA_FRAME][0] =
+                    (uint8_t)clamp(intra_lvl, 0, MAX_LOOP_FILTER);
+
+                for (int32_t ref = LAST_FRAME; ref < REF_FRAMES; ++ref) {
+                    for (int32_t mode = 0; mode < MAX_MODE_LF_DELTAS; ++mode) {
+                        const int32_t inter_lvl = lvl_seg + lf->ref_deltas[ref] * scale +
+                            lf->mode_deltas[mode] * scale;
+                        lfi->lvl[plane][seg_id][dir][ref][mode] =
+                            (uint8_t)clamp(inter_lvl, 0, MAX_LOOP_FILTER);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void fill_blk_params(DecLFCtxt *lf_ctxt, int32_t plane, int32_t row4,
+    int32_t col4, int32_t h4, int32_t w4, int32_t rows4, int32_t cols4,
+    const LFBlkParams *blk_params)
+{
+    LFBlkParams *dst = lf_ctxt->blk_params[plane];
+    int32_t stride = lf_ctxt->blk_params_stride[plane];
+
+    h4 = AOMMIN(h4, rows4 - row4);
+    w4 = AOMMIN(w4, cols4 - col4);
+    for (int32_t r = 0; r < h4; r++)
+        for (int32_t c = 0; c < w4; c++)
+            dst[(row4 + r) * stride + col4 + c] = *blk_params;
+}
+
+static void fill_tx_size(DecLFCtxt *lf_ctxt, int32_t plane, int32_t row4,
+    int32_t col4, TxSize tx_size, int32_t rows4, int32_t cols4)
+{
+    LFBlkParams *dst = lf_ctxt->blk_params[plane];
+    int32_t stride = lf_ctxt->blk_params_stride[plane];
+    int32_t h4 = AOMMIN(tx_size_high_unit[tx_size], rows4 - row4);
+    int32_t w4 = AOMMIN(tx_size_wide_unit[tx_size], cols4 - col4);
+
+    for (int32_t r = 0; r < h4; r++)
+        for (int32_t c = 0; c < w4; c++)
+            dst[(row4 + r) * stride + col4 + c].tx_size = (uint8_t)tx_size;
+}
+
+/* Stores the level, skip and TU sizes of a block in the 4x4 params of
+   every plane it covers */
+static void set_blk_params(EbDecHandle *dec_handle_ptr, DecLFCtxt *lf_ctxt,
+    ModeInfo_t *mi, SBInfo *sb_info, int32_t mi_row, int32_t mi_col)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    LoopFilterInfoN *lfi = &lf_ctxt->lf_info;
+    const int32_t num_planes = av1_num_planes(color_config);
+    const int32_t lossless = frame_header->lossless_array[mi->segment_id];
+    const int32_t is_inter = dec_is_inter_block(mi);
+    const int32_t ref = AOMMAX(mi->ref_frame[0], INTRA_FRAME);
+    const int32_t mode = mode_lf_lut[mi->mode];
+    const int32_t has_chroma = num_planes > 1 && dec_is_chroma_reference(mi_row,
+        mi_col, mi->sb_type, color_config->subsampling_x, color_config->subsampling_y);
+
+    for (int32_t plane = 0; plane < num_planes; plane++) {
+        if (plane && !has_chroma)
+            break;
+        int32_t sub_x = plane ? color_config->subsampling_x : 0;
+        int32_t sub_y = plane ? color_config->subsampling_y : 0;
+        BlockSize plane_bsize = get_plane_block_size(mi->sb_type, sub_x, sub_y);
+        LFBlkParams blk_params;
+
+        blk_params.tx_size = TX_4X4;
+        blk_params.bsize = (uint8_t)plane_bsize;
+        blk_params.skip = mi->skip && is_inter;
+        blk_params.lvl[0] = lfi->lvl[plane][mi->segment_id][0][ref][mode];
+        blk_params.lvl[1] = lfi->lvl[plane][mi->segment_id][1][ref][mode];
+
+        fill_blk_params(lf_ctxt, plane, mi_row >> sub_y, mi_col >> sub_x,
+            block_size_high[plane_bsize] >> MI_SIZE_LOG2,
+            block_size_wide[plane_bsize] >> MI_SIZE_LOG2,
+            (int32_t)frame_header->mi_rows >> sub_y,
+            (int32_t)frame_header->mi_cols >> sub_x, &blk_params);
+    }
+
+    /* Lossless blocks only use 4x4 transforms */
+    if (lossless)
+        return;
+
+    TransformInfo_t *trans_info = sb_info->sb_trans_info[AOM_PLANE_Y] +
+        mi->first_luma_tu_offset;
+    for (int32_t tu = 0; tu < mi->num_luma_tus; tu++, trans_info++) {
+        fill_tx_size(lf_ctxt, AOM_PLANE_Y, mi_row + trans_info->tu_y_offset,
+            mi_col + trans_info->tu_x_offset, trans_info->tx_size,
+            frame_header->mi_rows, frame_header->mi_cols);
+    }
+
+    if (!has_chroma)
+        return;
+    trans_info = sb_info->sb_trans_info[AOM_PLANE_U] + mi->first_chroma_tu_offset;
+    for (int32_t tu = 0; tu < mi->num_chroma_tus; tu++, trans_info++) {
+        for (int32_t plane = AOM_PLANE_U; plane < num_planes; plane++) {
+            fill_tx_size(lf_ctxt, plane,
+                (mi_row >> color_config->subsampling_y) + trans_info->tu_y_offset,
+                (mi_col >> color_config->subsampling_x) + trans_info->tu_x_offset,
+                trans_info->tx_size,
+                frame_header->mi_rows >> color_config->subsampling_y,
+                frame_header->mi_cols >> color_config->subsampling_x);
+        }
+    }
+}
+
+static void set_sb_row_params(EbDecHandle *dec_handle_ptr, DecLFCtxt *lf_ctxt,
+    int32_t sb_row)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    FrameMiMap *frame_mi_map = &dec_handle_ptr->master_frame_buf.frame_mi_map;
+    int32_t sb_mi_log2 = frame_mi_map->sb_size_log2 - MI_SIZE_LOG2;
+    int32_t mi_row_start = sb_row << sb_mi_log2;
+    int32_t mi_row_end = AOMMIN((sb_row + 1) << sb_mi_log2,
+        (int32_t)frame_header->mi_rows);
+
+    /* Blocks are aligned to their width, so stepping by the width visits
+       every block of the row once. Blocks starting in a row above are
+       already stored */
+    for (int32_t mi_row = mi_row_start; mi_row < mi_row_end; mi_row++) {
+        for (int32_t mi_col = 0; mi_col < (int32_t)frame_header->mi_cols;) {
+            ModeInfo_t *mi = get_cur_mode_info(dec_handle_ptr, mi_row, mi_col, NULL);
+            if (mi_row == mi_row_start || mi !=
+                get_cur_mode_info(dec_handle_ptr, mi_row - 1, mi_col, NULL))
+            {
+                SBInfo *sb_info = frame_mi_map->pps_sb_info[sb_row *
+                    frame_mi_map->sb_cols + (mi_col >> sb_mi_log2)];
+                set_blk_params(dec_handle_ptr, lf_ctxt, mi, sb_info, mi_row, mi_col);
+            }
+            mi_col += mi_size_wide[mi->sb_type];
+        }
+    }
+}
+
+static INLINE void filter_edge(void *buf, int32_t stride, int32_t is16bit,
+    int32_t bit_depth, int32_t dir, int32_t filter_length,
+    const LoopFilterThresh *thr)
+{
+    if (is16bit) {
+        uint16_t *s = (uint16_t *)buf;
+        if (dir == 0) {
+            switch (filter_length) {
+            case 4: aom_highbd_lpf_vertical_4(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            case 6: aom_highbd_lpf_vertical_6(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            case 8: aom_highbd_lpf_vertical_8(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            default: aom_highbd_lpf_vertical_14(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            }
+        }
+        else {
+            switch (filter_length) {
+            case 4: aom_highbd_lpf_horizontal_4(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            case 6: aom_highbd_lpf_horizontal_6(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            case 8: aom_highbd_lpf_horizontal_8(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            default: aom_highbd_lpf_horizontal_14(s, stride, thr->mblim, thr->lim, thr->hev_thr, bit_depth); break;
+            }
+        }
+    }
+    else {
+        uint8_t *s = (uint8_t *)buf;
+        if (dir == 0) {
+            switch (filter_length) {
+            case 4: aom_lpf_vertical_4(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            case 6: aom_lpf_vertical_6(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            case 8: aom_lpf_vertical_8(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            default: aom_lpf_vertical_14(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            }
+        }
+        else {
+            switch (filter_length) {
+            case 4: aom_lpf_horizontal_4(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            case 6: aom_lpf_horizontal_6(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            case 8: aom_lpf_horizontal_8(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            default: aom_lpf_horizontal_14(s, stride, thr->mblim, thr->lim, thr->hev_thr); break;
+            }
+        }
+    }
+}
+
+/* Filters the edges of one direction in rows [row4_start, row4_end) of
+   4x4s of the plane, in raster order */
+static void filter_plane_edges(EbDecHandle *dec_handle_ptr, DecLFCtxt *lf_ctxt,
+    int32_t plane, int32_t dir, int32_t row4_start, int32_t row4_end)
+{
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+    int32_t is16bit = recon_picture_buf->bit_depth != EB_8BIT;
+    int32_t sub_x = plane ? color_config->subsampling_x : 0;
+    int32_t sub_y = plane ? color_config->subsampling_y : 0;
+    int32_t plane_w = ROUND_POWER_OF_TWO(frame_header->frame_size.frame_width, sub_x);
+    int32_t plane_h = ROUND_POWER_OF_TWO(frame_header->frame_size.frame_height, sub_y);
+    int32_t cols4 = (plane_w + MI_SIZE - 1) >> MI_SIZE_LOG2;
+    const LFBlkParams *blk_params = lf_ctxt->blk_params[plane];
+    int32_t params_stride = lf_ctxt->blk_params_stride[plane];
+    int32_t prev_offset = dir == 0 ? 1 : params_stride;
+    void *plane_buf;
+    int32_t stride;
+
+    derive_blk_pointers(recon_picture_buf, plane, 0, 0, &plane_buf, &stride,
+        sub_x, sub_y);
+
+    row4_end = AOMMIN(row4_end, (plane_h + MI_SIZE - 1) >> MI_SIZE_LOG2);
+    for (int32_t row4 = row4_start; row4 < row4_end; row4++) {
+        for (int32_t col4 = 0; col4 < cols4; col4++) {
+            const LFBlkParams *curr = &blk_params[row4 * params_stride + col4];
+            const int32_t coord = (dir == 0 ? col4 : row4) << MI_SIZE_LOG2;
+            const TxSize ts = dir == 0 ? txsize_horz_map[curr->tx_size] :
+                txsize_vert_map[curr->tx_size];
+            const int32_t tx_dim = dir == 0 ? tx_size_wide[ts] : tx_size_high[ts];
+
+            /* Frame edges and edges inside a TU are not filtered */
+            if (!coord || (coord & (tx_dim - 1)))
+                continue;
+
+            const LFBlkParams *prev = curr - prev_offset;
+            const int32_t curr_lvl = curr->lvl[dir];
+            const int32_t prev_lvl = prev->lvl[dir];
+            const int32_t pu_mask = (dir == 0 ? block_size_wide[curr->bsize] :
+                block_size_high[curr->bsize]) - 1;
+            const int32_t pu_edge = !(coord & pu_mask);
+
+            if (!(curr_lvl || prev_lvl) || (prev->skip && curr->skip && !pu_edge))
+                continue;
+
+            const TxSize prev_ts = dir == 0 ? txsize_horz_map[prev->tx_size] :
+                txsize_vert_map[prev->tx_size];
+            const TxSize min_ts = AOMMIN(ts, prev_ts);
+            int32_t filter_length;
+            if (min_ts == TX_4X4)
+                filter_length = 4;
+            else if (min_ts == TX_8X8)
+                filter_length = plane ? 6 : 8;
+            else
+                filter_length = plane ? 6 : 14;
+
+            const int32_t offset = (row4 << MI_SIZE_LOG2) * stride +
+                (col4 << MI_SIZE_LOG2);
+            filter_edge(is16bit ? (void *)((uint16_t *)plane_buf + offset) :
+                (void *)((uint8_t *)plane_buf + offset), stride, is16bit,
+                color_config->bit_depth, dir, filter_length,
+                &lf_ctxt->lf_info.lfthr[curr_lvl ? curr_lvl : prev_lvl]);
+        }
+    }
+}
+
+void dec_lf_sb_row(EbDecHandle *dec_handle_ptr, DecLFCtxt *lf_ctxt,
+                   int32_t sb_row)
+{
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    struct LoopFilter *lf = &dec_handle_ptr->frame_header.loop_filter_params;
+    int32_t sb_size_log2 = dec_handle_ptr->seq_header.sb_size_log2;
+
+    set_sb_row_params(dec_handle_ptr, lf_ctxt, sb_row);
+
+    for (int32_t plane = 0; plane < av1_num_planes(color_config); plane++) {
+        if (plane == 1 && !lf->filter_level_u)
+            continue;
+        if (plane == 2 && !lf->filter_level_v)
+            continue;
+        int32_t sub_y = plane ? color_config->subsampling_y : 0;
+        int32_t row4_start = (sb_row << sb_size_log2) >> (MI_SIZE_LOG2 + sub_y);
+        int32_t row4_end = ((sb_row + 1) << sb_size_log2) >> (MI_SIZE_LOG2 + sub_y);
+
+        for (int32_t dir = 0; dir < 2; dir++)
+            filter_plane_edges(dec_handle_ptr, lf_ctxt, plane, dir, row4_start, row4_end);
+    }
+}
@@ -0,0 +1,48 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecLF_h
+#define EbDecLF_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Deblocking parameters of a 4x4 of a plane, gathered from the mode and
+   transform info of the block covering it */
+typedef struct LFBlkParams {
+    /*!< Transform size of the TU covering the 4x4 */
+    uint8_t     tx_size;
+    /*!< Prediction block size in the plane */
+    uint8_t     bsize;
+    /*!< 1 for skipped inter blocks, whose TU edges are not filtered */
+    uint8_t     skip;
+    /*!< Filter level for vertical and horizontal edges */
+    uint8_t     lvl[2];
+} LFBlkParams;
+
+typedef struct DecLFCtxt {
+    /*!< Thresholds per level and level per segment, ref and mode */
+    LoopFilterInfoN lf_info;
+
+    /*!< Per 4x4 params for the whole frame, filled one SB row at a time */
+    LFBlkParams     *blk_params[MAX_MB_PLANE];
+    int32_t         blk_params_stride[MAX_MB_PLANE];
+} DecLFCtxt;
+
+/* Sets up the thresholds and level table of the frame */
+void dec_lf_frame_init(EbDecHandle *dec_handle_ptr, DecLFCtxt *lf_ctxt);
+
+/* Deblocks all the planes of an SB row: vertical edges first, then
+   horizontal edges. Needs the SB row below to be reconstructed and
+   the SB row above to be deblocked */
+void dec_lf_sb_row(EbDecHandle *dec_handle_ptr, DecLFCtxt *lf_ctxt,
+                   int32_t sb_row);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbDecLF_h
@@ -12,6 +12,7 @@
 #include <stdlib.h>
 
 #include "EbDefinitions.h"
+#include "EbThreads.h"
 #include "EbPictureBufferDesc.h"
 
 #include "EbSvtAv1Dec.h"
@@ -21,9 +22,11 @@
 #include "EbObuParse.h"
 
 #include "EbDecMemInit.h"
+#include "EbDecTileThreads.h"
 #include "EbDecInverseQuantize.h"
 
 #include "EbDecPicMgr.h"
+#include "EbDecPostFilter.h"
 
 /*TODO: Remove and harmonize with encoder. Globals prevent harmonization now! */
 /*****************************************
@@ -187,13 +190,28 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
         /* tile map allocation at SB level */
         EB_MALLOC_DEC(uint8_t*, cur_frame_buf->tile_map_sb,
             (num_sb * sizeof(uint8_t)), EB_N_PTR);
+
+        /* LR unit allocation for the smallest unit size of each plane */
+        for (int32_t plane = 0; plane < MAX_MB_PLANE; plane++) {
+            int32_t sub_x = plane ? seq_header->color_config.subsampling_x : 0;
+            int32_t sub_y = plane ? seq_header->color_config.subsampling_y : 0;
+            int32_t unit_size = (RESTORATION_TILESIZE_MAX >> 2) >> (plane ? 1 : 0);
+            int32_t unit_cols = (((seq_header->max_frame_width + sub_x) >> sub_x) +
+                unit_size - 1) / unit_size;
+            int32_t unit_rows = (((seq_header->max_frame_height + sub_y) >> sub_y) +
+                unit_size - 1) / unit_size;
+            EB_MALLOC_DEC(RestorationUnitInfo*, cur_frame_buf->lr_unit[plane],
+                (unit_rows * unit_cols * sizeof(RestorationUnitInfo)), EB_N_PTR);
+            cur_frame_buf->lr_unit_rows[plane] = 0;
+            cur_frame_buf->lr_unit_cols[plane] = 0;
+        }
     }
 #if FRAME_MI_MAP
     FrameMiMap *frame_mi_map = &master_frame_buf->frame_mi_map;
     frame_mi_map->sb_cols = sb_cols;
     frame_mi_map->sb_rows = sb_rows;
     frame_mi_map->mi_cols_algnsb = sb_cols * (1 << (sb_size_log2 - MI_SIZE_LOG2));
-    frame_mi_map->mi_rows_algnsb = sb_cols * (1 << (sb_size_log2 - MI_SIZE_LOG2));
+    frame_mi_map->mi_rows_algnsb = sb_rows * (1 << (sb_size_log2 - MI_SIZE_LOG2));
     /* SBInfo pointers for entire frame */
     EB_MALLOC_DEC(SBInfo**, frame_mi_map->pps_sb_info,
         sb_rows * sb_cols * sizeof(SBInfo *), EB_N_PTR);
@@ -239,12 +257,15 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
 }
 
 /*TODO: Move to module files */
-static EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr) {
+EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr,
+                                       ParseCtxt **parse_ctxt_ptr) {
     EbErrorType return_error = EB_ErrorNone;
 
-    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_parse_ctxt, sizeof(ParseCtxt), EB_N_PTR);
+    EB_MALLOC_DEC(ParseCtxt*, *parse_ctxt_ptr, sizeof(ParseCtxt), EB_N_PTR);
+
+    ParseCtxt *parse_ctx = *parse_ctxt_ptr;
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt;
+    parse_ctx->dec_handle_ptr = (void *)dec_handle_ptr;
 
     SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
 
@@ -288,13 +309,14 @@ static EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr) {
 }
 
 /*TODO: Move to module files */
-static EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr)
+EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr,
+                                     DecModCtxt **dec_mod_ctxt_ptr)
 {
     EbErrorType return_error = EB_ErrorNone;
 
-    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_dec_mod_ctxt, sizeof(DecModCtxt), EB_N_PTR);
+    EB_MALLOC_DEC(DecModCtxt*, *dec_mod_ctxt_ptr, sizeof(DecModCtxt), EB_N_PTR);
 
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
+    DecModCtxt *dec_mod_ctxt = *dec_mod_ctxt_ptr;
 
     dec_mod_ctxt->dec_handle_ptr = (void *)dec_handle_ptr;
 
@@ -302,7 +324,8 @@ static EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr)
     EB_MALLOC_DEC(int32_t*, dec_mod_ctxt->sb_iquant_ptr, (1 << sb_size_log2) *
                   (1 << sb_size_log2) * sizeof(int32_t), EB_N_PTR);
 
-    av1_inverse_qm_init(dec_handle_ptr);
+    av1_inverse_qm_init(dec_mod_ctxt, &dec_handle_ptr->seq_header);
+    dec_mod_ctxt->dequants_delta_q = &dec_mod_ctxt->dequants;
 
     return return_error;
 }
@@ -314,15 +337,25 @@ EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
         return EB_ErrorNone;
 
     /* init module ctxts */
-    return_error |= dec_pic_mgr_init((EbDecPicMgr **)&dec_handle_ptr->pv_pic_mgr);
+    return_error |= dec_pic_mgr_init((EbDecPicMgr **)&dec_handle_ptr->pv_pic_mgr,
+                                     &dec_handle_ptr->frame_buf_cbs);
 
-    return_error |= init_parse_context(dec_handle_ptr);
+    return_error |= init_parse_context(dec_handle_ptr,
+                                       (ParseCtxt **)&dec_handle_ptr->pv_parse_ctxt);
 
-    return_error |= init_dec_mod_ctxt(dec_handle_ptr);
+    return_error |= init_dec_mod_ctxt(dec_handle_ptr,
+                                      (DecModCtxt **)&dec_handle_ptr->pv_dec_mod_ctxt);
+
+    if (return_error != EB_ErrorNone)
+        return return_error;
+
+    return_error |= dec_tile_thrd_init(dec_handle_ptr);
 
     /* init frame buffers */
     return_error |= init_master_frame_ctxt(dec_handle_ptr);
 
+    return_error |= dec_post_filter_init(dec_handle_ptr);
+
     /* Initialize the references to NULL */
     for (int i = 0; i < REF_FRAMES; i++) {
         dec_handle_ptr->ref_frame_map[i] = NULL;
@@ -330,6 +363,7 @@ EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
         dec_handle_ptr->remapped_ref_idx[i] = INVALID_IDX;
     }
     dec_handle_ptr->cur_pic_buf[0] = NULL;
+    dec_handle_ptr->out_pic_buf = NULL;
 
     dec_handle_ptr->mem_init_done = 1;
 
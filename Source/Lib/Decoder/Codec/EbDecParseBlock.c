@@ -172,13 +172,12 @@ void palette_mode_info(/*EbDecHandle *dec_handle,
     assert(0);
 }
 
-void filter_intra_mode_info(EbDecHandle *dec_handle,
+void filter_intra_mode_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt,
     PartitionInfo_t *xd, SvtReader *r)
 {
     ModeInfo_t *const mbmi = xd->mi;
     FilterIntraModeInfo_t *filter_intra_mode_info =
         &mbmi->filter_intra_mode_info;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
 
     if (filter_intra_allowed(dec_handle, mbmi)) {
@@ -217,21 +216,36 @@ void read_cdef(EbDecHandle *dec_handle, SvtReader *r, PartitionInfo_t *xd,
     int mi_col, int mi_row, int8_t *cdef_strength)
 {
     ModeInfo_t *const mbmi = xd->mi;
-    if (mbmi->skip_mode || dec_handle->frame_header.coded_lossless ||
+    if (mbmi->skip || dec_handle->frame_header.coded_lossless ||
         !dec_handle->seq_header.enable_cdef || dec_handle->frame_header.allow_intrabc)
     {
         return;
     }
 
-    int cdf_size = block_size_wide[BLOCK_64X64] >> 2;
-    const int mask = ~(cdf_size - 1);
+    /* cdef_strength holds one entry per 64x64 of the SB, reset to -1
+       at the start of the SB */
+    const int cdef_size = mi_size_wide[BLOCK_64X64];
+    const int cdef_mask = cdef_size - 1;
     const int index = dec_handle->seq_header.sb_size == BLOCK_128X128
-        ? !!(mi_col & mask) + 2 * !!(mi_row & mask) : 0;
-    if (cdef_strength[index] == -1)
-        svt_read_literal(r, dec_handle->frame_header.CDEF_params.cdef_bits, ACCT_STR);
+        ? !!(mi_col & cdef_size) + 2 * !!(mi_row & cdef_size) : 0;
+    if (cdef_strength[index] == -1) {
+        cdef_strength[index] = (int8_t)svt_read_literal(r,
+            dec_handle->frame_header.CDEF_params.cdef_bits, ACCT_STR);
+
+        /* Blocks larger than 64x64 share the strength in all their 64x64s */
+        const int w4 = mi_size_wide[mbmi->sb_type];
+        const int h4 = mi_size_high[mbmi->sb_type];
+        for (int y = (mi_row & ~cdef_mask); y < mi_row + h4; y += cdef_size) {
+            for (int x = (mi_col & ~cdef_mask); x < mi_col + w4; x += cdef_size) {
+                const int idx = dec_handle->seq_header.sb_size == BLOCK_128X128
+                    ? !!(x & cdef_size) + 2 * !!(y & cdef_size) : 0;
+                cdef_strength[idx] = cdef_strength[index];
+            }
+        }
+    }
 }
 
-int read_delta_qindex(EbDecHandle *dec_handle, SvtReader *r,
+int read_delta_qindex(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, SvtReader *r,
     ModeInfo_t *const mbmi, int mi_col, int mi_row)
 {
     int sign, abs, reduced_delta_qindex = 0;
@@ -243,7 +257,6 @@ int read_delta_qindex(EbDecHandle *dec_handle, SvtReader *r,
     if ((bsize != dec_handle->seq_header.sb_size || mbmi->skip == 0) &&
         read_delta_q_flag)
     {
-        ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
         abs = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.delta_q_cdf,
             DELTA_Q_PROBS + 1, ACCT_STR);
 
@@ -286,10 +299,9 @@ int read_delta_lflevel(EbDecHandle *dec_handle, SvtReader *r,
     return reduced_delta_lflevel;
 }
 
-int read_skip(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+int read_skip(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *xd,
     int segment_id, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     uint8_t segIdPreSkip = dec_handle->frame_header.segmentation_params.seg_id_pre_skip;
     if (segIdPreSkip && seg_feature_active(&dec_handle->frame_header.segmentation_params,
         segment_id, SEG_LVL_SKIP))
@@ -304,7 +316,7 @@ int read_skip(EbDecHandle *dec_handle, PartitionInfo_t *xd,
     }
 }
 
-int read_skip_mode(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
+int read_skip_mode(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *xd, int segment_id,
     SvtReader *r)
 {
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
@@ -317,7 +329,6 @@ int read_skip_mode(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
     {
         return 0;
     }
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     int above_skip_mode = xd->above_mbmi ? xd->above_mbmi->skip_mode : 0;
     int left_skip_mode = xd->left_mbmi ? xd->left_mbmi->skip_mode : 0;
     int ctx = above_skip_mode + left_skip_mode;
@@ -326,10 +337,9 @@ int read_skip_mode(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
 
 // If delta q is present, reads delta_q index.
 // Also reads delta_q loop filter levels, if present.
-static void read_delta_params(EbDecHandle *dec_handle, SvtReader *r,
+static void read_delta_params(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, SvtReader *r,
     PartitionInfo_t *xd, const int mi_row, const int mi_col)
 {
-    ParseCtxt       *parse_ctxt     = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     DeltaQParams    *delta_q_params = &dec_handle->frame_header.delta_q_params;
     DeltaLFParams   *delta_lf_params = &dec_handle->frame_header.delta_lf_params;
     SBInfo          *sb_info = xd->sb_info;
@@ -341,7 +351,7 @@ static void read_delta_params(EbDecHandle *dec_handle, SvtReader *r,
 
         assert(0);
         //delta_q_res should be left shifted instead of being multiplied - check logic
-        int delta_q = read_delta_qindex(dec_handle, r, mbmi, mi_col, mi_row);
+        int delta_q = read_delta_qindex(dec_handle, parse_ctxt, r, mbmi, mi_col, mi_row);
         sb_info->sb_delta_q[0] = delta_q * delta_q_params->delta_q_res;
         current_qindex = base_qindex + sb_info->sb_delta_q[0];
         /* Normative: Clamp to [1,MAXQ] to not interfere with lossless mode */
@@ -423,11 +433,10 @@ int get_segment_id(FrameHeader *frm_info, uint8_t *segment_ids,
     return segment_id;
 }
 
-static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_t mi_row,
+static int read_segment_id(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *xd, uint32_t mi_row,
     uint32_t mi_col, SvtReader *r, int skip)
 {
     int cdf_num = 0;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     int prev_ul = -1;  // top left segment_id
     int prev_l = -1;   // left segment_id
@@ -472,7 +481,7 @@ static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_
     return neg_deinterleave(coded_id, pred, seg->last_active_seg_id + 1);
 }
 
-int intra_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_row, int mi_col,
+int intra_segment_id(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *xd, int mi_row, int mi_col,
     int bsize, SvtReader *r, int skip)
 {
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
@@ -484,8 +493,8 @@ int intra_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_row, i
         const int bh = mi_size_high[bsize];
         const int x_mis = AOMMIN((int32_t)(dec_handle->frame_header.mi_cols - mi_col), bw);
         const int y_mis = AOMMIN((int32_t)(dec_handle->frame_header.mi_rows - mi_row), bh);
-        segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, skip);
-        set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
+        segment_id = read_segment_id(dec_handle, parse_ctx, xd, mi_row, mi_col, r, skip);
+        set_segment_id(dec_handle, parse_ctx, mi_offset, x_mis, y_mis, segment_id);
     }
     return segment_id;
 }
@@ -515,10 +524,9 @@ PredictionMode getMode(PredictionMode yMode, int refList) {
     return compMode;
 }
 
-void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_row,
+void intra_frame_mode_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *xd, int mi_row,
     int mi_col, SvtReader *r, int8_t *cdef_strength)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     ModeInfo_t *const mbmi = xd->mi;
     const ModeInfo_t *above_mi = xd->above_mbmi;
     const ModeInfo_t *left_mi = xd->left_mbmi;
@@ -533,19 +541,19 @@ void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_
 
     if (seg->seg_id_pre_skip) {
         mbmi->segment_id =
-            intra_segment_id(dec_handle, xd, mi_row, mi_col, bsize, r, 0);
+            intra_segment_id(dec_handle, parse_ctxt, xd, mi_row, mi_col, bsize, r, 0);
     }
 
-    mbmi->skip = read_skip(dec_handle, xd, mbmi->segment_id, r);
+    mbmi->skip = read_skip(dec_handle, parse_ctxt, xd, mbmi->segment_id, r);
 
     if (!seg->seg_id_pre_skip) {
         mbmi->segment_id =
-            intra_segment_id(dec_handle, xd, mi_row, mi_col, bsize, r, mbmi->skip);
+            intra_segment_id(dec_handle, parse_ctxt, xd, mi_row, mi_col, bsize, r, mbmi->skip);
     }
 
     read_cdef(dec_handle, r, xd, mi_col, mi_row, cdef_strength);
 
-    read_delta_params(dec_handle, r, xd, mi_row, mi_col);
+    read_delta_params(dec_handle, parse_ctxt, r, xd, mi_row, mi_col);
 
     mbmi->ref_frame[0] = INTRA_FRAME;
     mbmi->ref_frame[1] = NONE_FRAME;
@@ -562,7 +570,7 @@ void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_
         mbmi->compound_mode = COMPOUND_AVERAGE;
         dec_handle->frame_header.interpolation_filter = BILINEAR;
         IntMv_dec global_mvs[2];
-        av1_find_mv_refs(dec_handle, xd, ref_frame, xd->ref_mv_stack,
+        av1_find_mv_refs(dec_handle, parse_ctxt, xd, ref_frame, xd->ref_mv_stack,
             ref_mvs, global_mvs, mi_row, mi_col,
             inter_mode_ctx, mv_cnt);
         assert(0);
@@ -591,7 +599,7 @@ void intra_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_
 
         if (allow_palette(dec_handle->frame_header.allow_screen_content_tools, bsize))
             palette_mode_info(/*dec_handle, mi_row, mi_col, r*/);
-        filter_intra_mode_info(dec_handle, xd, r);
+        filter_intra_mode_info(dec_handle, parse_ctxt, xd, r);
     }
     free(mv_cnt);
 }
@@ -615,13 +623,12 @@ void update_seg_ctx(ParseNbr4x4Ctxt *ngr_ctx, int blk_col,
     memset(left_seg_ctx, seg_id_predicted, h4);
 }
 
-int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+int read_inter_segment_id(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *xd,
                         uint32_t mi_row, uint32_t mi_col, int preskip, SvtReader *r)
 {
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
     ModeInfo_t *const mbmi = xd->mi;
     FrameHeader *frame_header = &dec_handle->frame_header;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const int mi_offset = mi_row * frame_header->mi_cols + mi_col;
     const uint32_t bw = mi_size_wide[mbmi->sb_type];
     const uint32_t bh = mi_size_high[mbmi->sb_type];
@@ -647,27 +654,26 @@ int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
             mbmi->seg_id_predicted = 0;
             update_seg_ctx(&parse_ctxt->parse_nbr4x4_ctxt,
                 mi_col, bw, bh, mbmi->seg_id_predicted);
-            segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 1);
-            set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
+            segment_id = read_segment_id(dec_handle, parse_ctxt, xd, mi_row, mi_col, r, 1);
+            set_segment_id(dec_handle, parse_ctxt, mi_offset, x_mis, y_mis, segment_id);
             return segment_id;
         }
     }
 
     if (seg->segmentation_temporal_update) {
         const int ctx = get_pred_context_seg_id(xd);
-        ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
         struct segmentation_probs *const segp = &parse_ctxt->cur_tile_ctx.seg;
         mbmi->seg_id_predicted = svt_read_symbol(r, segp->pred_cdf[ctx], 2, ACCT_STR);
         if (mbmi->seg_id_predicted)
             segment_id = predictedSegmentId;
         else
-            segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 0);
+            segment_id = read_segment_id(dec_handle, parse_ctxt, xd, mi_row, mi_col, r, 0);
         update_seg_ctx(&parse_ctxt->parse_nbr4x4_ctxt,
             mi_col, bw, bh, mbmi->seg_id_predicted);
     }
     else
-        segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 0);
-    set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
+        segment_id = read_segment_id(dec_handle, parse_ctxt, xd, mi_row, mi_col, r, 0);
+    set_segment_id(dec_handle, parse_ctxt, mi_offset, x_mis, y_mis, segment_id);
 
     return segment_id;
 }
@@ -845,10 +851,9 @@ void svt_setup_motion_field(EbDecHandle *dec_handle) {
     if (ref_stamp >= 0) motion_field_projection(dec_handle, LAST2_FRAME, 2);
 }
 
-void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
+void intra_block_mode_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, int mi_row,
     int mi_col, PartitionInfo_t* xd, ModeInfo_t *mbmi, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const BlockSize bsize = mbmi->sb_type;
     mbmi->ref_frame[0] = INTRA_FRAME;
     mbmi->ref_frame[1] = NONE_FRAME;
@@ -881,13 +886,12 @@ void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
     if (allow_palette(dec_handle->frame_header.allow_screen_content_tools, bsize))
         palette_mode_info(/*dec_handle, mi_row, mi_col, r*/);
 
-    filter_intra_mode_info(dec_handle, xd, r);
+    filter_intra_mode_info(dec_handle, parse_ctxt, xd, r);
 }
 
-int read_is_inter(EbDecHandle* dec_handle, PartitionInfo_t * xd,
+int read_is_inter(EbDecHandle* dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t * xd,
     int segment_id, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     int is_inter = 0;
     SegmentationParams *seg_params = &dec_handle->frame_header.segmentation_params;
     if (seg_feature_active(seg_params, segment_id, SEG_LVL_REF_FRAME))
@@ -902,7 +906,7 @@ int read_is_inter(EbDecHandle* dec_handle, PartitionInfo_t * xd,
     return is_inter;
 }
 
-void inter_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t * pi,
+void inter_frame_mode_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t * pi,
     uint32_t mi_row, uint32_t mi_col, SvtReader *r, int8_t *cdef_strength)
 {
     ModeInfo_t *mbmi = pi->mi;
@@ -912,34 +916,32 @@ void inter_frame_mode_info(EbDecHandle *dec_handle, PartitionInfo_t * pi,
     mbmi->mv[0].as_int = 0;
     mbmi->mv[1].as_int = 0;
 
-    mbmi->segment_id = read_inter_segment_id(dec_handle, pi, mi_row, mi_col, 1, r);
+    mbmi->segment_id = read_inter_segment_id(dec_handle, parse_ctx, pi, mi_row, mi_col, 1, r);
 
-    mbmi->skip_mode = read_skip_mode(dec_handle, pi, mbmi->segment_id, r);
+    mbmi->skip_mode = read_skip_mode(dec_handle, parse_ctx, pi, mbmi->segment_id, r);
 
     if (mbmi->skip_mode)
         mbmi->skip = 1;
     else
-        mbmi->skip = read_skip(dec_handle, pi, mbmi->segment_id, r);
+        mbmi->skip = read_skip(dec_handle, parse_ctx, pi, mbmi->segment_id, r);
 
     if (!dec_handle->frame_header.segmentation_params.seg_id_pre_skip)
-        mbmi->segment_id = read_inter_segment_id(dec_handle, pi, mi_row, mi_col, 0, r);
+        mbmi->segment_id = read_inter_segment_id(dec_handle, parse_ctx, pi, mi_row, mi_col, 0, r);
 
-    dec_handle->frame_header.coded_lossless = dec_handle->frame_header.
-        lossless_array[mbmi->segment_id];
     read_cdef(dec_handle, r, pi, mi_col, mi_row, cdef_strength);
 
-    read_delta_params(dec_handle, r, pi, mi_row, mi_col);
+    read_delta_params(dec_handle, parse_ctx, r, pi, mi_row, mi_col);
 
     if (!mbmi->skip_mode)
-        inter_block = read_is_inter(dec_handle, pi, mbmi->segment_id, r);
+        inter_block = read_is_inter(dec_handle, parse_ctx, pi, mbmi->segment_id, r);
 
     if (inter_block)
-        inter_block_mode_info(dec_handle, pi, mi_row, mi_col, r);
+        inter_block_mode_info(dec_handle, parse_ctx, pi, mi_row, mi_col, r);
     else
-        intra_block_mode_info(dec_handle, mi_row, mi_col, pi, mbmi, r);
+        intra_block_mode_info(dec_handle, parse_ctx, mi_row, mi_col, pi, mbmi, r);
 }
 
-void mode_info(EbDecHandle *decHandle, PartitionInfo_t *part_info, uint32_t mi_row,
+void mode_info(EbDecHandle *decHandle, ParseCtxt *parse_ctx, PartitionInfo_t *part_info, uint32_t mi_row,
     uint32_t mi_col, SvtReader *r, int8_t *cdef_strength)
 {
     ModeInfo_t *mi = part_info->mi;
@@ -948,13 +950,13 @@ void mode_info(EbDecHandle *decHandle, PartitionInfo_t *part_info, uint32_t mi_r
     if (decHandle->frame_header.frame_type == KEY_FRAME
         || decHandle->frame_header.frame_type == INTRA_ONLY_FRAME)
     {
-        intra_frame_mode_info(decHandle, part_info, mi_row, mi_col, r, cdef_strength);
+        intra_frame_mode_info(decHandle, parse_ctx, part_info, mi_row, mi_col, r, cdef_strength);
     }
     else
-        inter_frame_mode_info(decHandle, part_info, mi_row, mi_col, r, cdef_strength);
+        inter_frame_mode_info(decHandle, parse_ctx, part_info, mi_row, mi_col, r, cdef_strength);
 }
 
-TxSize read_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+TxSize read_tx_size(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *xd,
                     int allow_select, SvtReader *r)
 {
     ModeInfo_t *mbmi = xd->mi;
@@ -963,7 +965,7 @@ TxSize read_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *xd,
     if (dec_handle->frame_header.lossless_array[mbmi->segment_id]) return TX_4X4;
 
     if (bsize > BLOCK_4X4 && allow_select && tx_mode == TX_MODE_SELECT) {
-        const TxSize coded_tx_size = read_selected_tx_size(xd, r, dec_handle);
+        const TxSize coded_tx_size = read_selected_tx_size(xd, r, parse_ctx);
         return coded_tx_size;
     }
     assert(IMPLIES(tx_mode == ONLY_4X4, bsize == BLOCK_4X4));
@@ -982,10 +984,9 @@ static INLINE TxSize av1_get_max_uv_txsize(BlockSize bsize, int subsampling_x,
 }
 
 /* Update Chroma Transform Info for Inter Case! */
-void update_chroma_trans_info(EbDecHandle *dec_handle,
+void update_chroma_trans_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctx,
     PartitionInfo_t *part_info, BlockSize bsize)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     ModeInfo_t *mbmi = part_info->mi;
     SBInfo     *sb_info = part_info->sb_info;
     EbColorConfig color_config = dec_handle->seq_header.color_config;
@@ -1086,11 +1087,10 @@ int get_txfm_split_ctx(PartitionInfo_t *pi, ParseCtxt *parse_ctx,
              (TX_SIZES - 1 - max_tx_size) * 6 + above + left);
 }
 
-void read_var_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
+void read_var_tx_size(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi, SvtReader *r,
     TxSize tx_size, int blk_row, int blk_col, int depth, int *num_luma_tus) {
 
     ModeInfo_t *mbmi = pi->mi;
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     const BlockSize bsize = mbmi->sb_type;
     const int max_blocks_high = max_block_high(pi, bsize, 0);
     const int max_blocks_wide = max_block_wide(pi, bsize, 0);
@@ -1115,7 +1115,7 @@ void read_var_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r
 
         for (i = 0; i < h4; i += step_h)
             for (j = 0; j < w4; j += step_w)
-                read_var_tx_size(dec_handle, pi, r, sub_tx_sz, blk_row + i,
+                read_var_tx_size(dec_handle, parse_ctx, pi, r, sub_tx_sz, blk_row + i,
                                  blk_col + j, depth + 1, num_luma_tus);
     }
     else {
@@ -1130,10 +1130,9 @@ void read_var_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r
 }
 
 /* Update Flat Transform Info for Intra Case! */
-void update_flat_trans_info(EbDecHandle *dec_handle, PartitionInfo_t *part_info,
+void update_flat_trans_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *part_info,
                             BlockSize bsize, TxSize tx_size)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     ModeInfo_t *mbmi = part_info->mi;
     SBInfo     *sb_info = part_info->sb_info;
     EbColorConfig color_config = dec_handle->seq_header.color_config;
@@ -1254,11 +1253,10 @@ static INLINE void set_txfm_ctxs(ParseCtxt *parse_ctx, TxSize tx_size,
     memset(left_ctx, tx_high, n4_h);
 }
 
-void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r,
+void read_block_tx_size(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, SvtReader *r,
     PartitionInfo_t *part_info, BlockSize bsize)
 {
     ModeInfo_t *mbmi = part_info->mi;
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     SBInfo     *sb_info = part_info->sb_info;
     int inter_block_tx = dec_is_inter_block(mbmi);
 
@@ -1283,19 +1281,19 @@ void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r,
             for (int idx = 0; idx < width; idx += bw)
             {
                 num_luma_tus = 0;
-                read_var_tx_size(dec_handle, part_info, r, max_tx_size, idy, idx, 0, &num_luma_tus);
+                read_var_tx_size(dec_handle, parse_ctx, part_info, r, max_tx_size, idy, idx, 0, &num_luma_tus);
                 parse_ctx->num_tus[AOM_PLANE_Y][force_split_cnt] = num_luma_tus;
                 force_split_cnt++;
             }
 
         // Chroma trans_info update
-        update_chroma_trans_info(dec_handle, part_info, bsize);
+        update_chroma_trans_info(dec_handle, parse_ctx, part_info, bsize);
 
         mbmi->num_luma_tus = parse_ctx->cur_blk_luma_count;
         parse_ctx->first_luma_tu_offset += parse_ctx->cur_blk_luma_count;
     }
     else {
-        TxSize tx_size = read_tx_size(dec_handle, part_info,
+        TxSize tx_size = read_tx_size(dec_handle, parse_ctx, part_info,
             !mbmi->skip || !inter_block_tx, r);
 
         int b4_w = mi_size_wide[mbmi->sb_type];
@@ -1305,7 +1303,7 @@ void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r,
             mbmi->skip && dec_is_inter_block(mbmi), part_info);
 
         /* Update Flat Transform Info */
-        update_flat_trans_info(dec_handle, part_info, bsize, tx_size);
+        update_flat_trans_info(dec_handle, parse_ctx, part_info, bsize, tx_size);
     }
 }
 
@@ -1320,7 +1318,7 @@ TxSetType get_tx_set(TxSize tx_size, int is_inter, int use_reduced_set) {
     return get_ext_tx_set_type(tx_size, is_inter, use_reduced_set);
 }
 
-void parse_transform_type(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+void parse_transform_type(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *xd,
      TxSize tx_size, SvtReader *r, TransformInfo_t *trans_info)
 {
     ModeInfo_t *mbmi = xd->mi;
@@ -1328,7 +1326,6 @@ void parse_transform_type(EbDecHandle *dec_handle, PartitionInfo_t *xd,
     TxType *tx_type = &trans_info->txk_type;
     *tx_type = DCT_DCT;
 
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
 
     // No need to read transform type if block is skipped.
@@ -1414,11 +1411,10 @@ static AOM_FORCE_INLINE int get_br_ctx_eob(const int c,  // raster order
     return 14;
 }
 
-void update_coeff_ctx(EbDecHandle *dec_handle, int plane, PartitionInfo_t *pi,
+void update_coeff_ctx(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, int plane, PartitionInfo_t *pi,
     TxSize tx_size, uint32_t blk_row, uint32_t blk_col, int above_off,
     int left_off, int cul_level, int dc_val)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     ParseNbr4x4Ctxt *ngr_ctx = &parse_ctxt->parse_nbr4x4_ctxt;
 
     uint8_t suby = plane ? dec_handle->seq_header.color_config.subsampling_y : 0;
@@ -1617,7 +1613,7 @@ static INLINE void read_coeffs_reverse(SvtReader *r, TxSize tx_size,
     }
 }
 
-uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r,
+uint16_t parse_coeffs(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *xd, SvtReader *r,
     uint32_t blk_row, uint32_t blk_col, int above_off, int left_off, int plane,
     int txb_skip_ctx, int dc_sign_ctx, TxSize tx_size, int32_t *coeff_buf,
     TransformInfo_t *trans_info)
@@ -1625,7 +1621,6 @@ uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r
     const int width = get_txb_wide(tx_size);
     const int height = get_txb_high(tx_size);
 
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
 
     TxSize txs_ctx = (TxSize)((txsize_sqr_map[tx_size] +
@@ -1649,14 +1644,14 @@ uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r
             trans_info->cbf      = 0;
         }
 
-        update_coeff_ctx(dec_handle, plane, xd, tx_size, blk_row, blk_col,
+        update_coeff_ctx(dec_handle, parse_ctxt, plane, xd, tx_size, blk_row, blk_col,
             above_off, left_off, cul_level, dc_val);
 
         return 0;
     }
 
     if (plane == AOM_PLANE_Y)
-        parse_transform_type(dec_handle, xd, tx_size, r, trans_info);
+        parse_transform_type(dec_handle, parse_ctxt, xd, tx_size, r, trans_info);
 
     uint8_t     *lossless_array = &dec_handle->frame_header.lossless_array[0];
     TransformInfo_t *trans_buf = (dec_is_inter_block(xd->mi) && plane) ?
@@ -1800,7 +1795,7 @@ uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r
 
     cul_level = AOMMIN(COEFF_CONTEXT_MASK, cul_level);
 
-    update_coeff_ctx(dec_handle, plane, xd, tx_size, blk_row, blk_col,
+    update_coeff_ctx(dec_handle, parse_ctxt, plane, xd, tx_size, blk_row, blk_col,
         above_off, left_off, cul_level, dc_val);
 
     trans_info->cbf = 1; assert(eob);
@@ -1869,9 +1864,8 @@ void partition_gather_vert_alike(AomCdfProb *out, AomCdfProb *in, BlockSize bsiz
 }
 
 PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader *reader,
-    BlockSize bsize, int has_rows, int has_cols, EbDecHandle *dec_handle)
+    BlockSize bsize, int has_rows, int has_cols, ParseCtxt *parse_ctxt)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     int partition_cdf_length = bsize <= BLOCK_8X8 ? PARTITION_TYPES :
         (bsize == BLOCK_128X128 ? EXT_PARTITION_TYPES - 2 : EXT_PARTITION_TYPES);
@@ -1907,12 +1901,11 @@ PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader
 }
 
 static INLINE void dec_get_txb_ctx(int plane_bsize, const TxSize tx_size,
-    const int plane, int blk_row, int blk_col, EbDecHandle *dec_handle,
+    const int plane, int blk_row, int blk_col, EbDecHandle *dec_handle, ParseCtxt *parse_ctx,
     TXB_CTX *const txb_ctx)
 {
 #define MAX_TX_SIZE_UNIT 16
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     ParseNbr4x4Ctxt *nbr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
     EbColorConfig *clr_cfg = &dec_handle->seq_header.color_config;
     int txb_w_unit = tx_size_wide_unit[tx_size];
@@ -2004,7 +1997,7 @@ static INLINE void dec_get_txb_ctx(int plane_bsize, const TxSize tx_size,
 #undef MAX_TX_SIZE_UNIT
 }
 
-uint16_t parse_transform_block(EbDecHandle *dec_handle,
+uint16_t parse_transform_block(EbDecHandle *dec_handle, ParseCtxt *parse_ctx,
     PartitionInfo_t *pi, SvtReader *r, int32_t *coeff,
     TransformInfo_t *trans_info, int plane, int blk_col,
     int blk_row, int mi_row, int mi_col,
@@ -2029,23 +2022,22 @@ uint16_t parse_transform_block(EbDecHandle *dec_handle,
         TXB_CTX txb_ctx;
         dec_get_txb_ctx(plane_bsize, tx_size, plane,
                     start_y, start_x,
-                    dec_handle, &txb_ctx);
+                    dec_handle, parse_ctx, &txb_ctx);
 
-        eob = parse_coeffs(dec_handle, pi, r, start_y, start_x, blk_col,
+        eob = parse_coeffs(dec_handle, parse_ctx, pi, r, start_y, start_x, blk_col,
             blk_row, plane, txb_ctx.txb_skip_ctx, txb_ctx.dc_sign_ctx,
             tx_size, coeff, trans_info);
     }
     else{
-        update_coeff_ctx(dec_handle, plane, pi, tx_size,
+        update_coeff_ctx(dec_handle, parse_ctx, plane, pi, tx_size,
             start_y, start_x, blk_col, blk_row, 0, 0);
     }
     return eob;
 }
 
-void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
+void parse_residual(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi, SvtReader *r,
                     int mi_row, int mi_col, BlockSize mi_size)
 {
-    ParseCtxt   *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     EbColorConfig *color_info = &dec_handle->seq_header.color_config;
     SBInfo *sb_info = pi->sb_info;
     int num_planes = color_info->mono_chrome ? 1 : MAX_MB_PLANE;
@@ -2123,7 +2115,7 @@ void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
                     cur_coeff[1] = cur_loc;
                     }
 #endif
-                    int32_t eob = parse_transform_block(dec_handle, pi, r, coeff,
+                    int32_t eob = parse_transform_block(dec_handle, parse_ctx, pi, r, coeff,
                         trans_info[plane], plane,
                         trans_info[plane]->tu_x_offset, trans_info[plane]->tu_y_offset,
                         mi_row, mi_col, trans_info[plane]->tx_size, skip);
@@ -2144,11 +2136,10 @@ void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
     }
 }
 
-void parse_block(EbDecHandle *dec_handle, uint32_t mi_row, uint32_t mi_col,
+void parse_block(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, uint32_t mi_row, uint32_t mi_col,
     SvtReader *r, BlockSize subsize, TileInfo *tile, SBInfo *sb_info,
     PartitionType partition)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
 
     ModeInfo_t *mode = parse_ctx->cur_mode_info;
 
@@ -2228,7 +2219,7 @@ void parse_block(EbDecHandle *dec_handle, uint32_t mi_row, uint32_t mi_col,
     else
         part_info.left_mbmi = NULL;
     mode->sb_type = subsize;
-    mode_info(dec_handle, &part_info, mi_row, mi_col, r, cdef_strength);
+    mode_info(dec_handle, parse_ctx, &part_info, mi_row, mi_col, r, cdef_strength);
 
     /* Replicating same chroma mode for block pairs or 4x4 blks
        when chroma is present in last block*/
@@ -2269,12 +2260,12 @@ void parse_block(EbDecHandle *dec_handle, uint32_t mi_row, uint32_t mi_col,
         }
     }
 
-    read_block_tx_size(dec_handle, r, &part_info, subsize);
+    read_block_tx_size(dec_handle, parse_ctx, r, &part_info, subsize);
 
-    parse_residual(dec_handle, &part_info, r, mi_row, mi_col, subsize);
+    parse_residual(dec_handle, parse_ctx, &part_info, r, mi_row, mi_col, subsize);
 
     /* Update block level MI map */
-    update_block_nbrs(dec_handle, mi_row, mi_col, subsize);
+    update_block_nbrs(dec_handle, parse_ctx, mi_row, mi_col, subsize);
     parse_ctx->cur_mode_info_cnt++;
     parse_ctx->cur_mode_info++;
 }
@@ -2330,10 +2321,9 @@ static INLINE void update_ext_partition_context(ParseCtxt *parse_ctx, int mi_row
     }
 }
 
-void parse_partition(EbDecHandle *dec_handle, uint32_t blk_row,
+void parse_partition(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, uint32_t blk_row,
     uint32_t blk_col, SvtReader *reader, BlockSize bsize, SBInfo *sb_info)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
 
     if (blk_row >= dec_handle->frame_header.mi_rows ||
         blk_col >= dec_handle->frame_header.mi_cols)
@@ -2350,16 +2340,16 @@ void parse_partition(EbDecHandle *dec_handle, uint32_t blk_row,
 
     partition = (bsize < BLOCK_8X8) ? PARTITION_NONE
         : parse_partition_type(blk_row, blk_col, reader, bsize,
-            has_rows, has_cols, dec_handle);
+            has_rows, has_cols, parse_ctx);
     int subSize = Partition_Subsize[(int)partition][bsize];
     int splitSize = Partition_Subsize[PARTITION_SPLIT][bsize];
 
 #define PARSE_BLOCK(db_r, db_c, db_subsize)                 \
-parse_block(dec_handle, db_r, db_c, reader, db_subsize,     \
+parse_block(dec_handle, parse_ctx, db_r, db_c, reader, db_subsize,     \
     &parse_ctx->cur_tile_info, sb_info, partition);
 
 #define PARSE_PARTITION(db_r, db_c, db_subsize)                 \
-  parse_partition(dec_handle, (db_r), (db_c), reader,           \
+  parse_partition(dec_handle, parse_ctx, (db_r), (db_c), reader,           \
                    (db_subsize), sb_info)
 
     switch ((int)partition) {
@@ -2418,14 +2408,13 @@ parse_block(dec_handle, db_r, db_c, reader, db_subsize,     \
         subSize, bsize, partition);
 }
 
-void parse_super_block(EbDecHandle *dec_handle,
+void parse_super_block(EbDecHandle *dec_handle, ParseCtxt *parse_ctx,
     uint32_t blk_row, uint32_t blk_col, SBInfo *sbInfo)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     SvtReader *reader = &parse_ctx->r;
 #if ENABLE_ENTROPY_TRACE
     enable_dump = 1;
 #endif
-    parse_partition(dec_handle, blk_row, blk_col, reader,
+    parse_partition(dec_handle, parse_ctx, blk_row, blk_col, reader,
         dec_handle->seq_header.sb_size, sbInfo);
 }
@@ -49,12 +49,11 @@ int neg_deinterleave(const int diff, int ref, int max) {
     }
 }
 
-void set_segment_id(EbDecHandle *dec_handle, int mi_offset,
+void set_segment_id(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, int mi_offset,
     int x_mis, int y_mis, int segment_id)
 {
     assert(segment_id >= 0 && segment_id < MAX_SEGMENTS);
     FrameHeader *frm_header = &dec_handle->frame_header;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     for (int y = 0; y < y_mis; y++)
         for (int x = 0; x < x_mis; x++)
@@ -147,9 +146,8 @@ void update_tx_context(ParseCtxt *parse_ctxt, PartitionInfo_t *pi,
 }
 
 TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r,
-    EbDecHandle *dec_handle)
+    ParseCtxt *parse_ctxt)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const BlockSize bsize = xd->mi->sb_type;
     const int32_t tx_size_cat = bsize_to_tx_size_cat(bsize);
     const int maxTxDepth = bsize_to_max_depth(bsize);
@@ -21,13 +21,13 @@ typedef struct MvCount{
 }MvCount;
 
 int neg_deinterleave(const int diff, int ref, int max);
-void set_segment_id(EbDecHandle *dec_handle, int mi_offset,
-    int x_mis, int y_mis, int segment_id);
+void set_segment_id(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt,
+    int mi_offset, int x_mis, int y_mis, int segment_id);
 int bsize_to_max_depth(BlockSize bsize);
 int get_tx_size_context(const PartitionInfo_t *xd, ParseCtxt *parse_ctx);
 TxSize depth_to_tx_size(int depth, BlockSize bsize);
 TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r,
-    EbDecHandle *dec_handle);
+    ParseCtxt *parse_ctxt);
 int dec_is_inter_block(const ModeInfo_t *mbmi);
 int is_intrabc_block(const ModeInfo_t *mbmi);
 int max_block_wide(PartitionInfo_t *part_info, int plane_bsize, int subx);
@@ -74,6 +74,6 @@ void update_tx_context(ParseCtxt *parse_ctxt, PartitionInfo_t *pi,
 int seg_feature_active(SegmentationParams *seg, int segment_id,
     SEG_LVL_FEATURES feature_id);
 
-int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
-    int mi_row, int mi_col, int *pts, int *pts_inref);
+int find_warp_samples(EbDecHandle *dec_handle, TileInfo *tile,
+    PartitionInfo_t *pi, int mi_row, int mi_col, int *pts, int *pts_inref);
 #endif  // EbDecParseHelper_h
@@ -244,12 +244,11 @@ static int32_t get_pred_context_last3_or_gld(PartitionInfo_t *pi) {
     return pred_context;
 }
 
-static void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const pi,
+static void read_ref_frames(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *const pi,
     SvtReader *r)
 {
     int segment_id = pi->mi->segment_id;
     MvReferenceFrame *ref_frame = pi->mi->ref_frame;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     AomCdfProb *cdf;
     SegmentationParams *seg_params = &dec_handle->frame_header.segmentation_params;
     if (pi->mi->skip_mode) {
@@ -490,14 +489,13 @@ static void add_ref_mv_candidate(EbDecHandle *dec_handle,
     }
 }
 
-static void scan_row_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void scan_row_mbmi(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int delta_row, int mi_row, int mi_col, const MvReferenceFrame rf[2],
     CandidateMv_dec *ref_mv_stack, uint8_t *num_mv_found, uint8_t *found_match,
     uint8_t *newmv_count, IntMv_dec *gm_mv_candidates, int max_row_offset,
     int *processed_rows)
 {
     int bw4 = mi_size_wide[pi->mi->sb_type];
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frm_header = &dec_handle->frame_header;
     int end4 = AOMMIN(AOMMIN(bw4, (int)frm_header->mi_cols - mi_col), 16);
     int delta_col = 0;
@@ -539,14 +537,13 @@ static void scan_row_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     }
 }
 
-static void scan_col_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void scan_col_mbmi(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int delta_col, int mi_row, int mi_col, const MvReferenceFrame rf[2],
     CandidateMv_dec *ref_mv_stack, uint8_t *num_mv_found, uint8_t *found_match,
     uint8_t *newmv_count, IntMv_dec *gm_mv_candidates, int max_col_offset,
     int *processed_cols)
 {
     int bh4 = mi_size_high[pi->mi->sb_type];
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frm_header = &dec_handle->frame_header;
     int end4 = AOMMIN(AOMMIN(bh4, (int)frm_header->mi_rows - mi_row), 16);
     int delta_row = 0;
@@ -588,13 +585,12 @@ static void scan_col_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     }
 }
 
-static void scan_blk_mbmi(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void scan_blk_mbmi(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int delta_row, int delta_col, const int mi_row, const int mi_col,
     const MvReferenceFrame rf[2], CandidateMv_dec *ref_mv_stack,
     uint8_t *found_match, uint8_t *newmv_count, IntMv_dec *gm_mv_candidates,
     uint8_t num_mv_found[MODE_CTX_REF_FRAMES])
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
 
     int mv_row = mi_row + delta_row;
     int mv_col = mi_col + delta_col;
@@ -687,13 +683,12 @@ static INLINE void lower_mv_precision(MV *mv, int allow_hp, int is_integer) {
     }
 }
 
-static int add_tpl_ref_mv(EbDecHandle *dec_handle, int mi_row, int mi_col,
+static int add_tpl_ref_mv(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, int mi_row, int mi_col,
     MvReferenceFrame ref_frame, int blk_row, int blk_col,
     IntMv_dec *gm_mv_candidates, uint8_t *num_mv_found,
     CandidateMv_dec ref_mv_stacks[][MAX_REF_MV_STACK_SIZE], int16_t *mode_context)
 {
     uint8_t idx;
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frm_header = &dec_handle->frame_header;
     int mv_row = (mi_row + blk_row) | 1;
     int mv_col = (mi_col + blk_col) | 1;
@@ -864,7 +859,7 @@ static INLINE void clamp_mv_ref(MV *mv, int bw, int bh, PartitionInfo_t *pi) {
 }
 
 static void dec_setup_ref_mv_list(
-    EbDecHandle *dec_handle, PartitionInfo_t *pi, MvReferenceFrame ref_frame,
+    EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi, MvReferenceFrame ref_frame,
     CandidateMv_dec ref_mv_stack[][MAX_REF_MV_STACK_SIZE],
     IntMv_dec mv_ref_list[][MAX_MV_REF_CANDIDATES], IntMv_dec *gm_mv_candidates,
     int mi_row, int mi_col, int16_t *mode_context, MvCount *mv_cnt)
@@ -874,7 +869,6 @@ static void dec_setup_ref_mv_list(
     const int bs = AOMMAX(n4_w, n4_h);
     MvReferenceFrame rf[2];
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     FrameHeader *frame_info = &dec_handle->frame_header;
     const TileInfo *const tile = &parse_ctx->cur_tile_info;
     int max_row_offset = 0, max_col_offset = 0;
@@ -910,20 +904,20 @@ static void dec_setup_ref_mv_list(
 
     // Scan the first above row mode info. row_offset = -1;
     if (abs(max_row_offset) >= 1) {
-        scan_row_mbmi(dec_handle, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
+        scan_row_mbmi(dec_handle, parse_ctx, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
             &mv_cnt->num_mv_found[ref_frame], &mv_cnt->found_above_match,
             &mv_cnt->newmv_count, gm_mv_candidates, max_row_offset, &processed_rows);
     }
 
     // Scan the first left column mode info. col_offset = -1;
     if (abs(max_col_offset) >= 1) {
-        scan_col_mbmi(dec_handle, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
+        scan_col_mbmi(dec_handle, parse_ctx, pi, -1, mi_row, mi_col, rf, ref_mv_stack[ref_frame],
             &mv_cnt->num_mv_found[ref_frame], &mv_cnt->found_left_match,
             &mv_cnt->newmv_count, gm_mv_candidates, max_col_offset, &processed_cols);
     }
 
     if (has_top_right(dec_handle, pi, mi_row, mi_col, bs)) {
-        scan_blk_mbmi(dec_handle, pi, -1, n4_w, mi_row, mi_col, rf,
+        scan_blk_mbmi(dec_handle, parse_ctx, pi, -1, n4_w, mi_row, mi_col, rf,
             ref_mv_stack[ref_frame], &mv_cnt->found_above_match, &mv_cnt->newmv_count,
             gm_mv_candidates, &mv_cnt->num_mv_found[ref_frame]);
     }
@@ -963,7 +957,7 @@ static void dec_setup_ref_mv_list(
         for (int blk_row = 0; blk_row < blk_row_end; blk_row += step_h) {
             for (int blk_col = 0; blk_col < blk_col_end; blk_col += step_w) {
 
-                int ret = add_tpl_ref_mv(dec_handle, mi_row, mi_col,
+                int ret = add_tpl_ref_mv(dec_handle, parse_ctx, mi_row, mi_col,
                     ref_frame, blk_row, blk_col, gm_mv_candidates,
                     &mv_cnt->num_mv_found[ref_frame], ref_mv_stack, mode_context);
                 if (blk_row == 0 && blk_col == 0) is_available = ret;
@@ -978,7 +972,7 @@ static void dec_setup_ref_mv_list(
                 const int blk_col = tpl_sample_pos[i][1];
 
                 if (check_sb_border(mi_row, mi_col, blk_row, blk_col)) {
-                    add_tpl_ref_mv(dec_handle, mi_row, mi_col, ref_frame, blk_row,
+                    add_tpl_ref_mv(dec_handle, parse_ctx, mi_row, mi_col, ref_frame, blk_row,
                         blk_col, gm_mv_candidates, &mv_cnt->num_mv_found[ref_frame],
                         ref_mv_stack, mode_context);
                 }
@@ -987,7 +981,7 @@ static void dec_setup_ref_mv_list(
     }
 
     // Scan the second outer area.
-    scan_blk_mbmi(dec_handle, pi, -1, -1, mi_row, mi_col, rf,
+    scan_blk_mbmi(dec_handle, parse_ctx, pi, -1, -1, mi_row, mi_col, rf,
         ref_mv_stack[ref_frame], &mv_cnt->found_above_match, &mv_cnt->newmv_count,
         gm_mv_candidates, &mv_cnt->num_mv_found[ref_frame]);
 
@@ -995,14 +989,14 @@ static void dec_setup_ref_mv_list(
         const int row_offset = -(idx << 1) + 1 + row_adj;
         const int col_offset = -(idx << 1) + 1 + col_adj;
         if (abs(row_offset) <= abs(max_row_offset) && abs(row_offset) > processed_rows) {
-            scan_row_mbmi(dec_handle, pi, row_offset, mi_row, mi_col, rf,
+            scan_row_mbmi(dec_handle, parse_ctx, pi, row_offset, mi_row, mi_col, rf,
                 ref_mv_stack[ref_frame], &mv_cnt->num_mv_found[ref_frame],
                 &mv_cnt->found_above_match, &mv_cnt->newmv_count,
                 gm_mv_candidates, max_row_offset, &processed_rows);
         }
 
         if (abs(col_offset) <= abs(max_col_offset) && abs(col_offset) > processed_cols) {
-            scan_col_mbmi(dec_handle, pi, col_offset, mi_row, mi_col, rf,
+            scan_col_mbmi(dec_handle, parse_ctx, pi, col_offset, mi_row, mi_col, rf,
                 ref_mv_stack[ref_frame], &mv_cnt->num_mv_found[ref_frame],
                 &mv_cnt->found_left_match, &mv_cnt->newmv_count,
                 gm_mv_candidates, max_col_offset, &processed_cols);
@@ -1227,7 +1221,7 @@ static INLINE int16_t svt_mode_context_analyzer(
     return comp_ctx;
 }
 
-void av1_find_mv_refs(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+void av1_find_mv_refs(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     MvReferenceFrame ref_frame, CandidateMv_dec ref_mv_stack[][MAX_REF_MV_STACK_SIZE],
     IntMv_dec mv_ref_list[][MAX_MV_REF_CANDIDATES], IntMv_dec global_mvs[2],
     int mi_row, int mi_col, int16_t *mode_context, MvCount *mv_cnt)
@@ -1250,14 +1244,13 @@ void av1_find_mv_refs(EbDecHandle *dec_handle, PartitionInfo_t *pi,
                 dec_handle->frame_header.allow_high_precision_mv, bsize,
                 mi_col, mi_row, dec_handle->frame_header.force_integer_mv).as_int : 0;
     }
-    dec_setup_ref_mv_list(dec_handle, pi, ref_frame, ref_mv_stack, mv_ref_list,
+    dec_setup_ref_mv_list(dec_handle, parse_ctx, pi, ref_frame, ref_mv_stack, mv_ref_list,
         global_mvs, mi_row, mi_col, mode_context, mv_cnt);
 }
 
-static PredictionMode read_inter_compound_mode(EbDecHandle *dec_handle,
+static PredictionMode read_inter_compound_mode(ParseCtxt *parse_ctxt,
     SvtReader *r, int16_t ctx)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const int mode =
         svt_read_symbol(r, parse_ctxt->cur_tile_ctx.inter_compound_mode_cdf[ctx],
             INTER_COMPOUND_MODES, ACCT_STR);
@@ -1287,10 +1280,9 @@ static INLINE uint8_t get_drl_ctx(const CandidateMv_dec *ref_mv_stack, int ref_i
     return 0;
 }
 
-static void read_drl_idx(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static void read_drl_idx(ParseCtxt *parse_ctxt, PartitionInfo_t *pi,
     ModeInfo_t *mbmi, SvtReader *r, int num_mv_found)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     uint8_t ref_frame_type = av1_ref_frame_type(mbmi->ref_frame);
     mbmi->ref_mv_idx = 0;
     if (mbmi->mode == NEWMV || mbmi->mode == NEW_NEWMV) {
@@ -1452,13 +1444,12 @@ static INLINE int is_mv_valid(MV *mv) {
         mv->col < MV_UPP;
 }
 
-static INLINE int assign_mv(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+static INLINE int assign_mv(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *pi,
     IntMv_dec mv[2], IntMv_dec *global_mvs, IntMv_dec ref_mv[2],
     IntMv_dec nearest_mv[2], IntMv_dec near_mv[2],
     int is_compound, int allow_hp, SvtReader *r)
 {
     ModeInfo_t *mbmi = pi->mi;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     if (dec_handle->frame_header.force_integer_mv)
         allow_hp = MV_SUBPEL_NONE;
@@ -1548,10 +1539,9 @@ static INLINE int is_interintra_wedge_used(BlockSize sb_type) {
     return wedge_params_lookup[sb_type].bits > 0;
 }
 
-void read_interintra_mode(EbDecHandle *dec_handle,
+void read_interintra_mode(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt,
     ModeInfo_t *mbmi, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
     BlockSize bsize = mbmi->sb_type;
     if (dec_handle->seq_header.enable_interintra_compound
@@ -1595,8 +1585,8 @@ static INLINE void add_samples(ModeInfo_t *mbmi, int *pts, int *pts_inref,
     pts_inref[1] = (y * 8) + mbmi->mv[0].as_mv.row;
 }
 
-int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
-    int mi_row, int mi_col, int *pts, int *pts_inref)
+int find_warp_samples(EbDecHandle *dec_handle, TileInfo *tile,
+    PartitionInfo_t *pi, int mi_row, int mi_col, int *pts, int *pts_inref)
 {
     ModeInfo_t *const mbmi0 = pi->mi;
     int ref_frame = mbmi0->ref_frame[0];
@@ -1604,8 +1594,6 @@ int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     int left_available = pi->left_available;
     int i, mi_step = 1, np = 0;
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
-    TileInfo *tile = &parse_ctx->cur_tile_info;
     int do_tl = 1;
     int do_tr = 1;
     int b4_w = mi_size_wide[pi->mi->sb_type];
@@ -1735,10 +1723,9 @@ int find_warp_samples(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     return np;
 }
 
-int has_overlappable_cand(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+int has_overlappable_cand(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, PartitionInfo_t *pi,
     int mi_row, int mi_col)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     const TileInfo *const tile = &parse_ctx->cur_tile_info;
     ModeInfo_t *mbmi = pi->mi;
     if (!is_motion_variation_allowed_bsize(mbmi->sb_type)) return 0;
@@ -1768,7 +1755,7 @@ int has_overlappable_cand(EbDecHandle *dec_handle, PartitionInfo_t *pi,
     return 0;
 }
 
-static INLINE MotionMode is_motion_mode_allowed(EbDecHandle *dec_handle, GlobalMotionParams *gm_params, PartitionInfo_t *pi, int mi_row,
+static INLINE MotionMode is_motion_mode_allowed(EbDecHandle *dec_handle, ParseCtxt *parse_ctx, GlobalMotionParams *gm_params, PartitionInfo_t *pi, int mi_row,
     int mi_col, int allow_warped_motion)
 {
     ModeInfo_t *mbmi = pi->mi;
@@ -1779,7 +1766,7 @@ static INLINE MotionMode is_motion_mode_allowed(EbDecHandle *dec_handle, GlobalM
     if ((block_size_wide[mbmi->sb_type] >= 8 && block_size_high[mbmi->sb_type] >= 8) &&
         (mbmi->mode >= NEARESTMV && mbmi->mode < MB_MODE_COUNT)
         && mbmi->ref_frame[1] != INTRA_FRAME && !has_second_ref(mbmi)) {
-        if (!has_overlappable_cand(dec_handle, pi, mi_row, mi_col))
+        if (!has_overlappable_cand(dec_handle, parse_ctx, pi, mi_row, mi_col))
             return SIMPLE_TRANSLATION;
         assert(!has_second_ref(mbmi));
 
@@ -1798,10 +1785,9 @@ static INLINE MotionMode is_motion_mode_allowed(EbDecHandle *dec_handle, GlobalM
     }
 }
 
-MotionMode read_motion_mode(EbDecHandle *dec_handle,
+MotionMode read_motion_mode(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt,
     PartitionInfo_t *pi, int mi_row, int mi_col, SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
     FrameHeader *frame_info = &dec_handle->frame_header;
     int allow_warped_motion = frame_info->allow_warped_motion;
@@ -1811,7 +1797,7 @@ MotionMode read_motion_mode(EbDecHandle *dec_handle,
     if (mbmi->skip_mode) return SIMPLE_TRANSLATION;
 
     const MotionMode last_motion_mode_allowed =
-        is_motion_mode_allowed(dec_handle,
+        is_motion_mode_allowed(dec_handle, parse_ctxt,
             dec_handle->cur_pic_buf[0]->global_motion, pi,
             mi_row, mi_col, allow_warped_motion);
     int motion_mode;
@@ -1928,13 +1914,12 @@ int get_comp_index_context(EbDecHandle *dec_handle, PartitionInfo_t *pi) {
     return above_ctx + left_ctx + 3 * offset;
 }
 
-void read_compound_type(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r)
+void read_compound_type(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t *pi, SvtReader *r)
 {
     ModeInfo_t *mbmi = pi->mi;
     BlockSize bsize = mbmi->sb_type;
     mbmi->inter_compound.comp_group_idx = 0;
     mbmi->inter_compound.compound_idx = 1;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     FRAME_CONTEXT *frm_ctx = &parse_ctxt->cur_tile_ctx;
 
     if (mbmi->skip_mode) mbmi->inter_compound.type = COMPOUND_AVERAGE;
@@ -2094,7 +2079,7 @@ int get_context_interp(PartitionInfo_t *pi, int dir) {
     return filter_type_ctx;
 }
 
-void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
+void inter_block_mode_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt, PartitionInfo_t* pi,
     int mi_row, int mi_col, SvtReader *r)
 {
     ModeInfo_t *mbmi = pi->mi;
@@ -2103,14 +2088,13 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
     int16_t inter_mode_ctx[MODE_CTX_REF_FRAMES];
     int pts[SAMPLES_ARRAY_SIZE], pts_inref[SAMPLES_ARRAY_SIZE];
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     MvCount mv_cnt;
 
     /* TO-DO initialize palette info */
 
     svt_collect_neighbors_ref_counts(pi);
 
-    read_ref_frames(dec_handle, pi, r);
+    read_ref_frames(dec_handle, parse_ctxt, pi, r);
    /* if ((pi->mi->ref_frame[0] >= BWDREF_FRAME && pi->mi->ref_frame[0] <= ALTREF_FRAME) ||
         (pi->mi->ref_frame[1] >= BWDREF_FRAME && pi->mi->ref_frame[1] <= ALTREF_FRAME)) {
         printf("ALTREF found - frame : %d\n", dec_handle->dec_cnt);
@@ -2120,7 +2104,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
 
     MvReferenceFrame ref_frame = av1_ref_frame_type(mbmi->ref_frame);
     IntMv_dec global_mvs[2];
-    av1_find_mv_refs(dec_handle, pi, ref_frame, pi->ref_mv_stack,
+    av1_find_mv_refs(dec_handle, parse_ctxt, pi, ref_frame, pi->ref_mv_stack,
         ref_mvs, global_mvs, mi_row, mi_col,
         inter_mode_ctx, &mv_cnt);
 
@@ -2148,7 +2132,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
             mbmi->mode = GLOBALMV;
         else {
             if (is_compound)
-                mbmi->mode = read_inter_compound_mode(dec_handle, r, mode_ctx);
+                mbmi->mode = read_inter_compound_mode(parse_ctxt, r, mode_ctx);
             else {
                 int new_mv = svt_read_symbol(r, parse_ctxt->cur_tile_ctx.
                     newmv_cdf[mode_ctx & NEWMV_CTX_MASK], 2, ACCT_STR);
@@ -2171,7 +2155,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
             }
             if (mbmi->mode == NEWMV || mbmi->mode == NEW_NEWMV ||
                 has_nearmv(mbmi->mode))
-                read_drl_idx(dec_handle, pi, mbmi, r, mv_cnt.num_mv_found[ref_frame]);
+                read_drl_idx(parse_ctxt, pi, mbmi, r, mv_cnt.num_mv_found[ref_frame]);
         }
     }
     mbmi->uv_mode = UV_DC_PRED;
@@ -2227,7 +2211,7 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
         }
     }
 
-    assign_mv(dec_handle, pi, mbmi->mv, global_mvs,
+    assign_mv(dec_handle, parse_ctxt, pi, mbmi->mv, global_mvs,
         ref_mv, nearestmv, nearmv, is_compound, allow_hp, r);
 
 #if EXTRA_DUMP
@@ -2236,13 +2220,14 @@ void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
         fflush(stdout);
     }
 #endif
-    read_interintra_mode(dec_handle, mbmi, r);
+    read_interintra_mode(dec_handle, parse_ctxt, mbmi, r);
 
-    pi->num_samples = find_warp_samples(dec_handle, pi, mi_row, mi_col, pts, pts_inref);
+    pi->num_samples = find_warp_samples(dec_handle, &parse_ctxt->cur_tile_info,
+        pi, mi_row, mi_col, pts, pts_inref);
 
-    mbmi->motion_mode = read_motion_mode(dec_handle, pi, mi_row, mi_col, r);
+    mbmi->motion_mode = read_motion_mode(dec_handle, parse_ctxt, pi, mi_row, mi_col, r);
 
-    read_compound_type(dec_handle, pi, r);
+    read_compound_type(dec_handle, parse_ctxt, pi, r);
 
     if (!av1_is_interp_needed(pi, dec_handle->cur_pic_buf[0]->global_motion)) {
         set_default_interp_filters(mbmi,
@@ -45,11 +45,11 @@ static const MV kZeroMv = { 0, 0 };
 extern  int8_t av1_ref_frame_type(const MvReferenceFrame *const rf);
 extern void av1_set_ref_frame(MvReferenceFrame *rf, int8_t ref_frame_type);
 
-void inter_block_mode_info(EbDecHandle *dec_handle, PartitionInfo_t* pi,
-    int mi_row, int mi_col, SvtReader *r);
+void inter_block_mode_info(EbDecHandle *dec_handle, ParseCtxt *parse_ctxt,
+    PartitionInfo_t* pi, int mi_row, int mi_col, SvtReader *r);
 
-void av1_find_mv_refs(EbDecHandle *dec_handle, PartitionInfo_t *pi,
-    MvReferenceFrame ref_frame, CandidateMv_dec ref_mv_stack[][MAX_REF_MV_STACK_SIZE],
+void av1_find_mv_refs(EbDecHandle *dec_handle, ParseCtxt *parse_ctx,
+    PartitionInfo_t *pi, MvReferenceFrame ref_frame, CandidateMv_dec ref_mv_stack[][MAX_REF_MV_STACK_SIZE],
     IntMv_dec mv_ref_list[][MAX_MV_REF_CANDIDATES], IntMv_dec global_mvs[2],
     int mi_row, int mi_col, int16_t *mode_context, MvCount *mv_cnt);
 
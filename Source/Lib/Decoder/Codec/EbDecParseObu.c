@@ -18,6 +18,7 @@
 
 #include "EbDefinitions.h"
 #include "EbUtility.h"
+#include "EbThreads.h"
 #include "EbEntropyCoding.h"
 
 #include"EbAv1Structs.h"
@@ -36,6 +37,8 @@
 
 #include "EbDecNbr.h"
 #include "EbDecUtils.h"
+#include "EbDecTileThreads.h"
+#include "EbDecPostFilter.h"
 
 
 #define CONFIG_MAX_DECODE_PROFILE 2
@@ -950,24 +953,45 @@ void read_segmentation_params(bitstrm_t *bs, SegmentationParams *seg_params, Fra
     }
 }
 
-void read_loop_filter_params(bitstrm_t *bs, FrameHeader *frame_info, int num_planes)
+static void set_default_lf_deltas(struct LoopFilter *lf)
+{
+    lf->ref_deltas[INTRA_FRAME] = 1;
+    lf->ref_deltas[LAST_FRAME] = 0;
+    lf->ref_deltas[LAST2_FRAME] = 0;
+    lf->ref_deltas[LAST3_FRAME] = 0;
+    lf->ref_deltas[BWDREF_FRAME] = 0;
+    lf->ref_deltas[GOLDEN_FRAME] = -1;
+    lf->ref_deltas[ALTREF_FRAME] = -1;
+    lf->ref_deltas[ALTREF2_FRAME] = -1;
+    lf->mode_deltas[0] = 0;
+    lf->mode_deltas[1] = 0;
+}
+
+void read_loop_filter_params(bitstrm_t *bs, EbDecHandle *dec_handle, int num_planes)
 {
     int i;
+    FrameHeader *frame_info = &dec_handle->frame_header;
+    frame_info->loop_filter_params.filter_level_u = 0;
+    frame_info->loop_filter_params.filter_level_v = 0;
     if (frame_info->coded_lossless || frame_info->allow_intrabc) {
         frame_info->loop_filter_params.filter_level[0] = 0;
         frame_info->loop_filter_params.filter_level[1] = 0;
-        frame_info->loop_filter_params.ref_deltas[INTRA_FRAME] = 1;
-        frame_info->loop_filter_params.ref_deltas[LAST_FRAME] = 0;
-        frame_info->loop_filter_params.ref_deltas[LAST2_FRAME] = 0;
-        frame_info->loop_filter_params.ref_deltas[LAST3_FRAME] = 0;
-        frame_info->loop_filter_params.ref_deltas[BWDREF_FRAME] = 0;
-        frame_info->loop_filter_params.ref_deltas[GOLDEN_FRAME] = -1;
-        frame_info->loop_filter_params.ref_deltas[ALTREF_FRAME] = -1;
-        frame_info->loop_filter_params.ref_deltas[ALTREF2_FRAME] = -1;
-        for (i = 0; i < 2; i++)
-            frame_info->loop_filter_params.mode_deltas[i] = 0;
+        set_default_lf_deltas(&frame_info->loop_filter_params);
         return;
     }
+
+    /* Deltas are inherited from the primary reference frame */
+    if (frame_info->primary_ref_frame == PRIMARY_REF_NONE)
+        set_default_lf_deltas(&frame_info->loop_filter_params);
+    else {
+        EbDecPicBuf *prev_buf = get_ref_frame_buf(dec_handle,
+            frame_info->primary_ref_frame + 1);
+        memcpy(frame_info->loop_filter_params.ref_deltas, prev_buf->lf_ref_deltas,
+            sizeof(prev_buf->lf_ref_deltas));
+        memcpy(frame_info->loop_filter_params.mode_deltas, prev_buf->lf_mode_deltas,
+            sizeof(prev_buf->lf_mode_deltas));
+    }
+
     frame_info->loop_filter_params.filter_level[0] = dec_get_bits(bs, 6);
     frame_info->loop_filter_params.filter_level[1] = dec_get_bits(bs, 6);
     PRINT_FRAME("loop_filter_level[0]", frame_info->loop_filter_params.filter_level[0]);
@@ -1087,6 +1111,34 @@ void read_lr_params(bitstrm_t *bs, FrameHeader *frame_info, SeqHeader *seq_heade
     }
 }
 
+static INLINE int count_units_in_frame(int unit_size, int frame_size) {
+    return AOMMAX((frame_size + (unit_size >> 1)) / unit_size, 1);
+}
+
+/* Restoration unit grid of the frame, used by read_lr and the LR filter */
+static void setup_lr_units(EbDecHandle *dec_handle_ptr)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    CurFrameBuf *frame_buf = &dec_handle_ptr->master_frame_buf.cur_frame_bufs[0];
+
+    for (int plane = 0; plane < av1_num_planes(color_config); plane++) {
+        int sub_x = plane ? color_config->subsampling_x : 0;
+        int sub_y = plane ? color_config->subsampling_y : 0;
+        int unit_size = frame_header->LR_params[plane].loop_restoration_size;
+
+        if (frame_header->LR_params[plane].frame_restoration_type == RESTORE_NONE) {
+            frame_buf->lr_unit_rows[plane] = 0;
+            frame_buf->lr_unit_cols[plane] = 0;
+            continue;
+        }
+        frame_buf->lr_unit_rows[plane] = count_units_in_frame(unit_size,
+            ROUND_POWER_OF_TWO(frame_header->frame_size.frame_height, sub_y));
+        frame_buf->lr_unit_cols[plane] = count_units_in_frame(unit_size,
+            ROUND_POWER_OF_TWO(frame_header->frame_size.superres_upscaled_width, sub_x));
+    }
+}
+
 void read_frame_cdef_params(bitstrm_t *bs, FrameHeader *frame_info, SeqHeader *seq_header,
     int num_planes)
 {
@@ -1101,20 +1153,16 @@ void read_frame_cdef_params(bitstrm_t *bs, FrameHeader *frame_info, SeqHeader *s
         frame_info->CDEF_params.cdef_damping = 3;
         return;
     }
-    frame_info->CDEF_params.cdef_damping = dec_get_bits(bs, 2);
+    frame_info->CDEF_params.cdef_damping = dec_get_bits(bs, 2) + 3;
     frame_info->CDEF_params.cdef_bits = dec_get_bits(bs, 2);
-    PRINT_FRAME("cdef_damping", frame_info->CDEF_params.cdef_damping + 3);
+    PRINT_FRAME("cdef_damping", frame_info->CDEF_params.cdef_damping);
     PRINT_FRAME("cdef_bits", frame_info->CDEF_params.cdef_bits);
     for (i = 0; i < (1 << frame_info->CDEF_params.cdef_bits); i++) {
         frame_info->CDEF_params.cdef_y_strength[i] = dec_get_bits(bs, 6);
         PRINT_FRAME("Primary Y cdef", frame_info->CDEF_params.cdef_y_strength[i]);
-        if (frame_info->CDEF_params.cdef_y_strength[i + 8] == 3)
-            frame_info->CDEF_params.cdef_y_strength[i + 8] += 1;
         if (num_planes > 1) {
             frame_info->CDEF_params.cdef_uv_strength[i] = dec_get_bits(bs, 6);
             PRINT_FRAME("Primary UV cdef", frame_info->CDEF_params.cdef_uv_strength[i]);
-            if (frame_info->CDEF_params.cdef_uv_strength[i + 8] == 3)
-                frame_info->CDEF_params.cdef_uv_strength[i + 8] += 1;
         }
     }
 }
@@ -1539,12 +1587,12 @@ void setup_frame_sign_bias(EbDecHandle *dec_handle) {
 }
 
 
-void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
-                              ObuHeader *obu_header, int num_planes)
+EbErrorType read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
+                                     ObuHeader *obu_header, int num_planes)
 {
     SeqHeader *seq_header = &dec_handle_ptr->seq_header;
     FrameHeader *frame_info = &dec_handle_ptr->frame_header;
-    int id_len=0, allFrames, FrameIsIntra = 0, i, frame_size_override_flag = 0;
+    int id_len=0, FrameIsIntra = 0, i, frame_size_override_flag = 0;
     uint32_t diff_len;
     int delta_frame_id_length_minus_1, frame_refs_short_signaling;
     int gold_frame_idx, frame_to_show_map_idx;
@@ -1558,7 +1606,6 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             seq_header->delta_frame_id_length -2 + 3;
         assert(id_len <= 16);
     }
-    allFrames = (1 << NUM_REF_FRAMES) - 1;
     if (seq_header->reduced_still_picture_header) {
         frame_info->show_existing_frame = 0;
         frame_info->frame_type = KEY_FRAME;
@@ -1582,17 +1629,30 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
                 PRINT_FRAME("display_frame_id", display_frame_id);
                 if (display_frame_id != frame_info->ref_frame_idx[frame_to_show_map_idx]
                     && frame_info->ref_valid[frame_to_show_map_idx] == 1)
-                    return; // EB_Corrupt_Frame;
+                    return EB_ErrorNone; // EB_Corrupt_Frame;
             }
 
-            //frame_type = RefFrameType[ frame_to_show_map_idx ]
+            /* The frame is output again as is, it is not decoded */
+            EbDecPicBuf *pic_to_show = dec_handle_ptr->ref_frame_map[frame_to_show_map_idx];
+            if (pic_to_show == NULL)
+                return EB_Corrupt_Frame;
+            frame_info->frame_type = pic_to_show->frame_type;
+            /* A shown key frame also reloads the decoder state and refreshes
+               every reference with the frame, which is not supported */
             if (frame_info->frame_type == KEY_FRAME)
-                frame_info->refresh_frame_flags = allFrames;
+                return EB_DecUnsupportedBitstream;
             if (seq_header->film_grain_params_present)
                 // TODO: Handle while implementing Inter
                 // load_grain_params(frame_to_show_map_idx);
                 assert(0);
-            return;
+
+            /* Held for output, see dec_pic_mgr_update_ref_pic */
+            pic_to_show->ref_count++;
+            dec_handle_ptr->cur_pic_buf[0] = pic_to_show;
+            frame_info->show_frame = 1;
+            dec_handle_ptr->show_existing_frame = 1;
+            dec_handle_ptr->show_frame = 1;
+            return EB_ErrorNone;
         }
 
         frame_info->frame_type = dec_get_bits(bs, 2);
@@ -1668,7 +1728,7 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
         // Bitstream conformance
         if (frame_info->current_frame_id == prev_frame_id || diff_frame_id >=
             1 << (id_len - 1))
-            return; // EB_Corrupt_Frame;
+            return EB_ErrorNone; // EB_Corrupt_Frame;
         }
 
         //mark_ref_frames( id_len )
@@ -1810,7 +1870,7 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
                 expected_frame_id = ((frame_info->current_frame_id + (1 << id_len) -
                     (delta_frame_id_length_minus_1 + 1)) % (1 << id_len));
                 if (expected_frame_id != frame_info->ref_frame_idx[i])
-                    return; // EB_Corrupt_Frame;
+                    return EB_ErrorNone; // EB_Corrupt_Frame;
             }
         }
         if (frame_size_override_flag && !frame_info->error_resilient_mode)
@@ -1845,7 +1905,11 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     dec_handle_ptr->cur_pic_buf[0] = dec_pic_mgr_get_cur_pic(dec_handle_ptr->pv_pic_mgr,
         &dec_handle_ptr->seq_header, &dec_handle_ptr->frame_header,
         dec_handle_ptr->dec_config.max_color_format);
+    /* No free picture, or the external frame buffer allocation failed */
+    if (dec_handle_ptr->cur_pic_buf[0] == NULL)
+        return EB_ErrorInsufficientResources;
     dec_handle_ptr->cur_pic_buf[0]->order_hint = dec_handle_ptr->frame_header.order_hint;
+    dec_handle_ptr->cur_pic_buf[0]->frame_type = frame_info->frame_type;
     /*Temporal MVs allocation */
     check_add_tplmv_buf(dec_handle_ptr);
 
@@ -1914,9 +1978,17 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     frame_info->all_lossless = frame_info->coded_lossless &&
         (frame_info->frame_size.frame_width ==
             frame_info->frame_size.superres_upscaled_width);
-    read_loop_filter_params(bs, frame_info, num_planes);
+    read_loop_filter_params(bs, dec_handle_ptr, num_planes);
+    /* Deltas of the frame, for the frames using it as primary_ref_frame */
+    memcpy(dec_handle_ptr->cur_pic_buf[0]->lf_ref_deltas,
+        frame_info->loop_filter_params.ref_deltas,
+        sizeof(dec_handle_ptr->cur_pic_buf[0]->lf_ref_deltas));
+    memcpy(dec_handle_ptr->cur_pic_buf[0]->lf_mode_deltas,
+        frame_info->loop_filter_params.mode_deltas,
+        sizeof(dec_handle_ptr->cur_pic_buf[0]->lf_mode_deltas));
     read_frame_cdef_params(bs, frame_info, seq_header, num_planes);
     read_lr_params(bs, frame_info, seq_header, num_planes);
+    setup_lr_units(dec_handle_ptr);
     read_tx_mode(bs, frame_info);
 
     frame_info->reference_mode = read_frame_reference_mode(bs, FrameIsIntra) ? REFERENCE_MODE_SELECT : SINGLE_REFERENCE;
@@ -1942,6 +2014,7 @@ void read_uncompressed_header(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     /* TODO: Should be moved to caller */
     if(!frame_info->show_existing_frame)
         svt_setup_motion_field(dec_handle_ptr);
+    return EB_ErrorNone;
 }
 
 EbErrorType read_frame_header_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
@@ -1953,7 +2026,8 @@ EbErrorType read_frame_header_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     uint32_t start_position, end_position, header_bytes;
 
     start_position = get_position(bs);
-    read_uncompressed_header(bs, dec_handle_ptr, obu_header, num_planes);
+    status = read_uncompressed_header(bs, dec_handle_ptr, obu_header, num_planes);
+    if (status != EB_ErrorNone) return status;
     if (trailing_bit) {
         status = av1_check_trailing_bits(bs);
         if (status != EB_ErrorNone) return status;
@@ -1968,12 +2042,11 @@ EbErrorType read_frame_header_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     return status;
 }
 
-void clear_above_context(EbDecHandle *dec_handle_ptr, int mi_col_start,
-                         int mi_col_end, const int tile_row)
+void clear_above_context(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctxt,
+                         int mi_col_start, int mi_col_end, const int tile_row)
 {
     assert(0 == tile_row);
 
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
     SeqHeader   *seq_params = &dec_handle_ptr->seq_header;
 
     int num_planes  = av1_num_planes(&seq_params->color_config);
@@ -2009,9 +2082,8 @@ void clear_above_context(EbDecHandle *dec_handle_ptr, int mi_col_start,
         tx_size_wide[TX_SIZES_LARGEST], width_y * sizeof(uint8_t));
 }
 
-void clear_left_context(EbDecHandle *dec_handle_ptr)
+void clear_left_context(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctxt)
 {
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
     SeqHeader   *seq_params = &dec_handle_ptr->seq_header;
 
     /* Maintained only for 1 left SB! */
@@ -2032,52 +2104,157 @@ void clear_left_context(EbDecHandle *dec_handle_ptr)
         blk_cnt*sizeof(parse_ctxt->parse_nbr4x4_ctxt.left_tx_ht[0]));
 }
 
-void clear_cdef(int32_t tile_row, int32_t tile_col, CDEFParams *cdefParams)
+void clear_loop_restoration(int num_planes, ParseCtxt *parse_ctx)
 {
-    (void)tile_row;
-    (void)tile_col;
-    for (int i = 0; i < CDEF_MAX_STRENGTHS; i++)
-    {
-        cdefParams->cdef_uv_strength[i] = 0;
-        cdefParams->cdef_y_strength[i] = 0;
+    for (int p = 0; p < num_planes; ++p) {
+        set_default_wiener(parse_ctx->ref_wiener_info + p);
+        set_default_sgrproj(parse_ctx->ref_sgrproj_info + p);
     }
 }
 
-void clear_loop_filter_delta(FrameHeader *fr_header, int num_planes)
+static void read_wiener_filter(SvtReader *r, int plane, WienerInfo *wiener_info,
+    WienerInfo *ref_wiener_info)
 {
-    fr_header->delta_lf_params.delta_lf_res = 0;
+    int16_t *filter[2] = { wiener_info->vfilter, wiener_info->hfilter };
+    int16_t *ref_filter[2] = { ref_wiener_info->vfilter, ref_wiener_info->hfilter };
+
+    /* Vertical taps first, then horizontal. Chroma uses 5 taps */
+    for (int pass = 0; pass < 2; pass++) {
+        int16_t *f = filter[pass];
+        int16_t *ref = ref_filter[pass];
+        if (plane)
+            f[0] = f[WIENER_WIN - 1] = 0;
+        else
+            f[0] = f[WIENER_WIN - 1] = (int16_t)(svt_read_primitive_refsubexpfin(r,
+                WIENER_FILT_TAP0_MAXV - WIENER_FILT_TAP0_MINV + 1,
+                WIENER_FILT_TAP0_SUBEXP_K, ref[0] - WIENER_FILT_TAP0_MINV) +
+                WIENER_FILT_TAP0_MINV);
+        f[1] = f[WIENER_WIN - 2] = (int16_t)(svt_read_primitive_refsubexpfin(r,
+            WIENER_FILT_TAP1_MAXV - WIENER_FILT_TAP1_MINV + 1,
+            WIENER_FILT_TAP1_SUBEXP_K, ref[1] - WIENER_FILT_TAP1_MINV) +
+            WIENER_FILT_TAP1_MINV);
+        f[2] = f[WIENER_WIN - 3] = (int16_t)(svt_read_primitive_refsubexpfin(r,
+            WIENER_FILT_TAP2_MAXV - WIENER_FILT_TAP2_MINV + 1,
+            WIENER_FILT_TAP2_SUBEXP_K, ref[2] - WIENER_FILT_TAP2_MINV) +
+            WIENER_FILT_TAP2_MINV);
+        /* The central tap is implicit, the kernels add the source back */
+        f[WIENER_HALFWIN] = -2 * (f[0] + f[1] + f[2]);
+        f[WIENER_WIN] = 0;
+        memcpy(ref, f, sizeof(InterpKernel));
+    }
+}
 
-    const int frame_lf_count =
-        num_planes > 1 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
-    for (int lf_id = 0; lf_id < frame_lf_count; ++lf_id)
-        fr_header->loop_filter_params.ref_deltas[lf_id] = 0;
-    for (int lf_id = 0; lf_id < MAX_MODE_LF_DELTAS; ++lf_id)
-        fr_header->loop_filter_params.mode_deltas[lf_id] = 0;
+static void read_sgrproj_filter(SvtReader *r, SgrprojInfo *sgrproj_info,
+    SgrprojInfo *ref_sgrproj_info)
+{
+    sgrproj_info->ep = svt_read_literal(r, SGRPROJ_PARAMS_BITS, ACCT_STR);
+    const SgrParamsType *params = &sgr_params[sgrproj_info->ep];
+
+    if (params->r[0] == 0) {
+        sgrproj_info->xqd[0] = 0;
+        sgrproj_info->xqd[1] = svt_read_primitive_refsubexpfin(r,
+            SGRPROJ_PRJ_MAX1 - SGRPROJ_PRJ_MIN1 + 1, SGRPROJ_PRJ_SUBEXP_K,
+            ref_sgrproj_info->xqd[1] - SGRPROJ_PRJ_MIN1) +
+            SGRPROJ_PRJ_MIN1;
+    }
+    else if (params->r[1] == 0) {
+        sgrproj_info->xqd[0] = svt_read_primitive_refsubexpfin(r,
+            SGRPROJ_PRJ_MAX0 - SGRPROJ_PRJ_MIN0 + 1, SGRPROJ_PRJ_SUBEXP_K,
+            ref_sgrproj_info->xqd[0] - SGRPROJ_PRJ_MIN0) +
+            SGRPROJ_PRJ_MIN0;
+        sgrproj_info->xqd[1] = clamp((1 << SGRPROJ_PRJ_BITS) - sgrproj_info->xqd[0],
+            SGRPROJ_PRJ_MIN1, SGRPROJ_PRJ_MAX1);
+    }
+    else {
+        sgrproj_info->xqd[0] = svt_read_primitive_refsubexpfin(r,
+            SGRPROJ_PRJ_MAX0 - SGRPROJ_PRJ_MIN0 + 1, SGRPROJ_PRJ_SUBEXP_K,
+            ref_sgrproj_info->xqd[0] - SGRPROJ_PRJ_MIN0) +
+            SGRPROJ_PRJ_MIN0;
+        sgrproj_info->xqd[1] = svt_read_primitive_refsubexpfin(r,
+            SGRPROJ_PRJ_MAX1 - SGRPROJ_PRJ_MIN1 + 1, SGRPROJ_PRJ_SUBEXP_K,
+            ref_sgrproj_info->xqd[1] - SGRPROJ_PRJ_MIN1) +
+            SGRPROJ_PRJ_MIN1;
+    }
+    *ref_sgrproj_info = *sgrproj_info;
 }
 
-void clear_loop_restoration(int num_planes, PartitionInfo_t *part_info)
+static void read_lr_unit(ParseCtxt *parse_ctx, int plane,
+    RestorationType frame_rtype, RestorationUnitInfo *lr_unit)
 {
-    for (int p = 0; p < num_planes; ++p) {
-        set_default_wiener(part_info->wiener_info + p);
-        set_default_sgrproj(part_info->sgrproj_info + p);
+    SvtReader *r = &parse_ctx->r;
+    FRAME_CONTEXT *ec_ctx = &parse_ctx->cur_tile_ctx;
+
+    if (frame_rtype == RESTORE_WIENER)
+        lr_unit->restoration_type = svt_read_symbol(r,
+            ec_ctx->wiener_restore_cdf, 2, ACCT_STR) ? RESTORE_WIENER : RESTORE_NONE;
+    else if (frame_rtype == RESTORE_SGRPROJ)
+        lr_unit->restoration_type = svt_read_symbol(r,
+            ec_ctx->sgrproj_restore_cdf, 2, ACCT_STR) ? RESTORE_SGRPROJ : RESTORE_NONE;
+    else
+        lr_unit->restoration_type = (RestorationType)svt_read_symbol(r,
+            ec_ctx->switchable_restore_cdf, RESTORE_SWITCHABLE_TYPES, ACCT_STR);
+
+    if (lr_unit->restoration_type == RESTORE_WIENER)
+        read_wiener_filter(r, plane, &lr_unit->wiener_info,
+            &parse_ctx->ref_wiener_info[plane]);
+    else if (lr_unit->restoration_type == RESTORE_SGRPROJ)
+        read_sgrproj_filter(r, &lr_unit->sgrproj_info,
+            &parse_ctx->ref_sgrproj_info[plane]);
+}
+
+/* Reads the restoration units whose top left corner lies in the SB */
+static void read_lr(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx,
+    int32_t mi_row, int32_t mi_col)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    CurFrameBuf *frame_buf = &dec_handle_ptr->master_frame_buf.cur_frame_bufs[0];
+    BlockSize sb_size = dec_handle_ptr->seq_header.sb_size;
+    int num_planes = av1_num_planes(color_config);
+
+    if (frame_header->allow_intrabc)
+        return;
+
+    for (int plane = 0; plane < num_planes; plane++) {
+        RestorationType frame_rtype = frame_header->LR_params[plane].frame_restoration_type;
+        if (frame_rtype == RESTORE_NONE)
+            continue;
+
+        int sub_x = plane ? color_config->subsampling_x : 0;
+        int sub_y = plane ? color_config->subsampling_y : 0;
+        int unit_size = frame_header->LR_params[plane].loop_restoration_size;
+        int unit_rows = frame_buf->lr_unit_rows[plane];
+        int unit_cols = frame_buf->lr_unit_cols[plane];
+
+        int unit_row_start = (mi_row * (MI_SIZE >> sub_y) + unit_size - 1) / unit_size;
+        int unit_row_end = AOMMIN(unit_rows, ((mi_row + mi_size_high[sb_size]) *
+            (MI_SIZE >> sub_y) + unit_size - 1) / unit_size);
+        int unit_col_start = (mi_col * (MI_SIZE >> sub_x) + unit_size - 1) / unit_size;
+        int unit_col_end = AOMMIN(unit_cols, ((mi_col + mi_size_wide[sb_size]) *
+            (MI_SIZE >> sub_x) + unit_size - 1) / unit_size);
+
+        for (int unit_row = unit_row_start; unit_row < unit_row_end; unit_row++) {
+            for (int unit_col = unit_col_start; unit_col < unit_col_end; unit_col++) {
+                read_lr_unit(parse_ctx, plane, frame_rtype,
+                    frame_buf->lr_unit[plane] + unit_row * unit_cols + unit_col);
+            }
+        }
     }
 }
 
-EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
-                       TilesInfo *tile_info, int32_t tile_row, int32_t tile_col)
+EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx,
+                       DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
+                       int32_t tile_row, int32_t tile_col)
 {
-    (void)bs;
     EbErrorType status = EB_ErrorNone;
 
     EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
-    int num_planes = av1_num_planes(color_config);
 
-    clear_above_context(dec_handle_ptr, tile_info->tile_col_start_sb[tile_col],
-                        tile_info->tile_col_start_sb[tile_col + 1], 0 /*TODO: For MultiThread*/);
-    clear_loop_filter_delta(&dec_handle_ptr->frame_header, num_planes);
+    /* Above ctxt arrays are owned by the thread parsing the tile */
+    clear_above_context(dec_handle_ptr, parse_ctx, tile_info->tile_col_start_sb[tile_col],
+                        tile_info->tile_col_start_sb[tile_col + 1], 0);
 
-    // to-do access to wiener info that is currently part of PartitionInfo_t
-    //clear_loop_restoration(num_planes, part_info);
+    clear_loop_restoration(av1_num_planes(color_config), parse_ctx);
 
     for (uint32_t mi_row = tile_info->tile_row_start_sb[tile_row];
          mi_row < tile_info->tile_row_start_sb[tile_row + 1];
@@ -2085,11 +2262,10 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     {
         int32_t sb_row = (mi_row << 2) >> dec_handle_ptr->seq_header.sb_size_log2;
 
-        clear_left_context(dec_handle_ptr);
+        clear_left_context(dec_handle_ptr, parse_ctx);
 
-        /*TODO: Move CFL to thread ctxt! We need to access DecModCtxt from parse_tile function */
         /*add tile level cfl init */
-        cfl_init(&((DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt)->cfl_ctx, color_config);
+        cfl_init(&dec_mod_ctxt->cfl_ctx, color_config);
 
         for (uint32_t mi_col = tile_info->tile_col_start_sb[tile_col];
             mi_col < tile_info->tile_col_start_sb[tile_col + 1];
@@ -2101,9 +2277,8 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             uint8_t     sx = color_config->subsampling_x;
             uint8_t     sy = color_config->subsampling_y;
 
-            clear_cdef(tile_row, tile_col, &dec_handle_ptr->frame_header.CDEF_params);
             //clear_block_decoded_flags(r, c, sbSize4)
-            //read_lr(r, c, sbSize)
+            read_lr(dec_handle_ptr, parse_ctx, mi_row, mi_col);
             MasterFrameBuf *master_frame_buf = &dec_handle_ptr->master_frame_buf;
             CurFrameBuf    *frame_buf        = &master_frame_buf->cur_frame_bufs[0];
             int32_t num_mis_in_sb = master_frame_buf->num_mis_in_sb;
@@ -2153,6 +2328,7 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             int cdef_factor = dec_handle_ptr->seq_header.use_128x128_superblock ? 4 : 1;
             sb_info->sb_cdef_strength = frame_buf->cdef_strength +
                 (((sb_row * master_frame_buf->sb_cols) + sb_col) * cdef_factor);
+            memset(sb_info->sb_cdef_strength, -1, cdef_factor * sizeof(int8_t));
 
             sb_info->sb_delta_lf = frame_buf->delta_lf +
                 (sb_row * master_frame_buf->sb_cols) + sb_col;
@@ -2163,8 +2339,6 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             /* TO DO : Populate other structures as well */
 
             /* Init ParseCtxt */
-            ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt;
-
             parse_ctx->first_luma_tu_offset = 0;
             parse_ctx->first_chroma_tu_offset = 0;
             parse_ctx->cur_mode_info = sb_info->sb_mode_info;
@@ -2181,7 +2355,6 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             parse_ctx->prev_blk_has_chroma = 1; //default at start of frame / tile
 
             /* Init DecModCtxt */
-            DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
 #if !FRAME_MI_MAP
             dec_mod_ctxt->sb_row_mi = mi_row;
             dec_mod_ctxt->sb_col_mi = mi_col;
@@ -2199,11 +2372,14 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             update_nbrs_before_sb(&master_frame_buf->frame_mi_map, sb_col);
 #endif
             // Bit-stream parsing of the superblock
-            parse_super_block(dec_handle_ptr, mi_row, mi_col, sb_info);
+            parse_super_block(dec_handle_ptr, parse_ctx, mi_row, mi_col, sb_info);
 
             /* TO DO : Will move later */
             // decoding of the superblock
             decode_super_block(dec_mod_ctxt, mi_row, mi_col, sb_info);
+
+            /* Filters the rows this SB completes, lagging behind */
+            dec_post_filter_sb_done(dec_handle_ptr, sb_row);
 #if !FRAME_MI_MAP
             /* nbr updates at SB level */
             update_nbrs_after_sb(&master_frame_buf->frame_mi_map, sb_col);
@@ -2262,6 +2438,161 @@ void svt_tile_init(TileInfo *cur_tile_info, FrameHeader *frame_header,
     assert(cur_tile_info->mi_col_end > cur_tile_info->mi_col_start);
 }
 
+/* Parses and decodes one tile with the ctxts of the calling thread */
+static EbErrorType decode_tile(DecThreadCtxt *thread_ctxt, DecTileJob *tile_job)
+{
+    DecTileThrdCtxt *tile_thrd_ctxt = thread_ctxt->tile_thrd_ctxt;
+    EbDecHandle     *dec_handle_ptr = tile_thrd_ctxt->dec_handle_ptr;
+    FrameHeader     *frame_header   = &dec_handle_ptr->frame_header;
+    ParseCtxt       *parse_ctxt     = thread_ctxt->parse_ctxt;
+    EbErrorType     status;
+
+    svt_tile_init(&parse_ctxt->cur_tile_info, frame_header,
+                    tile_job->tile_row, tile_job->tile_col);
+
+    //init_symbol(tileSize)
+
+    status = init_svt_reader(&parse_ctxt->r, tile_job->data,
+        tile_thrd_ctxt->data_end, tile_job->data_size,
+        !(frame_header->disable_cdf_update));
+    if (status != EB_ErrorNone)
+        return status;
+
+    /* Every tile starts from the CDFs of the frame */
+    parse_ctxt->cur_tile_ctx =
+        ((ParseCtxt *)dec_handle_ptr->pv_parse_ctxt)->init_frm_ctx;
+
+    /* TO DO decode_tile() */
+    status = parse_tile(dec_handle_ptr, parse_ctxt, thread_ctxt->dec_mod_ctxt,
+                        &frame_header->tiles_info, tile_job->tile_row,
+                        tile_job->tile_col);
+
+    /* Save CDF */
+    if (!frame_header->disable_frame_end_update_cdf &&
+        (tile_job->tile_num == frame_header->tiles_info.context_update_tile_id))
+    {
+        dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx =
+                                    parse_ctxt->cur_tile_ctx;
+        av1_reset_cdf_symbol_counters(&dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx);
+    }
+
+    return status;
+}
+
+/* Decodes tile jobs of the current tile group until none is left */
+static void decode_tile_jobs(DecThreadCtxt *thread_ctxt)
+{
+    DecTileThrdCtxt *tile_thrd_ctxt = thread_ctxt->tile_thrd_ctxt;
+    EbErrorType     status;
+    int32_t         job_idx;
+
+    for (;;) {
+        job_idx = eb_atomic_fetch_add(&tile_thrd_ctxt->next_tile_job, 1);
+        if (job_idx >= tile_thrd_ctxt->num_tile_jobs)
+            break;
+        status = decode_tile(thread_ctxt, &tile_thrd_ctxt->tile_jobs[job_idx]);
+        if (status != EB_ErrorNone)
+            eb_atomic_store(&tile_thrd_ctxt->tile_status, (int32_t)status);
+    }
+}
+
+static void *dec_tile_thread_kernel(void *input_ptr)
+{
+    DecThreadCtxt   *thread_ctxt    = (DecThreadCtxt *)input_ptr;
+    DecTileThrdCtxt *tile_thrd_ctxt = thread_ctxt->tile_thrd_ctxt;
+
+    for (;;) {
+        eb_block_on_semaphore(tile_thrd_ctxt->tile_start_semaphore);
+
+        decode_tile_jobs(thread_ctxt);
+
+        eb_post_semaphore(tile_thrd_ctxt->tile_done_semaphore);
+    }
+    return NULL;
+}
+
+EbErrorType dec_tile_thrd_init(EbDecHandle *dec_handle_ptr)
+{
+    EbErrorType return_error = EB_ErrorNone;
+
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_tile_thrd_ctxt, sizeof(DecTileThrdCtxt), EB_N_PTR);
+
+    DecTileThrdCtxt *tile_thrd_ctxt = (DecTileThrdCtxt*)dec_handle_ptr->pv_tile_thrd_ctxt;
+    uint32_t num_threads = dec_handle_ptr->dec_config.threads;
+
+    tile_thrd_ctxt->dec_handle_ptr = dec_handle_ptr;
+    tile_thrd_ctxt->num_threads = num_threads;
+    tile_thrd_ctxt->thread_handles = NULL;
+    tile_thrd_ctxt->tile_start_semaphore = NULL;
+    tile_thrd_ctxt->tile_done_semaphore = NULL;
+    tile_thrd_ctxt->num_tile_jobs = 0;
+    tile_thrd_ctxt->next_tile_job = 0;
+    tile_thrd_ctxt->tile_status = EB_ErrorNone;
+    tile_thrd_ctxt->data_end = NULL;
+
+    EB_MALLOC_DEC(DecTileJob*, tile_thrd_ctxt->tile_jobs,
+                  MAX_TILE_ROWS * MAX_TILE_COLS * sizeof(DecTileJob), EB_N_PTR);
+
+    EB_MALLOC_DEC(DecThreadCtxt*, tile_thrd_ctxt->thread_ctxt,
+                  num_threads * sizeof(DecThreadCtxt), EB_N_PTR);
+
+    /* The calling thread decodes tiles with the module ctxts of the handle */
+    tile_thrd_ctxt->thread_ctxt[0].tile_thrd_ctxt = tile_thrd_ctxt;
+    tile_thrd_ctxt->thread_ctxt[0].parse_ctxt = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt;
+    tile_thrd_ctxt->thread_ctxt[0].dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
+
+    if (num_threads == 1)
+        return return_error;
+
+    for (uint32_t i = 1; i < num_threads; i++) {
+        DecThreadCtxt *thread_ctxt = &tile_thrd_ctxt->thread_ctxt[i];
+        thread_ctxt->tile_thrd_ctxt = tile_thrd_ctxt;
+        return_error |= init_parse_context(dec_handle_ptr, &thread_ctxt->parse_ctxt);
+        return_error |= init_dec_mod_ctxt(dec_handle_ptr, &thread_ctxt->dec_mod_ctxt);
+    }
+    if (return_error != EB_ErrorNone)
+        return return_error;
+
+    EB_CREATE_SEMAPHORE_DEC(tile_thrd_ctxt->tile_start_semaphore, 0, num_threads - 1);
+    EB_CREATE_SEMAPHORE_DEC(tile_thrd_ctxt->tile_done_semaphore, 0, num_threads - 1);
+
+    EB_MALLOC_DEC(EbHandle*, tile_thrd_ctxt->thread_handles,
+                  (num_threads - 1) * sizeof(EbHandle), EB_N_PTR);
+    for (uint32_t i = 1; i < num_threads; i++) {
+        EB_CREATE_THREAD_DEC(tile_thrd_ctxt->thread_handles[i - 1],
+                             dec_tile_thread_kernel, &tile_thrd_ctxt->thread_ctxt[i]);
+    }
+
+    return return_error;
+}
+
+/* Decodes the tile jobs of the tile group on the calling thread and
+   num_threads - 1 worker threads */
+static EbErrorType decode_tile_group(DecTileThrdCtxt *tile_thrd_ctxt)
+{
+    DecModCtxt  *frm_dec_mod_ctxt = tile_thrd_ctxt->thread_ctxt[0].dec_mod_ctxt;
+    uint32_t    num_workers = AOMMIN(tile_thrd_ctxt->num_threads,
+                                (uint32_t)tile_thrd_ctxt->num_tile_jobs) - 1;
+
+    /* Frame level dequant is set up in the ctxt of the calling thread */
+    for (uint32_t i = 1; i <= num_workers; i++)
+        tile_thrd_ctxt->thread_ctxt[i].dec_mod_ctxt->dequants =
+            frm_dec_mod_ctxt->dequants;
+
+    tile_thrd_ctxt->next_tile_job = 0;
+    tile_thrd_ctxt->tile_status = EB_ErrorNone;
+
+    for (uint32_t i = 0; i < num_workers; i++)
+        eb_post_semaphore(tile_thrd_ctxt->tile_start_semaphore);
+
+    decode_tile_jobs(&tile_thrd_ctxt->thread_ctxt[0]);
+
+    for (uint32_t i = 0; i < num_workers; i++)
+        eb_block_on_semaphore(tile_thrd_ctxt->tile_done_semaphore);
+
+    return (EbErrorType)tile_thrd_ctxt->tile_status;
+}
+
 // Read Tile group information
 EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
                                 TilesInfo *tiles_info, ObuHeader *obu_header)
@@ -2269,6 +2600,9 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     EbErrorType status = EB_ErrorNone;
 
     ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    DecTileThrdCtxt *tile_thrd_ctxt =
+        (DecTileThrdCtxt *)dec_handle_ptr->pv_tile_thrd_ctxt;
+    DecTileJob  *tile_job;
 
     int num_tiles, tg_start, tg_end, tile_bits, tile_start_and_end_present_flag = 0;
     int tile_row, tile_col;
@@ -2302,6 +2636,10 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     header_bytes = (end_position - start_position) / 8;
     obu_header->payload_size -= header_bytes;
 
+    /* Locate all the tiles of the group first, so that they can be
+       parsed and decoded concurrently */
+    tile_thrd_ctxt->num_tile_jobs = 0;
+    tile_thrd_ctxt->data_end = bs->buf_max;
     for (int tile_num = tg_start; tile_num <= tg_end; tile_num++) {
         tile_row = tile_num / tiles_info->tile_cols;
         tile_col = tile_num % tiles_info->tile_cols;
@@ -2313,45 +2651,40 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             obu_header->payload_size -= (tiles_info->tile_size_bytes + tile_size);
         }
         PRINT_FRAME("tile_size", (tile_size));
-        svt_tile_init(&parse_ctxt->cur_tile_info, &dec_handle_ptr->frame_header,
-                        tile_row, tile_col);
 
-        //init_symbol(tileSize)
+        tile_job = &tile_thrd_ctxt->tile_jobs[tile_thrd_ctxt->num_tile_jobs++];
+        tile_job->tile_num  = tile_num;
+        tile_job->tile_row  = tile_row;
+        tile_job->tile_col  = tile_col;
+        tile_job->data      = (const uint8_t *)get_bitsteam_buf(bs);
+        tile_job->data_size = tile_size;
 
-        status = init_svt_reader(&parse_ctxt->r,
-            (const uint8_t *)get_bitsteam_buf(bs), bs->buf_max, tile_size,
-            !(dec_handle_ptr->frame_header.disable_cdf_update));
-        if (status != EB_ErrorNone)
-            return status;
-#if 0
-        reset_parse_ctx(&parse_ctxt->frm_ctx[0],
-            dec_handle_ptr->frame_header.quantization_params.base_q_idx);
-#else
-        parse_ctxt->cur_tile_ctx = parse_ctxt->init_frm_ctx;
-#endif
-        /* TO DO decode_tile() */
-        status = parse_tile(bs, dec_handle_ptr, tiles_info, tile_row, tile_col);
-
-        /* Save CDF */
-        if (!dec_handle_ptr->frame_header.disable_frame_end_update_cdf &&
-            (tile_num == tiles_info->context_update_tile_id))
-        {
-            dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx =
-                                        parse_ctxt->cur_tile_ctx;
-            av1_reset_cdf_symbol_counters(&dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx);
+        if (tile_num != tg_end) {
+            if (!read_is_valid(tile_job->data, tile_size, bs->buf_max))
+                return EB_Corrupt_Frame;
+            dec_bits_init(bs, tile_job->data + tile_size, obu_header->payload_size);
         }
+    }
 
-        dec_bits_init(bs, (uint8_t *)parse_ctxt->r.ec.bptr, obu_header->payload_size);
-
+    /* The post filters follow the reconstruction across the tile groups */
+    if (tg_start == 0) {
+        status = dec_post_filter_frame_init(dec_handle_ptr);
         if (status != EB_ErrorNone)
             return status;
     }
 
+    status = decode_tile_group(tile_thrd_ctxt);
+    if (status != EB_ErrorNone)
+        return status;
+
     /* Save CDF */
     if (dec_handle_ptr->frame_header.disable_frame_end_update_cdf)
         dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx = parse_ctxt->init_frm_ctx;
 
-    pad_pic(dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf);
+    if (tg_end == num_tiles - 1) {
+        dec_post_filter_flush(dec_handle_ptr);
+        pad_pic(dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf);
+    }
 
     return status;
 }
@@ -2431,7 +2764,13 @@ EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, uint8_t **data, siz
                 dec_handle_ptr->seen_frame_header = 1;
                 status = read_frame_header_obu(&bs, dec_handle_ptr, &obu_header,
                                                obu_header.obu_type != OBU_FRAME);
+                if (status != EB_ErrorNone) return status;
                 frame_decoding_finished = 1;
+                /* No tile group follows the header of a shown existing frame */
+                if (dec_handle_ptr->show_existing_frame) {
+                    dec_handle_ptr->seen_frame_header = 0;
+                    break;
+                }
             }
             /*else {
                  For OBU_REDUNDANT_FRAME_HEADER, previous frame_header is taken from dec_handle_ptr->frame_header
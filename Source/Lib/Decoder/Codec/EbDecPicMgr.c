@@ -53,7 +53,8 @@
 *******************************************************************************
 */
 
-EbErrorType dec_pic_mgr_init(EbDecPicMgr **pps_pic_mgr) {
+EbErrorType dec_pic_mgr_init(EbDecPicMgr **pps_pic_mgr,
+                             EbDecFrameBufCallbacks *frame_buf_cbs) {
 
     EbErrorType return_error = EB_ErrorNone;
     int32_t i;
@@ -67,13 +68,88 @@ EbErrorType dec_pic_mgr_init(EbDecPicMgr **pps_pic_mgr) {
         ps_pic_mgr->as_dec_pic[i].is_free    = 1;
         ps_pic_mgr->as_dec_pic[i].size       = 0;
         ps_pic_mgr->as_dec_pic[i].ref_count  = 0;
+        ps_pic_mgr->as_dec_pic[i].ext_frame_buf.buffer = NULL;
     }
 
     ps_pic_mgr->num_pic_bufs = 0;
+    ps_pic_mgr->frame_buf_cbs = frame_buf_cbs;
 
     return return_error;
 }
 
+/* Points the picture planes to a buffer of the application allocator,
+   each plane aligned to ALVALUE */
+static EbErrorType alloc_ext_frame_buf(EbDecPicMgr *ps_pic_mgr,
+                                       EbDecPicBuf *pic_buf,
+                                       int32_t mono_chrome)
+{
+    EbDecFrameBufCallbacks *cbs = ps_pic_mgr->frame_buf_cbs;
+    EbPictureBufferDesc *ps_pic_buf = pic_buf->ps_pic_buf;
+    const size_t bytes_per_pixel = ps_pic_buf->bit_depth == EB_8BIT ? 1 : 2;
+    const size_t luma_bytes = (ps_pic_buf->luma_size * bytes_per_pixel +
+        ALVALUE - 1) & ~(size_t)(ALVALUE - 1);
+    const size_t chroma_bytes = mono_chrome ? 0 :
+        (ps_pic_buf->chroma_size * bytes_per_pixel + ALVALUE - 1) &
+        ~(size_t)(ALVALUE - 1);
+    uint8_t *base;
+
+    if (cbs->allocate_buffer(&pic_buf->ext_frame_buf,
+        (uint32_t)(luma_bytes + 2 * chroma_bytes + ALVALUE - 1),
+        cbs->priv_data) || pic_buf->ext_frame_buf.buffer == NULL)
+    {
+        pic_buf->ext_frame_buf.buffer = NULL;
+        return EB_ErrorInsufficientResources;
+    }
+
+    base = (uint8_t *)(((uintptr_t)pic_buf->ext_frame_buf.buffer +
+        ALVALUE - 1) & ~(uintptr_t)(ALVALUE - 1));
+    ps_pic_buf->buffer_y  = base;
+    ps_pic_buf->buffer_cb = mono_chrome ? NULL : base + luma_bytes;
+    ps_pic_buf->buffer_cr = mono_chrome ? NULL : base + luma_bytes + chroma_bytes;
+
+    return EB_ErrorNone;
+}
+
+/* Gives the application buffer of a picture back */
+static void release_ext_frame_buf(EbDecPicMgr *ps_pic_mgr, EbDecPicBuf *pic_buf)
+{
+    EbDecFrameBufCallbacks *cbs = ps_pic_mgr->frame_buf_cbs;
+
+    if (pic_buf->ext_frame_buf.buffer == NULL)
+        return;
+
+    cbs->release_buffer(&pic_buf->ext_frame_buf, cbs->priv_data);
+    pic_buf->ext_frame_buf.buffer = NULL;
+    pic_buf->ps_pic_buf->buffer_y  = NULL;
+    pic_buf->ps_pic_buf->buffer_cb = NULL;
+    pic_buf->ps_pic_buf->buffer_cr = NULL;
+}
+
+/**
+*******************************************************************************
+*
+* @brief
+*  Picture manager de-initializer
+*
+* @par Description:
+*  Releases the application buffers still held. The rest of the memory is
+*  freed with the decoder memory map
+*
+* @param[in] ps_pic_mgr
+*  Pointer to the Picture manager structure
+*
+* @returns
+*
+* @remarks
+*
+*******************************************************************************
+*/
+void dec_pic_mgr_deinit(EbDecPicMgr *ps_pic_mgr) {
+
+    for (int32_t i = 0; i < MAX_PIC_BUFS; i++)
+        release_ext_frame_buf(ps_pic_mgr, &ps_pic_mgr->as_dec_pic[i]);
+}
+
 /**
 *******************************************************************************
 *
@@ -128,8 +204,12 @@ EbDecPicBuf * dec_pic_mgr_get_cur_pic(EbDecPicMgr *ps_pic_mgr,
         input_picture_buffer_desc_init_data.bit_depth = (EbBitDepthEnum)cc->bit_depth;
 
         input_picture_buffer_desc_init_data.color_format = color_format;
-        input_picture_buffer_desc_init_data.buffer_enable_mask = cc->mono_chrome ?
-            PICTURE_BUFFER_DESC_LUMA_MASK : PICTURE_BUFFER_DESC_FULL_MASK;
+        /* Application buffers are attached on each use instead */
+        if (ps_pic_mgr->frame_buf_cbs->allocate_buffer)
+            input_picture_buffer_desc_init_data.buffer_enable_mask = 0;
+        else
+            input_picture_buffer_desc_init_data.buffer_enable_mask = cc->mono_chrome ?
+                PICTURE_BUFFER_DESC_LUMA_MASK : PICTURE_BUFFER_DESC_FULL_MASK;
 
         input_picture_buffer_desc_init_data.left_padding  = PAD_VALUE;
         input_picture_buffer_desc_init_data.right_padding = PAD_VALUE;
@@ -149,21 +229,31 @@ EbDecPicBuf * dec_pic_mgr_get_cur_pic(EbDecPicMgr *ps_pic_mgr,
     else
         assert(ps_pic_mgr->as_dec_pic[i].ps_pic_buf != NULL);
 
+    if (ps_pic_mgr->frame_buf_cbs->allocate_buffer &&
+        alloc_ext_frame_buf(ps_pic_mgr, &ps_pic_mgr->as_dec_pic[i],
+                            cc->mono_chrome) != EB_ErrorNone)
+        return NULL;
+
     ps_pic_mgr->as_dec_pic[i].is_free = 0;
+    /* Held by the frame being decoded, see dec_pic_mgr_update_ref_pic */
+    ps_pic_mgr->as_dec_pic[i].ref_count = 1;
     pic_buf = &ps_pic_mgr->as_dec_pic[i];
 
     return pic_buf;
 }
 
-static INLINE void dec_ref_count_and_rel(EbDecPicBuf *ps_pic_buf) {
+static INLINE void dec_ref_count_and_rel(EbDecPicMgr *ps_pic_mgr,
+                                         EbDecPicBuf *ps_pic_buf) {
 
     if (ps_pic_buf != NULL) {
 
+        assert(ps_pic_buf->ref_count > 0);
         ps_pic_buf->ref_count--;
-        assert(ps_pic_buf->ref_count >= 0);
 
-        if (ps_pic_buf->ref_count == 0)
+        if (ps_pic_buf->ref_count == 0) {
+            release_ext_frame_buf(ps_pic_mgr, ps_pic_buf);
             ps_pic_buf->is_free = 1;
+        }
     }
 }
 
@@ -189,12 +279,26 @@ static INLINE void dec_ref_count_and_rel(EbDecPicBuf *ps_pic_buf) {
 void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decoded,
                                 int32_t refresh_frame_flags)
 {
+    EbDecPicMgr *ps_pic_mgr = (EbDecPicMgr *)dec_handle_ptr->pv_pic_mgr;
     int32_t ref_index = 0, mask;
 
     /* TODO: Add lock and unlock for MT */
+    /* No frame header in the data, keep the references */
+    if (frame_decoded && dec_handle_ptr->cur_pic_buf[0] == NULL)
+        return;
+
+    /* A shown existing frame leaves the references untouched, it only
+       takes the output hold */
+    if (frame_decoded && dec_handle_ptr->show_existing_frame) {
+        dec_ref_count_and_rel(ps_pic_mgr, dec_handle_ptr->out_pic_buf);
+        dec_handle_ptr->out_pic_buf = dec_handle_ptr->cur_pic_buf[0];
+        dec_handle_ptr->cur_pic_buf[0] = NULL;
+        return;
+    }
+
     if (frame_decoded) {
         for (mask = refresh_frame_flags; mask; mask >>= 1) {
-            dec_ref_count_and_rel(dec_handle_ptr->ref_frame_map[ref_index]);
+            dec_ref_count_and_rel(ps_pic_mgr, dec_handle_ptr->ref_frame_map[ref_index]);
             dec_handle_ptr->ref_frame_map[ref_index] = dec_handle_ptr->
                                                 next_ref_frame_map[ref_index];
             dec_handle_ptr->next_ref_frame_map[ref_index] = NULL;
@@ -202,7 +306,7 @@ void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decod
         }
 
         for (; ref_index < REF_FRAMES; ++ref_index) {
-            dec_ref_count_and_rel(dec_handle_ptr->ref_frame_map[ref_index]);
+            dec_ref_count_and_rel(ps_pic_mgr, dec_handle_ptr->ref_frame_map[ref_index]);
             dec_handle_ptr->ref_frame_map[ref_index] = dec_handle_ptr->
                                                 next_ref_frame_map[ref_index];
             dec_handle_ptr->next_ref_frame_map[ref_index] = NULL;
@@ -211,16 +315,20 @@ void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decod
         if (dec_handle_ptr->frame_header.show_existing_frame ||
             dec_handle_ptr->frame_header.show_frame)
         {
+            /* The decode hold becomes the output hold, the application
+               reads the picture until the next one is shown */
             //TODO: Add output Q logic
-            //assert(0);
+            dec_ref_count_and_rel(ps_pic_mgr, dec_handle_ptr->out_pic_buf);
+            dec_handle_ptr->out_pic_buf = dec_handle_ptr->cur_pic_buf[0];
         }
         else
-            dec_ref_count_and_rel(dec_handle_ptr->cur_pic_buf[0]);
+            dec_ref_count_and_rel(ps_pic_mgr, dec_handle_ptr->cur_pic_buf[0]);
     }
     else {
         // Nothing was decoded, so just drop this frame buffer
-        dec_ref_count_and_rel(dec_handle_ptr->cur_pic_buf[0]);
+        dec_ref_count_and_rel(ps_pic_mgr, dec_handle_ptr->cur_pic_buf[0]);
     }
+    dec_handle_ptr->cur_pic_buf[0] = NULL;
 
     /* Invalidate these references until the next frame starts. */
     for (ref_index = 0; ref_index < INTER_REFS_PER_FRAME; ref_index++) {
@@ -19,6 +19,9 @@ typedef struct EbDecPicMgr {
     /* number of picture buffers */
     uint8_t     num_pic_bufs;
 
+    /* Application allocator of the picture planes, if registered */
+    EbDecFrameBufCallbacks *frame_buf_cbs;
+
 } EbDecPicMgr;
 
 typedef struct RefFrameInfo {
@@ -29,7 +32,10 @@ typedef struct RefFrameInfo {
 } RefFrameInfo;
 
 
-EbErrorType dec_pic_mgr_init(EbDecPicMgr **pps_pic_mgr);
+EbErrorType dec_pic_mgr_init(EbDecPicMgr **pps_pic_mgr,
+                             EbDecFrameBufCallbacks *frame_buf_cbs);
+
+void dec_pic_mgr_deinit(EbDecPicMgr *ps_pic_mgr);
 
 EbDecPicBuf * dec_pic_mgr_get_cur_pic(EbDecPicMgr *ps_pic_mgr,
                                       SeqHeader   *seq_header,
@@ -0,0 +1,238 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#include "EbDeblockingFilter.h"
+
+#include "EbDecStruct.h"
+#include "EbDecBlock.h"
+#include "EbDecHandle.h"
+#include "EbObuParse.h"
+#include "EbDecMemInit.h"
+#include "EbDecInverseQuantize.h"
+
+#include "EbDecPostFilter.h"
+
+EbErrorType dec_post_filter_init(EbDecHandle *dec_handle_ptr)
+{
+    EbErrorType return_error = EB_ErrorNone;
+
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_post_filter_ctxt,
+                  sizeof(DecPostFilterCtxt), EB_N_PTR);
+
+    DecPostFilterCtxt *pf_ctxt = (DecPostFilterCtxt*)dec_handle_ptr->pv_post_filter_ctxt;
+    SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
+    FrameMiMap  *frame_mi_map = &dec_handle_ptr->master_frame_buf.frame_mi_map;
+    int32_t sub_x = seq_header->color_config.subsampling_x;
+    int32_t sub_y = seq_header->color_config.subsampling_y;
+    int32_t use_highbd = seq_header->color_config.bit_depth > EB_8BIT;
+    int32_t sb_aligned_width = frame_mi_map->mi_cols_algnsb << MI_SIZE_LOG2;
+    int32_t sb_aligned_height = frame_mi_map->mi_rows_algnsb << MI_SIZE_LOG2;
+    int32_t num_fb_cols = (sb_aligned_width + 63) >> 6;
+    int32_t num_stripes = (sb_aligned_height + RESTORATION_UNIT_OFFSET +
+        RESTORATION_PROC_UNIT_SIZE - 1) / RESTORATION_PROC_UNIT_SIZE;
+
+    memset(pf_ctxt, 0, sizeof(DecPostFilterCtxt));
+
+    EB_MALLOC_DEC(volatile int32_t*, pf_ctxt->sb_row_done,
+                  frame_mi_map->sb_rows * sizeof(int32_t), EB_N_PTR);
+
+    for (int32_t plane = 0; plane < MAX_MB_PLANE; plane++) {
+        int32_t ss_x = plane ? sub_x : 0;
+        int32_t ss_y = plane ? sub_y : 0;
+
+        /* Deblocking params of the 4x4s of the plane */
+        DecLFCtxt *lf_ctxt = &pf_ctxt->lf_ctxt;
+        lf_ctxt->blk_params_stride[plane] = frame_mi_map->mi_cols_algnsb >> ss_x;
+        EB_MALLOC_DEC(LFBlkParams*, lf_ctxt->blk_params[plane],
+                      lf_ctxt->blk_params_stride[plane] *
+                      (frame_mi_map->mi_rows_algnsb >> ss_y) *
+                      sizeof(LFBlkParams), EB_N_PTR);
+
+        /* CDEF line and column buffers */
+        DecCdefCtxt *cdef_ctxt = &pf_ctxt->cdef_ctxt;
+        cdef_ctxt->linebuf_stride = sb_aligned_width + 2 * CDEF_HBORDER;
+        EB_MALLOC_DEC(uint16_t*, cdef_ctxt->linebuf[plane], CDEF_VBORDER *
+                      cdef_ctxt->linebuf_stride * sizeof(uint16_t), EB_N_PTR);
+        EB_MALLOC_DEC(uint16_t*, cdef_ctxt->colbuf[plane],
+                      ((CDEF_BLOCKSIZE >> ss_y) + 2 * CDEF_VBORDER) *
+                      CDEF_HBORDER * sizeof(uint16_t), EB_N_PTR);
+
+        /* LR stripe boundaries, 2 rows above and below each stripe */
+        RestorationStripeBoundaries *rsb = &pf_ctxt->lr_ctxt.boundaries[plane];
+        rsb->stripe_boundary_stride = ALIGN_POWER_OF_TWO(
+            (sb_aligned_width >> ss_x) + 2 * RESTORATION_EXTRA_HORZ, 5);
+        rsb->stripe_boundary_size = (num_stripes * RESTORATION_CTX_VERT *
+            rsb->stripe_boundary_stride) << use_highbd;
+        EB_MALLOC_DEC(uint8_t*, rsb->stripe_boundary_above,
+                      rsb->stripe_boundary_size, EB_N_PTR);
+        EB_MALLOC_DEC(uint8_t*, rsb->stripe_boundary_below,
+                      rsb->stripe_boundary_size, EB_N_PTR);
+    }
+
+    EB_MALLOC_DEC(uint8_t*, pf_ctxt->cdef_ctxt.row_cdef,
+                  (num_fb_cols + 2) * 2 * sizeof(uint8_t), EB_N_PTR);
+    EB_ALLIGN_MALLOC_DEC(uint16_t*, pf_ctxt->cdef_ctxt.src,
+                         CDEF_INBUF_SIZE * sizeof(uint16_t), EB_A_PTR);
+
+    EB_MALLOC_DEC(RestorationLineBuffers*, pf_ctxt->lr_ctxt.rlbs,
+                  sizeof(RestorationLineBuffers), EB_N_PTR);
+    EB_ALLIGN_MALLOC_DEC(int32_t*, pf_ctxt->lr_ctxt.rst_tmpbuf,
+                         RESTORATION_TMPBUF_SIZE, EB_A_PTR);
+    /* The wiener filter writes widths rounded up to 16 */
+    pf_ctxt->lr_ctxt.stripe_buf_stride = sb_aligned_width + 32;
+    EB_ALLIGN_MALLOC_DEC(uint8_t*, pf_ctxt->lr_ctxt.stripe_buf,
+                         (pf_ctxt->lr_ctxt.stripe_buf_stride *
+                         RESTORATION_PROC_UNIT_SIZE) << use_highbd, EB_A_PTR);
+
+    return return_error;
+}
+
+EbErrorType dec_post_filter_frame_init(EbDecHandle *dec_handle_ptr)
+{
+    DecPostFilterCtxt *pf_ctxt = (DecPostFilterCtxt *)dec_handle_ptr->pv_post_filter_ctxt;
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    CDEFParams *cdef_params = &frame_header->CDEF_params;
+    const int32_t num_planes = av1_num_planes(&dec_handle_ptr->seq_header.color_config);
+    const int32_t sb_size_log2 = dec_handle_ptr->seq_header.sb_size_log2;
+    const int32_t no_filters = frame_header->coded_lossless ||
+        frame_header->allow_intrabc;
+
+    /* The SB level filter levels of delta LF, and the upscaling of
+       superres before LR, are not supported */
+    if (!no_filters && frame_header->delta_lf_params.delta_lf_present)
+        return EB_DecUnsupportedBitstream;
+    if (frame_header->frame_size.superres_denominator != SCALE_NUMERATOR)
+        return EB_DecUnsupportedBitstream;
+
+    pf_ctxt->do_lf = !no_filters &&
+        (frame_header->loop_filter_params.filter_level[0] ||
+         frame_header->loop_filter_params.filter_level[1]);
+    pf_ctxt->do_cdef = !no_filters && dec_handle_ptr->seq_header.enable_cdef &&
+        !(cdef_params->cdef_bits == 0 && cdef_params->cdef_y_strength[0] == 0 &&
+          cdef_params->cdef_uv_strength[0] == 0);
+    pf_ctxt->do_lr = 0;
+    for (int32_t plane = 0; plane < num_planes; plane++) {
+        if (frame_header->LR_params[plane].frame_restoration_type != RESTORE_NONE)
+            pf_ctxt->do_lr = !frame_header->allow_intrabc;
+    }
+
+    pf_ctxt->sb_rows = ((frame_header->mi_rows << MI_SIZE_LOG2) +
+        (1 << sb_size_log2) - 1) >> sb_size_log2;
+    pf_ctxt->sb_cols = ((frame_header->mi_cols << MI_SIZE_LOG2) +
+        (1 << sb_size_log2) - 1) >> sb_size_log2;
+    pf_ctxt->fb_rows = (frame_header->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    pf_ctxt->lr_stripes = (frame_header->frame_size.frame_height +
+        RESTORATION_UNIT_OFFSET + RESTORATION_PROC_UNIT_SIZE - 1) /
+        RESTORATION_PROC_UNIT_SIZE;
+
+    memset((void *)pf_ctxt->sb_row_done, 0,
+        pf_ctxt->sb_rows * sizeof(*pf_ctxt->sb_row_done));
+    pf_ctxt->recon_rows = 0;
+    pf_ctxt->dbk_rows = 0;
+    pf_ctxt->cdef_rows = 0;
+    pf_ctxt->lr_rows = 0;
+    pf_ctxt->busy = 0;
+    pf_ctxt->pending = 0;
+
+    if (pf_ctxt->do_lf)
+        dec_lf_frame_init(dec_handle_ptr, &pf_ctxt->lf_ctxt);
+    if (pf_ctxt->do_cdef)
+        dec_cdef_frame_init(dec_handle_ptr, &pf_ctxt->cdef_ctxt);
+
+    return EB_ErrorNone;
+}
+
+/* Runs every stage whose input rows are ready, in row order */
+static void run_ready_stages(EbDecHandle *dec_handle_ptr, DecPostFilterCtxt *pf_ctxt)
+{
+    const int32_t fb_shift = dec_handle_ptr->seq_header.sb_size_log2 - 6;
+    const int32_t sb_rows = pf_ctxt->sb_rows;
+
+    while (pf_ctxt->recon_rows < sb_rows && eb_atomic_load(
+        &pf_ctxt->sb_row_done[pf_ctxt->recon_rows]) == pf_ctxt->sb_cols)
+        pf_ctxt->recon_rows++;
+
+    while (pf_ctxt->dbk_rows < sb_rows &&
+        (pf_ctxt->recon_rows > pf_ctxt->dbk_rows + 1 ||
+         pf_ctxt->recon_rows == sb_rows))
+    {
+        if (pf_ctxt->do_lf)
+            dec_lf_sb_row(dec_handle_ptr, &pf_ctxt->lf_ctxt, pf_ctxt->dbk_rows);
+        pf_ctxt->dbk_rows++;
+    }
+
+    while (pf_ctxt->cdef_rows < pf_ctxt->fb_rows &&
+        (pf_ctxt->cdef_rows + 1 < (pf_ctxt->dbk_rows << fb_shift) ||
+         pf_ctxt->dbk_rows == sb_rows))
+    {
+        /* LR uses the deblocked rows at the stripe boundaries */
+        if (pf_ctxt->do_lr)
+            dec_lr_save_boundary_lines(dec_handle_ptr, &pf_ctxt->lr_ctxt,
+                pf_ctxt->cdef_rows);
+        if (pf_ctxt->do_cdef)
+            dec_cdef_fb_row(dec_handle_ptr, &pf_ctxt->cdef_ctxt, pf_ctxt->cdef_rows);
+        pf_ctxt->cdef_rows++;
+    }
+
+    while (pf_ctxt->lr_rows < pf_ctxt->lr_stripes &&
+        (pf_ctxt->cdef_rows > pf_ctxt->lr_rows ||
+         pf_ctxt->cdef_rows == pf_ctxt->fb_rows))
+    {
+        if (pf_ctxt->do_lr)
+            dec_lr_stripe(dec_handle_ptr, &pf_ctxt->lr_ctxt, pf_ctxt->lr_rows);
+        pf_ctxt->lr_rows++;
+    }
+}
+
+static void run_post_filter(EbDecHandle *dec_handle_ptr, DecPostFilterCtxt *pf_ctxt)
+{
+    for (;;) {
+        if (!eb_atomic_compare_exchange(&pf_ctxt->busy, 0, 1)) {
+            /* Leave the request to the running thread, unless it
+               finished in between */
+            eb_atomic_store(&pf_ctxt->pending, 1);
+            if (eb_atomic_load(&pf_ctxt->busy))
+                return;
+            continue;
+        }
+        do {
+            eb_atomic_store(&pf_ctxt->pending, 0);
+            run_ready_stages(dec_handle_ptr, pf_ctxt);
+        } while (eb_atomic_load(&pf_ctxt->pending));
+        eb_atomic_store(&pf_ctxt->busy, 0);
+        /* A request may have been left after the last check */
+        if (!eb_atomic_load(&pf_ctxt->pending))
+            return;
+    }
+}
+
+void dec_post_filter_sb_done(EbDecHandle *dec_handle_ptr, int32_t sb_row)
+{
+    DecPostFilterCtxt *pf_ctxt = (DecPostFilterCtxt *)dec_handle_ptr->pv_post_filter_ctxt;
+
+    if (!pf_ctxt->do_lf && !pf_ctxt->do_cdef && !pf_ctxt->do_lr)
+        return;
+
+    if (eb_atomic_fetch_add(&pf_ctxt->sb_row_done[sb_row], 1) + 1 == pf_ctxt->sb_cols)
+        run_post_filter(dec_handle_ptr, pf_ctxt);
+}
+
+void dec_post_filter_flush(EbDecHandle *dec_handle_ptr)
+{
+    DecPostFilterCtxt *pf_ctxt = (DecPostFilterCtxt *)dec_handle_ptr->pv_post_filter_ctxt;
+
+    if (!pf_ctxt->do_lf && !pf_ctxt->do_cdef && !pf_ctxt->do_lr)
+        return;
+
+    /* All the decoding threads are done, mark any row left incomplete
+       (e.g. by a corrupt tile) so that the whole frame gets filtered */
+    for (int32_t sb_row = 0; sb_row < pf_ctxt->sb_rows; sb_row++)
+        eb_atomic_store(&pf_ctxt->sb_row_done[sb_row], pf_ctxt->sb_cols);
+    run_post_filter(dec_handle_ptr, pf_ctxt);
+}
@@ -0,0 +1,73 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecPostFilter_h
+#define EbDecPostFilter_h
+
+#include "EbDecLF.h"
+#include "EbDecCdef.h"
+#include "EbDecRestoration.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Post reconstruction filters of a frame, run on SB rows as soon as the
+   rows below them are reconstructed:
+     deblock(sb row r)  once SB row r + 1 is reconstructed,
+     CDEF(fb row f)     once fb row f + 1 is deblocked,
+     LR(stripe s)       once fb row s is CDEF filtered.
+   The lag covers the rows each stage reads below its own, and keeps the
+   unfiltered above rows intra prediction of the next SB row reads. */
+typedef struct DecPostFilterCtxt {
+    DecLFCtxt           lf_ctxt;
+    DecCdefCtxt         cdef_ctxt;
+    DecLrCtxt           lr_ctxt;
+
+    /*!< Stages enabled for the current frame */
+    uint8_t             do_lf;
+    uint8_t             do_cdef;
+    uint8_t             do_lr;
+
+    /*!< Frame size in SB rows / cols, 64x64 fb rows and LR stripes */
+    int32_t             sb_rows;
+    int32_t             sb_cols;
+    int32_t             fb_rows;
+    int32_t             lr_stripes;
+
+    /*!< Number of reconstructed SBs of each SB row */
+    volatile int32_t    *sb_row_done;
+
+    /*!< Rows done by each stage, owned by the thread running the stages */
+    int32_t             recon_rows;
+    int32_t             dbk_rows;
+    int32_t             cdef_rows;
+    int32_t             lr_rows;
+
+    /*!< Only one thread runs the stages at a time, the others leave a
+         pending request that the running thread picks up */
+    volatile int32_t    busy;
+    volatile int32_t    pending;
+} DecPostFilterCtxt;
+
+/* Allocates the stage buffers for the largest frame of the sequence */
+EbErrorType dec_post_filter_init(EbDecHandle *dec_handle_ptr);
+
+/* Resets the stages at the start of a frame. Fails frames using delta LF
+   or superres, which the stages do not filter */
+EbErrorType dec_post_filter_frame_init(EbDecHandle *dec_handle_ptr);
+
+/* Called by the decoding threads after each reconstructed SB. Runs the
+   stages that became ready when the SB completes its row */
+void dec_post_filter_sb_done(EbDecHandle *dec_handle_ptr, int32_t sb_row);
+
+/* Runs the remaining stages once all the SBs of the frame are decoded */
+void dec_post_filter_flush(EbDecHandle *dec_handle_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbDecPostFilter_h
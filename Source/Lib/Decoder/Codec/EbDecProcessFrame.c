@@ -122,7 +122,7 @@ void decode_super_block(DecModCtxt *dec_mod_ctxt,
     /* Pointer updates */
 
     /* SB level dequant update */
-    update_dequant(dec_handle, sb_info);
+    update_dequant(dec_mod_ctxt, sb_info);
 
     /* Decode partition */
     decode_partition(dec_mod_ctxt, mi_row, mi_col,
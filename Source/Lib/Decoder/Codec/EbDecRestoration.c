@@ -0,0 +1,203 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbUtility.h"
+#include "EbRestoration.h"
+
+#include "EbDecStruct.h"
+#include "EbDecBlock.h"
+#include "EbDecHandle.h"
+#include "EbObuParse.h"
+#include "EbDecUtils.h"
+#include "EbDecInverseQuantize.h"
+
+#include "EbDecRestoration.h"
+
+/* Replicates the first / last pixel of each row over 'extend' pixels */
+static void extend_rows(uint8_t *buf, int32_t width, int32_t height, int32_t stride,
+    int32_t extend, int32_t is16bit)
+{
+    for (int32_t i = 0; i < height; i++) {
+        if (is16bit) {
+            uint16_t *buf16 = (uint16_t *)buf + i * stride;
+            aom_memset16(buf16 - extend, buf16[0], extend);
+            aom_memset16(buf16 + width, buf16[width - 1], extend);
+        }
+        else {
+            uint8_t *buf8 = buf + i * stride;
+            memset(buf8 - extend, buf8[0], extend);
+            memset(buf8 + width, buf8[width - 1], extend);
+        }
+    }
+}
+
+/* Copies rows, strides in pixels */
+static void copy_rows(uint8_t *dst, int32_t dst_stride, const uint8_t *src,
+    int32_t src_stride, int32_t width, int32_t height, int32_t is16bit)
+{
+    for (int32_t i = 0; i < height; i++)
+        memcpy(dst + ((i * dst_stride) << is16bit),
+            src + ((i * src_stride) << is16bit), width << is16bit);
+}
+
+static void save_deblock_lines(const uint8_t *src, int32_t src_stride,
+    int32_t plane_width, int32_t plane_height, int32_t row, int32_t stripe,
+    int32_t is16bit, uint8_t *bdry_buf, int32_t bdry_stride)
+{
+    uint8_t *bdry_rows = bdry_buf + ((RESTORATION_EXTRA_HORZ +
+        RESTORATION_CTX_VERT * stripe * bdry_stride) << is16bit);
+    /* A stripe can end 1 row above the frame bottom, the row is then
+       duplicated as if the samples were clamped against the frame */
+    const int32_t lines_to_save = AOMMIN(RESTORATION_CTX_VERT, plane_height - row);
+
+    copy_rows(bdry_rows, bdry_stride, src + ((row * src_stride) << is16bit),
+        src_stride, plane_width, lines_to_save, is16bit);
+    if (lines_to_save == 1)
+        copy_rows(bdry_rows + (bdry_stride << is16bit), bdry_stride, bdry_rows,
+            bdry_stride, plane_width, 1, is16bit);
+
+    extend_rows(bdry_rows, plane_width, RESTORATION_CTX_VERT, bdry_stride,
+        RESTORATION_EXTRA_HORZ, is16bit);
+}
+
+void dec_lr_save_boundary_lines(EbDecHandle *dec_handle_ptr, DecLrCtxt *lr_ctxt,
+                                int32_t fbr)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+    const int32_t is16bit = recon_picture_buf->bit_depth != EB_8BIT;
+    const int32_t num_planes = av1_num_planes(color_config);
+
+    for (int32_t plane = 0; plane < num_planes; plane++) {
+        if (frame_header->LR_params[plane].frame_restoration_type == RESTORE_NONE)
+            continue;
+
+        const int32_t ss_x = plane ? color_config->subsampling_x : 0;
+        const int32_t ss_y = plane ? color_config->subsampling_y : 0;
+        const int32_t plane_width = ROUND_POWER_OF_TWO(
+            frame_header->frame_size.superres_upscaled_width, ss_x);
+        const int32_t plane_height = ROUND_POWER_OF_TWO(
+            frame_header->frame_size.frame_height, ss_y);
+        const int32_t stripe_height = RESTORATION_PROC_UNIT_SIZE >> ss_y;
+        const int32_t stripe_off = RESTORATION_UNIT_OFFSET >> ss_y;
+        const int32_t row = (fbr + 1) * stripe_height - stripe_off;
+        RestorationStripeBoundaries *rsb = &lr_ctxt->boundaries[plane];
+        void *src;
+        int32_t src_stride;
+
+        /* The last stripe uses the CDEF output below, nothing to save */
+        if (row >= plane_height) continue;
+
+        derive_blk_pointers(recon_picture_buf, plane, 0, 0, &src, &src_stride,
+            ss_x, ss_y);
+
+        /* Rows below stripe fbr and above stripe fbr + 1 */
+        save_deblock_lines((uint8_t *)src, src_stride, plane_width, plane_height,
+            row, fbr, is16bit, rsb->stripe_boundary_below,
+            rsb->stripe_boundary_stride);
+        save_deblock_lines((uint8_t *)src, src_stride, plane_width, plane_height,
+            row - RESTORATION_CTX_VERT, fbr + 1, is16bit,
+            rsb->stripe_boundary_above, rsb->stripe_boundary_stride);
+    }
+}
+
+void dec_lr_stripe(EbDecHandle *dec_handle_ptr, DecLrCtxt *lr_ctxt,
+                   int32_t stripe)
+{
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+    CurFrameBuf *frame_buf = &dec_handle_ptr->master_frame_buf.cur_frame_bufs[0];
+    EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
+    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+    const int32_t is16bit = recon_picture_buf->bit_depth != EB_8BIT;
+    const int32_t num_planes = av1_num_planes(color_config);
+    const int32_t dst_stride = lr_ctxt->stripe_buf_stride;
+
+    for (int32_t plane = 0; plane < num_planes; plane++) {
+        if (frame_header->LR_params[plane].frame_restoration_type == RESTORE_NONE)
+            continue;
+
+        const int32_t ss_x = plane ? color_config->subsampling_x : 0;
+        const int32_t ss_y = plane ? color_config->subsampling_y : 0;
+        const int32_t plane_width = ROUND_POWER_OF_TWO(
+            frame_header->frame_size.superres_upscaled_width, ss_x);
+        const int32_t plane_height = ROUND_POWER_OF_TWO(
+            frame_header->frame_size.frame_height, ss_y);
+        const int32_t stripe_height = RESTORATION_PROC_UNIT_SIZE >> ss_y;
+        const int32_t stripe_off = RESTORATION_UNIT_OFFSET >> ss_y;
+        const int32_t y0 = AOMMAX(0, stripe * stripe_height - stripe_off);
+        const int32_t y1 = AOMMIN((stripe + 1) * stripe_height - stripe_off,
+            plane_height);
+        const int32_t unit_size = frame_header->LR_params[plane].loop_restoration_size;
+        const int32_t ext_size = unit_size * 3 / 2;
+        const int32_t unit_row = AOMMIN((y0 + stripe_off) / unit_size,
+            frame_buf->lr_unit_rows[plane] - 1);
+        const RestorationUnitInfo *lr_unit = frame_buf->lr_unit[plane] +
+            unit_row * frame_buf->lr_unit_cols[plane];
+        const AV1PixelRect tile_rect = { 0, 0, plane_width, plane_height };
+        uint8_t *data8, *dst8;
+        void *src;
+        int32_t src_stride;
+
+        if (y0 >= plane_height) continue;
+
+        derive_blk_pointers(recon_picture_buf, plane, 0, 0, &src, &src_stride,
+            ss_x, ss_y);
+
+        /* Frame border the filters read where no boundary lines are used:
+           3 columns on both sides and 3 rows above / below the frame */
+        uint8_t *src_rows = (uint8_t *)src + ((y0 * src_stride) << is16bit);
+        extend_rows(src_rows, plane_width, y1 - y0, src_stride,
+            RESTORATION_BORDER, is16bit);
+        if (y0 == 0) {
+            for (int32_t i = 1; i <= RESTORATION_BORDER; i++)
+                copy_rows(src_rows - ((i * src_stride +
+                    RESTORATION_BORDER) << is16bit), src_stride,
+                    src_rows - (RESTORATION_BORDER << is16bit), src_stride,
+                    plane_width + 2 * RESTORATION_BORDER, 1, is16bit);
+        }
+        if (y1 == plane_height) {
+            uint8_t *last_row = (uint8_t *)src + (((y1 - 1) * src_stride -
+                RESTORATION_BORDER) << is16bit);
+            for (int32_t i = 1; i <= RESTORATION_BORDER; i++)
+                copy_rows(last_row + ((i * src_stride) << is16bit), src_stride,
+                    last_row, src_stride, plane_width + 2 * RESTORATION_BORDER,
+                    1, is16bit);
+        }
+
+        if (is16bit) {
+            data8 = CONVERT_TO_BYTEPTR(src);
+            dst8 = CONVERT_TO_BYTEPTR((uint16_t *)lr_ctxt->stripe_buf -
+                y0 * dst_stride);
+        }
+        else {
+            data8 = (uint8_t *)src;
+            dst8 = lr_ctxt->stripe_buf - y0 * dst_stride;
+        }
+
+        /* Units are unit_size wide, the last one absorbing the remainder */
+        for (int32_t x0 = 0, unit_col = 0; x0 < plane_width; x0 += unit_size, unit_col++) {
+            const int32_t remaining_w = plane_width - x0;
+            RestorationTileLimits limits;
+            limits.h_start = x0;
+            limits.h_end = remaining_w < ext_size ? plane_width : x0 + unit_size;
+            limits.v_start = y0;
+            limits.v_end = y1;
+
+            av1_loop_restoration_filter_unit(1, &limits, &lr_unit[unit_col],
+                &lr_ctxt->boundaries[plane], lr_ctxt->rlbs, &tile_rect, 0, ss_x,
+                ss_y, is16bit, color_config->bit_depth, data8, src_stride, dst8,
+                dst_stride, lr_ctxt->rst_tmpbuf, 0);
+
+            if (limits.h_end == plane_width) break;
+        }
+
+        copy_rows(src_rows, src_stride, lr_ctxt->stripe_buf, dst_stride,
+            plane_width, y1 - y0, is16bit);
+    }
+}
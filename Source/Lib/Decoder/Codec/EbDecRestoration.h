@@ -0,0 +1,46 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecRestoration_h
+#define EbDecRestoration_h
+
+#include "EbRestoration.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Loop restoration state of a frame filtered one 64 row stripe at a time */
+typedef struct DecLrCtxt {
+    /*!< Deblocked rows above / below each stripe, per plane */
+    RestorationStripeBoundaries boundaries[MAX_MB_PLANE];
+
+    /*!< Scratch lines used while swapping in the stripe boundaries */
+    RestorationLineBuffers      *rlbs;
+
+    /*!< Scratch buffer of the self guided filter */
+    int32_t                     *rst_tmpbuf;
+
+    /*!< Filtered stripe, copied back to the frame once all its units
+         are done since the filters read the unfiltered rows */
+    uint8_t                     *stripe_buf;
+    int32_t                     stripe_buf_stride;
+} DecLrCtxt;
+
+/* Saves the deblocked rows around the stripe boundaries of a 64x64 filter
+   block row. Must be called before the fb row is CDEF filtered */
+void dec_lr_save_boundary_lines(EbDecHandle *dec_handle_ptr, DecLrCtxt *lr_ctxt,
+                                int32_t fbr);
+
+/* Restores all the planes of a stripe. Needs the fb row of the stripe to be
+   CDEF filtered */
+void dec_lr_stripe(EbDecHandle *dec_handle_ptr, DecLrCtxt *lr_ctxt,
+                   int32_t stripe);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbDecRestoration_h
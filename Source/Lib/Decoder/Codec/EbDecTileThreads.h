@@ -0,0 +1,69 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecTileThreads_h
+#define EbDecTileThreads_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Tile of the current tile group, located in the bitstream before
+   any of the tiles is decoded */
+typedef struct DecTileJob {
+    int32_t         tile_num;
+    int32_t         tile_row;
+    int32_t         tile_col;
+    const uint8_t   *data;
+    size_t          data_size;
+} DecTileJob;
+
+struct DecTileThrdCtxt;
+
+/* Per thread copy of the parse and decode state. Every tile is parsed and
+   reconstructed by a single thread, so these are only touched by their
+   owner while a tile group is being decoded */
+typedef struct DecThreadCtxt {
+    struct DecTileThrdCtxt  *tile_thrd_ctxt;
+
+    ParseCtxt   *parse_ctxt;
+
+    DecModCtxt  *dec_mod_ctxt;
+} DecThreadCtxt;
+
+typedef struct DecTileThrdCtxt {
+    /** Decoder Handle */
+    EbDecHandle     *dec_handle_ptr;
+
+    /*!< Number of threads decoding tiles, including the calling thread */
+    uint32_t        num_threads;
+
+    /*!< thread_ctxt[0] is used by the calling thread and shares its parse
+         and decode ctxts with pv_parse_ctxt and pv_dec_mod_ctxt */
+    DecThreadCtxt   *thread_ctxt;
+
+    /*!< num_threads - 1 worker threads */
+    EbHandle        *thread_handles;
+
+    EbHandle        tile_start_semaphore;
+    EbHandle        tile_done_semaphore;
+
+    /* Tile jobs of the current tile group */
+    DecTileJob      *tile_jobs;
+    int32_t         num_tile_jobs;
+    volatile int32_t next_tile_job;
+    volatile int32_t tile_status;
+    const uint8_t   *data_end;
+} DecTileThrdCtxt;
+
+/* Allocates the tile thread ctxt and starts the num_threads - 1 worker
+   threads, each with its own parse and decode ctxts */
+EbErrorType dec_tile_thrd_init(EbDecHandle *dec_handle_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbDecTileThreads_h
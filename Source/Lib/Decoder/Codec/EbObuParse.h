@@ -157,10 +157,17 @@ typedef struct ParseCtxt {
     /*!< Number of TUs in block or force split block */
     uint8_t         num_tus[MAX_MB_PLANE][4 /*Max force TU split*/];
 
+    /*!< Reference Wiener and Sgrproj coefficients of the tile, used for
+     *   the sub-exponential coding of the next restoration unit */
+    WienerInfo      ref_wiener_info[MAX_MB_PLANE];
+    SgrprojInfo     ref_sgrproj_info[MAX_MB_PLANE];
+
 } ParseCtxt;
 
 int get_qindex(SegmentationParams *seg_params, int segment_id, int base_q_idx);
-void parse_super_block(EbDecHandle *dec_handle,
+int seg_feature_active_idx(SegmentationParams *seg_params, int segment_id,
+    SEG_LVL_FEATURES feature_id);
+void parse_super_block(EbDecHandle *dec_handle, ParseCtxt *parse_ctx,
     uint32_t blk_row, uint32_t blk_col, SBInfo *sbInfo);
 
 void svt_setup_motion_field(EbDecHandle *dec_handle);
@@ -51,6 +51,7 @@
 #include "EbCdefProcess.h"
 #include "EbRestProcess.h"
 #include "EbObject.h"
+#include "EbLadder.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -118,36 +119,6 @@ processorGroup                   lp_group[MAX_PROCESSOR_GROUP];
 * Instruction Set Support
 **************************************/
 
-#if defined(_MSC_VER)
-# include <intrin.h>
-#endif
-// Helper Functions
-void RunCpuid(uint32_t eax, uint32_t ecx, int32_t* abcd)
-{
-#if defined(_MSC_VER)
-    __cpuidex(abcd, eax, ecx);
-#else
-    uint32_t ebx = 0, edx = 0;
-# if defined( __i386__ ) && defined ( __PIC__ )
-    /* in case of PIC under 32-bit EBX cannot be clobbered */
-    __asm__("movl %%ebx, %%edi \n\t cpuid \n\t xchgl %%ebx, %%edi" : "=D" (ebx),
-# else
-    __asm__("cpuid" : "+b" (ebx),
-# endif
-        "+a" (eax), "+c" (ecx), "=d" (edx));
-    abcd[0] = eax; abcd[1] = ebx; abcd[2] = ecx; abcd[3] = edx;
-#endif
-}
-int32_t CheckXcr0Ymm()
-{
-    uint32_t xcr0;
-#if defined(_MSC_VER)
-    xcr0 = (uint32_t)_xgetbv(0);  /* min VS2010 SP1 compiler is required */
-#else
-    __asm__("xgetbv" : "=a" (xcr0) : "c" (0) : "%edx");
-#endif
-    return ((xcr0 & 6) == 6); /* checking if xmm and ymm state are enabled in XCR0 */
-}
 int32_t Check4thGenIntelCoreFeatures()
 {
     int32_t abcd[4];
@@ -415,6 +386,196 @@ int32_t set_parent_pcs(EbSvtAv1EncConfiguration*   config, uint32_t core_count,
         return -1;
     }
 }
+/* Bytes of the objects behind the picture pools, fitted on the init
+   allocations of 8 bit 4:2:0 encodes from 320x256 to 1080p. The per sample
+   terms are in luma samples of the 64 aligned picture. */
+#define PPCS_FIXED_BYTES                    (1600 << 10)
+#define PPCS_SAMPLE_TENTHS                  125 // + NSQ and + single reference ME below
+#define PPCS_NSQ_SAMPLE_TENTHS              23
+#define PPCS_MRP_OFF_SAMPLE_TENTHS          33
+#define CHILD_PCS_FIXED_BYTES               (56 << 20)
+#define CHILD_PCS_SAMPLE_BYTES              360 // per super block CDFs, 147 without
+#define CHILD_PCS_CDF_MODE_SAMPLE_BYTES     147
+#define CHILD_PCS_TILE_BYTES                (64 << 10) // entropy coding neighbor arrays and CDFs of each extra tile
+#define PA_REFERENCE_SAMPLE_QUARTERS        3
+#define PA_REFERENCE_HASH_FIXED_BYTES       (4 << 20) // hash ME lookup table
+#define PA_REFERENCE_HASH_SAMPLE_BYTES      32 // up to one entry per sample and block size
+#define INPUT_FIXED_BYTES                   (150 << 10)
+#define INPUT_SAMPLE_TENTHS                 19
+#define CONTEXTS_FIXED_BYTES                (60 << 20)
+#define CONTEXTS_SAMPLE_BYTES               28
+#define PROCESS_CONTEXT_FIXED_BYTES         (9 << 20)
+#define PROCESS_CONTEXT_SAMPLE_BYTES        4
+#define MD_BLK_RECON_CONTEXT_BYTES          (6 << 20) // winners of all the blocks of a 128x128 SB
+
+static uint64_t frame_bytes(uint64_t width, uint64_t height, EbColorFormat color_format, EbBool is16bit) {
+    const uint64_t luma = width * height;
+    const uint64_t chroma = color_format == EB_YUV444 ? 2 * luma :
+        color_format == EB_YUV422 ? luma : luma >> 1;
+    return (luma + chroma) << is16bit;
+}
+
+/* Most tiles set_tile_info() splits the pictures into: tile_columns is raised
+   until the tiles are narrower than MAX_TILE_WIDTH, and there are no more
+   tiles than super blocks */
+static uint16_t max_tile_count(SequenceControlSet *sequence_control_set_ptr) {
+    const EbSvtAv1EncConfiguration *config = &sequence_control_set_ptr->static_config;
+    const uint32_t sb_size = config->super_block_size;
+    const uint32_t sb_cols = (sequence_control_set_ptr->max_input_luma_width + sb_size - 1) / sb_size;
+    const uint32_t sb_rows = (sequence_control_set_ptr->max_input_luma_height + sb_size - 1) / sb_size;
+    uint32_t log2_tile_cols = config->tile_columns;
+    while (((uint32_t)MAX_TILE_WIDTH << log2_tile_cols) < sb_cols * sb_size)
+        ++log2_tile_cols;
+    return (uint16_t)(MIN(1u << log2_tile_cols, MIN(sb_cols, MAX_TILE_COLS)) *
+        MIN(1u << config->tile_rows, MIN(sb_rows, MAX_TILE_ROWS)));
+}
+
+/* Estimated memory taken by the pools and contexts created at init for the
+   pool counts set in the sequence control set */
+static uint64_t estimate_memory_footprint(SequenceControlSet *sequence_control_set_ptr) {
+    const EbSvtAv1EncConfiguration *config = &sequence_control_set_ptr->static_config;
+    const uint64_t width = sequence_control_set_ptr->max_input_luma_width;
+    const uint64_t height = sequence_control_set_ptr->max_input_luma_height;
+    const uint64_t samples = ((width + 63) & ~63) * ((height + 63) & ~63);
+    const EbBool is16bit = (EbBool)(config->encoder_bit_depth > EB_8BIT);
+    const uint64_t ppcs = PPCS_FIXED_BYTES + samples * (PPCS_SAMPLE_TENTHS +
+        (sequence_control_set_ptr->nsq_present ? PPCS_NSQ_SAMPLE_TENTHS : 0) +
+        (sequence_control_set_ptr->mrp_mode ? 0 : PPCS_MRP_OFF_SAMPLE_TENTHS)) / 10;
+    const uint64_t child = CHILD_PCS_FIXED_BYTES + samples *
+        (sequence_control_set_ptr->cdf_mode ? CHILD_PCS_CDF_MODE_SAMPLE_BYTES : CHILD_PCS_SAMPLE_BYTES) +
+        (uint64_t)CHILD_PCS_TILE_BYTES * (max_tile_count(sequence_control_set_ptr) - 1);
+    // 10 bit references keep both the unpacked and the packed samples, and
+    // the final CDFs of the picture with frame end CDF update
+    const uint64_t reference = frame_bytes(width + 2 * PAD_VALUE, height + 2 * PAD_VALUE, config->encoder_color_format, EB_FALSE) *
+        (is16bit ? 3 : 1) + (config->frame_end_cdf_update ? sizeof(FRAME_CONTEXT) : 0);
+    const uint64_t pa_pad = 2 * (sequence_control_set_ptr->sb_sz + ME_FILTER_TAP);
+    // The half-pel planes are three luma planes of the padded PA picture
+    // The hash ME tables are only created for screen content pictures, they
+    // are counted when screen content is forced
+    const uint64_t pa_reference = ((samples * PA_REFERENCE_SAMPLE_QUARTERS / 4) << is16bit) +
+        (config->half_pel_planes ? 3 * (width + pa_pad) * (height + pa_pad) : 0) +
+        (config->screen_content_mode == 1 ? PA_REFERENCE_HASH_FIXED_BYTES + samples * PA_REFERENCE_HASH_SAMPLE_BYTES : 0);
+    const uint64_t input = (INPUT_FIXED_BYTES + samples * INPUT_SAMPLE_TENTHS / 10) << is16bit;
+    const uint64_t output = EB_OUTPUTSTREAMBUFFERSIZE_MACRO(width * height);
+    uint64_t footprint = CONTEXTS_FIXED_BYTES + samples * CONTEXTS_SAMPLE_BYTES +
+        (PROCESS_CONTEXT_FIXED_BYTES + samples * PROCESS_CONTEXT_SAMPLE_BYTES) * sequence_control_set_ptr->total_process_init_count;
+
+    footprint += ppcs * sequence_control_set_ptr->picture_control_set_pool_init_count;
+    footprint += child * sequence_control_set_ptr->picture_control_set_pool_init_count_child;
+    footprint += reference * sequence_control_set_ptr->reference_picture_buffer_init_count;
+    footprint += pa_reference * sequence_control_set_ptr->pa_reference_picture_buffer_init_count;
+    footprint += input * sequence_control_set_ptr->input_buffer_fifo_init_count;
+    footprint += output * sequence_control_set_ptr->output_stream_buffer_fifo_init_count;
+    if (config->enable_overlays)
+        footprint += input * sequence_control_set_ptr->overlay_input_picture_buffer_init_count;
+    if (config->recon_enabled)
+        footprint += frame_bytes(width, height, config->encoder_color_format, is16bit) *
+            sequence_control_set_ptr->output_recon_buffer_fifo_init_count;
+    // The MD winners kept for the encode pass, per EncDec context
+    if (config->reuse_md_recon && !is16bit)
+        footprint += (uint64_t)MD_BLK_RECON_CONTEXT_BYTES * sequence_control_set_ptr->enc_dec_process_init_count;
+    return footprint;
+}
+
+/* Sets the picture pool counts for input_pic pictures in flight and
+   child_count child picture control sets */
+static void set_picture_pool_counts(
+    SequenceControlSet *sequence_control_set_ptr,
+    uint32_t            input_pic,
+    uint32_t            child_count) {
+    const uint32_t hierarchical_levels = sequence_control_set_ptr->static_config.hierarchical_levels;
+    const uint32_t look_ahead_distance = sequence_control_set_ptr->static_config.look_ahead_distance;
+
+    sequence_control_set_ptr->input_buffer_fifo_init_count = input_pic + SCD_LAD + look_ahead_distance;
+    sequence_control_set_ptr->output_stream_buffer_fifo_init_count =
+        sequence_control_set_ptr->input_buffer_fifo_init_count + 4;
+
+    sequence_control_set_ptr->picture_control_set_pool_init_count       = input_pic + SCD_LAD + look_ahead_distance;
+    if (sequence_control_set_ptr->static_config.enable_overlays)
+        sequence_control_set_ptr->picture_control_set_pool_init_count = MAX(sequence_control_set_ptr->picture_control_set_pool_init_count,
+            look_ahead_distance + // frames in the LAD
+            look_ahead_distance / (1 << hierarchical_levels) + 1 +  // number of overlayes in the LAD
+            ((1 << hierarchical_levels) + SCD_LAD) * 2 +// minigop formation in PD + SCD_LAD *(normal pictures + potential pictures )
+            (1 << hierarchical_levels)); // minigop in PM
+    sequence_control_set_ptr->picture_control_set_pool_init_count_child = child_count;
+    sequence_control_set_ptr->reference_picture_buffer_init_count       = MAX((uint32_t)(input_pic >> 1),
+                                                                          (uint32_t)((1 << hierarchical_levels) + 2)) +
+                                                                          look_ahead_distance + SCD_LAD;
+    sequence_control_set_ptr->pa_reference_picture_buffer_init_count    = MAX((uint32_t)(input_pic >> 1),
+                                                                          (uint32_t)((1 << hierarchical_levels) + 2)) +
+                                                                          look_ahead_distance + SCD_LAD;
+    sequence_control_set_ptr->output_recon_buffer_fifo_init_count       = sequence_control_set_ptr->reference_picture_buffer_init_count;
+    sequence_control_set_ptr->overlay_input_picture_buffer_init_count   = sequence_control_set_ptr->static_config.enable_overlays ?
+                                                                          (2 << hierarchical_levels) + SCD_LAD : 1;
+}
+
+/* A pooled task waiting for an empty object holds a worker that the
+   consumers of the fifo may need, so the fifos posted by the pooled stages
+   hold every object the pictures in flight can post: one per picture, one
+   per segment or one per SB row of the child pictures */
+static void set_task_pool_fifo_counts(
+    SequenceControlSet *sequence_control_set_ptr) {
+    const uint32_t parent_count = sequence_control_set_ptr->picture_control_set_pool_init_count;
+    const uint32_t child_count = sequence_control_set_ptr->picture_control_set_pool_init_count_child;
+    const uint32_t sb_row_count = (sequence_control_set_ptr->max_input_luma_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64;
+    uint32_t enc_dec_segment_row_count = 0;
+
+    for (uint32_t i = 0; i < MAX_TEMPORAL_LAYERS; ++i)
+        enc_dec_segment_row_count = MAX(enc_dec_segment_row_count, sequence_control_set_ptr->enc_dec_segment_row_count_array[i]);
+
+    // Picture Analysis, and Source Based Operations with Rest to the Picture Manager
+    sequence_control_set_ptr->picture_analysis_fifo_init_count = MAX(sequence_control_set_ptr->picture_analysis_fifo_init_count,
+        parent_count);
+    sequence_control_set_ptr->picture_demux_fifo_init_count = MAX(sequence_control_set_ptr->picture_demux_fifo_init_count,
+        parent_count + child_count);
+    // MDC and the EncDec segment rows
+    sequence_control_set_ptr->mode_decision_configuration_fifo_init_count = MAX(sequence_control_set_ptr->mode_decision_configuration_fifo_init_count,
+        child_count * (1 + enc_dec_segment_row_count));
+    sequence_control_set_ptr->enc_dec_fifo_init_count = MAX(sequence_control_set_ptr->enc_dec_fifo_init_count,
+        child_count);
+    sequence_control_set_ptr->dlf_fifo_init_count = MAX(sequence_control_set_ptr->dlf_fifo_init_count,
+        child_count * sequence_control_set_ptr->cdef_segment_column_count * sequence_control_set_ptr->cdef_segment_row_count);
+    sequence_control_set_ptr->cdef_fifo_init_count = MAX(sequence_control_set_ptr->cdef_fifo_init_count,
+        child_count * sequence_control_set_ptr->rest_segment_column_count * sequence_control_set_ptr->rest_segment_row_count);
+    sequence_control_set_ptr->rest_fifo_init_count = MAX(sequence_control_set_ptr->rest_fifo_init_count,
+        child_count);
+    sequence_control_set_ptr->entropy_coding_fifo_init_count = MAX(sequence_control_set_ptr->entropy_coding_fifo_init_count,
+        child_count);
+    // Entropy coding row feedback, with the Picture Manager and Packetization tasks
+    sequence_control_set_ptr->rate_control_tasks_fifo_init_count = MAX(sequence_control_set_ptr->rate_control_tasks_fifo_init_count,
+        child_count * (sb_row_count + 1) + parent_count);
+}
+
+/* Sizes the picture pools to fit the memory budget: starts from the fewest
+   pictures in flight that still let a whole mini GOP plus the look ahead
+   build up and a single child picture control set, then grows both back
+   toward the default counts while the estimated footprint fits */
+static void fit_picture_pools_to_budget(
+    SequenceControlSet *sequence_control_set_ptr,
+    uint32_t            default_input_pic,
+    uint32_t            default_child_count) {
+    const uint64_t budget = (uint64_t)sequence_control_set_ptr->static_config.memory_budget << 20;
+    uint32_t input_pic = MIN((uint32_t)(2 << sequence_control_set_ptr->static_config.hierarchical_levels) + 1, default_input_pic);
+    uint32_t child_count = 1;
+
+    set_picture_pool_counts(sequence_control_set_ptr, input_pic, child_count);
+    if (estimate_memory_footprint(sequence_control_set_ptr) > budget) {
+        SVT_LOG("SVT [Warning]: memory budget of %u MB is below what the smallest pools need\n",
+            sequence_control_set_ptr->static_config.memory_budget);
+        return;
+    }
+    while (input_pic < default_input_pic || child_count < default_child_count) {
+        const uint32_t next_input_pic = MIN(input_pic + 1, default_input_pic);
+        const uint32_t next_child_count = input_pic < default_input_pic ? child_count : child_count + 1;
+        set_picture_pool_counts(sequence_control_set_ptr, next_input_pic, next_child_count);
+        if (estimate_memory_footprint(sequence_control_set_ptr) > budget)
+            break;
+        input_pic = next_input_pic;
+        child_count = next_child_count;
+    }
+    set_picture_pool_counts(sequence_control_set_ptr, input_pic, child_count);
+}
+
 EbErrorType load_default_buffer_configuration_settings(
     SequenceControlSet       *sequence_control_set_ptr){
     EbErrorType           return_error = EB_ErrorNone;
@@ -461,9 +622,6 @@ EbErrorType load_default_buffer_configuration_settings(
     if (return_ppcs == -1)
         return EB_ErrorInsufficientResources;
     uint32_t input_pic = (uint32_t)return_ppcs;
-    sequence_control_set_ptr->input_buffer_fifo_init_count = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
-    sequence_control_set_ptr->output_stream_buffer_fifo_init_count =
-        sequence_control_set_ptr->input_buffer_fifo_init_count + 4;
 
     // ME segments
     sequence_control_set_ptr->me_segment_row_count_array[0] = meSegH;
@@ -508,25 +666,6 @@ EbErrorType load_default_buffer_configuration_settings(
 
     sequence_control_set_ptr->tf_segment_column_count = meSegW;//1;//
     sequence_control_set_ptr->tf_segment_row_count =  meSegH;//1;//
-    //#====================== Data Structures and Picture Buffers ======================
-    sequence_control_set_ptr->picture_control_set_pool_init_count       = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
-    if (sequence_control_set_ptr->static_config.enable_overlays)
-        sequence_control_set_ptr->picture_control_set_pool_init_count = MAX(sequence_control_set_ptr->picture_control_set_pool_init_count,
-            sequence_control_set_ptr->static_config.look_ahead_distance + // frames in the LAD
-            sequence_control_set_ptr->static_config.look_ahead_distance / (1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 1 +  // number of overlayes in the LAD
-            ((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD) * 2 +// minigop formation in PD + SCD_LAD *(normal pictures + potential pictures )
-            (1 << sequence_control_set_ptr->static_config.hierarchical_levels)); // minigop in PM
-    sequence_control_set_ptr->picture_control_set_pool_init_count_child = MAX(MAX(MIN(3, core_count/2), core_count / 6), 1);
-    sequence_control_set_ptr->reference_picture_buffer_init_count       = MAX((uint32_t)(input_pic >> 1),
-                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
-                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
-    sequence_control_set_ptr->pa_reference_picture_buffer_init_count    = MAX((uint32_t)(input_pic >> 1),
-                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
-                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
-    sequence_control_set_ptr->output_recon_buffer_fifo_init_count       = sequence_control_set_ptr->reference_picture_buffer_init_count;
-    sequence_control_set_ptr->overlay_input_picture_buffer_init_count   = sequence_control_set_ptr->static_config.enable_overlays ?
-                                                                          (2 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD : 1;
-
     //#====================== Inter process Fifos ======================
     sequence_control_set_ptr->resource_coordination_fifo_init_count       = 300;
     sequence_control_set_ptr->picture_analysis_fifo_init_count            = 300;
@@ -544,7 +683,19 @@ EbErrorType load_default_buffer_configuration_settings(
     sequence_control_set_ptr->rest_fifo_init_count                        = 300;
     //#====================== Processes number ======================
     sequence_control_set_ptr->total_process_init_count                    = 0;
-    if (core_count > 1){
+    if (sequence_control_set_ptr->static_config.task_pool) {
+        // One context per pool worker for each stage run on the task pool,
+        // ME waits on the ME of its references so it keeps its threads
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count            = core_count);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count           = MAX(MIN(20, core_count >> 1), core_count / 3));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count     = core_count);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->mode_decision_configuration_process_init_count = core_count);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->enc_dec_process_init_count                     = core_count);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->entropy_coding_process_init_count              = core_count);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->dlf_process_init_count                         = core_count);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->cdef_process_init_count                        = core_count);
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->rest_process_init_count                        = core_count);
+    }else if (core_count > 1){
         sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count            = MAX(MIN(15, core_count >> 1), core_count / 6));
         sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count =  MAX(MIN(20, core_count >> 1), core_count / 3));//1);//
         sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count     = MAX(MIN(3, core_count >> 1), core_count / 12));
@@ -567,7 +718,17 @@ EbErrorType load_default_buffer_configuration_settings(
     }
 
     sequence_control_set_ptr->total_process_init_count += 6; // single processes count
+
+    //#====================== Data Structures and Picture Buffers ======================
+    uint32_t child_count = MAX(MAX(MIN(3, core_count/2), core_count / 6), 1);
+    if (sequence_control_set_ptr->static_config.memory_budget)
+        fit_picture_pools_to_budget(sequence_control_set_ptr, input_pic, child_count);
+    else
+        set_picture_pool_counts(sequence_control_set_ptr, input_pic, child_count);
+    if (sequence_control_set_ptr->static_config.task_pool)
+        set_task_pool_fifo_counts(sequence_control_set_ptr);
     printf("Number of logical cores available: %u\nNumber of PPCS %u\n", core_count, sequence_control_set_ptr->picture_control_set_pool_init_count);
+    printf("Estimated memory footprint: %u MB\n", (uint32_t)(estimate_memory_footprint(sequence_control_set_ptr) >> 20));
 
     return return_error;
 }
@@ -687,7 +848,52 @@ static void eb_enc_handle_stop_threads(EbEncHandle *enc_handle_ptr)
 
     // Packetization
     EB_DESTROY_THREAD(enc_handle_ptr->packetization_thread_handle);
+
+    // Task Pool
+    EB_DELETE(enc_handle_ptr->task_scheduler_ptr);
+}
+/*********************************
+* Report the ME statistics of every encode instance
+*********************************/
+static void print_me_statistics(EbEncHandle *enc_handle_ptr)
+{
+    uint32_t instance_index;
+
+    if (enc_handle_ptr->sequence_control_set_instance_array == NULL)
+        return;
+    for (instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; ++instance_index) {
+        EbSequenceControlSetInstance *instance_ptr = enc_handle_ptr->sequence_control_set_instance_array[instance_index];
+        if (instance_ptr && instance_ptr->encode_context_ptr && instance_ptr->encode_context_ptr->hme_level0_eligible_count) {
+            const EncodeContext *encode_context_ptr = instance_ptr->encode_context_ptr;
+            SVT_LOG("SVT [info]: HME level 0 skipped for %llu of %llu SB searches (%.1f%%)\n",
+                (unsigned long long)encode_context_ptr->hme_level0_skip_count,
+                (unsigned long long)encode_context_ptr->hme_level0_eligible_count,
+                100.0 * encode_context_ptr->hme_level0_skip_count / encode_context_ptr->hme_level0_eligible_count);
+        }
+    }
+}
+/*********************************
+* Report the RDOQ cache hit rate of every encode instance (stat_report only)
+*********************************/
+static void print_md_statistics(EbEncHandle *enc_handle_ptr)
+{
+    uint32_t instance_index;
+
+    if (enc_handle_ptr->sequence_control_set_instance_array == NULL)
+        return;
+    for (instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; ++instance_index) {
+        EbSequenceControlSetInstance *instance_ptr = enc_handle_ptr->sequence_control_set_instance_array[instance_index];
+        if (instance_ptr && instance_ptr->sequence_control_set_ptr && instance_ptr->sequence_control_set_ptr->static_config.stat_report &&
+            instance_ptr->encode_context_ptr && instance_ptr->encode_context_ptr->rdoq_cache_lookup_count) {
+            const EncodeContext *encode_context_ptr = instance_ptr->encode_context_ptr;
+            SVT_LOG("SVT [info]: RDOQ cache hit for %llu of %llu transform blocks (%.1f%%)\n",
+                (unsigned long long)encode_context_ptr->rdoq_cache_hit_count,
+                (unsigned long long)encode_context_ptr->rdoq_cache_lookup_count,
+                100.0 * encode_context_ptr->rdoq_cache_hit_count / encode_context_ptr->rdoq_cache_lookup_count);
+        }
+    }
 }
+
 /**********************************
 * Encoder Library Handle Deonstructor
 **********************************/
@@ -696,6 +902,8 @@ static void eb_enc_handle_dctor(EbPtr p)
     EbEncHandle *enc_handle_ptr = (EbEncHandle *)p;
 
     eb_enc_handle_stop_threads(enc_handle_ptr);
+    print_me_statistics(enc_handle_ptr);
+    print_md_statistics(enc_handle_ptr);
     EB_FREE_PTR_ARRAY(enc_handle_ptr->app_callback_ptr_array, enc_handle_ptr->encode_instance_total_count);
     EB_DELETE(enc_handle_ptr->sequence_control_set_pool_ptr);
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->picture_parent_control_set_pool_ptr_array, enc_handle_ptr->encode_instance_total_count);
@@ -749,6 +957,8 @@ static void eb_enc_handle_dctor(EbPtr p)
     EB_FREE_ARRAY(enc_handle_ptr->output_recon_buffer_producer_fifo_ptr_dbl_array);
     EB_FREE_ARRAY(enc_handle_ptr->output_recon_buffer_consumer_fifo_ptr_dbl_array);
 
+    // Every object built by eb_init_encoder is gone, drop their memory at once
+    eb_arena_destroy(enc_handle_ptr->arena);
 }
 
 /**********************************
@@ -796,6 +1006,9 @@ EbErrorType EbOutputBufferHeaderCreator(
     EbPtr objectInitDataPtr);
 
 void EbInputBufferHeaderDestoryer(    EbPtr p);
+static void EbInputBufferHeaderRelease(
+    EbPtr            release_context_ptr,
+    EbObjectWrapper *wrapper_ptr);
 void EbOutputReconBufferHeaderDestoryer(    EbPtr p);
 void EbOutputBufferHeaderDestoryer(    EbPtr p);
 
@@ -872,15 +1085,10 @@ EbErrorType RestResultsCreator(
 void init_fn_ptr(void);
 
 /**********************************
-* Initialize Encoder Library
+* Build the encoder pipeline
 **********************************/
-#if defined(__linux__) || defined(__APPLE__)
-__attribute__((visibility("default")))
-#endif
-EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
+static EbErrorType init_encoder_objects(EbComponentType *svt_enc_component)
 {
-    if(svt_enc_component == NULL)
-        return EB_ErrorBadParameter;
     EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
     EbErrorType return_error = EB_ErrorNone;
     uint32_t instance_index;
@@ -1009,6 +1217,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         inputData.color_format = color_format;
         inputData.sb_sz = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->sb_sz;
         inputData.sb_size_pix = scs_init.sb_size;
+        inputData.tile_count = max_tile_count(enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr);
         inputData.max_depth = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->max_sb_depth;
         inputData.hbd_mode_decision = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.enable_hbd_mode_decision;
         inputData.cdf_mode = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->cdf_mode;
@@ -1072,6 +1281,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             referencePictureBufferDescInitData.bit_depth = EB_10BIT;
 
         EbReferenceObjectDescInitDataStructure.reference_picture_desc_init_data = referencePictureBufferDescInitData;
+        EbReferenceObjectDescInitDataStructure.frame_end_cdf_update = (EbBool)enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.frame_end_cdf_update;
 
         // Reference Picture Buffers
         EB_NEW(
@@ -1126,6 +1336,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EbPaReferenceObjectDescInitDataStructure.reference_picture_desc_init_data = referencePictureBufferDescInitData;
         EbPaReferenceObjectDescInitDataStructure.quarter_picture_desc_init_data = quarterPictureBufferDescInitData;
         EbPaReferenceObjectDescInitDataStructure.sixteenth_picture_desc_init_data = sixteenthPictureBufferDescInitData;
+        EbPaReferenceObjectDescInitDataStructure.half_pel_planes = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.half_pel_planes;
+        EbPaReferenceObjectDescInitDataStructure.hash_me = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.screen_content_mode != 0;
         // Reference Picture Buffers
         EB_NEW(enc_handle_ptr->pa_reference_picture_pool_ptr_array[instance_index],
             eb_system_resource_ctor,
@@ -1178,6 +1390,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EbInputBufferHeaderCreator,
         enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr,
         EbInputBufferHeaderDestoryer);
+    // Hands the pictures sent in place back to the application
+    enc_handle_ptr->input_buffer_resource_ptr->release_callback = EbInputBufferHeaderRelease;
+    enc_handle_ptr->input_buffer_resource_ptr->release_context_ptr = enc_handle_ptr;
 
     // EbBufferHeaderType Output Stream
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->output_stream_buffer_resource_ptr_array, enc_handle_ptr->encode_instance_total_count);
@@ -1629,6 +1844,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             is16bit,
             color_format,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.enable_hbd_mode_decision,
+            enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.reuse_md_recon,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_width,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_height
         );
@@ -1713,62 +1929,94 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
 
     // Resource Coordination
     EB_CREATE_THREAD(enc_handle_ptr->resource_coordination_thread_handle, resource_coordination_kernel, enc_handle_ptr->resource_coordination_context_ptr);
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->picture_analysis_thread_handle_array,control_set_ptr->picture_analysis_process_init_count,
-        picture_analysis_kernel,
-        enc_handle_ptr->picture_analysis_context_ptr_array);
 
     // Picture Decision
     EB_CREATE_THREAD(enc_handle_ptr->picture_decision_thread_handle, picture_decision_kernel, enc_handle_ptr->picture_decision_context_ptr);
 
-    // Motion Estimation
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->motion_estimation_thread_handle_array, control_set_ptr->motion_estimation_process_init_count,
-        motion_estimation_kernel,
-        enc_handle_ptr->motion_estimation_context_ptr_array);
-
     // Initial Rate Control
     EB_CREATE_THREAD(enc_handle_ptr->initial_rate_control_thread_handle, initial_rate_control_kernel, enc_handle_ptr->initial_rate_control_context_ptr);
 
-    // Source Based Oprations
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->source_based_operations_thread_handle_array, control_set_ptr->source_based_operations_process_init_count,
-        source_based_operations_kernel,
-        enc_handle_ptr->source_based_operations_context_ptr_array);
-
     // Picture Manager
     EB_CREATE_THREAD(enc_handle_ptr->picture_manager_thread_handle, picture_manager_kernel, enc_handle_ptr->picture_manager_context_ptr);
 
     // Rate Control
     EB_CREATE_THREAD(enc_handle_ptr->rate_control_thread_handle, rate_control_kernel, enc_handle_ptr->rate_control_context_ptr);
 
-    // Mode Decision Configuration Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->mode_decision_configuration_thread_handle_array, control_set_ptr->mode_decision_configuration_process_init_count,
-        mode_decision_configuration_kernel,
-        enc_handle_ptr->mode_decision_configuration_context_ptr_array);
-
-
-    // EncDec Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->enc_dec_thread_handle_array, control_set_ptr->enc_dec_process_init_count,
-        enc_dec_kernel,
-        enc_handle_ptr->enc_dec_context_ptr_array);
-
-    // Dlf Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->dlf_thread_handle_array, control_set_ptr->dlf_process_init_count,
-        dlf_kernel,
-        enc_handle_ptr->dlf_context_ptr_array);
-
-    // Cdef Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->cdef_thread_handle_array, control_set_ptr->cdef_process_init_count,
-        cdef_kernel,
-        enc_handle_ptr->cdef_context_ptr_array);
-
-    // Rest Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count,
-        rest_kernel,
-        enc_handle_ptr->rest_context_ptr_array);
+    // Motion Estimation, on its own threads also with the task pool as it
+    // waits on the ME of the references
+    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->motion_estimation_thread_handle_array, control_set_ptr->motion_estimation_process_init_count,
+        motion_estimation_kernel,
+        enc_handle_ptr->motion_estimation_context_ptr_array);
 
-    // Entropy Coding Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->entropy_coding_thread_handle_array, control_set_ptr->entropy_coding_process_init_count,
-        entropy_coding_kernel,
-        enc_handle_ptr->entropy_coding_context_ptr_array);
+    if (config_ptr->task_pool) {
+        // Task Pool, one worker per logical processor; each other
+        // multi-threaded stage is fed by the full objects of its input resource
+        EB_NEW(
+            enc_handle_ptr->task_scheduler_ptr,
+            eb_task_scheduler_ctor,
+            control_set_ptr->enc_dec_process_init_count,
+            8);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->resource_coordination_results_resource_ptr,
+            picture_analysis_task, (EbPtr*)enc_handle_ptr->picture_analysis_context_ptr_array);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->initial_rate_control_results_resource_ptr,
+            source_based_operations_task, (EbPtr*)enc_handle_ptr->source_based_operations_context_ptr_array);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->rate_control_results_resource_ptr,
+            mode_decision_configuration_task, (EbPtr*)enc_handle_ptr->mode_decision_configuration_context_ptr_array);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->enc_dec_tasks_resource_ptr,
+            enc_dec_task, (EbPtr*)enc_handle_ptr->enc_dec_context_ptr_array);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->enc_dec_results_resource_ptr,
+            dlf_task, (EbPtr*)enc_handle_ptr->dlf_context_ptr_array);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->dlf_results_resource_ptr,
+            cdef_task, (EbPtr*)enc_handle_ptr->cdef_context_ptr_array);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->cdef_results_resource_ptr,
+            rest_task, (EbPtr*)enc_handle_ptr->rest_context_ptr_array);
+        eb_task_scheduler_add_stage(enc_handle_ptr->task_scheduler_ptr, enc_handle_ptr->rest_results_resource_ptr,
+            entropy_coding_task, (EbPtr*)enc_handle_ptr->entropy_coding_context_ptr_array);
+        return_error = eb_task_scheduler_start(enc_handle_ptr->task_scheduler_ptr);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
+    else {
+        // Picture Analysis
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->picture_analysis_thread_handle_array,control_set_ptr->picture_analysis_process_init_count,
+            picture_analysis_kernel,
+            enc_handle_ptr->picture_analysis_context_ptr_array);
+
+        // Source Based Oprations
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->source_based_operations_thread_handle_array, control_set_ptr->source_based_operations_process_init_count,
+            source_based_operations_kernel,
+            enc_handle_ptr->source_based_operations_context_ptr_array);
+
+        // Mode Decision Configuration Process
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->mode_decision_configuration_thread_handle_array, control_set_ptr->mode_decision_configuration_process_init_count,
+            mode_decision_configuration_kernel,
+            enc_handle_ptr->mode_decision_configuration_context_ptr_array);
+
+        // EncDec Process
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->enc_dec_thread_handle_array, control_set_ptr->enc_dec_process_init_count,
+            enc_dec_kernel,
+            enc_handle_ptr->enc_dec_context_ptr_array);
+
+        // Dlf Process
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->dlf_thread_handle_array, control_set_ptr->dlf_process_init_count,
+            dlf_kernel,
+            enc_handle_ptr->dlf_context_ptr_array);
+
+        // Cdef Process
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->cdef_thread_handle_array, control_set_ptr->cdef_process_init_count,
+            cdef_kernel,
+            enc_handle_ptr->cdef_context_ptr_array);
+
+        // Rest Process
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count,
+            rest_kernel,
+            enc_handle_ptr->rest_context_ptr_array);
+
+        // Entropy Coding Process
+        EB_CREATE_THREAD_ARRAY(enc_handle_ptr->entropy_coding_thread_handle_array, control_set_ptr->entropy_coding_process_init_count,
+            entropy_coding_kernel,
+            enc_handle_ptr->entropy_coding_context_ptr_array);
+    }
 
     // Packetization
     EB_CREATE_THREAD(enc_handle_ptr->packetization_thread_handle, packetization_kernel, enc_handle_ptr->packetization_context_ptr);
@@ -1781,6 +2029,38 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     return return_error;
 }
 
+/**********************************
+* Initialize Encoder Library
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
+{
+    if(svt_enc_component == NULL)
+        return EB_ErrorBadParameter;
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    EncodeContext *encode_context_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr;
+    EbArena *prev_arena;
+    EbErrorType return_error;
+
+    // Every rendition of a ladder joins before any of them is initialized:
+    // the leader would otherwise convert its motion for, and wait forever
+    // on, followers that are not there
+    if (encode_context_ptr->ladder && !eb_ladder_is_complete(encode_context_ptr->ladder))
+        return EB_ErrorBadParameter;
+
+    // The many small objects of the pipeline are carved from a per handle
+    // arena instead of the system heap, a failure to create it just leaves
+    // them to malloc
+    enc_handle_ptr->arena = eb_arena_create();
+    prev_arena = eb_arena_set_current(enc_handle_ptr->arena);
+    return_error = init_encoder_objects(svt_enc_component);
+    eb_arena_set_current(prev_arena);
+
+    return return_error;
+}
+
 /**********************************
 * DeInitialize Encoder Library
 **********************************/
@@ -1876,6 +2156,23 @@ EB_API EbErrorType eb_deinit_handle(
     return return_error;
 }
 
+/**********************************
+* eb_svt_ladder_destroy
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_ladder_destroy(
+    EbSvtLadder *ladder)
+{
+    if (ladder == NULL)
+        return EB_ErrorBadParameter;
+
+    EB_DELETE(ladder);
+    eb_decrease_component_count();
+    return EB_ErrorNone;
+}
+
 // Sets the default intra period the closest possible to 1 second without breaking the minigop
 static int32_t compute_default_intra_period(
     SequenceControlSet       *sequence_control_set_ptr){
@@ -2113,6 +2410,7 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.enable_hme_level2_flag = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_hme_level2_flag;
     sequence_control_set_ptr->static_config.search_area_width = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->search_area_width;
     sequence_control_set_ptr->static_config.search_area_height = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->search_area_height;
+    sequence_control_set_ptr->static_config.half_pel_planes = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->half_pel_planes;
     sequence_control_set_ptr->static_config.number_hme_search_region_in_width = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->number_hme_search_region_in_width;
     sequence_control_set_ptr->static_config.number_hme_search_region_in_height = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->number_hme_search_region_in_height;
     sequence_control_set_ptr->static_config.hme_level0_total_search_area_width = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->hme_level0_total_search_area_width;
@@ -2142,10 +2440,12 @@ void CopyApiFromApp(
     // MD Parameters
     sequence_control_set_ptr->static_config.enable_hbd_mode_decision = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->encoder_bit_depth > 8 ? ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_hbd_mode_decision : 0;
     sequence_control_set_ptr->static_config.constrained_intra = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->constrained_intra;
+    sequence_control_set_ptr->static_config.reuse_md_recon = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->reuse_md_recon;
 
     // Adaptive Loop Filter
     sequence_control_set_ptr->static_config.tile_rows = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->tile_rows;
     sequence_control_set_ptr->static_config.tile_columns = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->tile_columns;
+    sequence_control_set_ptr->static_config.frame_end_cdf_update = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->frame_end_cdf_update;
 
     // Rate Control
     sequence_control_set_ptr->static_config.scene_change_detection = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->scene_change_detection;
@@ -2206,6 +2506,8 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.active_channel_count = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->active_channel_count;
     sequence_control_set_ptr->static_config.logical_processors = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->logical_processors;
     sequence_control_set_ptr->static_config.target_socket = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->target_socket;
+    sequence_control_set_ptr->static_config.task_pool = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->task_pool;
+    sequence_control_set_ptr->static_config.memory_budget = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->memory_budget;
     sequence_control_set_ptr->qp = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->qp;
     sequence_control_set_ptr->static_config.recon_enabled = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->recon_enabled;
 
@@ -2396,6 +2698,11 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->half_pel_planes > 1) {
+        SVT_LOG("Error Instance %u: Invalid half_pel_planes. half_pel_planes must be [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->enable_hme_flag) {
         if ((config->number_hme_search_region_in_width > (uint32_t)EB_HME_SEARCH_AREA_COLUMN_MAX_COUNT) || (config->number_hme_search_region_in_width == 0)) {
             SVT_LOG("Error Instance %u: Invalid number_hme_search_region_in_width. number_hme_search_region_in_width must be [1 - %d]\n", channelNumber + 1, EB_HME_SEARCH_AREA_COLUMN_MAX_COUNT);
@@ -2452,6 +2759,10 @@ static EbErrorType VerifySettings(
         SVT_LOG("Error Instance %u: The constrained intra must be [0 - 1] \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
+    if (config->reuse_md_recon > 1) {
+        SVT_LOG("Error Instance %u: The reuse MD recon flag must be [0 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
     if (config->rate_control_mode > 3) {
         SVT_LOG("Error Instance %u: The rate control mode must be [0 - 3] \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
@@ -2473,6 +2784,10 @@ static EbErrorType VerifySettings(
         SVT_LOG("Error Instance %u: Log2Tile rows/cols must be [0 - 6] \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
+    if (config->frame_end_cdf_update > 1) {
+        SVT_LOG("Error Instance %u: Invalid frame_end_cdf_update flag [0 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
 
     if (config->scene_change_detection > 1) {
         SVT_LOG("Error Instance %u: The scene change detection must be [0 - 1] \n", channelNumber + 1);
@@ -2565,6 +2880,11 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->task_pool > 1) {
+        SVT_LOG("Error instance %u: Invalid task_pool flag [0 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     // alt-ref frames related
     if (config->altref_strength > ALTREF_MAX_STRENGTH ) {
         SVT_LOG("Error instance %u: invalid altref-strength, should be in the range [0 - %d] \n", channelNumber + 1, ALTREF_MAX_STRENGTH);
@@ -2604,6 +2924,7 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->stat_report = 0;
     config_ptr->tile_rows = 0;
     config_ptr->tile_columns = 0;
+    config_ptr->frame_end_cdf_update = 0;
 
     config_ptr->qp = 50;
     config_ptr->use_qp_file = EB_FALSE;
@@ -2630,6 +2951,7 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->enable_hme_level2_flag = EB_FALSE;
     config_ptr->search_area_width = 16;
     config_ptr->search_area_height = 7;
+    config_ptr->half_pel_planes = EB_FALSE;
     config_ptr->number_hme_search_region_in_width = 2;
     config_ptr->number_hme_search_region_in_height = 2;
     config_ptr->hme_level0_total_search_area_width = 64;
@@ -2647,6 +2969,7 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->hme_level2_search_area_in_height_array[0] = 1;
     config_ptr->hme_level2_search_area_in_height_array[1] = 1;
     config_ptr->constrained_intra = EB_FALSE;
+    config_ptr->reuse_md_recon = EB_FALSE;
     config_ptr->improve_sharpness = EB_FALSE;
 
     // Bitstream options
@@ -2678,6 +3001,8 @@ EbErrorType eb_svt_enc_init_parameter(
     // Channel info
     config_ptr->logical_processors = 0;
     config_ptr->target_socket = -1;
+    config_ptr->task_pool = 0;
+    config_ptr->memory_budget = 0;
     config_ptr->channel_id = 0;
     config_ptr->active_channel_count = 1;
 
@@ -2839,6 +3164,61 @@ EB_API EbErrorType eb_svt_enc_set_parameter(
 
     return return_error;
 }
+
+/**********************************
+* Ladder
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_ladder_create(
+    EbSvtLadder **ladder,
+    uint32_t      rendition_count)
+{
+    EbSvtLadder *ladder_ptr;
+
+    if (ladder == NULL || rendition_count == 0 || rendition_count > EB_MAX_LADDER_RENDITIONS)
+        return EB_ErrorBadParameter;
+
+    *ladder = NULL;
+    EB_NEW(ladder_ptr, eb_ladder_ctor, rendition_count);
+    *ladder = ladder_ptr;
+    eb_increase_component_count();
+
+    return EB_ErrorNone;
+}
+
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_join_ladder(
+    EbComponentType *svt_enc_component,
+    EbSvtLadder     *ladder,
+    uint32_t         rendition_index)
+{
+    if (svt_enc_component == NULL || ladder == NULL)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle          *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    SequenceControlSet   *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    EncodeContext        *encode_context_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr;
+    EbErrorType           return_error;
+
+    if (encode_context_ptr->ladder)
+        return EB_ErrorBadParameter;
+    return_error = eb_ladder_join(
+        ladder,
+        rendition_index,
+        sequence_control_set_ptr->seq_header.max_frame_width,
+        sequence_control_set_ptr->seq_header.max_frame_height,
+        sequence_control_set_ptr->sb_sz);
+    if (return_error != EB_ErrorNone)
+        return return_error;
+    encode_context_ptr->ladder = ladder;
+    encode_context_ptr->ladder_rendition_index = rendition_index;
+
+    return EB_ErrorNone;
+}
 #if defined(__linux__) || defined(__APPLE__)
 __attribute__((visibility("default")))
 #endif
@@ -3078,13 +3458,11 @@ static EbErrorType CopyFrameBuffer(
     }
     return return_error;
 }
-static void CopyInputBuffer(
-    SequenceControlSet*    sequenceControlSet,
+static void CopyInputBufferHeader(
     EbBufferHeaderType*     dst,
     EbBufferHeaderType*     src
 )
 {
-    // Copy the higher level structure
     dst->n_alloc_len = src->n_alloc_len;
     dst->n_filled_len = src->n_filled_len;
     dst->flags = src->flags;
@@ -3093,12 +3471,74 @@ static void CopyInputBuffer(
     dst->size = src->size;
     dst->qp = src->qp;
     dst->pic_type = src->pic_type;
+}
+static void CopyInputBuffer(
+    SequenceControlSet*    sequenceControlSet,
+    EbBufferHeaderType*     dst,
+    EbBufferHeaderType*     src
+)
+{
+    // Copy the higher level structure
+    CopyInputBufferHeader(dst, src);
 
     // Copy the picture buffer
     if (src->p_buffer != NULL)
         CopyFrameBuffer(sequenceControlSet, dst->p_buffer, src->p_buffer);
 }
 
+/***********************************************
+**** Layout of the input pictures: the one of
+**** the library input buffers (allocate_frame_buffer)
+************************************************/
+static void GetInputBufferRequirements(
+    SequenceControlSet          *sequence_control_set_ptr,
+    EbInputBufferRequirements   *requirements)
+{
+    const uint32_t subsampling_x = (sequence_control_set_ptr->static_config.encoder_color_format == EB_YUV444 ? 1 : 2) - 1;
+
+    requirements->width = sequence_control_set_ptr->max_input_luma_width;
+    requirements->height = sequence_control_set_ptr->max_input_luma_height;
+    requirements->left_padding = sequence_control_set_ptr->left_padding;
+    requirements->right_padding = sequence_control_set_ptr->right_padding;
+    requirements->top_padding = sequence_control_set_ptr->top_padding;
+    requirements->bottom_padding = sequence_control_set_ptr->bot_padding;
+    requirements->y_stride = requirements->left_padding + requirements->width + requirements->right_padding;
+    requirements->cb_stride = requirements->y_stride >> subsampling_x;
+    requirements->cr_stride = requirements->y_stride >> subsampling_x;
+    requirements->alignment = ALVALUE;
+    requirements->buffer_count = sequence_control_set_ptr->input_buffer_fifo_init_count;
+}
+
+/***********************************************
+**** Checks that a picture can be referenced in
+**** place: 8 bit, library strides and alignment
+************************************************/
+static EbBool IsInPlaceInput(
+    SequenceControlSet            *sequence_control_set_ptr,
+    EbSvtIOFormat                 *inputPtr)
+{
+    EbInputBufferRequirements requirements;
+    uint32_t lumaOffset, chromaOffset;
+
+    if (sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT)
+        return EB_FALSE;
+
+    GetInputBufferRequirements(sequence_control_set_ptr, &requirements);
+    if (inputPtr->y_stride != requirements.y_stride ||
+        inputPtr->cb_stride != requirements.cb_stride ||
+        inputPtr->cr_stride != requirements.cr_stride)
+        return EB_FALSE;
+
+    lumaOffset = requirements.y_stride * requirements.top_padding + requirements.left_padding;
+    chromaOffset = requirements.cb_stride * (requirements.top_padding >> 1) + (requirements.left_padding >> 1);
+    if (((uintptr_t)(inputPtr->luma - lumaOffset) % requirements.alignment) ||
+        ((uintptr_t)(inputPtr->cb - chromaOffset) % requirements.alignment) ||
+        ((uintptr_t)(inputPtr->cr - chromaOffset) % requirements.alignment))
+        return EB_FALSE;
+
+    return EB_TRUE;
+}
+
 /**********************************
 * Empty This Buffer
 **********************************/
@@ -3128,6 +3568,142 @@ EB_API EbErrorType eb_svt_enc_send_picture(
 
     return EB_ErrorNone;
 }
+
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_get_input_buffer_requirements(
+    EbComponentType             *svt_enc_component,
+    EbInputBufferRequirements   *requirements)
+{
+    if (svt_enc_component == NULL || requirements == NULL)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+
+    GetInputBufferRequirements(
+        enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr,
+        requirements);
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Empty This Buffer, without copy
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_send_picture_in_place(
+    EbComponentType         *svt_enc_component,
+    EbBufferHeaderType      *p_buffer,
+    EbInputReleaseCallback   release_callback,
+    void                    *release_context)
+{
+    if (svt_enc_component == NULL || p_buffer == NULL || p_buffer->p_buffer == NULL || release_callback == NULL)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle          *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    SequenceControlSet   *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    EbSvtIOFormat        *inputPtr = (EbSvtIOFormat*)p_buffer->p_buffer;
+    EbObjectWrapper      *ebWrapperPtr;
+    EbInputBufferHeader  *inputBuffer;
+    EbPictureBufferDesc  *input_picture_ptr;
+
+    if (!IsInPlaceInput(sequence_control_set_ptr, inputPtr)) {
+        EbErrorType return_error = eb_svt_enc_send_picture(svt_enc_component, p_buffer);
+        release_callback(release_context);
+        return return_error;
+    }
+
+    eb_get_empty_object(
+        enc_handle_ptr->input_buffer_producer_fifo_ptr_array[0],
+        &ebWrapperPtr);
+    inputBuffer = (EbInputBufferHeader*)ebWrapperPtr->object_ptr;
+    input_picture_ptr = (EbPictureBufferDesc*)inputBuffer->header.p_buffer;
+
+    CopyInputBufferHeader(&inputBuffer->header, p_buffer);
+
+    // Swap in the caller's planes, the library ones are restored on release
+    inputBuffer->release_callback = release_callback;
+    inputBuffer->release_context = release_context;
+    inputBuffer->buffer_y = input_picture_ptr->buffer_y;
+    inputBuffer->buffer_cb = input_picture_ptr->buffer_cb;
+    inputBuffer->buffer_cr = input_picture_ptr->buffer_cr;
+    input_picture_ptr->buffer_y = inputPtr->luma -
+        (input_picture_ptr->stride_y * sequence_control_set_ptr->top_padding + sequence_control_set_ptr->left_padding);
+    input_picture_ptr->buffer_cb = inputPtr->cb -
+        (input_picture_ptr->stride_cb * (sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1));
+    input_picture_ptr->buffer_cr = inputPtr->cr -
+        (input_picture_ptr->stride_cr * (sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1));
+
+    eb_post_full_object(ebWrapperPtr);
+
+    return EB_ErrorNone;
+}
+/***********************************************
+**** Checks the motion sent with a picture
+************************************************/
+static EbBool IsValidMotionField(
+    const EbSvtMotionField   *motion_field)
+{
+    uint32_t ref_index;
+
+    if (motion_field->width == 0 || motion_field->height == 0 ||
+        motion_field->ref_count > EB_MAX_MOTION_FIELD_REFS)
+        return EB_FALSE;
+    if (motion_field->block_size != 8 && motion_field->block_size != 16 &&
+        motion_field->block_size != 32 && motion_field->block_size != 64)
+        return EB_FALSE;
+    if (motion_field->stride < (motion_field->width + motion_field->block_size - 1) / motion_field->block_size)
+        return EB_FALSE;
+    for (ref_index = 0; ref_index < motion_field->ref_count; ref_index++) {
+        if (motion_field->mv[ref_index] == NULL || motion_field->ref_distance[ref_index] == 0)
+            return EB_FALSE;
+    }
+    return EB_TRUE;
+}
+
+/**********************************
+* Empty This Buffer, with motion
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_send_picture_with_motion(
+    EbComponentType          *svt_enc_component,
+    EbBufferHeaderType       *p_buffer,
+    const EbSvtMotionField   *motion_field)
+{
+    if (svt_enc_component == NULL || p_buffer == NULL || motion_field == NULL ||
+        !IsValidMotionField(motion_field))
+        return EB_ErrorBadParameter;
+
+    EbEncHandle          *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    SequenceControlSet   *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    EbObjectWrapper      *ebWrapperPtr;
+    EbInputBufferHeader  *inputBuffer;
+
+    eb_get_empty_object(
+        enc_handle_ptr->input_buffer_producer_fifo_ptr_array[0],
+        &ebWrapperPtr);
+    inputBuffer = (EbInputBufferHeader*)ebWrapperPtr->object_ptr;
+
+    CopyInputBuffer(
+        sequence_control_set_ptr,
+        &inputBuffer->header,
+        p_buffer);
+    eb_convert_motion_field(
+        &inputBuffer->motion_field,
+        motion_field,
+        sequence_control_set_ptr->seq_header.max_frame_width,
+        sequence_control_set_ptr->seq_header.max_frame_height,
+        sequence_control_set_ptr->sb_sz);
+
+    eb_post_full_object(ebWrapperPtr);
+
+    return EB_ErrorNone;
+}
 static void CopyOutputReconBuffer(
     EbBufferHeaderType   *dst,
     EbBufferHeaderType   *src
@@ -3352,31 +3928,76 @@ EbErrorType EbInputBufferHeaderCreator(
     EbPtr *objectDblPtr,
     EbPtr  objectInitDataPtr)
 {
-    EbBufferHeaderType* inputBuffer;
+    EbInputBufferHeader* inputBuffer;
     SequenceControlSet        *sequence_control_set_ptr = (SequenceControlSet*)objectInitDataPtr;
 
     *objectDblPtr = NULL;
-    EB_CALLOC(inputBuffer, 1, sizeof(EbBufferHeaderType));
+    EB_CALLOC(inputBuffer, 1, sizeof(EbInputBufferHeader));
     *objectDblPtr = (EbPtr)inputBuffer;
     // Initialize Header
-    inputBuffer->size = sizeof(EbBufferHeaderType);
+    inputBuffer->header.size = sizeof(EbBufferHeaderType);
 
     allocate_frame_buffer(
         sequence_control_set_ptr,
-        inputBuffer);
+        &inputBuffer->header);
 
-    inputBuffer->p_app_private = NULL;
+    inputBuffer->header.p_app_private = NULL;
+
+    // Motion sent with the picture, see eb_convert_motion_field()
+    {
+        const uint32_t sb_sz = sequence_control_set_ptr->sb_sz;
+        const uint32_t sb_count =
+            ((sequence_control_set_ptr->seq_header.max_frame_width + sb_sz - 1) / sb_sz) *
+            ((sequence_control_set_ptr->seq_header.max_frame_height + sb_sz - 1) / sb_sz);
+        uint32_t ref_index;
+        EB_MALLOC_ARRAY(inputBuffer->motion_field.sb_mv[0], sb_count * EB_MAX_MOTION_FIELD_REFS);
+        for (ref_index = 1; ref_index < EB_MAX_MOTION_FIELD_REFS; ref_index++)
+            inputBuffer->motion_field.sb_mv[ref_index] = inputBuffer->motion_field.sb_mv[0] + ref_index * sb_count;
+    }
 
     return EB_ErrorNone;
 }
 
+/**************************************
+* Returns a picture sent in place to the
+* application, once it is no longer used
+**************************************/
+static void EbInputBufferHeaderRelease(
+    EbPtr            release_context_ptr,
+    EbObjectWrapper *wrapper_ptr)
+{
+    EbInputBufferHeader *inputBuffer = (EbInputBufferHeader*)wrapper_ptr->object_ptr;
+    EbPictureBufferDesc *buf = (EbPictureBufferDesc*)inputBuffer->header.p_buffer;
+    EbInputReleaseCallback release_callback = inputBuffer->release_callback;
+    (void)release_context_ptr;
+
+    inputBuffer->motion_field.valid = EB_FALSE;
+    if (release_callback == NULL)
+        return;
+
+    buf->buffer_y = inputBuffer->buffer_y;
+    buf->buffer_cb = inputBuffer->buffer_cb;
+    buf->buffer_cr = inputBuffer->buffer_cr;
+    inputBuffer->release_callback = NULL;
+
+    release_callback(inputBuffer->release_context);
+}
+
 void EbInputBufferHeaderDestoryer(    EbPtr p)
 {
-    EbBufferHeaderType *obj = (EbBufferHeaderType*)p;
+    EbInputBufferHeader *inputBuffer = (EbInputBufferHeader*)p;
+    EbBufferHeaderType *obj = &inputBuffer->header;
     EbPictureBufferDesc* buf = (EbPictureBufferDesc*)obj->p_buffer;
+    EbObjectWrapper wrapper;
+
+    // A picture still held at deinit time goes back to the application
+    wrapper.object_ptr = inputBuffer;
+    EbInputBufferHeaderRelease(NULL, &wrapper);
+
     EB_FREE_ALIGNED_ARRAY(buf->buffer_bit_inc_y);
     EB_FREE_ALIGNED_ARRAY(buf->buffer_bit_inc_cb);
     EB_FREE_ALIGNED_ARRAY(buf->buffer_bit_inc_cr);
+    EB_FREE_ARRAY(inputBuffer->motion_field.sb_mv[0]);
 
     EB_DELETE(buf);
     EB_FREE(obj);
@@ -29,7 +29,9 @@
 #include "EbRestProcess.h"
 #include "EbEntropyCodingProcess.h"
 #include "EbPacketizationProcess.h"
+#include "EbTaskScheduler.h"
 #include "EbObject.h"
+#include "EbArena.h"
 
 /**************************************
  * Component Private Data
@@ -92,6 +94,12 @@ typedef struct EbEncHandle
 
     EbHandle                               packetization_thread_handle;
 
+    // Task pool running the multi-threaded stages when task_pool is set
+    EbTaskScheduler                       *task_scheduler_ptr;
+
+    // Serves the allocations of eb_init_encoder, released with the handle
+    EbArena                               *arena;
+
     // Contexts
     ResourceCoordinationContext            *resource_coordination_context_ptr;
     PictureAnalysisContext                 **picture_analysis_context_ptr_array;
@@ -0,0 +1,250 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+
+#include "EbTaskScheduler.h"
+#include "EbThreads.h"
+
+#ifdef _WIN32
+#define EB_THREAD_LOCAL __declspec(thread)
+#else
+#define EB_THREAD_LOCAL __thread
+#endif
+
+// Worker running on the calling thread, NULL outside of the pool
+static EB_THREAD_LOCAL EbTaskWorker *current_worker_ptr = NULL;
+
+/**************************************
+ * EbTaskDequePush
+ *   Queues a task as the newest entry.
+ **************************************/
+static void EbTaskDequePush(
+    EbTaskScheduler *scheduler_ptr,
+    EbTaskDeque     *deque_ptr,
+    EbTask           task)
+{
+    eb_block_on_mutex(deque_ptr->lockout_mutex);
+    deque_ptr->task_array[deque_ptr->tail & scheduler_ptr->task_mask] = task;
+    deque_ptr->tail++;
+    eb_release_mutex(deque_ptr->lockout_mutex);
+}
+
+/**************************************
+ * EbTaskDequePop
+ *   Removes the newest (newest == EB_TRUE)
+ *   or the oldest task of the deque.
+ **************************************/
+static EbBool EbTaskDequePop(
+    EbTaskScheduler *scheduler_ptr,
+    EbTaskDeque     *deque_ptr,
+    EbBool           newest,
+    EbTask          *task_ptr)
+{
+    EbBool found = EB_FALSE;
+
+    // Unlocked peek to avoid contending on empty deques
+    if (deque_ptr->head == deque_ptr->tail)
+        return EB_FALSE;
+
+    eb_block_on_mutex(deque_ptr->lockout_mutex);
+    if (deque_ptr->head != deque_ptr->tail) {
+        if (newest) {
+            deque_ptr->tail--;
+            *task_ptr = deque_ptr->task_array[deque_ptr->tail & scheduler_ptr->task_mask];
+        }
+        else {
+            *task_ptr = deque_ptr->task_array[deque_ptr->head & scheduler_ptr->task_mask];
+            deque_ptr->head++;
+        }
+        found = EB_TRUE;
+    }
+    eb_release_mutex(deque_ptr->lockout_mutex);
+
+    return found;
+}
+
+/**************************************
+ * eb_task_scheduler_post
+ *   EbPostCallback of the registered
+ *   resources. Tasks posted by a worker go
+ *   to its own deque so that follow-up work
+ *   (e.g. the next EncDec segment) stays on
+ *   the same core.
+ **************************************/
+static void eb_task_scheduler_post(
+    EbPtr            post_context_ptr,
+    EbObjectWrapper *wrapper_ptr)
+{
+    EbTaskStage     *stage_ptr = (EbTaskStage*)post_context_ptr;
+    EbTaskScheduler *scheduler_ptr = stage_ptr->scheduler_ptr;
+    EbTaskWorker    *worker_ptr = current_worker_ptr;
+    EbTask           task;
+
+    task.stage_ptr = stage_ptr;
+    task.wrapper_ptr = wrapper_ptr;
+
+    EbTaskDequePush(
+        scheduler_ptr,
+        (worker_ptr && worker_ptr->scheduler_ptr == scheduler_ptr) ?
+            &scheduler_ptr->deque_array[worker_ptr->worker_index] :
+            &scheduler_ptr->deque_array[scheduler_ptr->worker_count],
+        task);
+
+    // Wake a parked worker if there is one
+    if (eb_atomic_fetch_add(&scheduler_ptr->pending_count, 1) < 0)
+        eb_post_semaphore(scheduler_ptr->park_semaphore);
+}
+
+/**************************************
+ * EbTaskWorkerTake
+ *   Returns a queued task: the newest of the
+ *   worker's own deque, else the oldest of
+ *   another deque. The caller claimed one
+ *   through pending_count; it may briefly be
+ *   taken by a concurrent claimer before
+ *   this worker reaches it, so keep scanning.
+ **************************************/
+static EbTask EbTaskWorkerTake(
+    EbTaskWorker *worker_ptr)
+{
+    EbTaskScheduler *scheduler_ptr = worker_ptr->scheduler_ptr;
+    uint32_t         deque_count = scheduler_ptr->worker_count + 1;
+    uint32_t         victim_index;
+    uint32_t         i;
+    EbTask           task;
+
+    for (;;) {
+        if (EbTaskDequePop(scheduler_ptr, &scheduler_ptr->deque_array[worker_ptr->worker_index], EB_TRUE, &task))
+            return task;
+        for (i = 1; i < deque_count; ++i) {
+            victim_index = (worker_ptr->worker_index + deque_count - i) % deque_count;
+            if (EbTaskDequePop(scheduler_ptr, &scheduler_ptr->deque_array[victim_index], EB_FALSE, &task))
+                return task;
+        }
+        eb_yield_thread();
+    }
+}
+
+/**************************************
+ * eb_task_worker_kernel
+ **************************************/
+static void* eb_task_worker_kernel(void *input_ptr)
+{
+    EbTaskWorker    *worker_ptr = (EbTaskWorker*)input_ptr;
+    EbTaskScheduler *scheduler_ptr = worker_ptr->scheduler_ptr;
+
+    current_worker_ptr = worker_ptr;
+
+    for (;;) {
+        // Claim a task, park while there is none
+        if (eb_atomic_fetch_add(&scheduler_ptr->pending_count, -1) <= 0)
+            eb_block_on_semaphore(scheduler_ptr->park_semaphore);
+
+        const EbTask task = EbTaskWorkerTake(worker_ptr);
+        task.stage_ptr->task_function(
+            task.stage_ptr->context_ptr_array[worker_ptr->worker_index],
+            task.wrapper_ptr);
+    }
+    return EB_NULL;
+}
+
+static void eb_task_scheduler_dctor(EbPtr p)
+{
+    EbTaskScheduler *obj = (EbTaskScheduler*)p;
+    uint32_t i;
+
+    EB_DESTROY_THREAD_ARRAY(obj->thread_handle_array, obj->worker_count);
+    if (obj->deque_array) {
+        for (i = 0; i <= obj->worker_count; ++i) {
+            EB_DESTROY_MUTEX(obj->deque_array[i].lockout_mutex);
+            EB_FREE_ARRAY(obj->deque_array[i].task_array);
+        }
+        EB_FREE_ARRAY(obj->deque_array);
+    }
+    if (obj->park_semaphore)
+        EB_DESTROY_SEMAPHORE(obj->park_semaphore);
+    EB_FREE_ARRAY(obj->worker_array);
+    EB_FREE_ARRAY(obj->stage_array);
+}
+
+/**************************************
+ * eb_task_scheduler_ctor
+ **************************************/
+EbErrorType eb_task_scheduler_ctor(
+    EbTaskScheduler *scheduler_ptr,
+    uint32_t         worker_count,
+    uint32_t         stage_max_count)
+{
+    scheduler_ptr->dctor = eb_task_scheduler_dctor;
+
+    scheduler_ptr->worker_count = worker_count;
+    scheduler_ptr->stage_max_count = stage_max_count;
+    EB_CALLOC_ARRAY(scheduler_ptr->stage_array, stage_max_count);
+    EB_CREATE_SEMAPHORE(scheduler_ptr->park_semaphore, 0, worker_count);
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * eb_task_scheduler_add_stage
+ **************************************/
+EbErrorType eb_task_scheduler_add_stage(
+    EbTaskScheduler  *scheduler_ptr,
+    EbSystemResource *input_resource_ptr,
+    EbTaskFunction    task_function,
+    EbPtr            *context_ptr_array)
+{
+    EbTaskStage *stage_ptr;
+
+    if (scheduler_ptr->stage_count == scheduler_ptr->stage_max_count || scheduler_ptr->thread_handle_array)
+        return EB_ErrorBadParameter;
+
+    stage_ptr = &scheduler_ptr->stage_array[scheduler_ptr->stage_count++];
+    stage_ptr->scheduler_ptr = scheduler_ptr;
+    stage_ptr->task_function = task_function;
+    stage_ptr->context_ptr_array = context_ptr_array;
+
+    scheduler_ptr->task_capacity += input_resource_ptr->object_total_count;
+
+    input_resource_ptr->post_context_ptr = stage_ptr;
+    input_resource_ptr->post_callback = eb_task_scheduler_post;
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * eb_task_scheduler_start
+ *   Allocates the deques and creates the
+ *   worker threads.
+ **************************************/
+EbErrorType eb_task_scheduler_start(
+    EbTaskScheduler *scheduler_ptr)
+{
+    uint32_t deque_size = 1;
+    uint32_t i;
+
+    while (deque_size < scheduler_ptr->task_capacity)
+        deque_size <<= 1;
+    scheduler_ptr->task_mask = deque_size - 1;
+
+    EB_CALLOC_ARRAY(scheduler_ptr->deque_array, scheduler_ptr->worker_count + 1);
+    for (i = 0; i <= scheduler_ptr->worker_count; ++i) {
+        EB_CREATE_MUTEX(scheduler_ptr->deque_array[i].lockout_mutex);
+        EB_MALLOC_ARRAY(scheduler_ptr->deque_array[i].task_array, deque_size);
+    }
+
+    EB_MALLOC_ARRAY(scheduler_ptr->worker_array, scheduler_ptr->worker_count);
+    for (i = 0; i < scheduler_ptr->worker_count; ++i) {
+        scheduler_ptr->worker_array[i].scheduler_ptr = scheduler_ptr;
+        scheduler_ptr->worker_array[i].worker_index = i;
+    }
+
+    EB_ALLOC_PTR_ARRAY(scheduler_ptr->thread_handle_array, scheduler_ptr->worker_count);
+    for (i = 0; i < scheduler_ptr->worker_count; ++i)
+        EB_CREATE_THREAD(scheduler_ptr->thread_handle_array[i], eb_task_worker_kernel, &scheduler_ptr->worker_array[i]);
+
+    return EB_ErrorNone;
+}
@@ -0,0 +1,120 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbTaskScheduler_h
+#define EbTaskScheduler_h
+
+#include "EbDefinitions.h"
+#include "EbSystemResourceManager.h"
+#include "EbObject.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /**************************************
+     * Task Scheduler
+     *   Work-stealing pool that replaces the
+     *   per-stage thread arrays. Every full
+     *   object posted to a registered stage's
+     *   input resource becomes a task; each
+     *   worker owns a deque, pops its own newest
+     *   task first and steals the oldest task of
+     *   the other workers when it runs dry.
+     *
+     *   A worker always runs a stage with its
+     *   own context (context_ptr_array[worker]),
+     *   so each stage needs one context per
+     *   worker. Only the stages that already
+     *   run with several threads may be
+     *   registered; the serial stages keep
+     *   their dedicated threads.
+     *
+     *   A task must never wait on another
+     *   task: the stages that wait on other
+     *   pictures keep their threads too, and
+     *   the fifos the tasks post to must hold
+     *   every object that can be in flight.
+     **************************************/
+    typedef void(*EbTaskFunction)(
+        void            *context_ptr,
+        EbObjectWrapper *input_wrapper_ptr);
+
+    struct EbTaskScheduler;
+
+    typedef struct EbTaskStage
+    {
+        struct EbTaskScheduler *scheduler_ptr;
+        EbTaskFunction          task_function;
+        EbPtr                  *context_ptr_array;
+    } EbTaskStage;
+
+    typedef struct EbTask
+    {
+        EbTaskStage            *stage_ptr;
+        EbObjectWrapper        *wrapper_ptr;
+    } EbTask;
+
+    typedef struct EbTaskDeque
+    {
+        EbHandle                lockout_mutex;
+        EbTask                 *task_array;
+        volatile uint32_t       head;       // oldest task, stolen by other workers
+        volatile uint32_t       tail;       // newest task, popped by the owner
+    } EbTaskDeque;
+
+    typedef struct EbTaskWorker
+    {
+        struct EbTaskScheduler *scheduler_ptr;
+        uint32_t                worker_index;
+    } EbTaskWorker;
+
+    typedef struct EbTaskScheduler
+    {
+        EbDctor                 dctor;
+        uint32_t                worker_count;
+        uint32_t                stage_count;
+        uint32_t                stage_max_count;
+        EbTaskStage            *stage_array;
+
+        // Every task is a wrapper of a registered resource, so no deque can
+        // hold more than the sum of the registered object counts.
+        uint32_t                task_capacity;
+        uint32_t                task_mask;
+
+        // deque_array[worker_count] is the injection deque used by posts
+        // coming from threads outside of the pool.
+        EbTaskDeque            *deque_array;
+        EbTaskWorker           *worker_array;
+        EbHandle               *thread_handle_array;
+
+        // pending_count - queued tasks not yet claimed by a worker, minus the
+        //   number of workers parked on park_semaphore.
+        volatile int32_t        pending_count;
+        EbHandle                park_semaphore;
+    } EbTaskScheduler;
+
+    extern EbErrorType eb_task_scheduler_ctor(
+        EbTaskScheduler *scheduler_ptr,
+        uint32_t         worker_count,
+        uint32_t         stage_max_count);
+
+    /**************************************
+     * eb_task_scheduler_add_stage
+     *   Routes the full objects of
+     *   input_resource_ptr to the pool. Must be
+     *   called before eb_task_scheduler_start.
+     **************************************/
+    extern EbErrorType eb_task_scheduler_add_stage(
+        EbTaskScheduler  *scheduler_ptr,
+        EbSystemResource *input_resource_ptr,
+        EbTaskFunction    task_function,
+        EbPtr            *context_ptr_array);
+
+    extern EbErrorType eb_task_scheduler_start(
+        EbTaskScheduler *scheduler_ptr);
+#ifdef __cplusplus
+}
+#endif
+#endif // EbTaskScheduler_h
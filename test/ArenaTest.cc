@@ -0,0 +1,111 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+#include "EbDefinitions.h"
+#include "EbMalloc.h"
+#include "EbArena.h"
+
+namespace {
+
+static const size_t test_sizes[] = {1, 8, 63, 64, 65, 200, 1000, 1024,
+                                    1025, 3000, 8192, 20000, 32768};
+
+class ArenaTest : public ::testing::Test {
+  public:
+    void SetUp() {
+        arena_ = eb_arena_create();
+        ASSERT_NE(arena_, nullptr);
+        prev_ = eb_arena_set_current(arena_);
+    }
+    void TearDown() {
+        eb_arena_set_current(prev_);
+        eb_arena_destroy(arena_);
+    }
+
+  protected:
+    EbArena *arena_;
+    EbArena *prev_;
+};
+
+TEST_F(ArenaTest, BlocksAreAlignedAndDistinct) {
+    const size_t count = sizeof(test_sizes) / sizeof(test_sizes[0]);
+    uint8_t *blocks[sizeof(test_sizes) / sizeof(test_sizes[0])];
+
+    for (size_t i = 0; i < count; i++) {
+        blocks[i] = (uint8_t *)eb_malloc(test_sizes[i]);
+        ASSERT_NE(blocks[i], nullptr);
+        EXPECT_EQ((uintptr_t)blocks[i] & 63, 0u) << test_sizes[i];
+        memset(blocks[i], (int)i, test_sizes[i]);
+    }
+    // No block overlaps another one
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < test_sizes[i]; j++)
+            ASSERT_EQ(blocks[i][j], (uint8_t)i) << test_sizes[i];
+    }
+    for (size_t i = 0; i < count; i++)
+        eb_free(blocks[i]);
+}
+
+TEST_F(ArenaTest, FreedBlocksAreReused) {
+    for (size_t i = 0; i < sizeof(test_sizes) / sizeof(test_sizes[0]); i++) {
+        void *p = eb_malloc(test_sizes[i]);
+        eb_free(p);
+        EXPECT_EQ(eb_malloc(test_sizes[i]), p) << test_sizes[i];
+        eb_free(p);
+    }
+}
+
+TEST_F(ArenaTest, CallocClearsReusedBlocks) {
+    uint8_t *p = (uint8_t *)eb_malloc(500);
+    memset(p, 0xff, 500);
+    eb_free(p);
+
+    uint8_t *q = (uint8_t *)eb_calloc(50, 10);
+    ASSERT_EQ(q, p);
+    for (int i = 0; i < 500; i++)
+        ASSERT_EQ(q[i], 0);
+    eb_free(q);
+}
+
+TEST_F(ArenaTest, UsageIsReported) {
+    EbArenaUsage before, after;
+    eb_arena_get_usage(&before);
+
+    void *n = eb_malloc(100);
+    void *c = eb_calloc(10, 30);
+    eb_arena_get_usage(&after);
+    EXPECT_EQ(after.amount[EB_N_PTR] - before.amount[EB_N_PTR], 100u);
+    EXPECT_EQ(after.amount[EB_C_PTR] - before.amount[EB_C_PTR], 300u);
+    EXPECT_EQ(after.in_use - before.in_use, 128u + 320u);
+    EXPECT_GE(after.reserved, after.in_use);
+
+    eb_free(n);
+    eb_free(c);
+    eb_arena_get_usage(&after);
+    EXPECT_EQ(after.in_use, before.in_use);
+}
+
+// Blocks above the largest class and allocations of threads without an
+// arena come from the system heap and are freed back to it
+TEST_F(ArenaTest, FallsBackToHeap) {
+    void *large = eb_malloc(1 << 20);
+    ASSERT_NE(large, nullptr);
+    eb_free(large);
+
+    EbArena *arena = eb_arena_set_current(NULL);
+    EbArenaUsage before, after;
+    eb_arena_get_usage(&before);
+    void *p = eb_malloc(100);
+    eb_arena_get_usage(&after);
+    EXPECT_EQ(after.in_use, before.in_use);
+    eb_free(p);
+    eb_arena_set_current(arena);
+}
+
+}  // namespace
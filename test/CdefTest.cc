@@ -0,0 +1,120 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "EbCdef.h"
+#include "EbUnitTestUtility.h"
+#include "EbUtility.h"
+#include "util.h"
+
+namespace {
+
+#define CDEF_TEST_DST_STRIDE 16
+
+class CdefFilterBlockTest : public ::testing::Test {
+  public:
+    void TearDown() {
+        aom_clear_system_state();
+    }
+
+  protected:
+    void RunCheckOutput(cdef_filter_block_func ref_func,
+                        cdef_filter_block_func tst_func);
+
+    // An 8x8 block with its borders, some of the border samples are
+    // outside the frame and set to CDEF_VERY_LARGE
+    void init_data(int32_t bd) {
+        eb_buf_random_u16_with_bd(in_, CDEF_INBUF_SIZE, bd);
+        if (rand() & 1) {
+            const int32_t rows = 8 + 2 * CDEF_VBORDER;
+            const int32_t side = rand() & 3;
+            for (int32_t y = 0; y < rows; y++) {
+                for (int32_t x = 0; x < CDEF_BSTRIDE; x++) {
+                    if ((side == 0 && y < CDEF_VBORDER) ||
+                        (side == 1 && y >= rows - CDEF_VBORDER) ||
+                        (side == 2 && x < CDEF_HBORDER) ||
+                        (side == 3 && x >= CDEF_HBORDER + 8))
+                        in_[y * CDEF_BSTRIDE + x] = CDEF_VERY_LARGE;
+                }
+            }
+        }
+    }
+
+    uint16_t in_[CDEF_INBUF_SIZE];
+    uint8_t dst8_ref_[8 * CDEF_TEST_DST_STRIDE];
+    uint8_t dst8_tst_[8 * CDEF_TEST_DST_STRIDE];
+    uint16_t dst16_ref_[8 * CDEF_TEST_DST_STRIDE];
+    uint16_t dst16_tst_[8 * CDEF_TEST_DST_STRIDE];
+};
+
+void CdefFilterBlockTest::RunCheckOutput(cdef_filter_block_func ref_func,
+                                         cdef_filter_block_func tst_func) {
+    static const int32_t bsizes[] = {
+        BLOCK_8X8, BLOCK_4X8, BLOCK_8X4, BLOCK_4X4};
+    static const int32_t sec_strengths[] = {0, 1, 2, 4};
+    const uint16_t *in = in_ + CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER;
+
+    for (int32_t bd = 8; bd <= 12; bd += 2) {
+        const int32_t coeff_shift = bd - 8;
+        for (int32_t i = 0; i < 20; i++) {
+            init_data(bd);
+            for (int32_t b = 0; b < 4; b++) {
+                for (int32_t pri = 0; pri < CDEF_PRI_STRENGTHS; pri++) {
+                    for (int32_t s = 0; s < CDEF_SEC_STRENGTHS; s++) {
+                        const int32_t pri_strength = pri << coeff_shift;
+                        const int32_t sec_strength = sec_strengths[s]
+                                                     << coeff_shift;
+                        const int32_t dir = rand() & 7;
+                        const int32_t damping = 3 + (rand() & 3) + coeff_shift;
+                        const int32_t max = (256 << coeff_shift) - 1;
+
+                        memset(dst16_ref_, 0, sizeof(dst16_ref_));
+                        memset(dst16_tst_, 0, sizeof(dst16_tst_));
+                        ref_func(NULL, dst16_ref_, CDEF_TEST_DST_STRIDE, in,
+                                 pri_strength, sec_strength, dir, damping,
+                                 damping, bsizes[b], max, coeff_shift);
+                        tst_func(NULL, dst16_tst_, CDEF_TEST_DST_STRIDE, in,
+                                 pri_strength, sec_strength, dir, damping,
+                                 damping, bsizes[b], max, coeff_shift);
+                        ASSERT_EQ(0, memcmp(dst16_ref_, dst16_tst_,
+                                            sizeof(dst16_ref_)))
+                            << "bd " << bd << " bsize " << bsizes[b]
+                            << " pri " << pri_strength << " sec "
+                            << sec_strength << " dir " << dir;
+
+                        if (bd != 8)
+                            continue;
+                        memset(dst8_ref_, 0, sizeof(dst8_ref_));
+                        memset(dst8_tst_, 0, sizeof(dst8_tst_));
+                        ref_func(dst8_ref_, NULL, CDEF_TEST_DST_STRIDE, in,
+                                 pri_strength, sec_strength, dir, damping,
+                                 damping, bsizes[b], max, coeff_shift);
+                        tst_func(dst8_tst_, NULL, CDEF_TEST_DST_STRIDE, in,
+                                 pri_strength, sec_strength, dir, damping,
+                                 damping, bsizes[b], max, coeff_shift);
+                        ASSERT_EQ(0, memcmp(dst8_ref_, dst8_tst_,
+                                            sizeof(dst8_ref_)))
+                            << "bsize " << bsizes[b] << " pri "
+                            << pri_strength << " sec " << sec_strength
+                            << " dir " << dir;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(CdefFilterBlockTest, CheckOutputAvx512) {
+    if (!CanUseAvx512Features())
+        return;
+    RunCheckOutput(cdef_filter_block_c, cdef_filter_block_avx512);
+}
+
+}  // namespace
@@ -6,7 +6,8 @@
 /******************************************************************************
  * @file EncodeTxbAsmTest.cc
  *
- * @brief Unit test for av1_txb_init_levels_avx2:
+ * @brief Unit test for av1_txb_init_levels_avx2 and
+ * av1_get_nz_map_contexts_sse2:
  *
  * @author Cidana-Wenyao
  *
@@ -30,6 +31,7 @@
 
 #include "EbDefinitions.h"
 #include "EbTransforms.h"
+#include "EbCabacContextModel.h"
 #include "util.h"
 #include "aom_dsp_rtcd.h"
 #include "TxfmCommon.h"
@@ -143,4 +145,118 @@ INSTANTIATE_TEST_CASE_P(
     Entropy, EncodeTxbInitLevelTest,
     ::testing::Combine(::testing::Values(&av1_txb_init_levels_avx2),
                        ::testing::Range(0, static_cast<int>(TX_SIZES_ALL), 1)));
+
+// test assembly code of av1_get_nz_map_contexts
+using GetNzMapContextsFunc = void (*)(const uint8_t *const levels,
+                                      const int16_t *const scan,
+                                      const uint16_t eob, const TxSize tx_size,
+                                      const TxClass tx_class,
+                                      int8_t *const coeff_contexts);
+using GetNzMapContextsParam = std::tuple<GetNzMapContextsFunc, int, int>;
+/**
+ * @brief Unit test for av1_get_nz_map_contexts_sse2:
+ *
+ * Test strategy:
+ * Verify this assembly code by comparing with reference c implementation.
+ * Build the levels of a random transform block, feed the same levels, scan
+ * and eob and check the contexts of every scan position before eob.
+ *
+ * Expect result:
+ * Output from assemble function should be exactly same as output from c.
+ *
+ * Test coverage:
+ * Input buffer: random levels up to eob in scan order, zero after it,
+ * with a mix of sparse and dense blocks
+ * eob: random in [1, number of coded coefficients]
+ * tx_size: all valid tx_size
+ * tx_type: one tx_type of each tx_class
+ *
+ */
+class EncodeTxbNzMapContextsTest
+    : public ::testing::TestWithParam<GetNzMapContextsParam> {
+  public:
+    EncodeTxbNzMapContextsTest() : ref_func_(&av1_get_nz_map_contexts_c) {
+        rnd_ = new SVTRandom(0, 255);
+    }
+
+    virtual ~EncodeTxbNzMapContextsTest() {
+        delete rnd_;
+        aom_clear_system_state();
+    }
+
+    void check_nz_map_contexts_assembly(GetNzMapContextsFunc test_func,
+                                        int tx_size, int tx_type) {
+        const int width = get_txb_wide((TxSize)tx_size);
+        const int height = get_txb_high((TxSize)tx_size);
+        const TxClass tx_class = tx_type_to_class[tx_type];
+        const int16_t *const scan =
+            av1_scan_orders[tx_size][tx_type].scan;
+
+        ASSERT_NE(rnd_, nullptr) << "Fail to create SVTRandom";
+
+        const uint16_t eob = prepare_data(scan, width, height);
+
+        ref_func_(levels_, scan, eob, (TxSize)tx_size, tx_class,
+                  contexts_ref_);
+        test_func(levels_, scan, eob, (TxSize)tx_size, tx_class,
+                  contexts_test_);
+
+        // compare the result
+        for (int i = 0; i < eob; ++i) {
+            const int pos = scan[i];
+            ASSERT_EQ(contexts_test_[pos], contexts_ref_[pos])
+                << "scan idx " << i << " eob " << eob << " tx_size "
+                << tx_size << " tx_type " << tx_type;
+        }
+    }
+
+  private:
+    uint16_t prepare_data(const int16_t *const scan, const int width,
+                          const int height) {
+        const int n = width * height;
+        const uint16_t eob = (uint16_t)(1 + rnd_->random() * n / 256);
+        // lower thresholds give sparse blocks, higher ones dense blocks
+        const int nz_threshold = rnd_->random();
+
+        memset(contexts_test_, 0, sizeof(contexts_test_));
+        memset(contexts_ref_, 1, sizeof(contexts_ref_));
+        memset(input_coeff_, 0, sizeof(input_coeff_));
+        for (int i = 0; i < eob; i++) {
+            if (i == eob - 1 || rnd_->random() < nz_threshold)
+                input_coeff_[scan[i]] = 1 + (rnd_->random() & 15);
+        }
+
+        levels_ = set_levels(levels_buf_, width);
+        av1_txb_init_levels_c(input_coeff_, width, height, levels_);
+        return eob;
+    }
+
+  private:
+    SVTRandom *rnd_;
+    uint8_t levels_buf_[TX_PAD_2D];
+    TranLow input_coeff_[MAX_TX_SQUARE];
+    DECLARE_ALIGNED(16, int8_t, contexts_test_[MAX_TX_SQUARE]);
+    DECLARE_ALIGNED(16, int8_t, contexts_ref_[MAX_TX_SQUARE]);
+
+    uint8_t *levels_;
+    const GetNzMapContextsFunc ref_func_;
+};
+
+TEST_P(EncodeTxbNzMapContextsTest, get_nz_map_contexts_assmbly) {
+    const int loops = 100;
+    for (int i = 0; i < loops; ++i) {
+        check_nz_map_contexts_assembly(
+            TEST_GET_PARAM(0), TEST_GET_PARAM(1), TEST_GET_PARAM(2));
+    }
+}
+
+// DCT_DCT, V_DCT and H_DCT cover TX_CLASS_2D, TX_CLASS_VERT and
+// TX_CLASS_HORIZ
+INSTANTIATE_TEST_CASE_P(
+    Entropy, EncodeTxbNzMapContextsTest,
+    ::testing::Combine(::testing::Values(&av1_get_nz_map_contexts_sse2),
+                       ::testing::Range(0, static_cast<int>(TX_SIZES_ALL), 1),
+                       ::testing::Values(static_cast<int>(DCT_DCT),
+                                         static_cast<int>(V_DCT),
+                                         static_cast<int>(H_DCT))));
 }  // namespace
@@ -0,0 +1,205 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "EbComputeSAD_AVX2.h"
+#include "EbComputeSAD_C.h"
+#include "EbDefinitions.h"
+#include "EbUnitTestUtility.h"
+#include "EbUtility.h"
+#include "util.h"
+
+namespace {
+
+// Initial best SAD of the ME (MAX_SAD_VALUE)
+static const uint32_t max_sad = 128 * 128 * 255;
+
+typedef void (*MultiRefSadFunc)(uint8_t *src, uint32_t src_stride,
+                                uint8_t **ref, uint32_t ref_stride,
+                                uint32_t num_refs, uint32_t **p_best_sad8x8,
+                                uint32_t **p_best_mv8x8,
+                                uint32_t **p_best_sad16x16,
+                                uint32_t **p_best_mv16x16, uint32_t *mv,
+                                uint16_t **p_sad16x16, EbBool sub_sad);
+
+// Best SADs, MVs and the eight 16x16 SADs of every reference
+typedef struct MultiRefSadResult {
+    uint32_t best_sad8x8[MAX_REF_IDX][4];
+    uint32_t best_mv8x8[MAX_REF_IDX][4];
+    uint32_t best_sad16x16[MAX_REF_IDX];
+    uint32_t best_mv16x16[MAX_REF_IDX];
+    DECLARE_ALIGNED(16, uint16_t, sad16x16[MAX_REF_IDX][8]);
+} MultiRefSadResult;
+
+class MultiRefSadTest : public ::testing::Test {
+  public:
+    void SetUp() {
+        src_stride_ = eb_create_random_aligned_stride(MAX_SB_SIZE, 64);
+        ref_stride_ = eb_create_random_aligned_stride(MAX_SB_SIZE, 64);
+        src_ = (uint8_t *)malloc(sizeof(*src_) * 16 * src_stride_);
+        ref_ = (uint8_t *)malloc(sizeof(*ref_) * 16 * MAX_REF_IDX *
+                                 ref_stride_);
+    }
+    void TearDown() {
+        free(ref_);
+        free(src_);
+        aom_clear_system_state();
+    }
+
+  protected:
+    void RunCheckOutput(void (*init)(MultiRefSadTest *));
+
+    static void init_random(MultiRefSadTest *t) {
+        eb_buf_random_u8(t->src_, 16 * t->src_stride_);
+        eb_buf_random_u8(t->ref_, 16 * MAX_REF_IDX * t->ref_stride_);
+    }
+    // Largest possible SADs, all eight positions tied
+    static void init_extreme(MultiRefSadTest *t) {
+        memset(t->src_, 255, 16 * t->src_stride_);
+        memset(t->ref_, 0, 16 * MAX_REF_IDX * t->ref_stride_);
+    }
+
+    void init_best() {
+        for (int r = 0; r < MAX_REF_IDX; r++) {
+            // Keep some previous bests low enough not to be replaced
+            for (int i = 0; i < 4; i++) {
+                best_sad_init_[r][i] = (rand() & 1) ? max_sad
+                                                    : (rand() & 0x3FFF);
+                best_mv_init_[r][i] = (uint32_t)rand();
+            }
+            best_sad_init_[r][4] = (rand() & 1) ? max_sad
+                                                : (rand() & 0xFFFF);
+            best_mv_init_[r][4] = (uint32_t)rand();
+            // Negative components exercise the 16-bit MV wrap around
+            mv_[r] = ((uint32_t)(uint16_t)(rand() % 512 - 256) << 16) |
+                     (uint16_t)(rand() % 512 - 256);
+        }
+    }
+
+    void reset_result(MultiRefSadResult *res) {
+        for (int r = 0; r < MAX_REF_IDX; r++) {
+            for (int i = 0; i < 4; i++) {
+                res->best_sad8x8[r][i] = best_sad_init_[r][i];
+                res->best_mv8x8[r][i] = best_mv_init_[r][i];
+            }
+            res->best_sad16x16[r] = best_sad_init_[r][4];
+            res->best_mv16x16[r] = best_mv_init_[r][4];
+        }
+    }
+
+    void run(MultiRefSadFunc func, MultiRefSadResult *res, uint32_t num_refs,
+             EbBool sub_sad) {
+        uint8_t *ref[MAX_REF_IDX];
+        uint32_t *best_sad8x8[MAX_REF_IDX], *best_mv8x8[MAX_REF_IDX];
+        uint32_t *best_sad16x16[MAX_REF_IDX], *best_mv16x16[MAX_REF_IDX];
+        uint16_t *sad16x16[MAX_REF_IDX];
+
+        reset_result(res);
+        for (uint32_t r = 0; r < num_refs; r++) {
+            ref[r] = ref_ + r * 16 * ref_stride_;
+            best_sad8x8[r] = res->best_sad8x8[r];
+            best_mv8x8[r] = res->best_mv8x8[r];
+            best_sad16x16[r] = &res->best_sad16x16[r];
+            best_mv16x16[r] = &res->best_mv16x16[r];
+            sad16x16[r] = res->sad16x16[r];
+        }
+        func(src_,
+             src_stride_,
+             ref,
+             ref_stride_,
+             num_refs,
+             best_sad8x8,
+             best_mv8x8,
+             best_sad16x16,
+             best_mv16x16,
+             mv_,
+             sad16x16,
+             sub_sad);
+    }
+
+    // The single reference kernel run once per reference
+    void run_single_ref(MultiRefSadResult *res, uint32_t num_refs,
+                        EbBool sub_sad) {
+        reset_result(res);
+        for (uint32_t r = 0; r < num_refs; r++) {
+            get_eight_horizontal_search_point_results_8x8_16x16_pu_avx2_intrin(
+                src_,
+                src_stride_,
+                ref_ + r * 16 * ref_stride_,
+                ref_stride_,
+                res->best_sad8x8[r],
+                res->best_mv8x8[r],
+                &res->best_sad16x16[r],
+                &res->best_mv16x16[r],
+                mv_[r],
+                res->sad16x16[r],
+                sub_sad);
+        }
+    }
+
+    uint8_t *src_;
+    uint8_t *ref_;
+    uint32_t src_stride_;
+    uint32_t ref_stride_;
+    uint32_t best_sad_init_[MAX_REF_IDX][5];
+    uint32_t best_mv_init_[MAX_REF_IDX][5];
+    uint32_t mv_[MAX_REF_IDX];
+};
+
+void MultiRefSadTest::RunCheckOutput(void (*init)(MultiRefSadTest *)) {
+    MultiRefSadResult res_ref, res_c, res_avx2, res_avx512;
+
+    for (int i = 0; i < 10; i++) {
+        init(this);
+        init_best();
+        memset(&res_ref, 0, sizeof(res_ref));
+        memset(&res_c, 0, sizeof(res_c));
+        memset(&res_avx2, 0, sizeof(res_avx2));
+        memset(&res_avx512, 0, sizeof(res_avx512));
+        for (uint32_t num_refs = 1; num_refs <= MAX_REF_IDX; num_refs++) {
+            for (int s = 0; s < 2; s++) {
+                const EbBool sub_sad = s ? EB_TRUE : EB_FALSE;
+
+                run_single_ref(&res_ref, num_refs, sub_sad);
+                run(get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_c,
+                    &res_c,
+                    num_refs,
+                    sub_sad);
+                run(get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx2,
+                    &res_avx2,
+                    num_refs,
+                    sub_sad);
+                EXPECT_EQ(0, memcmp(&res_ref, &res_c, sizeof(res_ref)))
+                    << "C refs " << num_refs << " sub_sad " << s;
+                EXPECT_EQ(0, memcmp(&res_ref, &res_avx2, sizeof(res_ref)))
+                    << "AVX2 refs " << num_refs << " sub_sad " << s;
+
+                if (CanUseAvx512Features()) {
+                    run(get_eight_horizontal_search_point_results_8x8_16x16_multi_ref_avx512,
+                        &res_avx512,
+                        num_refs,
+                        sub_sad);
+                    EXPECT_EQ(0,
+                              memcmp(&res_ref, &res_avx512, sizeof(res_ref)))
+                        << "AVX512 refs " << num_refs << " sub_sad " << s;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(MultiRefSadTest, CheckOutput) {
+    RunCheckOutput(init_random);
+}
+
+TEST_F(MultiRefSadTest, CheckOutputExtreme) {
+    RunCheckOutput(init_extreme);
+}
+
+}  // namespace
@@ -0,0 +1,113 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include <stdlib.h>
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "EbUnitTestUtility.h"
+#include "EbUtility.h"
+#include "util.h"
+
+namespace {
+
+class ResidualTest : public ::testing::Test {
+  public:
+    void SetUp() {
+        input_stride_ = eb_create_random_aligned_stride(MAX_SB_SIZE, 64);
+        pred_stride_ = eb_create_random_aligned_stride(MAX_SB_SIZE, 64);
+        residual_stride_ = eb_create_random_aligned_stride(MAX_SB_SIZE, 64);
+        input_ =
+            (uint8_t *)malloc(sizeof(*input_) * MAX_SB_SIZE * input_stride_);
+        pred_ = (uint8_t *)malloc(sizeof(*pred_) * MAX_SB_SIZE * pred_stride_);
+        residual_ref_ = (int16_t *)malloc(sizeof(*residual_ref_) *
+                                          MAX_SB_SIZE * residual_stride_);
+        residual_tst_ = (int16_t *)malloc(sizeof(*residual_tst_) *
+                                          MAX_SB_SIZE * residual_stride_);
+    }
+    void TearDown() {
+        free(residual_tst_);
+        free(residual_ref_);
+        free(pred_);
+        free(input_);
+        aom_clear_system_state();
+    }
+
+  protected:
+    void RunCheckOutput();
+
+    void init_data() {
+        eb_buf_random_u8(input_, MAX_SB_SIZE * input_stride_);
+        eb_buf_random_u8(pred_, MAX_SB_SIZE * pred_stride_);
+        memset(residual_ref_,
+               0,
+               sizeof(*residual_ref_) * MAX_SB_SIZE * residual_stride_);
+        memset(residual_tst_,
+               0,
+               sizeof(*residual_tst_) * MAX_SB_SIZE * residual_stride_);
+    }
+
+    uint8_t *input_;
+    uint8_t *pred_;
+    int16_t *residual_ref_;
+    int16_t *residual_tst_;
+    uint32_t input_stride_;
+    uint32_t pred_stride_;
+    uint32_t residual_stride_;
+};
+
+void ResidualTest::RunCheckOutput() {
+    if (!CanUseAvx512Features())
+        return;
+
+    for (int i = 0; i < 10; i++) {
+        for (uint32_t area_width = 4; area_width <= 128; area_width <<= 1) {
+            for (uint32_t area_height = 4; area_height <= 128;
+                 area_height <<= 1) {
+                // Block shapes of AV1
+                if (area_width > 4 * area_height ||
+                    area_height > 4 * area_width ||
+                    (area_width == 128 && area_height == 32) ||
+                    (area_width == 32 && area_height == 128))
+                    continue;
+
+                init_data();
+                residual_kernel_c(input_,
+                                  input_stride_,
+                                  pred_,
+                                  pred_stride_,
+                                  residual_ref_,
+                                  residual_stride_,
+                                  area_width,
+                                  area_height);
+                residual_kernel_avx512(input_,
+                                       input_stride_,
+                                       pred_,
+                                       pred_stride_,
+                                       residual_tst_,
+                                       residual_stride_,
+                                       area_width,
+                                       area_height);
+
+                for (uint32_t y = 0; y < area_height; y++) {
+                    const int16_t *ref = residual_ref_ + y * residual_stride_;
+                    const int16_t *tst = residual_tst_ + y * residual_stride_;
+                    for (uint32_t x = 0; x < area_width; x++) {
+                        ASSERT_EQ(ref[x], tst[x])
+                            << area_width << "x" << area_height << " at ("
+                            << x << ", " << y << ")";
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(ResidualTest, CheckOutputAvx512) {
+    RunCheckOutput();
+}
+
+}  // namespace
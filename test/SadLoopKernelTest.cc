@@ -0,0 +1,187 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SadLoopKernelTest.cc
+ *
+ * @brief Unit test of the full search kernels of the ME:
+ * sad_loop_kernel_avx512_intrin() and sad_loop_kernel_avx512_hme_l0_intrin()
+ * against sad_loop_kernel(), for every block size of the AVX-512 path and a
+ * few that fall back to AVX2.
+ *
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "EbComputeSAD_C.h"
+#include "EbDefinitions.h"
+#include "EbUnitTestUtility.h"
+#include "EbUtility.h"
+#include "util.h"
+
+namespace {
+
+typedef void (*SadLoopKernelFunc)(
+    uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride,
+    uint32_t height, uint32_t width, uint64_t *best_sad,
+    int16_t *x_search_center, int16_t *y_search_center,
+    uint32_t src_stride_raw, int16_t search_area_width,
+    int16_t search_area_height);
+
+typedef struct BlockSize {
+    uint32_t width;
+    uint32_t height;
+} BlockSize;
+
+// 4x8 and 8x16 use the AVX2 kernels
+static const BlockSize block_sizes[] = {
+    {16, 8},  {16, 16}, {16, 32}, {16, 64}, {32, 8},  {32, 16}, {32, 32},
+    {32, 64}, {48, 16}, {48, 48}, {48, 64}, {64, 16}, {64, 32}, {64, 64},
+    {4, 8},   {8, 16}};
+
+// Search area widths: any width for sad_loop_kernel_avx512_intrin(), the
+// multiples of 16 for the HME level 0 kernel
+static const int16_t search_area_widths[] = {8, 13, 16, 64, 67, 128};
+static const int16_t search_area_heights[] = {1, 5, 16};
+
+static const uint32_t max_search_area_width = 128 + 8;
+static const uint32_t max_search_area_height = 16;
+
+class SadLoopKernelTest : public ::testing::Test {
+  public:
+    void SetUp() {
+        src_stride_ = eb_create_random_aligned_stride(MAX_SB_SIZE, 64);
+        ref_stride_ = eb_create_random_aligned_stride(
+            MAX_SB_SIZE + max_search_area_width, 64);
+        src_ = (uint8_t *)malloc(sizeof(*src_) * MAX_SB_SIZE * src_stride_);
+        ref_ = (uint8_t *)malloc(sizeof(*ref_) * ref_rows() * ref_stride_);
+    }
+    void TearDown() {
+        free(ref_);
+        free(src_);
+        aom_clear_system_state();
+    }
+
+  protected:
+    void RunCheckOutput(void (*init)(SadLoopKernelTest *));
+
+    uint32_t ref_rows() const {
+        return MAX_SB_SIZE + max_search_area_height;
+    }
+
+    static void init_random(SadLoopKernelTest *t) {
+        eb_buf_random_u8(t->src_, MAX_SB_SIZE * t->src_stride_);
+        eb_buf_random_u8(t->ref_, t->ref_rows() * t->ref_stride_);
+    }
+    // Largest possible SADs, all positions tied
+    static void init_extreme(SadLoopKernelTest *t) {
+        memset(t->src_, 255, MAX_SB_SIZE * t->src_stride_);
+        memset(t->ref_, 0, t->ref_rows() * t->ref_stride_);
+    }
+    // Large SADs but for one position, which matches the source
+    static void init_match(SadLoopKernelTest *t) {
+        eb_buf_random_u8_to_large(t->src_, MAX_SB_SIZE * t->src_stride_);
+        eb_buf_random_u8_to_small(t->ref_, t->ref_rows() * t->ref_stride_);
+        const uint32_t x = rand() % max_search_area_width;
+        const uint32_t y = rand() % max_search_area_height;
+        for (uint32_t r = 0; r < MAX_SB_SIZE; r++)
+            memcpy(t->ref_ + (y + r) * t->ref_stride_ + x,
+                   t->src_ + r * t->src_stride_,
+                   MAX_SB_SIZE);
+    }
+
+    void check(SadLoopKernelFunc func, const char *name,
+               const BlockSize *bsize, int16_t search_area_width,
+               int16_t search_area_height) {
+        uint64_t best_sad_org, best_sad_opt;
+        int16_t x_org = 0, y_org = 0, x_opt = 0, y_opt = 0;
+
+        sad_loop_kernel(src_,
+                        src_stride_,
+                        ref_,
+                        ref_stride_,
+                        bsize->height,
+                        bsize->width,
+                        &best_sad_org,
+                        &x_org,
+                        &y_org,
+                        ref_stride_,
+                        search_area_width,
+                        search_area_height);
+        func(src_,
+             src_stride_,
+             ref_,
+             ref_stride_,
+             bsize->height,
+             bsize->width,
+             &best_sad_opt,
+             &x_opt,
+             &y_opt,
+             ref_stride_,
+             search_area_width,
+             search_area_height);
+        EXPECT_EQ(best_sad_org, best_sad_opt)
+            << name << " " << bsize->width << "x" << bsize->height
+            << " search area " << search_area_width << "x"
+            << search_area_height;
+        EXPECT_EQ(x_org, x_opt)
+            << name << " " << bsize->width << "x" << bsize->height
+            << " search area " << search_area_width << "x"
+            << search_area_height;
+        EXPECT_EQ(y_org, y_opt)
+            << name << " " << bsize->width << "x" << bsize->height
+            << " search area " << search_area_width << "x"
+            << search_area_height;
+    }
+
+    uint8_t *src_;
+    uint8_t *ref_;
+    uint32_t src_stride_;
+    uint32_t ref_stride_;
+};
+
+void SadLoopKernelTest::RunCheckOutput(void (*init)(SadLoopKernelTest *)) {
+    if (!CanUseAvx512Features())
+        return;
+
+    for (int i = 0; i < 4; i++) {
+        init(this);
+        for (const BlockSize &bsize : block_sizes) {
+            for (const int16_t search_area_width : search_area_widths) {
+                for (const int16_t search_area_height : search_area_heights) {
+                    check(sad_loop_kernel_avx512_intrin,
+                          "sad_loop_kernel_avx512_intrin",
+                          &bsize,
+                          search_area_width,
+                          search_area_height);
+                    if (search_area_width & 15)
+                        continue;
+                    check(sad_loop_kernel_avx512_hme_l0_intrin,
+                          "sad_loop_kernel_avx512_hme_l0_intrin",
+                          &bsize,
+                          search_area_width,
+                          search_area_height);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(SadLoopKernelTest, CheckOutputAvx512) {
+    RunCheckOutput(init_random);
+}
+
+TEST_F(SadLoopKernelTest, CheckOutputAvx512Extreme) {
+    RunCheckOutput(init_extreme);
+}
+
+TEST_F(SadLoopKernelTest, CheckOutputAvx512Match) {
+    RunCheckOutput(init_match);
+}
+
+}  // namespace
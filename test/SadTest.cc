@@ -0,0 +1,126 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "EbUnitTestUtility.h"
+#include "EbUtility.h"
+#include "util.h"
+
+namespace {
+
+typedef uint32_t (*SadFunc)(const uint8_t *src_ptr, int src_stride,
+                            const uint8_t *ref_ptr, int ref_stride);
+typedef void (*Sad4dFunc)(const uint8_t *src_ptr, int src_stride,
+                          const uint8_t *const ref_ptr[], int ref_stride,
+                          uint32_t *sad_array);
+
+typedef struct SadFuncs {
+    uint32_t width;
+    uint32_t height;
+    SadFunc sad_c;
+    SadFunc sad_avx512;
+    Sad4dFunc sad4d_c;
+    Sad4dFunc sad4d_avx512;
+} SadFuncs;
+
+#define SAD_FUNCS(w, h)                                          \
+    {                                                            \
+        w, h, aom_sad##w##x##h##_c, aom_sad##w##x##h##_avx512,   \
+            aom_sad##w##x##h##x4d_c, aom_sad##w##x##h##x4d_avx512 \
+    }
+
+static const SadFuncs sad_funcs[] = {SAD_FUNCS(32, 8),
+                                     SAD_FUNCS(32, 16),
+                                     SAD_FUNCS(32, 32),
+                                     SAD_FUNCS(32, 64),
+                                     SAD_FUNCS(64, 16),
+                                     SAD_FUNCS(64, 32),
+                                     SAD_FUNCS(64, 64),
+                                     SAD_FUNCS(64, 128),
+                                     SAD_FUNCS(128, 64),
+                                     SAD_FUNCS(128, 128)};
+
+class SadTest : public ::testing::Test {
+  public:
+    void SetUp() {
+        src_stride_ = eb_create_random_aligned_stride(2 * MAX_SB_SIZE, 64);
+        ref_stride_ = eb_create_random_aligned_stride(2 * MAX_SB_SIZE, 64);
+        src_ = (uint8_t *)malloc(sizeof(*src_) * MAX_SB_SIZE * src_stride_);
+        ref_ = (uint8_t *)malloc(sizeof(*ref_) * (MAX_SB_SIZE + 3) *
+                                 ref_stride_);
+    }
+    void TearDown() {
+        free(ref_);
+        free(src_);
+        aom_clear_system_state();
+    }
+
+  protected:
+    void RunCheckOutput(void (*init)(SadTest *));
+
+    static void init_random(SadTest *t) {
+        eb_buf_random_u8(t->src_, MAX_SB_SIZE * t->src_stride_);
+        eb_buf_random_u8(t->ref_, (MAX_SB_SIZE + 3) * t->ref_stride_);
+    }
+    // Largest possible SADs
+    static void init_extreme(SadTest *t) {
+        memset(t->src_, 255, MAX_SB_SIZE * t->src_stride_);
+        memset(t->ref_, 0, (MAX_SB_SIZE + 3) * t->ref_stride_);
+    }
+
+    uint8_t *src_;
+    uint8_t *ref_;
+    uint32_t src_stride_;
+    uint32_t ref_stride_;
+};
+
+void SadTest::RunCheckOutput(void (*init)(SadTest *)) {
+    if (!CanUseAvx512Features())
+        return;
+
+    for (int i = 0; i < 10; i++) {
+        init(this);
+        for (size_t f = 0; f < sizeof(sad_funcs) / sizeof(sad_funcs[0]);
+             f++) {
+            const SadFuncs *funcs = &sad_funcs[f];
+            const uint8_t *const refs[4] = {ref_,
+                                            ref_ + 1,
+                                            ref_ + ref_stride_,
+                                            ref_ + 3 * ref_stride_ + 3};
+            uint32_t sad4d_org[4], sad4d_opt[4];
+
+            const uint32_t sad_org =
+                funcs->sad_c(src_, src_stride_, ref_, ref_stride_);
+            const uint32_t sad_opt =
+                funcs->sad_avx512(src_, src_stride_, ref_, ref_stride_);
+            EXPECT_EQ(sad_org, sad_opt)
+                << funcs->width << "x" << funcs->height;
+
+            funcs->sad4d_c(src_, src_stride_, refs, ref_stride_, sad4d_org);
+            funcs->sad4d_avx512(
+                src_, src_stride_, refs, ref_stride_, sad4d_opt);
+            for (int j = 0; j < 4; j++) {
+                EXPECT_EQ(sad4d_org[j], sad4d_opt[j])
+                    << funcs->width << "x" << funcs->height << "x4d ref "
+                    << j;
+            }
+        }
+    }
+}
+
+TEST_F(SadTest, CheckOutputAvx512) {
+    RunCheckOutput(init_random);
+}
+
+TEST_F(SadTest, CheckOutputAvx512Extreme) {
+    RunCheckOutput(init_extreme);
+}
+
+}  // namespace
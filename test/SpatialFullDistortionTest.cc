@@ -11,6 +11,7 @@
 #include "EbDefinitions.h"
 #include "EbPictureOperators_AVX2.h"
 #include "EbTransforms.h"
+#include "EbUtility.h"
 #include "EbUnitTestUtility.h"
 #include "random.h"
 #include "util.h"
@@ -36,7 +37,7 @@ class SpatialFullDistortionTest : public ::testing::Test {
     }
 
   protected:
-    void RunCheckOutput();
+    void RunCheckOutput(EbSpatialFullDistType func);
     void RunSpeedTest();
 
     void init_data() {
@@ -53,7 +54,7 @@ class SpatialFullDistortionTest : public ::testing::Test {
 SpatialFullDistortionTest::~SpatialFullDistortionTest() {
 }
 
-void SpatialFullDistortionTest::RunCheckOutput() {
+void SpatialFullDistortionTest::RunCheckOutput(EbSpatialFullDistType func) {
     for (int i = 0; i < 10; i++) {
         init_data();
         for (uint32_t area_width = 4; area_width <= 128; area_width += 4) {
@@ -68,15 +69,14 @@ void SpatialFullDistortionTest::RunCheckOutput() {
                                                      recon_stride_,
                                                      area_width,
                                                      area_height);
-                const uint64_t dist_opt =
-                    spatial_full_distortion_kernel_avx2(input_,
-                                                        0,
-                                                        input_stride_,
-                                                        recon_,
-                                                        0,
-                                                        recon_stride_,
-                                                        area_width,
-                                                        area_height);
+                const uint64_t dist_opt = func(input_,
+                                               0,
+                                               input_stride_,
+                                               recon_,
+                                               0,
+                                               recon_stride_,
+                                               area_width,
+                                               area_height);
 
                 EXPECT_EQ(dist_org, dist_opt)
                     << area_width << "x" << area_height;
@@ -152,7 +152,13 @@ void SpatialFullDistortionTest::RunSpeedTest() {
 }
 
 TEST_F(SpatialFullDistortionTest, CheckOutput) {
-    RunCheckOutput();
+    RunCheckOutput(spatial_full_distortion_kernel_avx2);
+}
+
+TEST_F(SpatialFullDistortionTest, CheckOutputAvx512) {
+    if (!CanUseAvx512Features())
+        return;
+    RunCheckOutput(spatial_full_distortion_kernel_avx512);
 }
 
 TEST_F(SpatialFullDistortionTest, DISABLED_Speed) {
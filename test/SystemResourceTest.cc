@@ -0,0 +1,161 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SystemResourceTest.cc
+ *
+ * @brief Unit test of the EbSystemResource fifos shared by the encoder
+ * pipeline stages: several producer and consumer threads move numbered
+ * objects through one system resource. Built with LOCK_FREE_FIFO, this
+ * exercises the lock-free ring of the muxing queues.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "EbDefinitions.h"
+#include "EbObject.h"
+#include "EbSystemResourceManager.h"
+
+namespace {
+
+static const uint32_t sentinel = ~0u;
+
+typedef struct TestObject {
+    EbDctor dctor;
+    uint32_t value;
+} TestObject;
+
+static EbErrorType test_object_ctor(TestObject *object_ptr,
+                                    EbPtr object_init_data_ptr) {
+    (void)object_ptr;
+    (void)object_init_data_ptr;
+    return EB_ErrorNone;
+}
+
+static EbErrorType test_object_creator(EbPtr *object_dbl_ptr,
+                                       EbPtr object_init_data_ptr) {
+    TestObject *obj;
+
+    *object_dbl_ptr = NULL;
+    EB_NEW(obj, test_object_ctor, object_init_data_ptr);
+    *object_dbl_ptr = obj;
+
+    return EB_ErrorNone;
+}
+
+static EbErrorType create_resource(EbSystemResource **resource_ptr,
+                                   uint32_t object_count,
+                                   uint32_t producer_count,
+                                   uint32_t consumer_count,
+                                   EbFifo ***producer_fifo_ptr_array,
+                                   EbFifo ***consumer_fifo_ptr_array) {
+    EB_NEW(*resource_ptr,
+           eb_system_resource_ctor,
+           object_count,
+           producer_count,
+           consumer_count,
+           producer_fifo_ptr_array,
+           consumer_fifo_ptr_array,
+           EB_TRUE,
+           test_object_creator,
+           NULL,
+           NULL);
+    return EB_ErrorNone;
+}
+
+static void post_value(EbFifo *producer_fifo_ptr, uint32_t value) {
+    EbObjectWrapper *wrapper_ptr;
+
+    eb_get_empty_object(producer_fifo_ptr, &wrapper_ptr);
+    ((TestObject *)wrapper_ptr->object_ptr)->value = value;
+    eb_post_full_object(wrapper_ptr);
+}
+
+/** Every value posted by the producers reaches exactly one consumer, with
+ * an object pool much smaller than the number of values so the fifos wrap
+ * around many times */
+static void run_producers_consumers(uint32_t object_count,
+                                    uint32_t producer_count,
+                                    uint32_t consumer_count,
+                                    uint32_t values_per_producer) {
+    EbSystemResource *resource_ptr = nullptr;
+    EbFifo **producer_fifo_ptr_array;
+    EbFifo **consumer_fifo_ptr_array;
+
+    ASSERT_EQ(EB_ErrorNone,
+              create_resource(&resource_ptr,
+                              object_count,
+                              producer_count,
+                              consumer_count,
+                              &producer_fifo_ptr_array,
+                              &consumer_fifo_ptr_array));
+
+    std::vector<std::vector<uint32_t> > received(consumer_count);
+    std::vector<std::thread> consumers;
+    for (uint32_t c = 0; c < consumer_count; c++) {
+        consumers.emplace_back([&, c]() {
+            for (;;) {
+                EbObjectWrapper *wrapper_ptr;
+                eb_get_full_object(consumer_fifo_ptr_array[c], &wrapper_ptr);
+                const uint32_t value =
+                    ((TestObject *)wrapper_ptr->object_ptr)->value;
+                eb_release_object(wrapper_ptr);
+                if (value == sentinel)
+                    break;
+                received[c].push_back(value);
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < producer_count; p++) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < values_per_producer; i++)
+                post_value(producer_fifo_ptr_array[p],
+                           p * values_per_producer + i);
+        });
+    }
+    for (auto &t : producers)
+        t.join();
+    // One sentinel per consumer, each consumer stops at the first it gets
+    for (uint32_t c = 0; c < consumer_count; c++)
+        post_value(producer_fifo_ptr_array[0], sentinel);
+    for (auto &t : consumers)
+        t.join();
+
+    std::vector<uint32_t> seen(producer_count * values_per_producer, 0);
+    for (uint32_t c = 0; c < consumer_count; c++) {
+        for (const uint32_t value : received[c]) {
+            ASSERT_LT(value, seen.size());
+            seen[value]++;
+        }
+    }
+    for (uint32_t value = 0; value < seen.size(); value++)
+        ASSERT_EQ(1u, seen[value]) << "value " << value;
+
+    EB_DELETE(resource_ptr);
+}
+
+TEST(SystemResourceTest, OneProducerOneConsumer) {
+    run_producers_consumers(4, 1, 1, 100000);
+}
+
+TEST(SystemResourceTest, ManyProducersOneConsumer) {
+    run_producers_consumers(8, 4, 1, 25000);
+}
+
+TEST(SystemResourceTest, OneProducerManyConsumers) {
+    run_producers_consumers(8, 1, 4, 100000);
+}
+
+TEST(SystemResourceTest, ManyProducersManyConsumers) {
+    run_producers_consumers(16, 4, 4, 25000);
+}
+
+}  // namespace
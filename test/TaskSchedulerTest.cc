@@ -0,0 +1,193 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file TaskSchedulerTest.cc
+ *
+ * @brief Unit test of the work-stealing task scheduler: threads outside of
+ * the pool post numbered objects to a registered stage, and every task posts
+ * its object again from the worker a few times, so the workers push to and
+ * pop from their own deques while the others steal from them.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "EbDefinitions.h"
+#include "EbObject.h"
+#include "EbSystemResourceManager.h"
+#include "EbTaskScheduler.h"
+
+namespace {
+
+typedef struct TestTaskObject {
+    EbDctor dctor;
+    uint32_t id;
+    uint32_t hop;
+} TestTaskObject;
+
+static EbErrorType test_task_object_ctor(TestTaskObject *object_ptr,
+                                         EbPtr object_init_data_ptr) {
+    (void)object_ptr;
+    (void)object_init_data_ptr;
+    return EB_ErrorNone;
+}
+
+static EbErrorType test_task_object_creator(EbPtr *object_dbl_ptr,
+                                            EbPtr object_init_data_ptr) {
+    TestTaskObject *obj;
+
+    *object_dbl_ptr = NULL;
+    EB_NEW(obj, test_task_object_ctor, object_init_data_ptr);
+    *object_dbl_ptr = obj;
+
+    return EB_ErrorNone;
+}
+
+/** State shared by the workers; each worker gets its own TestWorkerContext
+ * as the stage context */
+struct TestTaskState {
+    uint32_t hop_count;
+    std::vector<std::atomic<uint32_t> > run_count;  // per (id, hop)
+    std::atomic<uint32_t> done_count;
+
+    TestTaskState(uint32_t item_count, uint32_t hops)
+        : hop_count(hops), run_count(item_count * hops), done_count(0) {
+        for (auto &count : run_count)
+            count = 0;
+    }
+};
+
+struct TestWorkerContext {
+    TestTaskState *state;
+    uint32_t task_count;
+};
+
+static void test_task(void *context_ptr, EbObjectWrapper *wrapper_ptr) {
+    TestWorkerContext *context = (TestWorkerContext *)context_ptr;
+    TestTaskState *state = context->state;
+    TestTaskObject *obj = (TestTaskObject *)wrapper_ptr->object_ptr;
+
+    context->task_count++;
+    state->run_count[obj->id * state->hop_count + obj->hop]++;
+    if (++obj->hop < state->hop_count) {
+        // Queued on the deque of this worker, where it may be stolen
+        eb_post_full_object(wrapper_ptr);
+    } else {
+        eb_release_object(wrapper_ptr);
+        state->done_count++;
+    }
+}
+
+static EbErrorType create_stage(EbTaskScheduler **scheduler_ptr,
+                                EbSystemResource **resource_ptr,
+                                EbFifo ***producer_fifo_ptr_array,
+                                EbFifo ***consumer_fifo_ptr_array,
+                                uint32_t object_count, uint32_t producer_count,
+                                uint32_t worker_count,
+                                EbPtr *context_ptr_array) {
+    EB_NEW(*resource_ptr,
+           eb_system_resource_ctor,
+           object_count,
+           producer_count,
+           1,
+           producer_fifo_ptr_array,
+           consumer_fifo_ptr_array,
+           EB_TRUE,
+           test_task_object_creator,
+           NULL,
+           NULL);
+    EB_NEW(*scheduler_ptr, eb_task_scheduler_ctor, worker_count, 1);
+    return eb_task_scheduler_add_stage(
+        *scheduler_ptr, *resource_ptr, test_task, context_ptr_array);
+}
+
+/** Every (item, hop) task runs exactly once, whichever worker pops or
+ * steals it */
+static void run_task_scheduler(uint32_t worker_count, uint32_t object_count,
+                               uint32_t producer_count,
+                               uint32_t items_per_producer,
+                               uint32_t hop_count) {
+    const uint32_t item_count = producer_count * items_per_producer;
+    TestTaskState state(item_count, hop_count);
+    std::vector<TestWorkerContext> contexts(worker_count);
+    std::vector<EbPtr> context_ptr_array(worker_count);
+    EbTaskScheduler *scheduler_ptr = nullptr;
+    EbSystemResource *resource_ptr = nullptr;
+    EbFifo **producer_fifo_ptr_array;
+    EbFifo **consumer_fifo_ptr_array;
+
+    for (uint32_t w = 0; w < worker_count; w++) {
+        contexts[w].state = &state;
+        contexts[w].task_count = 0;
+        context_ptr_array[w] = &contexts[w];
+    }
+    ASSERT_EQ(EB_ErrorNone,
+              create_stage(&scheduler_ptr,
+                           &resource_ptr,
+                           &producer_fifo_ptr_array,
+                           &consumer_fifo_ptr_array,
+                           object_count,
+                           producer_count,
+                           worker_count,
+                           context_ptr_array.data()));
+    ASSERT_EQ(EB_ErrorNone, eb_task_scheduler_start(scheduler_ptr));
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < producer_count; p++) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < items_per_producer; i++) {
+                EbObjectWrapper *wrapper_ptr;
+                eb_get_empty_object(producer_fifo_ptr_array[p], &wrapper_ptr);
+                TestTaskObject *obj = (TestTaskObject *)wrapper_ptr->object_ptr;
+                obj->id = p * items_per_producer + i;
+                obj->hop = 0;
+                eb_post_full_object(wrapper_ptr);
+            }
+        });
+    }
+    for (auto &t : producers)
+        t.join();
+
+    // The workers never exit, wait for the last task to complete
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while (state.done_count < item_count &&
+           std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_EQ(item_count, state.done_count.load()) << "tasks were lost";
+
+    // Stop the workers before checking their counts
+    EB_DELETE(scheduler_ptr);
+
+    uint32_t task_count = 0;
+    for (uint32_t w = 0; w < worker_count; w++)
+        task_count += contexts[w].task_count;
+    EXPECT_EQ(item_count * hop_count, task_count);
+    for (uint32_t i = 0; i < item_count * hop_count; i++)
+        ASSERT_EQ(1u, state.run_count[i].load())
+            << "item " << i / hop_count << " hop " << i % hop_count;
+
+    EB_DELETE(resource_ptr);
+}
+
+TEST(TaskSchedulerTest, OneWorker) {
+    run_task_scheduler(1, 8, 1, 10000, 4);
+}
+
+TEST(TaskSchedulerTest, ManyWorkersOneProducer) {
+    run_task_scheduler(4, 16, 1, 20000, 8);
+}
+
+TEST(TaskSchedulerTest, ManyWorkersManyProducers) {
+    run_task_scheduler(8, 32, 4, 10000, 8);
+}
+
+}  // namespace
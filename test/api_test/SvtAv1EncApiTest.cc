@@ -11,6 +11,8 @@
  * @author Cidana-Edmond, Cidana-Ryan, Cidana-Wenyao
  *
  ******************************************************************************/
+#include <thread>
+#include <vector>
 #include "EbSvtAv1Enc.h"
 #include "gtest/gtest.h"
 #include "SvtAv1EncApiTest.h"
@@ -90,6 +92,25 @@ TEST(EncApiTest, check_null_pointer) {
     // nullptr)); EXPECT_EQ(EB_ErrorBadParameter, eb_svt_get_packet(nullptr,
     // nullptr, 0)); EXPECT_EQ(EB_ErrorBadParameter, eb_svt_get_recon(nullptr,
     // nullptr)); No return value, just feed nullptr as parameter.
+    // get input buffer requirements with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_get_input_buffer_requirements(nullptr, nullptr));
+    // send picture in place with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_send_picture_in_place(nullptr, nullptr, nullptr,
+                                               nullptr));
+    // send picture with motion with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_send_picture_with_motion(nullptr, nullptr, nullptr));
+    // create ladder with null pointer or no rendition
+    EXPECT_EQ(EB_ErrorBadParameter, eb_svt_ladder_create(nullptr, 2));
+    EbSvtLadder *ladder = nullptr;
+    EXPECT_EQ(EB_ErrorBadParameter, eb_svt_ladder_create(&ladder, 0));
+    // join ladder with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_join_ladder(nullptr, nullptr, 0));
+    // destroy ladder with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter, eb_svt_ladder_destroy(nullptr));
     // release output buffer with null pointer
     eb_svt_release_out_buffer(nullptr);
     // close encoder with null pointer
@@ -194,4 +215,147 @@ TEST(EncApiTest, DISABLED_repeat_normal_setup) {
     }
 }
 
+/** @brief encode_ladder_rendition sends frame_count pictures of a moving
+ * pattern to an initialized encoder, then drains its packets up to EOS and
+ * returns the number of packets */
+static int encode_ladder_rendition(EbComponentType *enc_handle,
+                                   const uint32_t width, const uint32_t height,
+                                   const int frame_count) {
+    std::vector<uint8_t> luma(width * height);
+    std::vector<uint8_t> chroma(width * height / 4, 128);
+    EbSvtIOFormat frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.luma = luma.data();
+    frame.cb = chroma.data();
+    frame.cr = chroma.data();
+    frame.y_stride = width;
+    frame.cb_stride = width / 2;
+    frame.cr_stride = width / 2;
+    frame.width = width;
+    frame.height = height;
+
+    EbBufferHeaderType input;
+    memset(&input, 0, sizeof(input));
+    input.size = sizeof(EbBufferHeaderType);
+    input.p_buffer = (uint8_t *)&frame;
+    input.n_filled_len = width * height * 3 / 2;
+    input.pic_type = EB_AV1_INVALID_PICTURE;
+
+    int packet_count = 0;
+    bool eos = false;
+    for (int i = 0; i <= frame_count && !eos; ++i) {
+        if (i < frame_count) {
+            // a diagonal gradient moving by 2 pixels per frame, scaled
+            // with the rendition so the leader motion applies
+            for (uint32_t y = 0; y < height; ++y)
+                for (uint32_t x = 0; x < width; ++x)
+                    luma[y * width + x] =
+                        (uint8_t)(((x + y) * 352 / width + 2 * i) & 0xff);
+            input.flags = 0;
+            input.pts = i;
+            EXPECT_EQ(EB_ErrorNone, eb_svt_enc_send_picture(enc_handle, &input))
+                << "eb_svt_enc_send_picture failed at " << i;
+        } else {
+            EbBufferHeaderType eos_buffer;
+            memset(&eos_buffer, 0, sizeof(eos_buffer));
+            eos_buffer.flags = EB_BUFFERFLAG_EOS;
+            eos_buffer.pic_type = EB_AV1_INVALID_PICTURE;
+            EXPECT_EQ(EB_ErrorNone,
+                      eb_svt_enc_send_picture(enc_handle, &eos_buffer))
+                << "eb_svt_enc_send_picture EOS failed";
+        }
+        // drain what is ready, then block for the rest once EOS is sent
+        const uint8_t pic_send_done = i == frame_count ? 1 : 0;
+        do {
+            EbBufferHeaderType *output = nullptr;
+            const EbErrorType ret =
+                eb_svt_get_packet(enc_handle, &output, pic_send_done);
+            if (ret == EB_NoErrorEmptyQueue || output == nullptr) {
+                EXPECT_EQ(EB_NoErrorEmptyQueue, ret)
+                    << "eb_svt_get_packet failed";
+                eos = ret != EB_NoErrorEmptyQueue;
+                break;
+            }
+            eos = (output->flags & EB_BUFFERFLAG_EOS) != 0;
+            if (output->n_filled_len)
+                packet_count++;
+            eb_svt_release_out_buffer(&output);
+        } while (pic_send_done && !eos);
+    }
+    EXPECT_TRUE(eos) << "encoder did not reach EOS";
+    return packet_count;
+}
+
+/** @brief encode_ladder is a api test case
+ * EncApiTest.encode_ladder is a api test case of an ABR ladder of two
+ * renditions encoding the same pictures
+ *
+ * Test strategy: <br>
+ * Join a leader and a follower of half its size to a ladder, check that the
+ * leader can not be initialized before the follower joins, then encode a few
+ * frames with each rendition drained by its own thread.
+ *
+ * Expected result: <br>
+ * Both renditions reach EOS with the same number of packets.
+ *
+ * Test coverage:
+ * eb_svt_ladder_create, eb_svt_enc_join_ladder, eb_svt_ladder_destroy.
+ */
+TEST(EncApiTest, encode_ladder) {
+    const uint32_t width[2] = {352, 176};
+    const uint32_t height[2] = {288, 144};
+    const int frame_count = 12;
+    SvtAv1Context context[2];
+    EbSvtLadder *ladder = nullptr;
+
+    ASSERT_EQ(EB_ErrorNone, eb_svt_ladder_create(&ladder, 2));
+    for (int r = 0; r < 2; ++r) {
+        memset(&context[r], 0, sizeof(context[r]));
+        ASSERT_EQ(EB_ErrorNone,
+                  eb_init_handle(
+                      &context[r].enc_handle, &context[r], &context[r].enc_params))
+            << "eb_init_handle failed";
+        context[r].enc_params.source_width = width[r];
+        context[r].enc_params.source_height = height[r];
+        ASSERT_EQ(EB_ErrorNone,
+                  eb_svt_enc_set_parameter(context[r].enc_handle,
+                                           &context[r].enc_params))
+            << "eb_svt_enc_set_parameter failed";
+    }
+
+    // join the leader, out of range and repeated joins are rejected
+    ASSERT_EQ(EB_ErrorNone,
+              eb_svt_enc_join_ladder(context[0].enc_handle, ladder, 0));
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_join_ladder(context[1].enc_handle, ladder, 2));
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_join_ladder(context[1].enc_handle, ladder, 0));
+    // the leader can not start before all the renditions joined
+    EXPECT_EQ(EB_ErrorBadParameter, eb_init_encoder(context[0].enc_handle));
+    ASSERT_EQ(EB_ErrorNone,
+              eb_svt_enc_join_ladder(context[1].enc_handle, ladder, 1));
+    for (int r = 0; r < 2; ++r)
+        ASSERT_EQ(EB_ErrorNone, eb_init_encoder(context[r].enc_handle))
+            << "eb_init_encoder failed";
+
+    int packet_count[2] = {0, 0};
+    std::vector<std::thread> threads;
+    for (int r = 0; r < 2; ++r) {
+        threads.emplace_back([&, r]() {
+            packet_count[r] = encode_ladder_rendition(
+                context[r].enc_handle, width[r], height[r], frame_count);
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    EXPECT_GT(packet_count[0], 0);
+    EXPECT_EQ(packet_count[0], packet_count[1]);
+
+    for (int r = 0; r < 2; ++r) {
+        EXPECT_EQ(EB_ErrorNone, eb_deinit_encoder(context[r].enc_handle));
+        EXPECT_EQ(EB_ErrorNone, eb_deinit_handle(context[r].enc_handle));
+    }
+    EXPECT_EQ(EB_ErrorNone, eb_svt_ladder_destroy(ladder));
+}
+
 }  // namespace
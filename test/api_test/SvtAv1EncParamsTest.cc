@@ -325,10 +325,18 @@ PARAM_TEST(EncParamSearchAreaWidthTest);
 DEFINE_PARAM_TEST_CLASS(EncParamSearchAreaHeightTest, search_area_height);
 PARAM_TEST(EncParamSearchAreaHeightTest);
 
+/** Test case for half_pel_planes*/
+DEFINE_PARAM_TEST_CLASS(EncParamHalfPelPlanesTest, half_pel_planes);
+PARAM_TEST(EncParamHalfPelPlanesTest);
+
 /** Test case for constrained_intra*/
 DEFINE_PARAM_TEST_CLASS(EncParamConstrainedIntraTest, constrained_intra);
 PARAM_TEST(EncParamConstrainedIntraTest);
 
+/** Test case for reuse_md_recon*/
+DEFINE_PARAM_TEST_CLASS(EncParamReuseMdReconTest, reuse_md_recon);
+PARAM_TEST(EncParamReuseMdReconTest);
+
 /** Test case for rate_control_mode*/
 DEFINE_PARAM_TEST_CLASS(EncParamRateCtrlModeTest, rate_control_mode);
 PARAM_TEST(EncParamRateCtrlModeTest);
@@ -398,6 +406,14 @@ PARAM_TEST(EncParamLogicalProcessorsTest);
 DEFINE_PARAM_TEST_CLASS(EncParamTargetSocketTest, target_socket);
 PARAM_TEST(EncParamTargetSocketTest);
 
+/** Test case for task_pool*/
+DEFINE_PARAM_TEST_CLASS(EncParamTaskPoolTest, task_pool);
+PARAM_TEST(EncParamTaskPoolTest);
+
+/** Test case for memory_budget*/
+DEFINE_PARAM_TEST_CLASS(EncParamMemoryBudgetTest, memory_budget);
+PARAM_TEST(EncParamMemoryBudgetTest);
+
 /** Test case for recon_enabled*/
 DEFINE_PARAM_TEST_CLASS(EncParamReconEnabledTest, recon_enabled);
 PARAM_TEST(EncParamReconEnabledTest);
@@ -412,6 +428,10 @@ DEFINE_PARAM_TEST_CLASS(EncParamTileRowsTest, tile_rows);
 PARAM_TEST(EncParamTileRowsTest);
 #endif
 
+/** Test case for frame_end_cdf_update*/
+DEFINE_PARAM_TEST_CLASS(EncParamFrameEndCdfUpdateTest, frame_end_cdf_update);
+PARAM_TEST(EncParamFrameEndCdfUpdateTest);
+
 /** Test case for screen_content_mode*/
 DEFINE_PARAM_TEST_CLASS(EncParamScreenContentModeTest, screen_content_mode);
 PARAM_TEST(EncParamScreenContentModeTest);
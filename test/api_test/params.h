@@ -606,6 +606,21 @@ static const vector<uint32_t> invalid_search_area_height = {
     0, 257, 1000,  // ...
 };
 
+/* Interpolate the half-pel positions of the PA reference pictures once, for
+ * the motion search of every super block.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_half_pel_planes = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_half_pel_planes = {
+    EB_FALSE,
+    EB_TRUE,
+};
+static const vector<EbBool> invalid_half_pel_planes = {
+    (EbBool)2,
+};
+
 // MD Parameters
 /* Enable the use of Constrained Intra, which yields sending two picture
  * parameter sets in the elementary streams .
@@ -622,6 +637,21 @@ static const vector<EbBool> invalid_constrained_intra = {
     // none
 };
 
+/* Copy the reconstruction and coefficients of the MD winners of 8 bit inter
+ * blocks in the encode pass when the prediction is the same.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_reuse_md_recon = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_reuse_md_recon = {
+    EB_FALSE,
+    EB_TRUE,
+};
+static const vector<EbBool> invalid_reuse_md_recon = {
+    // none
+};
+
 // Rate Control
 /* Rate control mode.
  *
@@ -953,6 +983,37 @@ static const vector<int32_t> invalid_target_socket = {
     2,
 };
 
+/* Run the multi-threaded stages on one work-stealing pool sized to the
+ * logical processors, instead of on fixed per-stage thread pools.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_task_pool = {
+    0,
+};
+static const vector<uint32_t> valid_task_pool = {
+    0,
+    1,
+};
+static const vector<uint32_t> invalid_task_pool = {
+    2,
+};
+
+/* Memory the picture pools of the channel may use, in MB. A budget below what
+ * the smallest pools need is only warned about.
+ *
+ * 0 = the pools are sized from the frame rate and core count.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_memory_budget = {
+    0,
+};
+static const vector<uint32_t> valid_memory_budget = {
+    0, 1, 64, 256, 1024, 4096,  // ...
+};
+static const vector<uint32_t> invalid_memory_budget = {
+    // none
+};
+
 // Debug tools
 
 /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -1001,6 +1062,13 @@ static const vector<int32_t> invalid_tile_rows = {
 };
 #endif
 
+/* Carry the CDFs of the LAST reference over to the picture
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_frame_end_cdf_update = {0};
+static const vector<uint32_t> valid_frame_end_cdf_update = {0, 1};
+static const vector<uint32_t> invalid_frame_end_cdf_update = {2};
+
 /* Flag to signal the content being a screen sharing content type
  *
  * Default is 2. */
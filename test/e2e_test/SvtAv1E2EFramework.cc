@@ -86,6 +86,8 @@ SvtAv1E2ETestFramework::SvtAv1E2ETestFramework() : enc_setting(GetParam()) {
     psnr_src_ = nullptr;
     recon_queue_ = nullptr;
     refer_dec_ = nullptr;
+    svt_dec_handle_ = nullptr;
+    svt_dec_output_ = nullptr;
     output_file_ = nullptr;
     obu_frame_header_size_ = 0;
     collect_ = nullptr;
@@ -94,6 +96,7 @@ SvtAv1E2ETestFramework::SvtAv1E2ETestFramework() : enc_setting(GetParam()) {
     use_ext_qp_ = false;
     enable_recon = false;
     enable_decoder = false;
+    enable_svt_decoder = false;
     enable_stat = false;
     enable_save_bitstream = false;
     enable_analyzer = false;
@@ -227,6 +230,8 @@ void SvtAv1E2ETestFramework::init_test(TestVideoVector &test_vector) {
     if (enable_decoder) {
         refer_dec_ = create_reference_decoder(enable_analyzer);
         ASSERT_NE(refer_dec_, nullptr) << "can not create reference decoder!!";
+        if (enable_svt_decoder)
+            init_svt_decoder();
     }
 
     // create IvfFile if required.
@@ -274,6 +279,7 @@ void SvtAv1E2ETestFramework::deinit_test() {
         delete refer_dec_;
         refer_dec_ = nullptr;
     }
+    deinit_svt_decoder();
 
     // close and release the video src
     ASSERT_NE(video_src_, nullptr);
@@ -673,10 +679,18 @@ void SvtAv1E2ETestFramework::decode_compress_data(const uint8_t *data,
 
     // input the compressed data into decoder
     ASSERT_EQ(refer_dec_->decode(data, size), RefDecoder::REF_CODEC_OK);
+    if (svt_dec_handle_) {
+        EbErrorType ret = eb_svt_decode_frame(svt_dec_handle_, data, size);
+        ASSERT_EQ(ret, EB_ErrorNone)
+            << "eb_svt_decode_frame return error:" << ret;
+    }
 
     VideoFrame ref_frame;
     memset(&ref_frame, 0, sizeof(ref_frame));
     while (refer_dec_->get_frame(ref_frame) == RefDecoder::REF_CODEC_OK) {
+        // SVT-AV1 decoder output should be the same as reference decoder
+        if (svt_dec_handle_)
+            check_svt_dec_frame(ref_frame);
         if (recon_queue_) {
             // compare tools
             if (ref_compare_ == nullptr) {
@@ -694,6 +708,93 @@ void SvtAv1E2ETestFramework::decode_compress_data(const uint8_t *data,
     }
 }
 
+void SvtAv1E2ETestFramework::init_svt_decoder() {
+    EbSvtAv1DecConfiguration config;
+    EbErrorType return_error =
+        eb_dec_init_handle(&svt_dec_handle_, nullptr, &config);
+    ASSERT_EQ(return_error, EB_ErrorNone)
+        << "eb_dec_init_handle return error:" << return_error;
+
+    const uint32_t width = av1enc_ctx_.enc_params.source_width;
+    const uint32_t height = av1enc_ctx_.enc_params.source_height;
+    const uint32_t bit_depth = av1enc_ctx_.enc_params.encoder_bit_depth;
+    config.max_picture_width = width;
+    config.max_picture_height = height;
+    config.max_bit_depth = (EbBitDepth)bit_depth;
+    config.max_color_format = av1enc_ctx_.enc_params.encoder_color_format;
+    return_error = eb_svt_dec_set_parameter(svt_dec_handle_, &config);
+    ASSERT_EQ(return_error, EB_ErrorNone)
+        << "eb_svt_dec_set_parameter return error:" << return_error;
+    return_error = eb_init_decoder(svt_dec_handle_);
+    ASSERT_EQ(return_error, EB_ErrorNone)
+        << "eb_init_decoder return error:" << return_error;
+
+    // output buffer of 420 frame, with 16-bit samples for 10-bit
+    const uint32_t luma_size = width * height * (bit_depth > 8 ? 2 : 1);
+    EbSvtIOFormat *out_img = new EbSvtIOFormat;
+    memset(out_img, 0, sizeof(*out_img));
+    out_img->luma = new uint8_t[luma_size];
+    out_img->cb = new uint8_t[luma_size >> 2];
+    out_img->cr = new uint8_t[luma_size >> 2];
+    out_img->y_stride = width;
+    out_img->cb_stride = width >> 1;
+    out_img->cr_stride = width >> 1;
+    out_img->width = width;
+    out_img->height = height;
+    svt_dec_output_ = new EbBufferHeaderType;
+    memset(svt_dec_output_, 0, sizeof(*svt_dec_output_));
+    svt_dec_output_->size = sizeof(EbBufferHeaderType);
+    svt_dec_output_->p_buffer = (uint8_t *)out_img;
+}
+
+void SvtAv1E2ETestFramework::deinit_svt_decoder() {
+    if (svt_dec_handle_) {
+        EbErrorType return_error = eb_deinit_decoder(svt_dec_handle_);
+        EXPECT_EQ(return_error, EB_ErrorNone)
+            << "eb_deinit_decoder return error:" << return_error;
+        return_error = eb_dec_deinit_handle(svt_dec_handle_);
+        EXPECT_EQ(return_error, EB_ErrorNone)
+            << "eb_dec_deinit_handle return error:" << return_error;
+        svt_dec_handle_ = nullptr;
+    }
+    if (svt_dec_output_) {
+        EbSvtIOFormat *out_img = (EbSvtIOFormat *)svt_dec_output_->p_buffer;
+        delete[] out_img->luma;
+        delete[] out_img->cb;
+        delete[] out_img->cr;
+        delete out_img;
+        delete svt_dec_output_;
+        svt_dec_output_ = nullptr;
+    }
+}
+
+void SvtAv1E2ETestFramework::check_svt_dec_frame(const VideoFrame &ref_frame) {
+    EbAV1StreamInfo stream_info;
+    EbAV1FrameInfo frame_info;
+    EbErrorType return_error = eb_svt_dec_get_picture(
+        svt_dec_handle_, svt_dec_output_, &stream_info, &frame_info);
+    ASSERT_EQ(return_error, EB_ErrorNone)
+        << "SVT-AV1 decoder has no output for frame " << ref_frame.timestamp;
+
+    // wrap the decoder output in a video frame to compare, without buffer
+    const EbSvtIOFormat *out_img = (EbSvtIOFormat *)svt_dec_output_->p_buffer;
+    const uint32_t bytes_per_sample =
+        av1enc_ctx_.enc_params.encoder_bit_depth > 8 ? 2 : 1;
+    VideoFrame svt_frame;
+    svt_frame.format = ref_frame.format;
+    svt_frame.width = out_img->width;
+    svt_frame.height = out_img->height;
+    svt_frame.bits_per_sample = bytes_per_sample == 2 ? 10 : 8;
+    svt_frame.stride[0] = out_img->y_stride * bytes_per_sample;
+    svt_frame.stride[1] = out_img->cb_stride * bytes_per_sample;
+    svt_frame.stride[2] = out_img->cr_stride * bytes_per_sample;
+    svt_frame.planes[0] = out_img->luma;
+    svt_frame.planes[1] = out_img->cb;
+    svt_frame.planes[2] = out_img->cr;
+    ASSERT_TRUE(compare_image(&svt_frame, &ref_frame))
+        << "SVT-AV1 decoder output compare failed on " << ref_frame.timestamp;
+}
+
 void SvtAv1E2ETestFramework::check_psnr(const VideoFrame &frame) {
     // Calculate psnr with input frame and
     EbSvtIOFormat *src_frame =
@@ -20,6 +20,7 @@
 #include "PerformanceCollect.h"
 #include "CompareTools.h"
 #include "EbDefinitions.h"
+#include "EbSvtAv1Dec.h"
 #include "RefDecoder.h"
 
 #define INPUT_SIZE_576p_TH 0x90000    // 0.58 Million
@@ -159,6 +160,15 @@ class SvtAv1E2ETestFramework : public ::testing::TestWithParam<EncTestSetting> {
      * @param frame  video frame from reference decoder
      */
     void check_psnr(const VideoFrame &frame);
+    /** create the SVT-AV1 decoder and its output buffer */
+    void init_svt_decoder();
+    /** destroy the SVT-AV1 decoder and its output buffer */
+    void deinit_svt_decoder();
+    /** compare the output frame of SVT-AV1 decoder with the same frame from
+     * reference decoder
+     * @param ref_frame  video frame from reference decoder
+     */
+    void check_svt_dec_frame(const VideoFrame &ref_frame);
 
     /* TODO: add comments */
     void output_stat();
@@ -170,6 +180,9 @@ class SvtAv1E2ETestFramework : public ::testing::TestWithParam<EncTestSetting> {
     uint32_t frames_to_test_;  /**< frame count for this test */
     FrameQueue *recon_queue_;  /**< reconstructed frame collection */
     RefDecoder *refer_dec_;    /**< reference decoder context */
+    EbComponentType *svt_dec_handle_; /**< SVT-AV1 decoder handle */
+    EbBufferHeaderType *svt_dec_output_; /**< output buffer of SVT-AV1
+                                            decoder */
     IvfFile *output_file_;     /**< file handle for save encoder output data */
     uint8_t obu_frame_header_size_; /**< size of obu frame header */
     PerformanceCollect *collect_;   /**< performance and time collection*/
@@ -182,6 +195,9 @@ class SvtAv1E2ETestFramework : public ::testing::TestWithParam<EncTestSetting> {
     bool enable_recon; /**< flag to control if make encoder output recon yuvs or
                           not */
     bool enable_decoder;        /**< flag to control if create av1 decoder */
+    bool enable_svt_decoder; /**< flag to control if the stream is also decoded
+                                by SVT-AV1 decoder and compared with the
+                                reference decoder, requires enable_decoder */
     bool enable_stat;           /**< flag to control if output encoder stat */
     bool enable_save_bitstream; /**< flag to control if the bitstream is saved
                                    on disk */
@@ -125,6 +125,19 @@ static const std::vector<EncTestSetting> default_enc_settings = {
     {"RcQpTest6",
      {{"RateControlMode", "3"}, {"TargetBitRate", "750000"}, {"MaxQpAllowed", "50"}, {"MinQpAllowed", "20"}},
      res_480p_test_vectors},
+
+    // test frame end cdf update, the pictures start from the CDFs of LAST
+    {"FrameEndCdfUpdateTest1", {{"FrameEndCdfUpdate", "1"}}, default_test_vectors},
+    {"FrameEndCdfUpdateTest2",
+     {{"FrameEndCdfUpdate", "1"}, {"TileCol", "1"}, {"TileRow", "1"}},
+     default_test_vectors},
+
+    // test reuse of the MD reconstruction in the encode pass, the recon
+    // must still match the decoded frames
+    {"ReuseMdReconTest1", {{"ReuseMdRecon", "1"}}, default_test_vectors},
+    {"ReuseMdReconTest2",
+     {{"ReuseMdRecon", "1"}, {"RateControlMode", "0"}, {"QP", "20"}},
+     default_test_vectors},
 };
 /* clang-format on */
 
@@ -15,6 +15,7 @@
 #include "EbSvtAv1Enc.h"
 #include "gtest/gtest.h"
 #include "SvtAv1E2EFramework.h"
+#include "ConfigEncoder.h"
 
 using namespace svt_av1_e2e_test;
 using namespace svt_av1_e2e_test_vector;
@@ -164,3 +165,68 @@ static const std::vector<EncTestSetting> default_enc_settings = {
 INSTANTIATE_TEST_CASE_P(SvtAv1, ConformanceDeathTest,
                         ::testing::ValuesIn(default_enc_settings),
                         EncTestSetting::GetSettingName);
+
+/**
+ * @brief SVT-AV1 decoder conformance E2E test
+ *
+ * Test strategy:
+ * Setup SVT-AV1 encoder with the settings of each case, encode the input YUV
+ * data frames, and decode the output with both SVT-AV1 decoder and reference
+ * decoder.
+ *
+ * Expected result:
+ * The frames of SVT-AV1 decoder, with deblocking, CDEF and restoration
+ * applied, are the same as the frames of reference decoder.
+ *
+ * Test coverage:
+ * All test vectors, intra only streams and the filter settings
+ */
+class DecoderConformanceTest : public SvtAv1E2ETestFramework {
+  public:
+    DecoderConformanceTest() {
+        enc_config_ = create_enc_config();
+    }
+
+    virtual ~DecoderConformanceTest() {
+        release_enc_config(enc_config_);
+    }
+
+  protected:
+    void config_test() override {
+        enable_decoder = true;
+        enable_svt_decoder = true;
+        enable_recon = true;
+        // iterate the mappings and update config
+        for (auto &x : enc_setting.setting)
+            set_enc_config(enc_config_, x.first.c_str(), x.second.c_str());
+    }
+
+    void update_enc_setting() override {
+        copy_enc_param(&av1enc_ctx_.enc_params, enc_config_);
+        setup_src_param(video_src_, av1enc_ctx_.enc_params);
+    }
+
+  protected:
+    void *enc_config_;
+};
+
+TEST_P(DecoderConformanceTest, CompareWithRefDecoder) {
+    run_death_test();
+}
+
+/* clang-format off */
+/* The decoder supports the intra coding tools without screen content tools */
+static const std::vector<EncTestSetting> dec_conformance_settings = {
+    {"DecFilterTest1", {{"IntraPeriod", "0"}, {"ScreenContentMode", "0"}},
+     default_test_vectors},
+    {"DecFilterTest2", {{"IntraPeriod", "0"}, {"ScreenContentMode", "0"},
+     {"RateControlMode", "0"}, {"QP", "50"}}, default_test_vectors},
+    {"DecFilterTest3", {{"IntraPeriod", "0"}, {"ScreenContentMode", "0"},
+     {"LoopFilterDisable", "1"}}, default_test_vectors},
+    {"DecFilterTest4", {{"IntraPeriod", "0"}, {"ScreenContentMode", "0"},
+     {"TileCol", "1"}, {"TileRow", "1"}}, default_test_vectors},
+};
+/* clang-format on */
+INSTANTIATE_TEST_CASE_P(SvtAv1, DecoderConformanceTest,
+                        ::testing::ValuesIn(dec_conformance_settings),
+                        EncTestSetting::GetSettingName);
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# Copyright(c) 2019 Intel Corporation
+# SPDX - License - Identifier: BSD - 2 - Clause - Patent
+#
+"""Retrain the NSQ pruning model of EbProductCodingLoop.c
+
+1. Build the encoder with NSQ_PRUNING_STATS set to 1 in EbDefinitions.h
+2. Encode a training set with the presets using the NSQ table (-enc-mode 1..2)
+   and -stat-report 1, keeping the standard output:
+       SvtAv1EncApp -i clip.yuv ... -enc-mode 2 -stat-report 1 > clip.log
+3. Run this script on the logs:
+       nsq_pruning_train.py clip0.log clip1.log ...
+   and paste the printed tables over the ones of EbProductCodingLoop.c
+
+Each "NSQ," line of the logs holds the features of one NSQ shape tested in MD,
+then 1 if the shape became the best partition of its square. The script fits a
+logistic regression, then picks the score thresholds keeping the share of
+winning shapes pruned under the --miss targets, one per nsq_pruning_level.
+"""
+
+import argparse
+import math
+import sys
+
+FEATURES = [
+    "rank of the shape in nsq_table",
+    "number of blocks of the shape",
+    "log2 of the square size",
+    "log2 of the source variance (Q4)",
+    "ME SAD of the shape over the ME SAD of the square (Q8)",
+    "parent square has coefficients",
+    "log2 of the best cost per sample of the square over lambda (Q4)",
+]
+# Scale of the fixed point weights: one unit of score is 1 / WEIGHT_SCALE of logit
+WEIGHT_SCALE = 1 << 10
+
+
+def load(paths):
+    rows = []
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                if not line.startswith("NSQ,"):
+                    continue
+                values = [int(v) for v in line.strip().split(",")[1:]]
+                if len(values) != len(FEATURES) + 1:
+                    sys.exit("%s: unexpected NSQ line: %s" % (path, line.strip()))
+                rows.append((values[:-1], values[-1]))
+    return rows
+
+
+def train(rows, epochs, rate):
+    n = len(FEATURES)
+    mean = [sum(r[0][i] for r in rows) / len(rows) for i in range(n)]
+    std = [math.sqrt(sum((r[0][i] - mean[i]) ** 2 for r in rows) / len(rows)) or 1.0 for i in range(n)]
+    data = [([(x[i] - mean[i]) / std[i] for i in range(n)], y) for x, y in rows]
+    wins = sum(y for _, y in data)
+    # Balance the classes so that the rare winning shapes are not ignored
+    class_weight = {1: len(data) / (2.0 * max(wins, 1)), 0: len(data) / (2.0 * max(len(data) - wins, 1))}
+    w = [0.0] * n
+    b = 0.0
+    for _ in range(epochs):
+        grad_w = [0.0] * n
+        grad_b = 0.0
+        for x, y in data:
+            z = b + sum(wi * xi for wi, xi in zip(w, x))
+            p = 1.0 / (1.0 + math.exp(-max(min(z, 30.0), -30.0)))
+            g = (p - y) * class_weight[y]
+            grad_b += g
+            for i in range(n):
+                grad_w[i] += g * x[i]
+        b -= rate * grad_b / len(data)
+        for i in range(n):
+            w[i] -= rate * grad_w[i] / len(data)
+    # Back to the raw features of the encoder
+    raw_w = [w[i] / std[i] for i in range(n)]
+    raw_b = b - sum(raw_w[i] * mean[i] for i in range(n))
+    return raw_b, raw_w
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("logs", nargs="+", help="encoder logs holding NSQ lines")
+    parser.add_argument("--miss", type=float, nargs="+", default=[0.01, 0.04],
+                        help="max share of winning shapes pruned, per nsq_pruning_level")
+    parser.add_argument("--epochs", type=int, default=300)
+    parser.add_argument("--rate", type=float, default=0.5)
+    args = parser.parse_args()
+
+    rows = load(args.logs)
+    if not rows:
+        sys.exit("no NSQ lines found; build with NSQ_PRUNING_STATS 1 and encode with -stat-report 1")
+    wins = sum(y for _, y in rows)
+    print("// %d shapes, %d winners" % (len(rows), wins))
+
+    raw_b, raw_w = train(rows, args.epochs, args.rate)
+    bias = int(round(raw_b * WEIGHT_SCALE))
+    weight = [int(round(v * WEIGHT_SCALE)) for v in raw_w]
+    scores = sorted((bias + sum(wi * xi for wi, xi in zip(weight, x)), y) for x, y in rows)
+    win_scores = sorted(s for s, y in scores if y)
+
+    thresholds = []
+    for miss in args.miss:
+        # Prune the shapes scoring under the score of the first winner kept
+        threshold = win_scores[int(miss * len(win_scores))] if win_scores else 0
+        pruned = sum(1 for s, _ in scores if s < threshold)
+        missed = sum(1 for s in win_scores if s < threshold)
+        print("// threshold %d: %.1f%% of the shapes pruned, %.1f%% of the winners pruned" %
+              (threshold, 100.0 * pruned / len(scores), 100.0 * missed / max(len(win_scores), 1)))
+        thresholds.append(threshold)
+
+    print("static const int32_t nsq_pruning_bias = %d;" % bias)
+    print("static const int32_t nsq_pruning_weight[NSQ_PRUNING_FEATURE_COUNT] = {")
+    for v, name in zip(weight, FEATURES):
+        print("    %d, // %s" % (v, name))
+    print("};")
+    print("// Score under which a shape is skipped, per nsq_pruning_level")
+    print("static const int32_t nsq_pruning_threshold[%d] = { INT32_MIN, %s };" %
+          (len(thresholds) + 1, ", ".join(str(t) for t in thresholds)))
+
+
+if __name__ == "__main__":
+    main()